@@ -26,9 +26,10 @@
 
 #include "arm_compute/core/IArray.h"
 #include "arm_compute/core/NEON/INEKernel.h"
-#include "support/Mutex.h"
+#include "arm_compute/core/utils/misc/PerThreadBuffers.h"
 
 #include <cstdint>
+#include <vector>
 
 namespace arm_compute
 {
@@ -37,6 +38,9 @@ class ITensor;
 using IImage = ITensor;
 
 /** CPP kernel to perform corner candidates
+ *
+ * Each thread collects the candidates of the windows it runs in its own buffer: @ref reset must be called before scheduling the kernel
+ * and @ref merge once all the windows have been run. The candidates are written to the output in raster order.
  */
 class CPPCornerCandidatesKernel : public INEKernel
 {
@@ -65,15 +69,22 @@ public:
      * @param[out] num_corner_candidates Number of corner candidates
      */
     void configure(const IImage *input, InternalKeypoint *output, int32_t *num_corner_candidates);
+    /** Resets the candidates of the threads.
+     *
+     * @param[in] num_threads Number of threads which will run the kernel.
+     */
+    void reset(unsigned int num_threads);
+    /** Writes the candidates of the threads to the output array and updates the number of corner candidates. */
+    void merge();
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
 
 private:
-    int32_t           *_num_corner_candidates;   /**< Number of corner candidates */
-    arm_compute::Mutex _corner_candidates_mutex; /**< Mutex to preventing race conditions */
-    const IImage      *_input;                   /**< Source image - Harris score */
-    InternalKeypoint *_output;                   /**< Array of NEInternalKeypoint */
+    int32_t                                 *_num_corner_candidates; /**< Number of corner candidates */
+    misc::PerThreadBuffers<InternalKeypoint> _local_candidates;      /**< Corner candidates of the threads */
+    const IImage                            *_input;                 /**< Source image - Harris score */
+    InternalKeypoint                        *_output;                /**< Array of NEInternalKeypoint */
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_CPPCORNERCANDIDATESKERNEL_H__ */
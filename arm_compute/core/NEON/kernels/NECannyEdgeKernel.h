@@ -25,6 +25,7 @@
 #define __ARM_COMPUTE_NECANNYEDGEKERNEL_H__
 
 #include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/utils/misc/PerThreadBuffers.h"
 
 #include <cstdint>
 
@@ -203,5 +204,178 @@ private:
     ITensor *_input;  /**< Source tensor */
     ITensor *_output; /**< Destination tensor */
 };
+
+/** NEON kernel computing the magnitude, the quantized phase and the non-maxima suppression of Canny Edge in a single pass.
+ *
+ * @note The magnitude and phase of the rows are only kept in per-thread buffers of a few rows, which replaces the
+ *       sequence @ref NEGradientKernel, @ref NEFillBorderKernel on the magnitude and @ref NEEdgeNonMaxSuppressionKernel.
+ *       The output is identical to the one of that sequence.
+ *
+ * @note Each point of the output is set to EDGE, NO_EDGE or MAYBE. For UNDEFINED border mode, the points outside of the
+ *       valid region are set to NO_EDGE.
+ */
+class NEGradientNonMaxSuppressionKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEGradientNonMaxSuppressionKernel";
+    }
+    /** Default constructor */
+    NEGradientNonMaxSuppressionKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGradientNonMaxSuppressionKernel(const NEGradientNonMaxSuppressionKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGradientNonMaxSuppressionKernel &operator=(const NEGradientNonMaxSuppressionKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEGradientNonMaxSuppressionKernel(NEGradientNonMaxSuppressionKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEGradientNonMaxSuppressionKernel &operator=(NEGradientNonMaxSuppressionKernel &&) = default;
+    /** Default destructor */
+    ~NEGradientNonMaxSuppressionKernel() = default;
+
+    /** Initialise the kernel's sources, destination and border mode.
+     *
+     * @param[in]  gx                    Source tensor - Gx component. Data type supported: S16/S32.
+     * @param[in]  gy                    Source tensor - Gy component. Data type supported: same as @p gx.
+     * @param[out] output                Output tensor. Data type supported: U8. It will be filled with 0 for "no edge", 127 for "maybe", 255 for "edge"
+     * @param[in]  upper_thr             Upper threshold used for the hysteresis
+     * @param[in]  lower_thr             Lower threshold used for the hysteresis
+     * @param[in]  norm_type             Normalization type. If 1, L1-Norm otherwise L2-Norm
+     * @param[in]  border_mode           Border mode used for the magnitude.
+     * @param[in]  constant_border_value Constant value of the magnitude border if border_mode is set to CONSTANT.
+     * @param[in]  use_fp16              If true the FP16 magnitude and phase functions are used (if supported).
+     */
+    void configure(const ITensor *gx, const ITensor *gy, ITensor *output, int32_t upper_thr, int32_t lower_thr, int32_t norm_type,
+                   BorderMode border_mode, uint8_t constant_border_value, bool use_fp16);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Common signature for all the specialised gradient functions
+     *
+     * @param[in]  gx_ptr        Pointer to the first input tensor.
+     * @param[in]  gy_ptr        Pointer to the second input tensor.
+     * @param[out] magnitude_ptr Pointer to the first output tensor
+     * @param[out] phase_ptr     Pointer to the second output tensor
+     */
+    using GradientFunction = void(const void *__restrict gx_ptr, const void *__restrict gy_ptr, void *__restrict magnitude_ptr, void *__restrict phase_ptr);
+    /** Common signature for all the specialised non-maxima suppression functions
+     *
+     * @param[in]  magnitude_ptr Pointer to the first input tensor.
+     * @param[in]  phase_ptr     Pointer to the second input tensor.
+     * @param[out] output_ptr    Pointer to the output tensor
+     * @param[in]  stride_mag    Stride of the magnitude tensor
+     * @param[in]  lower_thr     Lower threshold used for the hysteresis
+     * @param[in]  upper_thr     Upper threshold used for the hysteresis
+     */
+    using EdgeNonMaxSupprFunction = void(const void *__restrict magnitude_ptr, const void *__restrict phase_ptr, void *__restrict output_ptr, const uint32_t stride_mag, const int32_t lower_thr,
+                                         const int32_t upper_thr);
+
+    GradientFunction        *_gradient_func;         /**< Gradient function to use for the particular tensor types passed to configure() */
+    EdgeNonMaxSupprFunction *_non_max_suppr_func;    /**< Non-Maxima suppression function to use for the particular tensor types passed to configure() */
+    const ITensor           *_gx;                    /**< Source tensor - Gx component */
+    const ITensor           *_gy;                    /**< Source tensor - Gy component */
+    ITensor                 *_output;                /**< Destination tensor */
+    int32_t                  _lower_thr;             /**< Lower threshold used for the hysteresis */
+    int32_t                  _upper_thr;             /**< Upper threshold used for the hysteresis */
+    BorderMode               _border_mode;           /**< Border mode used for the magnitude */
+    uint32_t                 _constant_border_value; /**< Constant value of the magnitude border */
+};
+
+/** NEON kernel labelling the connected components of the candidate edges of Canny Edge.
+ *
+ * The points set to EDGE or MAYBE are grouped in 8-connected components with a union-find forest stored in @p labels:
+ * every thread labels the rows of its windows on its own, then @ref merge joins the components across the first row of each window.
+ * Each root records whether its component contains an EDGE point. @ref reset must be called before scheduling the kernel.
+ *
+ * @note Hysteresis is completed by @ref NEEdgeHysteresisKernel
+ */
+class NEEdgeLabelKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEEdgeLabelKernel";
+    }
+    /** Default constructor */
+    NEEdgeLabelKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEEdgeLabelKernel(const NEEdgeLabelKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEEdgeLabelKernel &operator=(const NEEdgeLabelKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEEdgeLabelKernel(NEEdgeLabelKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEEdgeLabelKernel &operator=(NEEdgeLabelKernel &&) = default;
+    /** Default destructor */
+    ~NEEdgeLabelKernel() = default;
+
+    /** Initialise the kernel's source and destination.
+     *
+     * @param[in]  input  Source tensor. Data type supported: U8. Must contain 0 for "no edge", 127 for "maybe", 255 for "edge"
+     * @param[out] labels Union-find forest of the candidate edges. Data type supported: S32. Only the points of @p input which are not "no edge" are written.
+     */
+    void configure(const ITensor *input, ITensor *labels);
+    /** Resets the windows run by the threads.
+     *
+     * @param[in] num_threads Number of threads which will run the kernel.
+     */
+    void reset(unsigned int num_threads);
+    /** Joins the components of the rows on both sides of the first row of each window. */
+    void merge();
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor               *_input;       /**< Source tensor */
+    ITensor                     *_labels;      /**< Union-find forest */
+    misc::PerThreadBuffers<int> _window_rows; /**< First row of the windows run by each thread */
+};
+
+/** NEON kernel writing the result of the hysteresis of Canny Edge.
+ *
+ * A point is set to EDGE if it was labelled by @ref NEEdgeLabelKernel and its component contains an EDGE point, NO_EDGE otherwise.
+ * This is the result of tracing the edges from the EDGE points through the MAYBE points, as done by @ref NEEdgeTraceKernel,
+ * but all the points of the output are written and the rows are independent.
+ */
+class NEEdgeHysteresisKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEEdgeHysteresisKernel";
+    }
+    /** Default constructor */
+    NEEdgeHysteresisKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEEdgeHysteresisKernel(const NEEdgeHysteresisKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEEdgeHysteresisKernel &operator=(const NEEdgeHysteresisKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEEdgeHysteresisKernel(NEEdgeHysteresisKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEEdgeHysteresisKernel &operator=(NEEdgeHysteresisKernel &&) = default;
+    /** Default destructor */
+    ~NEEdgeHysteresisKernel() = default;
+
+    /** Initialise the kernel's sources and destination.
+     *
+     * @param[in]  input  Source tensor. Data type supported: U8. Must contain 0 for "no edge", 127 for "maybe", 255 for "edge"
+     * @param[in]  labels Union-find forest computed by @ref NEEdgeLabelKernel. Data type supported: S32.
+     * @param[out] output Destination tensor. Data type supported: U8.
+     */
+    void configure(const ITensor *input, const ITensor *labels, ITensor *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input;  /**< Source tensor */
+    const ITensor *_labels; /**< Union-find forest */
+    ITensor       *_output; /**< Destination tensor */
+};
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_NECANNYEDGEKERNEL_H */
@@ -76,18 +76,20 @@ public:
      * @param[out] output         The output tensor. 3 lower dimensions represent a single output [width, height, OFM],
      *                            while the rest represent batch of outputs. Data types supported: Same as @p input
      * @param[in]  convolved_dims Output convolved dimensions.
+     * @param[in]  num_groups     (Optional) Number of groups when performing a grouped convolution. When grouping @p input is [OFM / num_groups, M, batches, num_groups]
      */
-    void configure(const ITensor *input, ITensor *output, const Size2D &convolved_dims);
+    void configure(const ITensor *input, ITensor *output, const Size2D &convolved_dims, unsigned int num_groups = 1);
     /** Static function to check if given info will lead to a valid configuration of @ref NECol2ImKernel
      *
      * @param[in] input          The input tensor to convert. Data types supported: U8/S8/QASYMM8/U16/S16/F16/U32/S32/F32
      * @param[in] output         The output tensor. 3 lower dimensions represent a single output [width, height, OFM],
      *                           while the rest represent batch of outputs. Data types supported: Same as @p input
      * @param[in] convolved_dims Output convolved dimensions.
+     * @param[in] num_groups     (Optional) Number of groups when performing a grouped convolution. When grouping @p input is [OFM / num_groups, M, batches, num_groups]
      *
      * @return a status
      */
-    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const Size2D &convolved_dims);
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const Size2D &convolved_dims, unsigned int num_groups = 1);
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
@@ -110,6 +112,7 @@ private:
     const ITensor    *_input;
     ITensor          *_output;
     Size2D            _convolved_dims;
+    unsigned int      _num_groups;
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NECOL2IMKERNEL_H__ */
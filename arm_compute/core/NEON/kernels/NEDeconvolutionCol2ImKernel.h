@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEDECONVOLUTIONCOL2IMKERNEL_H__
+#define __ARM_COMPUTE_NEDECONVOLUTIONCOL2IMKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+#include "arm_compute/core/Size2D.h"
+#include "arm_compute/core/Types.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to accumulate the per-pixel contributions computed by a deconvolution GEMM into the output image.
+ *
+ * The input matrix has dimensions [kernel_x * kernel_y * OFM, width * height, 1, batches] as computed by multiplying the deconvolution input by
+ * the weights reshaped with @ref NEDeconvolutionWeightsReshapeKernel. Each output value is the sum of the (at most ceil(kernel_x / stride_x) * ceil(kernel_y / stride_y))
+ * contributions of the input pixels whose kernel footprint covers it, plus the bias:
+ *
+ * @f[ out(ox, oy, ofm) = bias(ofm) + \sum in(kx + kernel\_x \cdot ky + kernel\_x \cdot kernel\_y \cdot ofm, ix + width \cdot iy) @f]
+ *
+ * where kx = pad_x + ix * stride_x - ox and ky = inner_border_top + pad_y + iy * stride_y - oy.
+ *
+ * As each output value is gathered rather than scattered, the kernel doesn't need the output to be zero initialised and can be split in any dimension.
+ */
+class NEDeconvolutionCol2ImKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEDeconvolutionCol2ImKernel";
+    }
+    /** Default constructor */
+    NEDeconvolutionCol2ImKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDeconvolutionCol2ImKernel(const NEDeconvolutionCol2ImKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDeconvolutionCol2ImKernel &operator=(const NEDeconvolutionCol2ImKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEDeconvolutionCol2ImKernel(NEDeconvolutionCol2ImKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEDeconvolutionCol2ImKernel &operator=(NEDeconvolutionCol2ImKernel &&) = default;
+    /** Default destructor */
+    ~NEDeconvolutionCol2ImKernel() = default;
+    /** Set the input, bias and output of the kernel.
+     *
+     * @param[in]  input              The GEMM output with dimensions [kernel_x * kernel_y * OFM, width * height, 1, batches]. Data types supported: F32
+     * @param[in]  bias               (Optional) The biases have one dimension [OFM]. Pass nullptr if not needed. Data type supported: Same as @p input
+     * @param[out] output             Output tensor [width_output, height_output, OFM, batches]. Data type supported: Same as @p input
+     * @param[in]  input_dims         Width and height of the deconvolution input.
+     * @param[in]  kernel_dims        Width and height of the deconvolution kernel.
+     * @param[in]  info               Contains padding and strides of the deconvolution, as described in @ref PadStrideInfo.
+     * @param[in]  inner_border_right The number of zeros added to right edge of the input.
+     * @param[in]  inner_border_top   The number of zeros added to top edge of the input.
+     */
+    void configure(const ITensor *input, const ITensor *bias, ITensor *output, const Size2D &input_dims, const Size2D &kernel_dims, const PadStrideInfo &info,
+                   unsigned int inner_border_right, unsigned int inner_border_top);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEDeconvolutionCol2ImKernel
+     *
+     * @param[in] input              The GEMM output info with dimensions [kernel_x * kernel_y * OFM, width * height, 1, batches]. Data types supported: F32
+     * @param[in] bias               (Optional) The biases info with one dimension [OFM]. Data type supported: Same as @p input
+     * @param[in] output             Output tensor info [width_output, height_output, OFM, batches]. Data type supported: Same as @p input
+     * @param[in] input_dims         Width and height of the deconvolution input.
+     * @param[in] kernel_dims        Width and height of the deconvolution kernel.
+     * @param[in] info               Contains padding and strides of the deconvolution, as described in @ref PadStrideInfo.
+     * @param[in] inner_border_right The number of zeros added to right edge of the input.
+     * @param[in] inner_border_top   The number of zeros added to top edge of the input.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *bias, const ITensorInfo *output, const Size2D &input_dims, const Size2D &kernel_dims, const PadStrideInfo &info,
+                           unsigned int inner_border_right, unsigned int inner_border_top);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Compute, for every output coordinate along one axis, the first kernel tap and input coordinate contributing to it
+     *
+     * @param[in]  output_size  Size of the output along the axis.
+     * @param[in]  kernel_size  Size of the kernel along the axis.
+     * @param[in]  stride       Deconvolution stride along the axis.
+     * @param[in]  offset       Position of the first input element in the upsampled image along the axis.
+     * @param[out] kernel_start First kernel tap for each output coordinate.
+     * @param[out] input_start  Input coordinate matching @p kernel_start for each output coordinate.
+     */
+    static void compute_start_tables(int output_size, int kernel_size, int stride, int offset, std::vector<int> &kernel_start, std::vector<int> &input_start);
+
+    const ITensor   *_input;
+    const ITensor   *_bias;
+    ITensor         *_output;
+    Size2D           _input_dims;
+    Size2D           _kernel_dims;
+    PadStrideInfo    _info;
+    std::vector<int> _x_kernel_start;
+    std::vector<int> _x_input_start;
+    std::vector<int> _y_kernel_start;
+    std::vector<int> _y_input_start;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEDECONVOLUTIONCOL2IMKERNEL_H__ */
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEDECONVOLUTIONWEIGHTSRESHAPEKERNEL_H__
+#define __ARM_COMPUTE_NEDECONVOLUTIONWEIGHTSRESHAPEKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to reshape the weights of a deconvolution so that they can be used as the right hand side matrix of a GEMM.
+ *
+ * The 4D weights [kernel_x, kernel_y, IFM, OFM] are rearranged in a 2D matrix [kernel_x * kernel_y * OFM, IFM], where each row
+ * holds all the weights that a single input channel contributes with:
+ *
+ * @f[ out(kx + kernel\_x \cdot ky + kernel\_x \cdot kernel\_y \cdot ofm, ifm) = in(kx, ky, ifm, ofm) @f]
+ *
+ * Multiplying an image laid out as [IFM, width * height] by this matrix gives, for every input pixel, the kernel_x * kernel_y * OFM
+ * output values it contributes to. @ref NEDeconvolutionCol2ImKernel then accumulates them in the output image.
+ */
+class NEDeconvolutionWeightsReshapeKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEDeconvolutionWeightsReshapeKernel";
+    }
+    /** Default constructor */
+    NEDeconvolutionWeightsReshapeKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDeconvolutionWeightsReshapeKernel(const NEDeconvolutionWeightsReshapeKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDeconvolutionWeightsReshapeKernel &operator=(const NEDeconvolutionWeightsReshapeKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEDeconvolutionWeightsReshapeKernel(NEDeconvolutionWeightsReshapeKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEDeconvolutionWeightsReshapeKernel &operator=(NEDeconvolutionWeightsReshapeKernel &&) = default;
+    /** Default destructor */
+    ~NEDeconvolutionWeightsReshapeKernel() = default;
+    /** Set the input and output of the kernel.
+     *
+     * @param[in]  input  The 4D weights with dimensions [kernel_x, kernel_y, IFM, OFM]. Data types supported: F32
+     * @param[out] output The 2D output matrix with dimensions [kernel_x * kernel_y * OFM, IFM]. Data types supported: Same as @p input
+     */
+    void configure(const ITensor *input, ITensor *output);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEDeconvolutionWeightsReshapeKernel
+     *
+     * @param[in] input  The 4D weights info with dimensions [kernel_x, kernel_y, IFM, OFM]. Data types supported: F32
+     * @param[in] output The 2D output matrix info with dimensions [kernel_x * kernel_y * OFM, IFM]. Data types supported: Same as @p input
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input;
+    ITensor       *_output;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEDECONVOLUTIONWEIGHTSRESHAPEKERNEL_H__ */
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEDEPTHWISESEPARABLECONVOLUTIONLAYERKERNEL_H__
+#define __ARM_COMPUTE_NEDEPTHWISESEPARABLECONVOLUTIONLAYERKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the kernel to run a depthwise convolution followed by a pointwise convolution on a NHWC tensor in a single pass.
+ *
+ * The depthwise result of a tile of output pixels is written to a small buffer owned by the calling thread that stays in cache and is immediately
+ * multiplied by the pointwise weights, so the intermediate tensor is never stored to memory.
+ * An optional bounded rectifier can be applied after each of the two convolutions.
+ *
+ * @note Batch normalization layers following the convolutions are expected to be folded into the respective weights and biases.
+ */
+class NEDepthwiseSeparableConvolutionLayerKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEDepthwiseSeparableConvolutionLayerKernel";
+    }
+    /** Default constructor */
+    NEDepthwiseSeparableConvolutionLayerKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDepthwiseSeparableConvolutionLayerKernel(const NEDepthwiseSeparableConvolutionLayerKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDepthwiseSeparableConvolutionLayerKernel &operator=(const NEDepthwiseSeparableConvolutionLayerKernel &) = delete;
+    /** Default Move Constructor. */
+    NEDepthwiseSeparableConvolutionLayerKernel(NEDepthwiseSeparableConvolutionLayerKernel &&) = default;
+    /** Default move assignment operator */
+    NEDepthwiseSeparableConvolutionLayerKernel &operator=(NEDepthwiseSeparableConvolutionLayerKernel &&) = default;
+    /** Initialize the kernel's inputs, output and convolution information.
+     *
+     * @note Supported data layouts: NHWC
+     *
+     * @param[in]  input               Source tensor. Data type supported: F32.
+     * @param[in]  depthwise_weights   Depthwise convolution weights tensor with dimensions [IFM, kernel_x, kernel_y]. Data type supported: Same as @p input.
+     * @param[in]  depthwise_biases    (Optional) Depthwise biases tensor with dimensions [IFM]. Must be nullptr if not needed. Data type supported: Same as @p input.
+     * @param[in]  pointwise_weights   Pointwise convolution weights tensor with dimensions [IFM, 1, 1, OFM]. Data type supported: Same as @p input.
+     * @param[in]  pointwise_biases    (Optional) Pointwise biases tensor with dimensions [OFM]. Must be nullptr if not needed. Data type supported: Same as @p input.
+     * @param[out] output              Destination tensor with dimensions [OFM, width, height, batches]. Data type supported: Same as @p input.
+     * @param[in]  depthwise_conv_info Padding and stride information to use for the depthwise convolution.
+     * @param[in]  depthwise_act_info  (Optional) Activation applied to the depthwise result. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU are supported.
+     * @param[in]  pointwise_act_info  (Optional) Activation applied to the pointwise result. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU are supported.
+     */
+    void configure(const ITensor *input, const ITensor *depthwise_weights, const ITensor *depthwise_biases, const ITensor *pointwise_weights, const ITensor *pointwise_biases,
+                   ITensor *output, const PadStrideInfo &depthwise_conv_info,
+                   const ActivationLayerInfo &depthwise_act_info = ActivationLayerInfo(), const ActivationLayerInfo &pointwise_act_info = ActivationLayerInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref NEDepthwiseSeparableConvolutionLayerKernel
+     *
+     * @note Supported data layouts: NHWC
+     *
+     * @param[in] input               Source tensor info. Data type supported: F32.
+     * @param[in] depthwise_weights   Depthwise convolution weights tensor info with dimensions [IFM, kernel_x, kernel_y]. Data type supported: Same as @p input.
+     * @param[in] depthwise_biases    (Optional) Depthwise biases tensor info with dimensions [IFM]. Must be nullptr if not needed. Data type supported: Same as @p input.
+     * @param[in] pointwise_weights   Pointwise convolution weights tensor info with dimensions [IFM, 1, 1, OFM]. Data type supported: Same as @p input.
+     * @param[in] pointwise_biases    (Optional) Pointwise biases tensor info with dimensions [OFM]. Must be nullptr if not needed. Data type supported: Same as @p input.
+     * @param[in] output              Destination tensor info with dimensions [OFM, width, height, batches]. Data type supported: Same as @p input.
+     * @param[in] depthwise_conv_info Padding and stride information to use for the depthwise convolution.
+     * @param[in] depthwise_act_info  (Optional) Activation applied to the depthwise result. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU are supported.
+     * @param[in] pointwise_act_info  (Optional) Activation applied to the pointwise result. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU are supported.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *depthwise_weights, const ITensorInfo *depthwise_biases, const ITensorInfo *pointwise_weights,
+                           const ITensorInfo *pointwise_biases, const ITensorInfo *output, const PadStrideInfo &depthwise_conv_info,
+                           const ActivationLayerInfo &depthwise_act_info = ActivationLayerInfo(), const ActivationLayerInfo &pointwise_act_info = ActivationLayerInfo());
+    /** Number of output pixels along the width computed by each iteration of the kernel
+     *
+     * @return the tile size
+     */
+    static unsigned int num_pixels_per_tile();
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input;
+    const ITensor *_depthwise_weights;
+    const ITensor *_depthwise_biases;
+    const ITensor *_pointwise_weights;
+    const ITensor *_pointwise_biases;
+    ITensor       *_output;
+    PadStrideInfo  _depthwise_conv_info;
+    float          _depthwise_min;
+    float          _depthwise_max;
+    float          _pointwise_min;
+    float          _pointwise_max;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NEDEPTHWISESEPARABLECONVOLUTIONLAYERKERNEL_H__ */
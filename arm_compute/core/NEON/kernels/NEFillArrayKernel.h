@@ -27,6 +27,7 @@
 #include "arm_compute/core/IArray.h"
 #include "arm_compute/core/NEON/INEKernel.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/misc/PerThreadBuffers.h"
 
 #include <cstdint>
 
@@ -35,7 +36,11 @@ namespace arm_compute
 class ITensor;
 using IImage = ITensor;
 
-/** This kernel adds all texels greater than or equal to the threshold value to the keypoint array. */
+/** This kernel adds all texels greater than or equal to the threshold value to the keypoint array.
+ *
+ * Each thread collects the keypoints of the windows it runs in its own buffer: @ref reset must be called before scheduling the kernel
+ * and @ref merge once all the windows have been run. The keypoints are added to the array in raster order.
+ */
 class NEFillArrayKernel : public INEKernel
 {
 public:
@@ -63,15 +68,22 @@ public:
      * @param[out] output    Arrays of keypoints to store the results.
      */
     void configure(const IImage *input, uint8_t threshold, IKeyPointArray *output);
+    /** Resets the keypoints of the threads.
+     *
+     * @param[in] num_threads Number of threads which will run the kernel.
+     */
+    void reset(unsigned int num_threads);
+    /** Adds the keypoints of the threads to the output array, until it is full. */
+    void merge();
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
-    bool is_parallelisable() const override;
 
 private:
-    const IImage   *_input;
-    IKeyPointArray *_output;
-    uint8_t         _threshold;
+    const IImage                    *_input;
+    IKeyPointArray                  *_output;
+    uint8_t                          _threshold;
+    misc::PerThreadBuffers<KeyPoint> _local_keypoints;
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_NEFILLARRAYKERNEL_H__*/
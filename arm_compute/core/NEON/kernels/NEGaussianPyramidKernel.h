@@ -24,7 +24,14 @@
 #ifndef __ARM_COMPUTE_NEGAUSSIANPYRAMIDKERNEL_H__
 #define __ARM_COMPUTE_NEGAUSSIANPYRAMIDKERNEL_H__
 
+#include "arm_compute/core/IPyramid.h"
+#include "arm_compute/core/NEON/INEKernel.h"
 #include "arm_compute/core/NEON/INESimpleKernel.h"
+#include "arm_compute/core/Types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 
 namespace arm_compute
 {
@@ -101,5 +108,63 @@ public:
 private:
     int _t2_load_offset;
 };
+
+/** NEON kernel to compute one or more levels of a GaussianPyramid with HALF scale factor in a single pass
+ *
+ * Each level is computed from the previous one with the separable 5x5 Gaussian filter and a decimation by 2 in both directions.
+ * The horizontally filtered rows are kept in a line buffer of 5 rows, so each input row is filtered only once and
+ * neither an intermediate tensor nor a border fill is needed.
+ *
+ * The window is split along the rows of the last level computed by the pass. When several levels are computed,
+ * each window also computes the rows of the intermediate levels it depends on but only writes the rows it owns.
+ */
+class NEGaussianPyramidHalfKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEGaussianPyramidHalfKernel";
+    }
+    /** Default constructor */
+    NEGaussianPyramidHalfKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGaussianPyramidHalfKernel(const NEGaussianPyramidHalfKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGaussianPyramidHalfKernel &operator=(const NEGaussianPyramidHalfKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEGaussianPyramidHalfKernel(NEGaussianPyramidHalfKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEGaussianPyramidHalfKernel &operator=(NEGaussianPyramidHalfKernel &&) = default;
+    /** Default destructor */
+    ~NEGaussianPyramidHalfKernel() = default;
+
+    /** Initialise the kernel's pyramid, levels and border mode.
+     *
+     * @param[in,out] pyramid               Pyramid to compute the levels of. Data type supported at each level: U8.
+     * @param[in]     first_level           Level of @p pyramid read by the pass.
+     * @param[in]     num_levels            Number of levels computed by the pass, starting from @p first_level + 1.
+     * @param[in]     border_mode           Border mode to use.
+     * @param[in]     constant_border_value Constant value to use for borders if border_mode is set to CONSTANT.
+     */
+    void configure(IPyramid *pyramid, size_t first_level, size_t num_levels, BorderMode border_mode, uint8_t constant_border_value);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Level read or written by the pass */
+    struct Level
+    {
+        ITensor *tensor;   /**< Tensor of the level */
+        int      width;    /**< Width of the level */
+        int      height;   /**< Height of the level */
+        int      offset_x; /**< Column of the previous level sampled for the first column of this level */
+        int      offset_y; /**< Row of the previous level sampled for the first row of this level */
+    };
+
+    std::vector<Level> _levels;                /**< Input level followed by the levels computed by the pass */
+    BorderMode         _border_mode;           /**< Border mode */
+    uint8_t            _constant_border_value; /**< Constant value used for borders if the border mode is CONSTANT */
+};
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEGAUSSIANPYRAMIDKERNEL_H__ */
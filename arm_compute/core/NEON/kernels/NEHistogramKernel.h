@@ -25,10 +25,11 @@
 #define __ARM_COMPUTE_NEHISTOGRAMKERNEL_H__
 
 #include "arm_compute/core/NEON/INEKernel.h"
-#include "support/Mutex.h"
+#include "arm_compute/core/utils/misc/PerThreadAccumulator.h"
 
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 namespace arm_compute
 {
@@ -36,7 +37,11 @@ class IDistribution1D;
 class ITensor;
 using IImage = ITensor;
 
-/** Interface for the histogram kernel */
+/** Interface for the histogram kernel
+ *
+ * Each thread accumulates the windows it processes into its own histogram, the partial histograms are added up by @ref merge.
+ * The function running the kernel must call @ref reset with the number of threads of the scheduler before scheduling it.
+ */
 class NEHistogramKernel : public INEKernel
 {
 public:
@@ -59,18 +64,14 @@ public:
 
     /** Set the input image and the distribution output.
      *
-     * @param[in]     input      Source image. Data type supported: U8.
-     * @param[out]    output     Destination distribution.
-     * @param[in,out] local_hist Array that the threads use to save their local histograms.
-     *                           It's size should be equal to (number_of_threads * num_bins),
-     *                           and the Window::thread_id() is used to determine the part of the array
-     *                           used by each thread.
-     * @param[out]    window_lut LUT with pre-calculated possible window values.
-     *                           The size of the LUT should be equal to max_range_size and it will be filled
-     *                           during the configure stage, while it re-used in every run, therefore can be
-     *                           safely shared among threads.
+     * @param[in]  input      Source image. Data type supported: U8.
+     * @param[out] output     Destination distribution.
+     * @param[out] window_lut LUT with pre-calculated possible window values.
+     *                        The size of the LUT should be equal to max_range_size and it will be filled
+     *                        during the configure stage, while it re-used in every run, therefore can be
+     *                        safely shared among threads.
      */
-    void configure(const IImage *input, IDistribution1D *output, uint32_t *local_hist, uint32_t *window_lut);
+    void configure(const IImage *input, IDistribution1D *output, uint32_t *window_lut);
     /** Set the input image and the distribution output.
      *
      * @note Used for histogram of fixed size equal to 256
@@ -79,24 +80,18 @@ public:
      * @param[out] output Destination distribution which must be of 256 bins..
      */
     void configure(const IImage *input, IDistribution1D *output);
+    /** Clear the partial histograms
+     *
+     * @param[in] num_threads Number of threads of the scheduler which will run the kernel.
+     */
+    void reset(unsigned int num_threads);
+    /** Add up the partial histograms of the threads into the output distribution. */
+    void merge();
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
 
 private:
-    /** Function to merge multiple partial histograms.
-     *
-     * @param[out] global_hist Pointer to the final histogram.
-     * @param[in]  local_hist  Pointer to the partial histograms.
-     * @param[in]  bins        Number of bins.
-     */
-    void merge_histogram(uint32_t *global_hist, const uint32_t *local_hist, size_t bins);
-    /** Function to merge multiple minimum values of partial histograms.
-     *
-     * @param[out] global_min Pointer to the global min value.
-     * @param[in]  local_min  Local min value.
-     */
-    void merge_min(uint8_t *global_min, const uint8_t &local_min);
     /** Function to perform histogram on the given window
      *
      * @param[in] win  Region on which to execute the kernel
@@ -123,13 +118,12 @@ private:
      */
     using HistogramFunctionPtr = void (NEHistogramKernel::*)(Window window, const ThreadInfo &info);
 
-    HistogramFunctionPtr          _func; ///< Histogram function to use for the particular image types passed to configure()
-    const IImage                 *_input;
-    IDistribution1D              *_output;
-    uint32_t                     *_local_hist;
-    uint32_t                     *_window_lut;
-    arm_compute::Mutex            _hist_mtx;
-    static constexpr unsigned int _max_range_size{ 256 }; ///< 256 possible pixel values as we handle only U8 images
+    HistogramFunctionPtr                              _func; ///< Histogram function to use for the particular image types passed to configure()
+    const IImage                                     *_input;
+    IDistribution1D                                  *_output;
+    misc::PerThreadAccumulator<std::vector<uint32_t>> _local_hist; ///< Partial histograms of the threads
+    uint32_t                                         *_window_lut;
+    static constexpr unsigned int                     _max_range_size{ 256 }; ///< 256 possible pixel values as we handle only U8 images
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEHISTOGRAMKERNEL_H__ */
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEIMAGETOTENSORKERNEL_H__
+#define __ARM_COMPUTE_NEIMAGETOTENSORKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+class IMultiImage;
+class ITensor;
+using IImage = ITensor;
+
+/** Interface for the kernel that converts an image to the input tensor of a network.
+ *
+ * In a single pass over the output rows the kernel:
+ *
+ * -# Samples the image at the resized position (nearest neighbour or bilinear, centre aligned)
+ * -# Converts the sample to RGB (BT.709) if the image is in a YUV format
+ * -# Normalises each channel as (value - mean) * scale
+ * -# Writes the channels in RGB or BGR order to a F32 tensor or quantizes them to a QASYMM8 tensor, in NCHW or NHWC layout
+ */
+class NEImageToTensorKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEImageToTensorKernel";
+    }
+    /** Default constructor */
+    NEImageToTensorKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEImageToTensorKernel(const NEImageToTensorKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEImageToTensorKernel &operator=(const NEImageToTensorKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEImageToTensorKernel(NEImageToTensorKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEImageToTensorKernel &operator=(NEImageToTensorKernel &&) = default;
+    /** Default destructor */
+    ~NEImageToTensorKernel() = default;
+    /** Set the input and output of the kernel
+     *
+     * @param[in]  input  Single-planar source image. Formats supported: RGB888/YUYV422/UYVY422
+     * @param[out] output Destination tensor with shape [width, height, 3] (NCHW) or [3, width, height] (NHWC). Data types supported: QASYMM8/F32
+     * @param[in]  info   Normalisation, channel order and interpolation policy.
+     */
+    void configure(const IImage *input, ITensor *output, const ImageToTensorInfo &info);
+    /** Set the input and output of the kernel
+     *
+     * @param[in]  input  Multi-planar source image. Formats supported: NV12/NV21
+     * @param[out] output Destination tensor with shape [width, height, 3] (NCHW) or [3, width, height] (NHWC). Data types supported: QASYMM8/F32
+     * @param[in]  info   Normalisation, channel order and interpolation policy.
+     */
+    void configure(const IMultiImage *input, ITensor *output, const ImageToTensorInfo &info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEImageToTensorKernel
+     *
+     * @param[in] input  Single-planar source image info. Formats supported: RGB888/YUYV422/UYVY422
+     * @param[in] output Destination tensor info with shape [width, height, 3] (NCHW) or [3, width, height] (NHWC). Data types supported: QASYMM8/F32
+     * @param[in] info   Normalisation, channel order and interpolation policy.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const ImageToTensorInfo &info);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Common part of the configure methods
+     *
+     * @param[in] width  Width of the source image.
+     * @param[in] height Height of the source image.
+     */
+    void configure_common(unsigned int width, unsigned int height);
+    /** Sample and colour convert a row of the output
+     *
+     * @param[in]  y   Output row.
+     * @param[out] rgb Red, green and blue planes of the row, each of them padded to a multiple of 8 elements.
+     */
+    template <Format format, bool is_bilinear>
+    void sample_row(int y, float *rgb) const;
+    /** Normalise a row of red, green and blue values and write it to the output
+     *
+     * @param[in] y   Output row.
+     * @param[in] rgb Red, green and blue planes of the row, each of them padded to a multiple of 8 elements.
+     */
+    template <typename T>
+    void store_row(int y, const float *rgb) const;
+
+    /** Signature of the row sampling functions */
+    using SampleRowFunctionPtr = void (NEImageToTensorKernel::*)(int y, float *rgb) const;
+    /** Signature of the row storing functions */
+    using StoreRowFunctionPtr = void (NEImageToTensorKernel::*)(int y, const float *rgb) const;
+
+    SampleRowFunctionPtr _sample_row;
+    StoreRowFunctionPtr  _store_row;
+    const IImage        *_input;
+    const IImage        *_chroma;
+    ITensor             *_output;
+    Format               _format;
+    ImageToTensorInfo    _info;
+    bool                 _is_identity;
+    std::vector<int>     _x0;
+    std::vector<int>     _x1;
+    std::vector<float>   _wx;
+    std::vector<int>     _y0;
+    std::vector<int>     _y1;
+    std::vector<float>   _wy;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEIMAGETOTENSORKERNEL_H__ */
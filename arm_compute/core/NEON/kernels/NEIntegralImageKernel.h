@@ -24,13 +24,17 @@
 #ifndef __ARM_COMPUTE_NEINTEGRALIMAGEKERNEL_H__
 #define __ARM_COMPUTE_NEINTEGRALIMAGEKERNEL_H__
 
+#include "arm_compute/core/NEON/INEKernel.h"
 #include "arm_compute/core/NEON/INESimpleKernel.h"
 
 namespace arm_compute
 {
 class ITensor;
 
-/** Kernel to perform an image integral on an image */
+/** Kernel to perform an image integral on an image
+ *
+ * @note This kernel processes the image serially, @ref NEIntegralImageHorKernel and @ref NEIntegralImageVertKernel compute the same result in parallel.
+ */
 class NEIntegralImageKernel : public INESimpleKernel
 {
 public:
@@ -50,5 +54,83 @@ public:
     BorderSize border_size() const override;
     bool       is_parallelisable() const override;
 };
+
+/** Kernel to compute the horizontal prefix sums of the rows of an image, the first pass of a parallel image integral.
+ *
+ * The rows are independent and can be split between threads.
+ */
+class NEIntegralImageHorKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEIntegralImageHorKernel";
+    }
+    /** Default constructor */
+    NEIntegralImageHorKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEIntegralImageHorKernel(const NEIntegralImageHorKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEIntegralImageHorKernel &operator=(const NEIntegralImageHorKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEIntegralImageHorKernel(NEIntegralImageHorKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEIntegralImageHorKernel &operator=(NEIntegralImageHorKernel &&) = default;
+    /** Default destructor */
+    ~NEIntegralImageHorKernel() = default;
+    /** Set the source and destinations of the kernel
+     *
+     * @param[in]  input          Source tensor. Data type supported: U8
+     * @param[out] output         Destination tensor. Data type supported: U32
+     * @param[out] output_squared (Optional) Destination tensor of the prefix sums of the squared pixels. Data type supported: U64
+     */
+    void configure(const ITensor *input, ITensor *output, ITensor *output_squared = nullptr);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input;
+    ITensor       *_output;
+    ITensor       *_output_squared;
+};
+
+/** Kernel to accumulate the rows of an image from top to bottom, the second pass of a parallel image integral.
+ *
+ * The columns are independent and can be split between threads.
+ */
+class NEIntegralImageVertKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEIntegralImageVertKernel";
+    }
+    /** Default constructor */
+    NEIntegralImageVertKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEIntegralImageVertKernel(const NEIntegralImageVertKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEIntegralImageVertKernel &operator=(const NEIntegralImageVertKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEIntegralImageVertKernel(NEIntegralImageVertKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEIntegralImageVertKernel &operator=(NEIntegralImageVertKernel &&) = default;
+    /** Default destructor */
+    ~NEIntegralImageVertKernel() = default;
+    /** Set the tensors of the kernel
+     *
+     * @param[in,out] in_out         Prefix sums of the rows computed by @ref NEIntegralImageHorKernel. Data type supported: U32
+     * @param[in,out] in_out_squared (Optional) Prefix sums of the squared pixels of the rows. Data type supported: U64
+     */
+    void configure(ITensor *in_out, ITensor *in_out_squared = nullptr);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    ITensor *_in_out;
+    ITensor *_in_out_squared;
+};
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEINTEGRALIMAGEKERNEL_H__ */
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NELSTMCELLKERNEL_H__
+#define __ARM_COMPUTE_NELSTMCELLKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the kernel that computes the element-wise part of a Long Short-Term Memory (LSTM) time step.
+ *
+ * Given the pre-activations of the gates, split into the input contribution (@p input_gates) and the recurrent contribution (@p recurrent_gates),
+ * the kernel computes in a single pass:
+ *
+ * -# forget_gate = Logistic(forget_gate_in + forget_gate_bias + cell_state * cell_to_forget_weights)
+ * -# input_gate  = 1 - forget_gate with CIFG or Logistic(input_gate_in + input_gate_bias + cell_state * cell_to_input_weights) otherwise
+ * -# cell_state  = Clip(input_gate * Activation(cell_gate_in + cell_bias) + forget_gate * cell_state, cell_threshold)
+ * -# output_gate = Logistic(output_gate_in + output_gate_bias + cell_state * cell_to_output_weights)
+ * -# cell_output = output_gate * Activation(cell_state)
+ *
+ * The gates are stored along the X axis of @p input_gates and @p recurrent_gates in the order [input (without CIFG), forget, cell, output].
+ * The peephole terms are only added if the peephole weights are provided.
+ */
+class NELSTMCellKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NELSTMCellKernel";
+    }
+    /** Default constructor */
+    NELSTMCellKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELSTMCellKernel(const NELSTMCellKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELSTMCellKernel &operator=(const NELSTMCellKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NELSTMCellKernel(NELSTMCellKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NELSTMCellKernel &operator=(NELSTMCellKernel &&) = default;
+    /** Default destructor */
+    ~NELSTMCellKernel() = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]      input_gates            Input contribution of the gates with dimensions [num_gates * num_units, batch_size, num_timesteps]. Data types supported: F16/F32.
+     * @param[in]      recurrent_gates        Recurrent contribution of the gates with dimensions [num_gates * num_units, batch_size]. Data type supported: Same as @p input_gates.
+     * @param[in]      input_gate_bias        1D tensor with dimensions [num_units]. Must be nullptr with CIFG. Data type supported: Same as @p input_gates.
+     * @param[in]      forget_gate_bias       1D tensor with dimensions [num_units]. Data type supported: Same as @p input_gates.
+     * @param[in]      cell_bias              1D tensor with dimensions [num_units]. Data type supported: Same as @p input_gates.
+     * @param[in]      output_gate_bias       1D tensor with dimensions [num_units]. Data type supported: Same as @p input_gates.
+     * @param[in]      cell_to_input_weights  (Optional) 1D tensor with dimensions [num_units]. Must be nullptr with CIFG. Data type supported: Same as @p input_gates.
+     * @param[in]      cell_to_forget_weights (Optional) 1D tensor with dimensions [num_units]. Data type supported: Same as @p input_gates.
+     * @param[in]      cell_to_output_weights (Optional) 1D tensor with dimensions [num_units]. Data type supported: Same as @p input_gates.
+     * @param[in, out] cell_state             Cell state with dimensions [num_units, batch_size], updated in-place. Data type supported: Same as @p input_gates.
+     * @param[out]     cell_output            Cell output with dimensions [num_units, batch_size]. Data type supported: Same as @p input_gates.
+     * @param[out]     output                 (Optional) Sequence output with dimensions [num_units, batch_size, num_timesteps]. The cell output is also written to the current time step of this tensor.
+     *                                        Data type supported: Same as @p input_gates.
+     * @param[out]     scratch_buffer         Activated gates with dimensions [num_units * 4, batch_size] with CIFG or [num_units * 3, batch_size] without CIFG. Data type supported: Same as @p input_gates.
+     * @param[in]      activation_info        Activation used for the cell input and the cell output. Supported functions: RELU/BOUNDED_RELU/LU_BOUNDED_RELU/LOGISTIC/TANH.
+     * @param[in]      cell_threshold         The clipping threshold for the cell state. If set to 0.0 then clipping is disabled.
+     */
+    void configure(const ITensor *input_gates, const ITensor *recurrent_gates,
+                   const ITensor *input_gate_bias, const ITensor *forget_gate_bias, const ITensor *cell_bias, const ITensor *output_gate_bias,
+                   const ITensor *cell_to_input_weights, const ITensor *cell_to_forget_weights, const ITensor *cell_to_output_weights,
+                   ITensor *cell_state, ITensor *cell_output, ITensor *output, ITensor *scratch_buffer,
+                   const ActivationLayerInfo &activation_info, float cell_threshold);
+    /** Static function to check if given info will lead to a valid configuration of @ref NELSTMCellKernel
+     *
+     * @param[in] input_gates            Input contribution of the gates with dimensions [num_gates * num_units, batch_size, num_timesteps]. Data types supported: F16/F32.
+     * @param[in] recurrent_gates        Recurrent contribution of the gates with dimensions [num_gates * num_units, batch_size]. Data type supported: Same as @p input_gates.
+     * @param[in] input_gate_bias        1D tensor with dimensions [num_units]. Must be nullptr with CIFG. Data type supported: Same as @p input_gates.
+     * @param[in] forget_gate_bias       1D tensor with dimensions [num_units]. Data type supported: Same as @p input_gates.
+     * @param[in] cell_bias              1D tensor with dimensions [num_units]. Data type supported: Same as @p input_gates.
+     * @param[in] output_gate_bias       1D tensor with dimensions [num_units]. Data type supported: Same as @p input_gates.
+     * @param[in] cell_to_input_weights  (Optional) 1D tensor with dimensions [num_units]. Must be nullptr with CIFG. Data type supported: Same as @p input_gates.
+     * @param[in] cell_to_forget_weights (Optional) 1D tensor with dimensions [num_units]. Data type supported: Same as @p input_gates.
+     * @param[in] cell_to_output_weights (Optional) 1D tensor with dimensions [num_units]. Data type supported: Same as @p input_gates.
+     * @param[in] cell_state             Cell state with dimensions [num_units, batch_size]. Data type supported: Same as @p input_gates.
+     * @param[in] cell_output            Cell output with dimensions [num_units, batch_size]. Data type supported: Same as @p input_gates.
+     * @param[in] output                 (Optional) Sequence output with dimensions [num_units, batch_size, num_timesteps]. Data type supported: Same as @p input_gates.
+     * @param[in] scratch_buffer         Activated gates with dimensions [num_units * 4, batch_size] with CIFG or [num_units * 3, batch_size] without CIFG. Data type supported: Same as @p input_gates.
+     * @param[in] activation_info        Activation used for the cell input and the cell output. Supported functions: RELU/BOUNDED_RELU/LU_BOUNDED_RELU/LOGISTIC/TANH.
+     * @param[in] cell_threshold         The clipping threshold for the cell state. If set to 0.0 then clipping is disabled.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input_gates, const ITensorInfo *recurrent_gates,
+                           const ITensorInfo *input_gate_bias, const ITensorInfo *forget_gate_bias, const ITensorInfo *cell_bias, const ITensorInfo *output_gate_bias,
+                           const ITensorInfo *cell_to_input_weights, const ITensorInfo *cell_to_forget_weights, const ITensorInfo *cell_to_output_weights,
+                           const ITensorInfo *cell_state, const ITensorInfo *cell_output, const ITensorInfo *output, const ITensorInfo *scratch_buffer,
+                           const ActivationLayerInfo &activation_info, float cell_threshold);
+    /** Select the time step of @p input_gates and @p output processed by the next run
+     *
+     * @param[in] timestep Time step index. Must be less than num_timesteps.
+     */
+    void set_timestep(unsigned int timestep);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Common signature for all the specialised LSTM cell functions
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    using LSTMCellFunctionPtr = void (NELSTMCellKernel::*)(const Window &window);
+    /** Template function to run the LSTM cell
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <typename T>
+    void run_lstm_cell(const Window &window);
+
+    LSTMCellFunctionPtr _func;
+    const ITensor      *_input_gates;
+    const ITensor      *_recurrent_gates;
+    const ITensor      *_input_gate_bias;
+    const ITensor      *_forget_gate_bias;
+    const ITensor      *_cell_bias;
+    const ITensor      *_output_gate_bias;
+    const ITensor      *_cell_to_input_weights;
+    const ITensor      *_cell_to_forget_weights;
+    const ITensor      *_cell_to_output_weights;
+    ITensor            *_cell_state;
+    ITensor            *_cell_output;
+    ITensor            *_output;
+    ITensor            *_scratch_buffer;
+    ActivationLayerInfo _activation_info;
+    float               _cell_threshold;
+    unsigned int        _timestep;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NELSTMCELLKERNEL_H__ */
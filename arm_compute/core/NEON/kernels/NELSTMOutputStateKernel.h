@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NELSTMOUTPUTSTATEKERNEL_H__
+#define __ARM_COMPUTE_NELSTMOUTPUTSTATEKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the kernel that finalises the projected output state of a Long Short-Term Memory (LSTM) time step.
+ *
+ * The kernel computes in-place:
+ *
+ * output_state = Clip(output_state + projection_bias, projection_threshold)
+ *
+ * and optionally writes the result to the current time step of a sequence output.
+ */
+class NELSTMOutputStateKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NELSTMOutputStateKernel";
+    }
+    /** Default constructor */
+    NELSTMOutputStateKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELSTMOutputStateKernel(const NELSTMOutputStateKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELSTMOutputStateKernel &operator=(const NELSTMOutputStateKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NELSTMOutputStateKernel(NELSTMOutputStateKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NELSTMOutputStateKernel &operator=(NELSTMOutputStateKernel &&) = default;
+    /** Default destructor */
+    ~NELSTMOutputStateKernel() = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]      projection_bias      (Optional) 1D tensor with dimensions [output_size]. Data types supported: F16/F32.
+     * @param[in, out] output_state         Output state with dimensions [output_size, batch_size], updated in-place. Data type supported: Same as @p projection_bias.
+     * @param[out]     output               (Optional) Sequence output with dimensions [output_size, batch_size, num_timesteps]. Data type supported: Same as @p projection_bias.
+     * @param[in]      projection_threshold The clipping threshold for the output state. If set to 0.0 then clipping is disabled.
+     */
+    void configure(const ITensor *projection_bias, ITensor *output_state, ITensor *output, float projection_threshold);
+    /** Static function to check if given info will lead to a valid configuration of @ref NELSTMOutputStateKernel
+     *
+     * @param[in] projection_bias      (Optional) 1D tensor with dimensions [output_size]. Data types supported: F16/F32.
+     * @param[in] output_state         Output state with dimensions [output_size, batch_size]. Data type supported: Same as @p projection_bias.
+     * @param[in] output               (Optional) Sequence output with dimensions [output_size, batch_size, num_timesteps]. Data type supported: Same as @p projection_bias.
+     * @param[in] projection_threshold The clipping threshold for the output state. If set to 0.0 then clipping is disabled.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *projection_bias, const ITensorInfo *output_state, const ITensorInfo *output, float projection_threshold);
+    /** Select the time step of @p output written by the next run
+     *
+     * @param[in] timestep Time step index. Must be less than num_timesteps.
+     */
+    void set_timestep(unsigned int timestep);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Common signature for all the specialised output state functions
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    using OutputStateFunctionPtr = void (NELSTMOutputStateKernel::*)(const Window &window);
+    /** Template function to finalise the output state
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <typename T>
+    void run_output_state(const Window &window);
+
+    OutputStateFunctionPtr _func;
+    const ITensor         *_projection_bias;
+    ITensor               *_output_state;
+    ITensor               *_output;
+    float                  _projection_threshold;
+    unsigned int           _timestep;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NELSTMOUTPUTSTATEKERNEL_H__ */
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NELAPLACIANPYRAMIDKERNEL_H__
+#define __ARM_COMPUTE_NELAPLACIANPYRAMIDKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to compute a level of a Laplacian pyramid in a single pass
+ *
+ * For each row of the input level, the kernel blurs the row with a 5x5 Gaussian filter and computes:
+ *
+ * -# laplacian = input - Gaussian5x5(input)
+ * -# next_level = the blurred row decimated by 2 in both directions, if the row is sampled for the next level
+ * -# lowpass = Gaussian5x5(input) converted to S16
+ *
+ * The blurred image is never written to memory: the rows are filtered horizontally into a line buffer of five rows,
+ * from which the vertical filter, the subtraction and the decimation are computed while the rows are still in cache.
+ * The decimated output is the next level of the Gaussian pyramid of the input.
+ *
+ * Borders are handled while extending the input rows, so the input does not need any padding.
+ */
+class NELaplacianPyramidKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NELaplacianPyramidKernel";
+    }
+    /** Default constructor */
+    NELaplacianPyramidKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELaplacianPyramidKernel(const NELaplacianPyramidKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELaplacianPyramidKernel &operator=(const NELaplacianPyramidKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NELaplacianPyramidKernel(NELaplacianPyramidKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NELaplacianPyramidKernel &operator=(NELaplacianPyramidKernel &&) = default;
+    /** Default destructor */
+    ~NELaplacianPyramidKernel() = default;
+    /** Initialise the kernel's input, outputs and border mode.
+     *
+     * @param[in]  input                 Source tensor. Data type supported: U8.
+     * @param[out] laplacian             Laplacian level of @p input. Data type supported: S16. Must have the same shape as @p input.
+     * @param[out] next_level            (Optional) Next level of the Gaussian pyramid of @p input. Data type supported: U8.
+     *                                   Its width and height must be (width + 1) / 2 and (height + 1) / 2 of @p input.
+     * @param[out] lowpass               (Optional) Blurred @p input. Data type supported: S16. Must have the same shape as @p input.
+     * @param[in]  border_mode           Border mode to use.
+     * @param[in]  constant_border_value Constant value to use for borders if border_mode is set to CONSTANT.
+     */
+    void configure(const ITensor *input, ITensor *laplacian, ITensor *next_level, ITensor *lowpass, BorderMode border_mode, uint8_t constant_border_value);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor *_input;                 /**< Source tensor */
+    ITensor       *_laplacian;             /**< Laplacian level */
+    ITensor       *_next_level;            /**< Next level of the Gaussian pyramid */
+    ITensor       *_lowpass;               /**< Blurred source tensor */
+    BorderMode     _border_mode;           /**< Border mode */
+    uint8_t        _constant_border_value; /**< Constant value used for borders if the border mode is CONSTANT */
+    int            _offset_x;              /**< Column of the input sampled for the first column of the next level */
+    int            _offset_y;              /**< Row of the input sampled for the first row of the next level */
+};
+
+/** NEON kernel to compute a level of a Laplacian reconstruction in a single pass
+ *
+ * The kernel computes:
+ *
+ * output = Saturate(upsample(Saturate(low + low_laplacian)) + laplacian)
+ *
+ * where upsample is the nearest neighbour interpolation of @ref NEScaleKernel. The upsampled rows are computed
+ * once in a row buffer and added to the rows of @p laplacian, with the result converted to the output data type on store.
+ */
+class NELaplacianReconstructKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NELaplacianReconstructKernel";
+    }
+    /** Default constructor */
+    NELaplacianReconstructKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELaplacianReconstructKernel(const NELaplacianReconstructKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELaplacianReconstructKernel &operator=(const NELaplacianReconstructKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NELaplacianReconstructKernel(NELaplacianReconstructKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NELaplacianReconstructKernel &operator=(NELaplacianReconstructKernel &&) = default;
+    /** Default destructor */
+    ~NELaplacianReconstructKernel() = default;
+    /** Initialise the kernel's inputs and output.
+     *
+     * @param[in]  low           Lower resolution tensor to upsample. Data type supported: S16.
+     * @param[in]  low_laplacian (Optional) Tensor added to @p low before upsampling. Data type supported: S16. Must have the same shape as @p low.
+     * @param[in]  laplacian     Laplacian level added to the upsampled tensor. Data type supported: S16.
+     * @param[out] output        Destination tensor. Data types supported: U8/S16. Must have the same shape as @p laplacian.
+     */
+    void configure(const ITensor *low, const ITensor *low_laplacian, const ITensor *laplacian, ITensor *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor   *_low;           /**< Lower resolution tensor */
+    const ITensor   *_low_laplacian; /**< Tensor added to the lower resolution tensor */
+    const ITensor   *_laplacian;     /**< Laplacian level */
+    ITensor         *_output;        /**< Destination tensor */
+    std::vector<int> _offsets_x;     /**< Column of @p low sampled for each column of the output */
+    std::vector<int> _offsets_y;     /**< Row of @p low sampled for each row of the output */
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NELAPLACIANPYRAMIDKERNEL_H__ */
@@ -25,7 +25,7 @@
 #define __ARM_COMPUTE_NEMEANSTDDEVKERNEL_H__
 
 #include "arm_compute/core/NEON/INEKernel.h"
-#include "support/Mutex.h"
+#include "arm_compute/core/utils/misc/PerThreadAccumulator.h"
 
 #include <cstdint>
 
@@ -34,7 +34,11 @@ namespace arm_compute
 class ITensor;
 using IImage = ITensor;
 
-/** Interface for the kernel to calculate mean and standard deviation of input image pixels. */
+/** Interface for the kernel to calculate mean and standard deviation of input image pixels.
+ *
+ * Each thread accumulates the sums of the windows it processes, the mean and standard deviation are computed by @ref merge.
+ * The function running the kernel must call @ref reset with the number of threads of the scheduler before scheduling it.
+ */
 class NEMeanStdDevKernel : public INEKernel
 {
 public:
@@ -57,13 +61,18 @@ public:
 
     /** Initialise the kernel's input and outputs.
      *
-     * @param[in]  input              Input image. Data type supported: U8.
-     * @param[out] mean               Input average pixel value.
-     * @param[out] global_sum         Keeps global sum of pixel values.
-     * @param[out] stddev             (Optional) Output standard deviation of pixel values.
-     * @param[out] global_sum_squared (Optional if stddev is not set, required if stddev is set) Keeps global sum of squared pixel values.
+     * @param[in]  input  Input image. Data type supported: U8.
+     * @param[out] mean   Input average pixel value.
+     * @param[out] stddev (Optional) Output standard deviation of pixel values.
+     */
+    void configure(const IImage *input, float *mean, float *stddev = nullptr);
+    /** Clear the partial sums
+     *
+     * @param[in] num_threads Number of threads of the scheduler which will run the kernel.
      */
-    void configure(const IImage *input, float *mean, uint64_t *global_sum, float *stddev = nullptr, uint64_t *global_sum_squared = nullptr);
+    void reset(unsigned int num_threads);
+    /** Add up the partial sums of the threads and compute the mean and standard deviation. */
+    void merge();
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
@@ -71,13 +80,18 @@ public:
     BorderSize border_size() const override;
 
 private:
-    const IImage      *_input;
-    float             *_mean;
-    float             *_stddev;
-    uint64_t          *_global_sum;
-    uint64_t          *_global_sum_squared;
-    arm_compute::Mutex _mtx;
-    BorderSize         _border_size;
+    /** Partial sums of a thread */
+    struct Sums
+    {
+        uint64_t sum;         /**< Sum of the pixel values */
+        uint64_t sum_squared; /**< Sum of the squared pixel values */
+    };
+
+    const IImage                    *_input;
+    float                           *_mean;
+    float                           *_stddev;
+    misc::PerThreadAccumulator<Sums> _local_sums;
+    BorderSize                       _border_size;
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_NEMEANSTDDEVKERNEL_H__ */
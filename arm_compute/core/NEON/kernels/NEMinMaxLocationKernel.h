@@ -26,16 +26,22 @@
 
 #include "arm_compute/core/IArray.h"
 #include "arm_compute/core/NEON/INEKernel.h"
-#include "support/Mutex.h"
+#include "arm_compute/core/utils/misc/PerThreadAccumulator.h"
+#include "arm_compute/core/utils/misc/PerThreadBuffers.h"
 
 #include <cstdint>
+#include <vector>
 
 namespace arm_compute
 {
 class ITensor;
 using IImage = ITensor;
 
-/** Interface for the kernel to perform min max search on an image. */
+/** Interface for the kernel to perform min max search on an image.
+ *
+ * Each thread keeps the minimum and maximum of the windows it runs in its own slot: @ref reset must be called before scheduling the kernel
+ * and @ref merge once all the windows have been run.
+ */
 class NEMinMaxKernel : public INEKernel
 {
 public:
@@ -63,8 +69,13 @@ public:
      * @param[out] max   Maximum value of image. Data types supported: S32 if input type is U8/S16, F32 if input type is F32.
      */
     void configure(const IImage *input, void *min, void *max);
-    /** Resets global minimum and maximum. */
-    void reset();
+    /** Resets the minimum and maximum of the threads.
+     *
+     * @param[in] num_threads Number of threads which will run the kernel.
+     */
+    void reset(unsigned int num_threads);
+    /** Merges the minimum and maximum of the threads into the outputs. */
+    void merge();
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
@@ -72,37 +83,55 @@ public:
 private:
     /** Performs the min/max algorithm on U8 images on a given window.
      *
-     * @param win The window to run the algorithm on.
+     * @param win  The window to run the algorithm on.
+     * @param info Info about the executing thread.
      */
-    void minmax_U8(Window win);
+    void minmax_U8(Window win, const ThreadInfo &info);
     /** Performs the min/max algorithm on S16 images on a given window.
      *
-     * @param win The window to run the algorithm on.
+     * @param win  The window to run the algorithm on.
+     * @param info Info about the executing thread.
      */
-    void minmax_S16(Window win);
+    void minmax_S16(Window win, const ThreadInfo &info);
     /** Performs the min/max algorithm on F32 images on a given window.
      *
-     * @param win The window to run the algorithm on.
+     * @param win  The window to run the algorithm on.
+     * @param info Info about the executing thread.
      */
-    void minmax_F32(Window win);
+    void minmax_F32(Window win, const ThreadInfo &info);
     /** Common signature for all the specialised MinMax functions
      *
      * @param[in] window Region on which to execute the kernel.
+     * @param[in] info   Info about the executing thread.
      */
-    using MinMaxFunction = void (NEMinMaxKernel::*)(Window window);
+    using MinMaxFunction = void (NEMinMaxKernel::*)(Window window, const ThreadInfo &info);
     /** MinMax function to use for the particular image types passed to configure() */
     MinMaxFunction _func;
-    /** Helper to update min/max values **/
+    /** Helper to update the min/max values of a thread **/
     template <typename T>
-    void update_min_max(T min, T max);
+    void update_min_max(const ThreadInfo &info, T min, T max);
+    /** Helper to write the merged min/max values to the outputs **/
+    template <typename T>
+    void write_min_max(float min, float max);
+
+    /** Minimum and maximum found by a thread, stored as float which is exact for all the supported data types */
+    struct MinMax
+    {
+        float min;
+        float max;
+    };
 
-    const IImage      *_input; /**< Input image. */
-    void              *_min;   /**< Minimum value. */
-    void              *_max;   /**< Maximum value. */
-    arm_compute::Mutex _mtx;   /**< Mutex used for result reduction. */
+    const IImage                      *_input;         /**< Input image. */
+    void                              *_min;           /**< Minimum value. */
+    void                              *_max;           /**< Maximum value. */
+    misc::PerThreadAccumulator<MinMax> _local_min_max; /**< Minimum and maximum of the threads. */
 };
 
-/** Interface for the kernel to find min max locations of an image. */
+/** Interface for the kernel to find min max locations of an image.
+ *
+ * Each thread counts and locates the minimum and maximum values in the windows it runs in its own slot: @ref reset must be called before
+ * scheduling the kernel and @ref merge once all the windows have been run. The locations are appended to the arrays in the raster order of the windows, whatever the thread which ran them.
+ */
 class NEMinMaxLocationKernel : public INEKernel
 {
 public:
@@ -136,36 +165,54 @@ public:
     void configure(const IImage *input, void *min, void *max,
                    ICoordinates2DArray *min_loc = nullptr, ICoordinates2DArray *max_loc = nullptr,
                    uint32_t *min_count = nullptr, uint32_t *max_count = nullptr);
+    /** Resets the counts and locations of the threads.
+     *
+     * @param[in] num_threads Number of threads which will run the kernel.
+     */
+    void reset(unsigned int num_threads);
+    /** Merges the counts and locations of the threads into the outputs. */
+    void merge();
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
-    bool is_parallelisable() const override;
 
 private:
     /** Performs the min/max location algorithm on T type images on a given window.
      *
-     * @param win The window to run the algorithm on.
+     * @param win  The window to run the algorithm on.
+     * @param info Info about the executing thread.
      */
     template <class T, bool count_min, bool count_max, bool loc_min, bool loc_max>
-    void minmax_loc(const Window &win);
+    void minmax_loc(const Window &win, const ThreadInfo &info);
     /** Common signature for all the specialised MinMaxLoc functions
      *
      * @param[in] window Region on which to execute the kernel.
+     * @param[in] info   Info about the executing thread.
      */
-    using MinMaxLocFunction = void (NEMinMaxLocationKernel::*)(const Window &window);
+    using MinMaxLocFunction = void (NEMinMaxLocationKernel::*)(const Window &window, const ThreadInfo &info);
     /** MinMaxLoc function to use for the particular image types passed to configure() */
     MinMaxLocFunction _func;
     /** Helper to create a function pointer table for the parameterized MinMaxLocation functions. */
     template <class T, typename>
     struct create_func_table;
 
-    const IImage        *_input;     /**< Input image. */
-    void                *_min;       /**< Minimum value. */
-    void                *_max;       /**< Maximum value. */
-    uint32_t            *_min_count; /**< Count of minimum value encounters. */
-    uint32_t            *_max_count; /**< Count of maximum value encounters. */
-    ICoordinates2DArray *_min_loc;   /**< Locations of minimum values. */
-    ICoordinates2DArray *_max_loc;   /**< Locations of maximum values. */
+    /** Counts found by a thread */
+    struct Counts
+    {
+        uint32_t min_count;
+        uint32_t max_count;
+    };
+
+    const IImage                          *_input;         /**< Input image. */
+    void                                  *_min;           /**< Minimum value. */
+    void                                  *_max;           /**< Maximum value. */
+    uint32_t                              *_min_count;     /**< Count of minimum value encounters. */
+    uint32_t                              *_max_count;     /**< Count of maximum value encounters. */
+    ICoordinates2DArray                   *_min_loc;       /**< Locations of minimum values. */
+    ICoordinates2DArray                   *_max_loc;       /**< Locations of maximum values. */
+    misc::PerThreadAccumulator<Counts>     _local_count;   /**< Counts of the threads. */
+    misc::PerThreadBuffers<Coordinates2D>  _local_min_loc; /**< Locations of minimum values of the threads. */
+    misc::PerThreadBuffers<Coordinates2D>  _local_max_loc; /**< Locations of maximum values of the threads. */
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEMINMAXLOCATIONKERNEL_H__ */
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NERNNCELLKERNEL_H__
+#define __ARM_COMPUTE_NERNNCELLKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the kernel that computes the element-wise part of a Recurrent Neural Network (RNN) time step.
+ *
+ * The kernel computes in a single pass:
+ *
+ * -# hidden_state = Activation(input_projection + recurrent_projection + bias)
+ *
+ * and optionally writes the new hidden state to the current time step of a sequence output.
+ */
+class NERNNCellKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NERNNCellKernel";
+    }
+    /** Default constructor */
+    NERNNCellKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NERNNCellKernel(const NERNNCellKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NERNNCellKernel &operator=(const NERNNCellKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NERNNCellKernel(NERNNCellKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NERNNCellKernel &operator=(NERNNCellKernel &&) = default;
+    /** Default destructor */
+    ~NERNNCellKernel() = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input_projection     Input contribution with dimensions [num_units, batch_size, num_timesteps]. Data types supported: F16/F32.
+     * @param[in]  recurrent_projection Recurrent contribution with dimensions [num_units, batch_size]. Data type supported: Same as @p input_projection.
+     * @param[in]  bias                 1D tensor with dimensions [num_units]. Data type supported: Same as @p input_projection.
+     * @param[out] hidden_state         Hidden state with dimensions [num_units, batch_size]. Data type supported: Same as @p input_projection.
+     * @param[out] output               (Optional) Sequence output with dimensions [num_units, batch_size, num_timesteps]. The hidden state is also written to the current time step of this tensor.
+     *                                  Data type supported: Same as @p input_projection.
+     * @param[in]  activation_info      Activation layer information.
+     */
+    void configure(const ITensor *input_projection, const ITensor *recurrent_projection, const ITensor *bias, ITensor *hidden_state, ITensor *output, const ActivationLayerInfo &activation_info);
+    /** Static function to check if given info will lead to a valid configuration of @ref NERNNCellKernel
+     *
+     * @param[in] input_projection     Input contribution with dimensions [num_units, batch_size, num_timesteps]. Data types supported: F16/F32.
+     * @param[in] recurrent_projection Recurrent contribution with dimensions [num_units, batch_size]. Data type supported: Same as @p input_projection.
+     * @param[in] bias                 1D tensor with dimensions [num_units]. Data type supported: Same as @p input_projection.
+     * @param[in] hidden_state         Hidden state with dimensions [num_units, batch_size]. Data type supported: Same as @p input_projection.
+     * @param[in] output               (Optional) Sequence output with dimensions [num_units, batch_size, num_timesteps]. Data type supported: Same as @p input_projection.
+     * @param[in] activation_info      Activation layer information.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input_projection, const ITensorInfo *recurrent_projection, const ITensorInfo *bias, const ITensorInfo *hidden_state, const ITensorInfo *output,
+                           const ActivationLayerInfo &activation_info);
+    /** Select the time step of @p input_projection and @p output processed by the next run
+     *
+     * @param[in] timestep Time step index. Must be less than num_timesteps.
+     */
+    void set_timestep(unsigned int timestep);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Common signature for all the specialised RNN cell functions
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    using RNNCellFunctionPtr = void (NERNNCellKernel::*)(const Window &window);
+    /** Template function to run the RNN cell
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <typename T>
+    void run_rnn_cell(const Window &window);
+
+    RNNCellFunctionPtr  _func;
+    const ITensor      *_input_projection;
+    const ITensor      *_recurrent_projection;
+    const ITensor      *_bias;
+    ITensor            *_hidden_state;
+    ITensor            *_output;
+    ActivationLayerInfo _activation_info;
+    unsigned int        _timestep;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NERNNCELLKERNEL_H__ */
@@ -54,12 +54,12 @@ public:
 
     /** Initialise the kernel's inputs, output and interpolation policy
      *
-     * @note dx, dy and offsets have the same dimensions (width and height) of the output tensor
+     * @note The coordinates are separable: offsets and dx have one entry per output column and dy has one entry per output row
      *
-     * @param[in]  input           Source tensor. Data types supported: U8/S16/F32.
-     * @param[in]  dx              Pixel's distance between the X real coordinate and the smallest X following integer. Data type supported: F32
-     * @param[in]  dy              Pixel's distance between the Y real coordinate and the smallest Y following integer. Data type supported: F32
-     * @param[in]  offsets         Offset to access the pixel with NEAREST interpolation or the top-left pixel with BILINEAR interpolation in the input tensor. Data type supported: S32.
+     * @param[in]  input           Source tensor. Data types supported: U8/S16/F16/F32.
+     * @param[in]  dx              1D tensor with the distance between the X real coordinate and the smallest X following integer of each output column. Data type supported: F32
+     * @param[in]  dy              1D tensor with the distance between the Y real coordinate and the smallest Y following integer of each output row. Data type supported: F32
+     * @param[in]  offsets         1D tensor with the offset in bytes of each output column to access the pixel with NEAREST interpolation or the top-left pixel with BILINEAR interpolation in the input row. Data type supported: S32.
      * @param[out] output          Destination tensor. Data types supported: Same as @p input. All but the lowest two dimensions must be the same size as in the input tensor, i.e. scaling is only performed within the XY-plane.
      * @param[in]  policy          Interpolation type to use
      * @param[in]  border_mode     Border mode policy
@@ -69,12 +69,12 @@ public:
                    InterpolationPolicy policy, BorderMode border_mode, SamplingPolicy sampling_policy = SamplingPolicy::CENTER);
     /** Static function to check if given info will lead to a valid configuration of @ref NEScaleKernel
      *
-     * @note dx, dy and offsets have the same dimensions (width and height) of the output tensor
+     * @note The coordinates are separable: offsets and dx have one entry per output column and dy has one entry per output row
      *
-     * @param[in] input           Source tensor. Data types supported: U8/S16/F32.
-     * @param[in] dx              Pixel's distance between the X real coordinate and the smallest X following integer. Data type supported: F32
-     * @param[in] dy              Pixel's distance between the Y real coordinate and the smallest Y following integer. Data type supported: F32
-     * @param[in] offsets         Offset to access the pixel with NEAREST interpolation or the top-left pixel with BILINEAR interpolation in the input tensor. Data type supported: S32.
+     * @param[in] input           Source tensor. Data types supported: U8/S16/F16/F32.
+     * @param[in] dx              1D tensor with the distance between the X real coordinate and the smallest X following integer of each output column. Data type supported: F32
+     * @param[in] dy              1D tensor with the distance between the Y real coordinate and the smallest Y following integer of each output row. Data type supported: F32
+     * @param[in] offsets         1D tensor with the offset in bytes of each output column to access the pixel with NEAREST interpolation or the top-left pixel with BILINEAR interpolation in the input row. Data type supported: S32.
      * @param[in] output          Destination tensor. Data types supported: Same as @p input. All but the lowest two dimensions must be the same size as in the input tensor, i.e. scaling is only performed within the XY-plane.
      * @param[in] policy          Interpolation type to use
      * @param[in] border_mode     Border mode policy
@@ -26,6 +26,7 @@
 #include <memory>
 
 #include "arm_gemm_local.hpp"
+#include "convolution_parameters.hpp"
 #include "gemm_common.hpp"
 
 namespace arm_gemm {
@@ -67,6 +68,10 @@ public:
     T              _beta;
     int            _maxthreads;
     bool           _pretransposed_hint;
+    /* Optional: if set, A is gathered from a convolution input on the fly
+     * (see ConvolutionParameters).  Only needs to remain valid until the
+     * GEMM object has been created. */
+    const ConvolutionParameters *_conv_params = nullptr;
 
     GemmArgs(const CPUInfo *ci, const unsigned int M, const unsigned int N,
              const unsigned int K, const unsigned int nbatches,
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+namespace arm_gemm {
+
+/* Description of a convolution whose "A" matrix is gathered directly from
+ * the input tensor rather than from an im2col buffer.
+ *
+ * Rows of A are output points, in (batch, y, x) order with x fastest.
+ * Columns of A are kernel points, in (channel, kernel_y, kernel_x) order
+ * with kernel_x fastest (matching the ACL im2col / weights reshape
+ * layout).  If append_bias is set an extra column of ones is added after
+ * the last kernel point so that biases can be folded into B.
+ *
+ * Strides of the input tensor are not part of this structure as they are
+ * only known at run time - see GemmCommon::set_convolution_strides().
+ */
+struct ConvolutionParameters
+{
+    int  input_width     = 0;
+    int  input_height    = 0;
+    int  input_channels  = 0;
+    int  kernel_width    = 0;
+    int  kernel_height   = 0;
+    int  output_width    = 0;
+    int  output_height   = 0;
+    int  output_stride_w = 1;
+    int  output_stride_h = 1;
+    int  dilation_w      = 1;
+    int  dilation_h      = 1;
+    int  padding_top     = 0;
+    int  padding_left    = 0;
+    bool append_bias     = false;
+};
+
+} // namespace arm_gemm
@@ -112,6 +112,11 @@ public:
     /* Set pretransposed data - the void * passed in must previously have been passed to pretranspose_B_array() for the same or a similar GEMM. */
     virtual void set_pretransposed_B_data(void *buffer) { }
 
+    /*** "Convolution" interface (optional) ***/
+    /* Set the element strides of the input tensor A is gathered from.  Only meaningful for GEMMs created with ConvolutionParameters,
+     * in which case this must be called before execute() and the A pointer passed to set_arrays() is the base of the input tensor. */
+    virtual void set_convolution_strides(const int stride_x, const int stride_y, const int stride_c, const int stride_batch) { }
+
     // Destructor
     virtual ~GemmCommon() { }
 };
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_DETAIL_NERECURRENT_CELL_DETAIL_H__
+#define __ARM_COMPUTE_DETAIL_NERECURRENT_CELL_DETAIL_H__
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEMath.h"
+#include "arm_compute/core/Types.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace detail
+{
+/** Loads 4 values and widens them to F32: the recurrent cells accumulate in F32 whatever their data type
+ *
+ * @param[in] ptr Pointer to the values
+ *
+ * @return The F32 values
+ */
+inline float32x4_t vload(const float *ptr)
+{
+    return vld1q_f32(ptr);
+}
+
+/** Stores 4 F32 values
+ *
+ * @param[out] ptr   Pointer to the destination
+ * @param[in]  value Values to store
+ */
+inline void vstore(float *ptr, float32x4_t value)
+{
+    vst1q_f32(ptr, value);
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+/** Loads 4 F16 values and widens them to F32
+ *
+ * @param[in] ptr Pointer to the values
+ *
+ * @return The F32 values
+ */
+inline float32x4_t vload(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+
+/** Narrows 4 F32 values to F16 and stores them
+ *
+ * @param[out] ptr   Pointer to the destination
+ * @param[in]  value Values to store
+ */
+inline void vstore(float16_t *ptr, float32x4_t value)
+{
+    vst1_f16(ptr, vcvt_f16_f32(value));
+}
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+/** Computes the logistic function of 4 values
+ *
+ * @param[in] x Input values
+ *
+ * @return 1 / (1 + exp(-x))
+ */
+inline float32x4_t vlogistic(float32x4_t x)
+{
+    return vinvq_f32(vaddq_f32(vdupq_n_f32(1.f), vexpq_f32(vnegq_f32(x))));
+}
+
+/** Computes the logistic function of a value
+ *
+ * @param[in] x Input value
+ *
+ * @return 1 / (1 + exp(-x))
+ */
+inline float logistic(float x)
+{
+    return 1.f / (1.f + std::exp(-x));
+}
+
+/** Applies an activation function to 4 values
+ *
+ * @param[in] x    Input values
+ * @param[in] info Activation function to apply
+ *
+ * @return The activated values
+ */
+inline float32x4_t vactivation(float32x4_t x, const ActivationLayerInfo &info)
+{
+    using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+    const float32x4_t CONST_0 = vdupq_n_f32(0.f);
+    const float32x4_t CONST_1 = vdupq_n_f32(1.f);
+    const float32x4_t a       = vdupq_n_f32(info.a());
+    const float32x4_t b       = vdupq_n_f32(info.b());
+
+    switch(info.activation())
+    {
+        case ActivationFunction::ABS:
+            return vabsq_f32(x);
+        case ActivationFunction::LINEAR:
+            return vmlaq_f32(b, a, x);
+        case ActivationFunction::LOGISTIC:
+            return vlogistic(x);
+        case ActivationFunction::RELU:
+            return vmaxq_f32(CONST_0, x);
+        case ActivationFunction::BOUNDED_RELU:
+            return vminq_f32(a, vmaxq_f32(CONST_0, x));
+        case ActivationFunction::LU_BOUNDED_RELU:
+            return vminq_f32(a, vmaxq_f32(b, x));
+        case ActivationFunction::LEAKY_RELU:
+            return vbslq_f32(vcgtq_f32(x, CONST_0), x, vmulq_f32(a, x));
+        case ActivationFunction::SOFT_RELU:
+            return vlogq_f32(vaddq_f32(CONST_1, vexpq_f32(x)));
+        case ActivationFunction::SQRT:
+            return vinvq_f32(vinvsqrtq_f32(x));
+        case ActivationFunction::SQUARE:
+            return vmulq_f32(x, x);
+        case ActivationFunction::TANH:
+            return vmulq_f32(a, vtanhq_f32(vmulq_f32(b, x)));
+        default:
+            ARM_COMPUTE_ERROR("Unsupported activation function");
+    }
+}
+
+/** Applies an activation function to a value
+ *
+ * @param[in] x    Input value
+ * @param[in] info Activation function to apply
+ *
+ * @return The activated value
+ */
+inline float activation(float x, const ActivationLayerInfo &info)
+{
+    using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+    switch(info.activation())
+    {
+        case ActivationFunction::ABS:
+            return std::abs(x);
+        case ActivationFunction::LINEAR:
+            return info.a() * x + info.b();
+        case ActivationFunction::LOGISTIC:
+            return logistic(x);
+        case ActivationFunction::RELU:
+            return std::max(0.f, x);
+        case ActivationFunction::BOUNDED_RELU:
+            return std::min(info.a(), std::max(0.f, x));
+        case ActivationFunction::LU_BOUNDED_RELU:
+            return std::min(info.a(), std::max(info.b(), x));
+        case ActivationFunction::LEAKY_RELU:
+            return (x > 0.f) ? x : info.a() * x;
+        case ActivationFunction::SOFT_RELU:
+            return std::log(1.f + std::exp(x));
+        case ActivationFunction::SQRT:
+            return std::sqrt(x);
+        case ActivationFunction::SQUARE:
+            return x * x;
+        case ActivationFunction::TANH:
+            return info.a() * std::tanh(info.b() * x);
+        default:
+            ARM_COMPUTE_ERROR("Unsupported activation function");
+    }
+}
+
+/** Returns a pointer to the first element of a row of a tensor
+ *
+ * @param[in] tensor Tensor. Can be nullptr
+ * @param[in] y      Row
+ * @param[in] z      (Optional) Plane, i.e. time step of a sequence. Defaults to 0
+ *
+ * @return The pointer to the row, or nullptr if @p tensor is nullptr
+ */
+template <typename T>
+inline const T *row_ptr(const ITensor *tensor, int y, int z = 0)
+{
+    return tensor == nullptr ? nullptr : reinterpret_cast<const T *>(tensor->ptr_to_element(Coordinates(0, y, z)));
+}
+
+/** Returns a pointer to the first element of a row of a tensor
+ *
+ * @param[in] tensor Tensor. Can be nullptr
+ * @param[in] y      Row
+ * @param[in] z      (Optional) Plane, i.e. time step of a sequence. Defaults to 0
+ *
+ * @return The pointer to the row, or nullptr if @p tensor is nullptr
+ */
+template <typename T>
+inline T *row_ptr(ITensor *tensor, int y, int z = 0)
+{
+    return tensor == nullptr ? nullptr : reinterpret_cast<T *>(tensor->ptr_to_element(Coordinates(0, y, z)));
+}
+} // namespace detail
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_DETAIL_NERECURRENT_CELL_DETAIL_H__ */
@@ -32,6 +32,7 @@
 #include "arm_compute/core/TensorShape.h"
 #include "support/Half.h"
 
+#include <array>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
@@ -1243,6 +1244,53 @@ struct WinogradInfo
     DataLayout    output_data_layout{ DataLayout::NCHW }; /**< Data layout to use for the output tensor once the convolution has been applied (NCHW or NHWC) */
 };
 
+/** Image to tensor conversion information class
+ *
+ * Each output channel is computed as (pixel - mean) * scale from the red, green and blue values of the resized image.
+ */
+class ImageToTensorInfo final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] mean   (Optional) Mean of the red, green and blue channels. Defaults to 0
+     * @param[in] scale  (Optional) Scale applied to the red, green and blue channels once centred. Defaults to 1
+     * @param[in] bgr    (Optional) True if the channels have to be written in blue, green, red order. Defaults to false
+     * @param[in] policy (Optional) Interpolation used when the image and the tensor have different sizes. Supported: NEAREST_NEIGHBOR/BILINEAR. Defaults to BILINEAR
+     */
+    ImageToTensorInfo(std::array<float, 3> mean = { { 0.f, 0.f, 0.f } }, std::array<float, 3> scale = { { 1.f, 1.f, 1.f } }, bool bgr = false,
+                      InterpolationPolicy policy = InterpolationPolicy::BILINEAR)
+        : _mean(mean), _scale(scale), _bgr(bgr), _policy(policy)
+    {
+    }
+    /** Get the mean of the red, green and blue channels */
+    const std::array<float, 3> &mean() const
+    {
+        return _mean;
+    }
+    /** Get the scale of the red, green and blue channels */
+    const std::array<float, 3> &scale() const
+    {
+        return _scale;
+    }
+    /** Check if the channels are written in blue, green, red order */
+    bool bgr() const
+    {
+        return _bgr;
+    }
+    /** Get the interpolation policy */
+    InterpolationPolicy interpolation_policy() const
+    {
+        return _policy;
+    }
+
+private:
+    std::array<float, 3> _mean;
+    std::array<float, 3> _scale;
+    bool                 _bgr;
+    InterpolationPolicy  _policy;
+};
+
 /** IO formatting information class*/
 struct IOFormatInfo
 {
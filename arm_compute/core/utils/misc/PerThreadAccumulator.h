@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_MISC_PER_THREAD_ACCUMULATOR_H__
+#define __ARM_COMPUTE_MISC_PER_THREAD_ACCUMULATOR_H__
+
+#include "arm_compute/core/Error.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace arm_compute
+{
+namespace misc
+{
+/** Accumulators of a reduction kernel, one per thread of the scheduler.
+ *
+ * Each thread accumulates the windows it runs into the slot indexed by its ThreadInfo::thread_id, without any synchronisation,
+ * which also makes the reduction independent of the number of windows processed by each thread.
+ * The function running the kernel resets the slots for the number of threads of the scheduler before scheduling it,
+ * and the slots are merged once all the threads are done.
+ */
+template <typename T>
+class PerThreadAccumulator
+{
+public:
+    /** Default constructor */
+    PerThreadAccumulator()
+        : _slots()
+    {
+    }
+    /** Reset the accumulators
+     *
+     * @note The storage of the slots is reused if the number of threads does not change.
+     *
+     * @param[in] num_threads Number of threads which can run the kernel.
+     * @param[in] init        Initial value of each accumulator.
+     */
+    void reset(unsigned int num_threads, const T &init)
+    {
+        ARM_COMPUTE_ERROR_ON(num_threads == 0);
+        _slots.resize(num_threads);
+        for(auto &slot : _slots)
+        {
+            slot.value = init;
+        }
+    }
+    /** Number of accumulators */
+    unsigned int num_threads() const
+    {
+        return _slots.size();
+    }
+    /** Accumulator of a thread
+     *
+     * @param[in] thread_id Thread ID as set in the ThreadInfo passed to the kernel.
+     *
+     * @return The accumulator of the thread
+     */
+    T &operator[](unsigned int thread_id)
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(thread_id >= _slots.size(), "Accumulators were not reset for enough threads");
+        return _slots[thread_id].value;
+    }
+    /** Accumulator of a thread
+     *
+     * @param[in] thread_id Thread ID as set in the ThreadInfo passed to the kernel.
+     *
+     * @return The accumulator of the thread
+     */
+    const T &operator[](unsigned int thread_id) const
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(thread_id >= _slots.size(), "Accumulators were not reset for enough threads");
+        return _slots[thread_id].value;
+    }
+    /** Merge the accumulators in thread order
+     *
+     * @param[in] init  Initial value of the result.
+     * @param[in] merge Function merging an accumulator into the result, called as merge(result, accumulator).
+     *
+     * @return The merged result
+     */
+    template <typename R, typename F>
+    R merge(R init, F &&merge) const
+    {
+        for(const auto &slot : _slots)
+        {
+            merge(init, slot.value);
+        }
+        return init;
+    }
+
+private:
+    static constexpr size_t cache_line_size = 64;
+
+    /** Accumulator followed by a cache line of padding so that the accumulators of two threads never share a cache line */
+    struct Slot
+    {
+        /** Default constructor */
+        Slot()
+            : value(), padding()
+        {
+        }
+
+        T       value;
+        uint8_t padding[cache_line_size];
+    };
+
+    std::vector<Slot> _slots;
+};
+} // namespace misc
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_MISC_PER_THREAD_ACCUMULATOR_H__ */
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_MISC_PER_THREAD_BUFFERS_H__
+#define __ARM_COMPUTE_MISC_PER_THREAD_BUFFERS_H__
+
+#include "arm_compute/core/Window.h"
+#include "arm_compute/core/utils/misc/PerThreadAccumulator.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace arm_compute
+{
+namespace misc
+{
+/** Buffers of the elements produced by a kernel, one per thread of the scheduler.
+ *
+ * Each thread appends the elements of the windows it runs to its own buffer, without any synchronisation.
+ * The buffers are then merged in the raster order of the first element of each window, which is the order
+ * the kernel would produce if run on a single thread as long as the windows are split along a single dimension.
+ */
+template <typename T>
+class PerThreadBuffers
+{
+public:
+    /** Default constructor */
+    PerThreadBuffers()
+        : _buffers()
+    {
+    }
+    /** Reset the buffers
+     *
+     * @note The storage of the buffers is reused if the number of threads does not change.
+     *
+     * @param[in] num_threads Number of threads which can run the kernel.
+     */
+    void reset(unsigned int num_threads)
+    {
+        _buffers.reset(num_threads, Buffer{});
+    }
+    /** Start a new window
+     *
+     * @param[in] thread_id Thread ID as set in the ThreadInfo passed to the kernel.
+     * @param[in] window    Window about to be run by the thread.
+     *
+     * @return The buffer the elements of the window must be appended to
+     */
+    std::vector<T> &begin_window(unsigned int thread_id, const Window &window)
+    {
+        Buffer &buffer = _buffers[thread_id];
+        buffer.windows.push_back(Segment{ window.y().start(), window.x().start(), buffer.elements.size() });
+        return buffer.elements;
+    }
+    /** Merge the buffers in window order
+     *
+     * @param[in] merge Function called on each element as merge(element). Merging stops as soon as it returns false.
+     */
+    template <typename F>
+    void merge(F &&merge) const
+    {
+        struct Range
+        {
+            Segment  segment;
+            const T *begin;
+            const T *end;
+        };
+
+        std::vector<Range> ranges;
+        for(unsigned int t = 0; t < _buffers.num_threads(); ++t)
+        {
+            const Buffer &buffer = _buffers[t];
+            for(size_t w = 0; w < buffer.windows.size(); ++w)
+            {
+                const size_t end = (w + 1 < buffer.windows.size()) ? buffer.windows[w + 1].offset : buffer.elements.size();
+                ranges.push_back(Range{ buffer.windows[w], buffer.elements.data() + buffer.windows[w].offset, buffer.elements.data() + end });
+            }
+        }
+
+        std::sort(ranges.begin(), ranges.end(), [](const Range & lhs, const Range & rhs)
+        {
+            return (lhs.segment.y < rhs.segment.y) || (lhs.segment.y == rhs.segment.y && lhs.segment.x < rhs.segment.x);
+        });
+
+        for(const auto &range : ranges)
+        {
+            for(const T *element = range.begin; element != range.end; ++element)
+            {
+                if(!merge(*element))
+                {
+                    return;
+                }
+            }
+        }
+    }
+
+private:
+    /** First element of a window and offset of its elements in the buffer of the thread */
+    struct Segment
+    {
+        int    y;
+        int    x;
+        size_t offset;
+    };
+    /** Elements and windows of a thread */
+    struct Buffer
+    {
+        /** Default constructor */
+        Buffer()
+            : elements(), windows()
+        {
+        }
+
+        std::vector<T>       elements;
+        std::vector<Segment> windows;
+    };
+
+    PerThreadAccumulator<Buffer> _buffers;
+};
+} // namespace misc
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_MISC_PER_THREAD_BUFFERS_H__ */
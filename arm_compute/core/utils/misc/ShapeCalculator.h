@@ -166,7 +166,8 @@ inline TensorShape compute_transposed_shape(const ITensorInfo &input)
 
     return shape_transposed;
 }
-inline TensorShape compute_depthwise_convolution_shape(const ITensorInfo &input, const ITensorInfo &weights, PadStrideInfo conv_info, unsigned int depth_multiplier)
+inline TensorShape compute_depthwise_convolution_shape(const ITensorInfo &input, const ITensorInfo &weights, PadStrideInfo conv_info, unsigned int depth_multiplier,
+                                                       const Size2D &dilation = Size2D(1U, 1U))
 {
     const TensorShape input_shape{ input.tensor_shape() };
     const TensorShape weights_shape{ weights.tensor_shape() };
@@ -180,7 +181,7 @@ inline TensorShape compute_depthwise_convolution_shape(const ITensorInfo &input,
     unsigned int output_height = 0;
     std::tie(output_width, output_height) = scaled_dimensions(input_shape[width_idx], input_shape[height_idx],
                                                               weights_shape[width_idx], weights_shape[height_idx],
-                                                              conv_info);
+                                                              conv_info, dilation);
 
     TensorShape output_shape{ input_shape };
     output_shape.set(width_idx, output_width);
@@ -199,6 +200,22 @@ inline TensorShape compute_deconvolution_shape(const ITensorInfo &input, unsigne
 
     return scale_out_shape;
 }
+inline TensorShape compute_deconvolution_reshaped_weights_shape(const ITensorInfo &weights)
+{
+    // The reshaped weights are the 2D matrix [kernel_x * kernel_y * OFM, IFM]
+    return TensorShape(weights.dimension(0) * weights.dimension(1) * weights.dimension(3), weights.dimension(2));
+}
+inline TensorShape compute_deconvolution_col_shape(const ITensorInfo &input, const ITensorInfo &weights)
+{
+    // The GEMM output holds, for every input pixel, the contributions to kernel_x * kernel_y * OFM output values:
+    // [ kernel_x * kernel_y * OFM, width * height, 1, batches ]
+    TensorShape col_shape{ input.tensor_shape() };
+    col_shape.set(0, weights.dimension(0) * weights.dimension(1) * weights.dimension(3));
+    col_shape.set(1, input.dimension(0) * input.dimension(1));
+    col_shape.set(2, 1);
+
+    return col_shape;
+}
 inline TensorShape compute_im2col_conv_shape(const ITensorInfo *input, const Size2D &kernel_dims, const PadStrideInfo &conv_info, bool has_bias, const Size2D &dilation, bool batch_size_on_z,
                                              unsigned int num_groups = 1)
 {
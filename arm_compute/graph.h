@@ -46,6 +46,7 @@
 #include "arm_compute/graph/printers/Printers.h"
 
 // Frontend
+#include "arm_compute/graph/frontend/DynamicBatcher.h"
 #include "arm_compute/graph/frontend/IStreamOperators.h"
 #include "arm_compute/graph/frontend/Layers.h"
 #include "arm_compute/graph/frontend/Stream.h"
@@ -77,6 +77,13 @@ public:
      * @param[in] graph Graph to invalidate
      */
     void invalidate_graph(Graph &graph);
+    /** Returns the peak transition memory of the execution orders considered when finalizing a graph
+     *
+     * @param[in] graph Finalized graph to query
+     *
+     * @return The peak transition memory of the depth first and memory aware execution orders
+     */
+    TransitionMemoryInfo transition_memory_info(const Graph &graph) const;
 
 private:
     std::map<GraphID, ExecutionWorkload> _workloads = {}; /**< Graph workloads */
@@ -27,6 +27,7 @@
 #include "arm_compute/core/ITensor.h"
 
 #include <memory>
+#include <string>
 
 namespace arm_compute
 {
@@ -45,6 +46,16 @@ public:
      * @return True if access is successful else false
      */
     virtual bool access_tensor(ITensor &tensor) = 0;
+    /** Identifies the data written by the accessor
+     *
+     * Constant tensors filled by accessors returning the same identifier can share their memory across graphs.
+     *
+     * @return Identifier of the data, or an empty string if the data can't be shared
+     */
+    virtual std::string source() const
+    {
+        return "";
+    }
 };
 
 using ITensorAccessorUPtr = std::unique_ptr<ITensorAccessor>;
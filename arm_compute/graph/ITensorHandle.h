@@ -27,6 +27,8 @@
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/graph/Types.h"
 
+#include <string>
+
 namespace arm_compute
 {
 // Forward declarations
@@ -44,6 +46,28 @@ public:
     virtual void allocate() = 0;
     /** Allocates backend memory for the handle */
     virtual void free() = 0;
+    /** Allocates backend memory for a read-only handle, sharing it with the handles of other graphs holding the same data
+     *
+     * @note Backends not supporting sharing simply allocate the handle
+     *
+     * @param[in] key Identifier of the data held by the handle
+     *
+     * @return True if the memory of a handle holding the same data has been imported, in which case the handle must not be filled
+     */
+    virtual bool allocate_shared(const std::string &key)
+    {
+        ARM_COMPUTE_UNUSED(key);
+        allocate();
+        return false;
+    }
+    /** Makes the data of a handle allocated by @ref allocate_shared available to the other handles with the same key once filled
+     *
+     * @param[in] key Identifier of the data held by the handle
+     */
+    virtual void publish_shared(const std::string &key)
+    {
+        ARM_COMPUTE_UNUSED(key);
+    }
     /** Set backend tensor to be managed by a memory group
      *
      * @param[in] mg Memory group
@@ -77,11 +77,28 @@ class TensorDescriptor;
 /** Graph configuration structure */
 struct GraphConfig
 {
-    bool        use_function_memory_manager{ true };   /**< Use a memory manager to manage per-funcion auxilary memory */
-    bool        use_transition_memory_manager{ true }; /**< Use a memory manager to manager transition buffer memory */
-    bool        use_tuner{ false };                    /**< Use a tuner in tunable backends */
-    int         num_threads{ -1 };                     /**< Number of threads to use (thread capable backends), if 0 the backend will auto-initialize, if -1 the backend will stay as it is. */
-    std::string tuner_file{ "acl_tuner.csv" };         /**< File to load/store tuning values from */
+    bool         use_function_memory_manager{ true };   /**< Use a memory manager to manage per-funcion auxilary memory */
+    bool         use_transition_memory_manager{ true }; /**< Use a memory manager to manager transition buffer memory */
+    bool         use_tuner{ false };                    /**< Use a tuner in tunable backends */
+    int          num_threads{ -1 };                     /**< Number of threads to use (thread capable backends), if 0 the backend will auto-initialize, if -1 the backend will stay as it is. */
+    std::string  tuner_file{ "acl_tuner.csv" };         /**< File to load/store tuning values from */
+    unsigned int max_batch_size{ 1 };                   /**< Maximum number of requests packed into a single execution when dynamic batching is used */
+    unsigned int batching_timeout_us{ 1000 };           /**< Maximum time in microseconds the oldest queued request waits for a batch to fill up when dynamic batching is used */
+    std::string  trace_file{};                          /**< If not empty, file to write a Chrome trace of the kernels' execution by the scheduler threads to (thread capable backends) */
+    std::string  profile_file{};                        /**< If not empty, file to write the hardware counters aggregated per node and kernel to (thread capable backends) */
+    bool         share_weights{ false };                /**< Share the const tensors and the prepared weights with the other graphs of the process loading the same data (supporting backends) */
+    bool         use_implicit_gemm{ false };            /**< Let the GEMM based convolutions gather their input straight from the convolution input instead of running im2col, where supported (NEON backend) */
+};
+
+/** Peak transition memory of the execution orders considered when finalizing a graph
+ *
+ * @note Only estimated when the transition memory manager is used
+ */
+struct TransitionMemoryInfo
+{
+    size_t dfs_peak{ 0 };             /**< Peak bytes of live transition buffers with depth first ordering */
+    size_t memory_aware_peak{ 0 };    /**< Peak bytes of live transition buffers with memory aware ordering */
+    bool   use_memory_aware{ false }; /**< True if the memory aware ordering has been selected */
 };
 
 /**< Device target types */
@@ -82,11 +82,12 @@ struct ExecutionTask
 /** Execution workload */
 struct ExecutionWorkload
 {
-    std::vector<Tensor *>      inputs  = {};          /**< Input handles */
-    std::vector<Tensor *>      outputs = {};          /**< Output handles */
-    std::vector<ExecutionTask> tasks   = {};          /**< Execution workload */
-    Graph                     *graph   = { nullptr }; /**< Graph bound to the workload */
-    GraphContext              *ctx     = { nullptr }; /**< Graph execution context */
+    std::vector<Tensor *>      inputs            = {};          /**< Input handles */
+    std::vector<Tensor *>      outputs           = {};          /**< Output handles */
+    std::vector<ExecutionTask> tasks             = {};          /**< Execution workload */
+    Graph                     *graph             = { nullptr }; /**< Graph bound to the workload */
+    GraphContext              *ctx               = { nullptr }; /**< Graph execution context */
+    TransitionMemoryInfo       transition_memory = {};          /**< Peak transition memory of the execution orders considered */
 };
 } // namespace graph
 } // namespace arm_compute
@@ -26,6 +26,7 @@
 
 #include "arm_compute/graph/Types.h"
 
+#include <cstddef>
 #include <vector>
 
 namespace arm_compute
@@ -49,6 +50,27 @@ std::vector<NodeID> bfs(Graph &g);
  * @return A vector with the node id traversal order
  */
 std::vector<NodeID> dfs(Graph &g);
+/** Memory aware topological sort
+ *
+ * Greedily schedules, among the nodes whose inputs are ready, the one that minimises the growth of live transition memory,
+ * preferring the most recently readied node on ties to preserve depth-first locality.
+ *
+ * @param g Graph to traverse
+ *
+ * @return A vector with the node id traversal order
+ */
+std::vector<NodeID> memory_aware_sort(Graph &g);
+/** Estimates the peak memory required by the transition tensors of a graph for a given execution order
+ *
+ * A transition buffer is considered live from the execution of its first producer until the execution of its last consumer.
+ * Tensors bound to input, output and const nodes are not accounted for.
+ *
+ * @param g     Graph to inspect
+ * @param order Topological order of the graph nodes
+ *
+ * @return Peak number of bytes of transition memory
+ */
+size_t peak_transition_memory(Graph &g, const std::vector<NodeID> &order);
 } // namespace graph
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_GRAPH_ALGORITHM_TOPOLOGICAL_SORT_H__ */
@@ -27,6 +27,10 @@
 #include "arm_compute/graph/IDeviceBackend.h"
 
 #include "arm_compute/runtime/Allocator.h"
+#include "arm_compute/runtime/SchedulerTracer.h"
+
+#include <map>
+#include <mutex>
 
 namespace arm_compute
 {
@@ -53,7 +57,9 @@ public:
     std::shared_ptr<arm_compute::IMemoryManager> create_memory_manager(MemoryManagerAffinity affinity) override;
 
 private:
-    Allocator _allocator; /**< NEON backend allocator */
+    Allocator                                                           _allocator;       /**< NEON backend allocator */
+    std::map<const GraphContext *, SchedulerTracer::Clock::time_point> _traced_contexts; /**< Start of the recording of the contexts writing a trace or a profile */
+    std::mutex                                                          _mtx;             /**< Protects the traced contexts */
 };
 } // namespace backends
 } // namespace graph
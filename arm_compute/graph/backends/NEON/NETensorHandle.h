@@ -53,6 +53,8 @@ public:
     // Inherited overridden methods
     void allocate() override;
     void free() override;
+    bool allocate_shared(const std::string &key) override;
+    void publish_shared(const std::string &key) override;
     void manage(IMemoryGroup *mg) override;
     void map(bool blocking) override;
     void                        unmap() override;
@@ -64,6 +64,21 @@ void allocate_all_output_tensors(INode &node);
  * @param[in] g Graph to allocate the tensors
  */
 void allocate_const_tensors(Graph &g);
+/** Allocates the const tensors of a graph sharing their data with the other graphs of the process
+ *
+ * Const tensors whose accessor identifies its data import the memory of the tensors of other graphs holding the same data,
+ * their accessor is then replaced by one which doesn't write the tensor.
+ *
+ * @param[in] g Graph to allocate the tensors
+ */
+void allocate_shared_const_tensors(Graph &g);
+/** Makes the data of the shared const tensors of a graph available to the other graphs
+ *
+ * @note Must be called once the const node accessors have been called
+ *
+ * @param[in] g Graph containing the const tensors
+ */
+void publish_shared_const_tensors(Graph &g);
 /** Allocates all tensors of a graph
  *
  * @param[in] g Graph to allocate the tensors
@@ -108,6 +123,8 @@ bool call_all_input_node_accessors(ExecutionWorkload &workload);
  */
 bool call_all_output_node_accessors(ExecutionWorkload &workload);
 /** Prepares all tasks for execution
+ *
+ * @note If requested by the configuration of the workload context, the weights prepared by the tasks are shared with the other graphs of the process
  *
  * @param[in] workload Workload to prepare
  */
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_GRAPH_DYNAMIC_BATCHER_H__
+#define __ARM_COMPUTE_GRAPH_DYNAMIC_BATCHER_H__
+
+#include "arm_compute/graph/ITensorAccessor.h"
+#include "arm_compute/graph/Types.h"
+#include "arm_compute/graph/frontend/Stream.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace frontend
+{
+/** Dynamic batching frontend
+ *
+ * Queues single-sample inference requests and packs up to @ref GraphConfig::max_batch_size of them
+ * into one execution of a stream that was finalized for that batch size.
+ * A stream is finalized for every power of two below the maximum batch size and for the maximum batch size itself;
+ * a partially filled batch runs on the smallest stream that can hold it and the unused samples are ignored.
+ *
+ * A batch is dispatched as soon as it is full or when the oldest queued request has waited for @ref GraphConfig::batching_timeout_us.
+ *
+ * @note The batch dimension must be the outermost dimension of both the input and the output tensors of the stream.
+ */
+class DynamicBatcher final
+{
+public:
+    /** Function used to build a stream for a given batch size
+     *
+     * The builder must add an input layer of @p batch_size samples using @p input_accessor and an output layer using @p output_accessor.
+     */
+    using StreamBuilder = std::function<void(Stream &stream, unsigned int batch_size, ITensorAccessorUPtr input_accessor, ITensorAccessorUPtr output_accessor)>;
+
+    /** Constructor
+     *
+     * Builds and finalizes a stream for each supported batch size and starts the dispatching thread.
+     * The streams are finalized with @ref GraphConfig::share_weights set so that they share a single copy of the weights.
+     *
+     * @param[in] target  Execution target
+     * @param[in] config  Graph configuration to use
+     * @param[in] builder Function used to build the stream for each batch size
+     */
+    DynamicBatcher(Target target, const GraphConfig &config, StreamBuilder builder);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    DynamicBatcher(const DynamicBatcher &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    DynamicBatcher &operator=(const DynamicBatcher &) = delete;
+    /** Destructor
+     *
+     * Executes any pending requests and stops the dispatching thread.
+     */
+    ~DynamicBatcher();
+    /** Enqueues an inference request
+     *
+     * @note Both buffers must remain valid until the returned future is ready.
+     *
+     * @param[in]  input  Densely packed input sample, in the shape and layout of a single sample of the stream input
+     * @param[out] output Buffer large enough to hold a densely packed single sample of the stream output
+     *
+     * @return A future that becomes ready once @p output has been written.
+     *         If the batcher is shutting down the future holds a std::runtime_error instead.
+     */
+    std::future<void> enqueue(const void *input, void *output);
+    /** Returns the batch sizes a stream has been finalized for
+     *
+     * @return Supported batch sizes in increasing order
+     */
+    const std::vector<unsigned int> &batch_sizes() const;
+
+private:
+    /** Queued inference request */
+    struct Request
+    {
+        const void                           *input;   /**< Input sample */
+        void                                 *output;  /**< Output sample */
+        std::promise<void>                    promise; /**< Promise fulfilled once the output is written */
+        std::chrono::steady_clock::time_point arrival; /**< Time the request was enqueued */
+    };
+
+    /** Dispatching thread entry point */
+    void dispatch();
+    /** Executes a batch of requests
+     *
+     * @param[in] batch Requests to execute
+     */
+    void run_batch(std::vector<Request> &batch);
+
+    std::vector<unsigned int>            _batch_sizes;   /**< Batch sizes the streams are finalized for */
+    std::vector<std::unique_ptr<Stream>> _streams;       /**< Finalized streams, one for each batch size */
+    std::vector<const void *>            _batch_inputs;  /**< Input samples of the batch under execution */
+    std::vector<void *>                  _batch_outputs; /**< Output samples of the batch under execution */
+    std::deque<Request>                  _queue;         /**< Pending requests */
+    std::mutex                           _mtx;           /**< Queue mutex */
+    std::condition_variable              _cv;            /**< Queue condition variable */
+    std::chrono::microseconds            _timeout;       /**< Maximum waiting time of the oldest request */
+    bool                                 _stop;          /**< Set when the dispatching thread must exit */
+    std::thread                          _dispatcher;    /**< Dispatching thread */
+};
+} // namespace frontend
+} // namespace graph
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_GRAPH_DYNAMIC_BATCHER_H__ */
@@ -67,6 +67,11 @@ public:
     void finalize(Target target, const GraphConfig &config);
     /** Executes the stream **/
     void run();
+    /** Returns the peak transition memory of the execution orders considered when finalizing the stream
+     *
+     * @return The peak transition memory of the depth first and memory aware execution orders
+     */
+    TransitionMemoryInfo transition_memory_info() const;
 
     // Inherited overridden methods
     void add_layer(ILayer &layer) override;
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_GRAPH_CHANNEL_SHUFFLE_FUSION_MUTATOR_H__
+#define __ARM_COMPUTE_GRAPH_CHANNEL_SHUFFLE_FUSION_MUTATOR_H__
+
+#include "arm_compute/graph/IGraphMutator.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace detail
+{
+/** Folds channel shuffle layers into the constant weights of a nearby convolution
+ *
+ * A shuffle feeding convolutions is removed by permuting the input channels of their weights,
+ * while a shuffle fed by a convolution is removed by permuting the output channels of its weights and biases.
+ * Batch normalization, activation and depthwise convolution nodes between the shuffle and the convolution are looked through
+ * by permuting their per channel parameters as well, provided their output is only read by the next node.
+ * Only convolutions whose weights and biases are produced by constant nodes, not shared with other nodes, are considered:
+ * a grouped convolution is only considered if the permutation keeps every channel within its group.
+ *
+ * @param[in] g Graph to perform the folding on
+ */
+void fold_channel_shuffle_into_convolution(Graph &g);
+} // namespace detail
+
+/** Mutation pass to remove channel shuffle layers by folding them into adjacent convolutions */
+class ChannelShuffleFusionMutator final : public IGraphMutator
+{
+public:
+    // Inherited methods overridden
+    virtual void mutate(Graph &g) override;
+    const char *name() override;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_GRAPH_CHANNEL_SHUFFLE_FUSION_MUTATOR_H__ */
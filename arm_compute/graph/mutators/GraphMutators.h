@@ -24,6 +24,7 @@
 #ifndef __ARM_COMPUTE_GRAPH_GRAPH_MUTATORS_H__
 #define __ARM_COMPUTE_GRAPH_GRAPH_MUTATORS_H__
 
+#include "arm_compute/graph/mutators/ChannelShuffleFusionMutator.h"
 #include "arm_compute/graph/mutators/DepthConcatSubTensorMutator.h"
 #include "arm_compute/graph/mutators/GroupedConvolutionMutator.h"
 #include "arm_compute/graph/mutators/InPlaceOperationMutator.h"
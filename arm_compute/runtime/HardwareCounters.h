@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_HARDWARECOUNTERS_H__
+#define __ARM_COMPUTE_HARDWARECOUNTERS_H__
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace arm_compute
+{
+/** Access to the CPU hardware counters of the calling thread
+ *
+ * The counters are opened through perf_event the first time a thread reads them and stay open until the thread exits.
+ * They only count user space events of the calling thread.
+ *
+ * @note Hardware counters are only available on Linux and Android. They might also be restricted by the system
+ *       (e.g. /proc/sys/kernel/perf_event_paranoid), in which case @ref HardwareCounters::read returns false.
+ */
+class HardwareCounters final
+{
+public:
+    /** Available counters */
+    enum class Counter : unsigned int
+    {
+        CYCLES,        /**< CPU cycles */
+        INSTRUCTIONS,  /**< Retired instructions */
+        L1D_MISSES,    /**< Level 1 data cache read misses */
+        LLC_MISSES,    /**< Last level cache misses */
+        BRANCH_MISSES, /**< Mispredicted branches */
+    };
+    /** Number of counters */
+    static constexpr size_t num_counters = 5;
+    /** Values of the counters, indexed by @ref Counter */
+    using Values = std::array<uint64_t, num_counters>;
+
+    /** Read the counters of the calling thread
+     *
+     * @note Counters which are not supported by the CPU are always 0.
+     *
+     * @param[out] values Current values of the counters.
+     *
+     * @return False if the hardware counters can't be accessed from the calling thread.
+     */
+    static bool read(Values &values);
+    /** Name of a counter
+     *
+     * @param[in] counter Counter.
+     *
+     * @return The name of the counter
+     */
+    static const char *name(Counter counter);
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_HARDWARECOUNTERS_H__ */
@@ -24,6 +24,8 @@
 #ifndef __ARM_COMPUTE_IFUNCTION_H__
 #define __ARM_COMPUTE_IFUNCTION_H__
 
+#include "arm_compute/runtime/Types.h"
+
 namespace arm_compute
 {
 /** Base class for all functions */
@@ -57,6 +59,18 @@ public:
     virtual void prepare()
     {
     }
+    /** Amount of work done by a run of the function for the configured shapes
+     *
+     * Used to report the efficiency of a function (e.g. achieved GFLOP/s, GB/s and arithmetic intensity).
+     *
+     * @note Must be called after the function has been configured.
+     *
+     * @return The cost of a run, or an empty cost if the function doesn't report it
+     */
+    virtual WorkloadCost cost() const
+    {
+        return WorkloadCost{};
+    }
 };
 }
 #endif /*__ARM_COMPUTE_IFUNCTION_H__ */
@@ -25,7 +25,6 @@
 #define __ARM_COMPUTE_NECANNYEDGE_H__
 
 #include "arm_compute/core/NEON/kernels/NECannyEdgeKernel.h"
-#include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
@@ -45,9 +44,9 @@ class ITensor;
  *  -# @ref NESobel3x3 (if gradient_size == 3) or
  *     @ref NESobel5x5 (if gradient_size == 5) or
  *     @ref NESobel7x7 (if gradient_size == 7)
- *  -# @ref NEGradientKernel
- *  -# @ref NEEdgeNonMaxSuppressionKernel
- *  -# @ref NEEdgeTraceKernel
+ *  -# @ref NEGradientNonMaxSuppressionKernel
+ *  -# @ref NEEdgeLabelKernel
+ *  -# @ref NEEdgeHysteresisKernel
  *
  */
 class NECannyEdge : public IFunction
@@ -84,19 +83,15 @@ public:
     void run() override;
 
 private:
-    MemoryGroup                   _memory_group;        /**< Function's memory group */
-    std::unique_ptr<IFunction>    _sobel;               /**< Pointer to Sobel kernel */
-    std::unique_ptr<INEKernel>    _gradient;            /**< Gradient kernel */
-    NEEdgeNonMaxSuppressionKernel _non_max_suppr;       /**< Non-Maxima suppression kernel */
-    NEEdgeTraceKernel             _edge_trace;          /**< Edge tracing kernel */
-    NEFillBorderKernel            _border_mag_gradient; /**< Fill border on magnitude tensor kernel */
-    NEFillBorderKernel            _border_edge_trace;   /**< Fill border before edge trace */
-    Tensor                        _gx;                  /**< Source tensor - Gx component */
-    Tensor                        _gy;                  /**< Source tensor - Gy component */
-    Tensor                        _magnitude;           /**< Source tensor - Magnitude */
-    Tensor                        _phase;               /**< Source tensor - Phase */
-    Tensor                        _nonmax;              /**< Source tensor - Non-Maxima suppressed */
-    ITensor                      *_output;              /**< Output tensor provided by the user. */
+    MemoryGroup                       _memory_group;           /**< Function's memory group */
+    std::unique_ptr<IFunction>        _sobel;                  /**< Pointer to Sobel kernel */
+    NEGradientNonMaxSuppressionKernel _gradient_non_max_suppr; /**< Gradient and Non-Maxima suppression kernel */
+    NEEdgeLabelKernel                 _edge_label;             /**< Edge labelling kernel */
+    NEEdgeHysteresisKernel            _edge_hysteresis;        /**< Hysteresis kernel */
+    Tensor                            _gx;                     /**< Source tensor - Gx component */
+    Tensor                            _gy;                     /**< Source tensor - Gy component */
+    Tensor                            _nonmax;                 /**< Source tensor - Non-Maxima suppressed */
+    Tensor                            _labels;                 /**< Source tensor - Labels of the candidate edges */
 };
 }
 #endif /* __ARM_COMPUTE_NECANNYEDGE_H */
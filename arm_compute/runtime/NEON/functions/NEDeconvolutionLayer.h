@@ -61,6 +61,7 @@ namespace arm_compute
  *
  * -# @ref NEDirectConvolutionLayer
  *
+ * @note @ref NEGEMMDeconvolutionLayer computes the same output without convolving the zeros inserted by the upsampling.
  */
 class NEDeconvolutionLayer : public IFunction
 {
@@ -24,14 +24,18 @@
 #ifndef __ARM_COMPUTE_NEON_DEPTHWISE_SEPARABLE_CONVOLUTION_H__
 #define __ARM_COMPUTE_NEON_DEPTHWISE_SEPARABLE_CONVOLUTION_H__
 
+#include "arm_compute/core/NEON/kernels/NEDepthwiseSeparableConvolutionLayerKernel.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/NEON/INESimpleFunction.h"
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEDepthwiseConvolutionLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEDirectConvolutionLayer.h"
 #include "arm_compute/runtime/Tensor.h"
 
 #include <cstdint>
+#include <memory>
 
 namespace arm_compute
 {
@@ -39,16 +43,27 @@ class ITensor;
 
 /** Basic function to execute depthwise convolution. This function calls the following NEON kernels and function:
  *
+ * If the data layout is NHWC, the pointwise convolution has unit strides and no padding and the activations are rectifiers:
+ * -# @ref NEDepthwiseSeparableConvolutionLayerKernel
+ *
+ * Otherwise:
  * -# @ref NEDepthwiseConvolutionLayer
+ * -# @ref NEActivationLayer (if the depthwise activation is enabled)
  * -# @ref NEDirectConvolutionLayer
  *
+ * @note Batch normalization layers following the convolutions are expected to be folded into the respective weights and biases.
  */
 class NEDepthwiseSeparableConvolutionLayer : public IFunction
 {
 public:
-    /** Default constructor */
-    NEDepthwiseSeparableConvolutionLayer();
+    /** Constructor
+     *
+     * @param[in] memory_manager (Optional) Memory manager used by the pointwise convolution when the stages are not fused
+     */
+    NEDepthwiseSeparableConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
     /** Set the input and output tensors.
+     *
+     * @note When the fused kernel is used, the depthwise result is never stored and @p depthwise_out is only auto-initialized.
      *
      * @param[in]  input               Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
      *                                 while every optional dimension from 4 and above represent a batch of inputs. Data types supported: F32.
@@ -63,18 +78,25 @@ public:
      *                                 Data types supported: Same as @p input.
      * @param[in]  depthwise_conv_info Contains padding and stride information described in @ref PadStrideInfo for depthwise convolution.
      * @param[in]  pointwise_conv_info Contains padding and stride information described in @ref PadStrideInfo for pointwise convolution.
+     * @param[in]  depthwise_act_info  (Optional) Activation layer information applied to the depthwise result.
+     * @param[in]  pointwise_act_info  (Optional) Activation layer information applied to the pointwise result.
      */
     void configure(ITensor *input, const ITensor *depthwise_weights, const ITensor *depthwise_biases, ITensor *depthwise_out,
                    const ITensor *pointwise_weights, const ITensor *pointwise_biases, ITensor *output,
-                   const PadStrideInfo &depthwise_conv_info, const PadStrideInfo &pointwise_conv_info);
+                   const PadStrideInfo &depthwise_conv_info, const PadStrideInfo &pointwise_conv_info,
+                   const ActivationLayerInfo &depthwise_act_info = ActivationLayerInfo(), const ActivationLayerInfo &pointwise_act_info = ActivationLayerInfo());
 
     // Inherited methods overriden:
     void run() override;
     void prepare() override;
 
 private:
-    NEDepthwiseConvolutionLayer _depthwise_conv;
-    NEDirectConvolutionLayer    _pointwise_conv;
+    NEDepthwiseConvolutionLayer                _depthwise_conv;
+    NEActivationLayer                          _depthwise_act;
+    NEDirectConvolutionLayer                   _pointwise_conv;
+    NEDepthwiseSeparableConvolutionLayerKernel _fused_kernel;
+    bool                                       _is_fused;
+    bool                                       _run_depthwise_act;
 };
 }
 #endif /*__ARM_COMPUTE_NEON_DEPTHWISE_SEPARABLE_CONVOLUTION_H__ */
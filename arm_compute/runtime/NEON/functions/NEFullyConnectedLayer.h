@@ -120,8 +120,9 @@ public:
                            FullyConnectedLayerInfo fc_info = FullyConnectedLayerInfo());
 
     //Inherited methods override
-    void run() override;
-    void prepare() override;
+    void         run() override;
+    void         prepare() override;
+    WorkloadCost cost() const override;
 
 private:
     void configure_fc_fc(const ITensor *input, const ITensor *weights, ITensor *output);
@@ -141,6 +142,7 @@ private:
     Tensor                                              _converted_weights_output;
     Tensor                                              _reshape_weights_output;
     const ITensor                                      *_original_weights;
+    WorkloadCost                                        _cost;
     bool                                                _are_weights_converted;
     bool                                                _are_weights_reshaped;
     bool                                                _is_fc_after_conv;
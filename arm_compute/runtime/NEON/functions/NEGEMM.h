@@ -91,8 +91,9 @@ public:
     static Status validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *c, const ITensorInfo *output, float alpha, float beta, const GEMMInfo &gemm_info = GEMMInfo());
 
     // Inherited methods overridden:
-    void run() override;
-    void prepare() override;
+    void         run() override;
+    void         prepare() override;
+    WorkloadCost cost() const override;
 
 private:
     MemoryGroup                _memory_group;
@@ -108,6 +109,7 @@ private:
     bool                       _run_addition;
     bool                       _reshape_b_only_on_first_run;
     bool                       _is_prepared;
+    WorkloadCost               _cost;
 };
 } // namespace arm_compute
 #endif /*__ARM_COMPUTE_NEGEMM_H__ */
@@ -25,6 +25,7 @@
 #define __ARM_COMPUTE_NEGEMMASSEMBLYDISPATCH_H__
 
 #include "arm_compute/core/NEON/kernels/assembly/NEGEMMAssemblyWrapperKernel.h"
+#include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
@@ -104,6 +105,36 @@ public:
      * @return a status.
      */
     static Status validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, float alpha, float beta, bool pretranspose_hint);
+    /** Create an arm_gemm function which gathers the rows of Matrix A directly from a convolution input (implicit GEMM),
+     *  so that no im2col buffer has to be materialised.
+     *
+     * @note Matrix A is never allocated: its rows are the output points (x fastest) and its columns follow the @ref NEIm2ColKernel ordering.
+     *
+     * @param[in]  input        Convolution input tensor. 3 lower dimensions represent a single input [width, height, IFM] (NCHW) or [IFM, width, height] (NHWC),
+     *                          the fourth dimension represents the batch. Data types supported: F16/F32.
+     * @param[in]  b            Input tensor (Matrix B): the weights reshaped by @ref NEWeightsReshapeKernel. Data type supported: same as @p input.
+     * @param[out] d            Output tensor to store the result of matrix multiplication. Dimension 1 and the dimensions above it are interpreted
+     *                          as the rows of the output points, e.g. [OFM, conv_w, conv_h, batches] or [OFM, conv_w * conv_h, 1, batches]. Data type supported: same as @p input.
+     * @param[in]  kernel_dims  The kernel dimensions (width and height).
+     * @param[in]  conv_info    Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  dilation     Dilation, in elements, across x and y.
+     * @param[in]  append_bias  True if @p b contains the biases as its last row.
+     */
+    void configure_convolution(const ITensor *input, const ITensor *b, ITensor *d, const Size2D &kernel_dims, const PadStrideInfo &conv_info, const Size2D &dilation, bool append_bias);
+    /** Indicates whether or not an implicit GEMM convolution can be used to process the given parameters.
+     *
+     * @param[in] input       Convolution input tensor info. Data types supported: F16/F32.
+     * @param[in] b           Input tensor info (Matrix B). Data type supported: same as @p input.
+     * @param[in] d           Output tensor info. Data type supported: same as @p input.
+     * @param[in] kernel_dims The kernel dimensions (width and height).
+     * @param[in] conv_info   Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] dilation    Dilation, in elements, across x and y.
+     * @param[in] append_bias True if @p b contains the biases as its last row.
+     *
+     * @return a status.
+     */
+    static Status validate_convolution(const ITensorInfo *input, const ITensorInfo *b, const ITensorInfo *d, const Size2D &kernel_dims, const PadStrideInfo &conv_info, const Size2D &dilation,
+                                       bool append_bias);
     /** Was the function successfully configured ?
      *
      * @return True if the function is configured and ready to run
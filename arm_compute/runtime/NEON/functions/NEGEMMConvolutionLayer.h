@@ -35,6 +35,7 @@
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMLowpMatrixMultiplyCore.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMLowpOutputStage.h"
 #include "arm_compute/runtime/NEON/functions/NEReshapeLayer.h"
@@ -56,20 +57,22 @@ public:
     NEConvolutionLayerReshapeWeights();
     /** Set the input and output tensors.
      *
-     * @param[in]  weights Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: QASYMM8/F16/F32.
-     * @param[in]  biases  Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p weights.
-     * @param[out] output  Destination tensor. Data types supported: Same as @p weights.
+     * @param[in]  weights    Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: QASYMM8/F16/F32.
+     * @param[in]  biases     Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p weights.
+     * @param[out] output     Destination tensor. Data types supported: Same as @p weights.
+     * @param[in]  num_groups (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is only supported for NCHW data layout
      */
-    void configure(const ITensor *weights, const ITensor *biases, ITensor *output);
+    void configure(const ITensor *weights, const ITensor *biases, ITensor *output, unsigned int num_groups = 1);
     /** Static function to check if given info will lead to a valid configuration of @ref NEConvolutionLayerReshapeWeights
      *
-     * @param[in] weights Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: QASYMM8/F16/F32.
-     * @param[in] biases  Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p weights.
-     * @param[in] output  Destination tensor. Data types supported: Same as @p weights.
+     * @param[in] weights    Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: QASYMM8/F16/F32.
+     * @param[in] biases     Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p weights.
+     * @param[in] output     Destination tensor. Data types supported: Same as @p weights.
+     * @param[in] num_groups (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is only supported for NCHW data layout
      *
      * @return an error status
      */
-    static Status validate(const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output);
+    static Status validate(const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, unsigned int num_groups = 1);
 
     // Inherited methods overridden:
     void run() override;
@@ -80,8 +83,10 @@ private:
 
 /** Basic function to compute the convolution layer. This function calls the following NEON kernels/functions:
  *
- * -# @ref NEIm2ColKernel
- * -# @ref NEGEMM (if the data type is FP32 or FP16)
+ * -# @ref NEIm2ColKernel (if an implicit GEMM isn't enabled or can't be used)
+ * -# @ref NEGEMM (if the data type is FP32 or FP16 and an implicit GEMM isn't enabled or can't be used)
+ * -# @ref NEGEMMAssemblyDispatch (if an implicit GEMM is enabled and the data type is FP32 or FP16: gathers the patches straight from the input, no im2col buffer is allocated)
+ * -# @ref NEGEMMAssemblyDispatch (if num_groups != 1: all the groups are computed by a single GEMM, one multi per group)
  * -# @ref NEGEMMLowpMatrixMultiplyCore (if the data type is QASYMM8)
  * -# @ref NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPoint (if the data type is QASYMM8)
  * -# @ref NEArithmeticAdditionKernel (if biases != nullptr and we have a 1x1 convolution with the NHWC data layout)
@@ -103,48 +108,61 @@ public:
     NEGEMMConvolutionLayer &operator=(NEGEMMConvolutionLayer &&) = default;
     /** Set the input and output tensors.
      *
-     * @param[in]  input        Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
-     *                          while every optional dimension from 4 and above represent a batch of inputs.
-     *                          Data types supported: QASYMM8/F32.
-     * @param[in]  weights      Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input.
-     * @param[in]  biases       Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
-     *                          Data type supported: Should match @p input data type, except for input of QASYMM8 type where biases should be of S32 type.
-     * @param[out] output       Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
-     *                          Data types supported: Same as @p input.
-     * @param[in]  conv_info    Contains padding and stride information described in @ref PadStrideInfo.
-     * @param[in]  weights_info Specifies if the weights tensor has been reshaped with NEWeightsReshapeKernel. If this is not part of the fully connected layer the weights
-     *                          tensor has also been transposed with NEGEMMTranspose1xWKernel. Data type supported: Same as @p input.
-     * @param[in]  dilation     (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
-     * @param[in]  act_info     (Optional) Activation layer information in case of a fused activation. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU supported.
-     * @param[in]  num_groups   (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     * @param[in]  input         Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                           while every optional dimension from 4 and above represent a batch of inputs.
+     *                           Data types supported: QASYMM8/F32.
+     * @param[in]  weights       Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM / num_groups, OFM]. Data type supported: Same as @p input.
+     * @param[in]  biases        Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
+     *                           Data type supported: Should match @p input data type, except for input of QASYMM8 type where biases should be of S32 type.
+     * @param[out] output        Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
+     *                           Data types supported: Same as @p input.
+     * @param[in]  conv_info     Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  weights_info  Specifies if the weights tensor has been reshaped with NEWeightsReshapeKernel. If this is not part of the fully connected layer the weights
+     *                           tensor has also been transposed with NEGEMMTranspose1xWKernel. Data type supported: Same as @p input.
+     * @param[in]  dilation      (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
+     * @param[in]  act_info      (Optional) Activation layer information in case of a fused activation. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU supported.
+     * @param[in]  num_groups    (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is only supported for NCHW data layout and F16/F32
+     * @param[in]  implicit_gemm (Optional) Gather the GEMM input straight from @p input instead of running im2col, if an arm_gemm kernel supports it for this convolution.
+     *                           Only ungrouped F16/F32 convolutions are supported, im2col is used otherwise. Defaults to false.
      */
     void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info = WeightsInfo(),
-                   const Size2D &dilation = Size2D(1U, 1U), const ActivationLayerInfo &act_info = ActivationLayerInfo(), unsigned int num_groups = 1);
+                   const Size2D &dilation = Size2D(1U, 1U), const ActivationLayerInfo &act_info = ActivationLayerInfo(), unsigned int num_groups = 1, bool implicit_gemm = false);
     /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMConvolutionLayer
      *
-     * @param[in] input        Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
-     *                         while every optional dimension from 4 and above represent a batch of inputs.
-     *                         Data types supported: QASYMM8/F16/F32.
-     * @param[in] weights      Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported:Same as @p input.
-     * @param[in] biases       Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
-     *                         Data type supported: Should match @p input data type, except for input of QASYMM8 type where biases should be of S32 type.
-     * @param[in] output       Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
-     *                         Data types supported: Same as @p input.
-     * @param[in] conv_info    Contains padding and stride information described in @ref PadStrideInfo.
-     * @param[in] weights_info Specifies if the weights tensor has been reshaped with NEWeightsReshapeKernel. If this is not part of the fully connected layer the weights
-     *                         tensor has also been transposed with NEGEMMTranspose1xWKernel. Data type supported: Same as @p input.
-     * @param[in] dilation     (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
-     * @param[in] act_info     (Optional) Activation layer information in case of a fused activation. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU supported.
-     * @param[in] num_groups   (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     * @param[in] input         Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                          while every optional dimension from 4 and above represent a batch of inputs.
+     *                          Data types supported: QASYMM8/F16/F32.
+     * @param[in] weights       Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM / num_groups, OFM]. Data type supported:Same as @p input.
+     * @param[in] biases        Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM].
+     *                          Data type supported: Should match @p input data type, except for input of QASYMM8 type where biases should be of S32 type.
+     * @param[in] output        Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
+     *                          Data types supported: Same as @p input.
+     * @param[in] conv_info     Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] weights_info  Specifies if the weights tensor has been reshaped with NEWeightsReshapeKernel. If this is not part of the fully connected layer the weights
+     *                          tensor has also been transposed with NEGEMMTranspose1xWKernel. Data type supported: Same as @p input.
+     * @param[in] dilation      (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
+     * @param[in] act_info      (Optional) Activation layer information in case of a fused activation. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU supported.
+     * @param[in] num_groups    (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is only supported for NCHW data layout and F16/F32
+     * @param[in] implicit_gemm (Optional) Gather the GEMM input straight from @p input instead of running im2col, if an arm_gemm kernel supports it for this convolution.
+     *                          Only ungrouped F16/F32 convolutions are supported, im2col is used otherwise. Defaults to false.
      *
      * @return a status
      */
     static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
-                           const WeightsInfo &weights_info = WeightsInfo(), const Size2D &dilation = Size2D(1U, 1U), const ActivationLayerInfo &act_info = ActivationLayerInfo(), unsigned int num_groups = 1);
+                           const WeightsInfo &weights_info = WeightsInfo(), const Size2D &dilation = Size2D(1U, 1U), const ActivationLayerInfo &act_info = ActivationLayerInfo(), unsigned int num_groups = 1,
+                           bool implicit_gemm = false);
+    /** Was the implicit GEMM path selected by configure() ?
+     *
+     * @note The implicit GEMM is only used if it was requested and an arm_gemm kernel can gather the GEMM input for this convolution, im2col is used otherwise.
+     *
+     * @return True if the GEMM gathers its input straight from the convolution input, without running im2col
+     */
+    bool is_implicit_gemm() const;
 
     // Inherited methods overridden:
-    void run() override;
-    void prepare() override;
+    void         run() override;
+    void         prepare() override;
+    WorkloadCost cost() const override;
 
 private:
     /** Configures the appropriate matrix multiply routine
@@ -177,12 +195,26 @@ private:
      * @return a status
      */
     static Status validate_gemm3d(DataType data_type, int gemm_3d_depth, bool skip_im2col);
+    /** Static function to check if the GEMM input can be gathered straight from the convolution input (implicit GEMM) with @ref NEGEMMAssemblyDispatch
+     *
+     * @param[in] input       Source tensor info. Data types supported: QASYMM8/F16/F32.
+     * @param[in] weights     Weights tensor info. Data type supported: Same as @p input.
+     * @param[in] output      Destination tensor info. Data types supported: Same as @p input.
+     * @param[in] conv_info   Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] dilation    Dilation, in elements, across x and y.
+     * @param[in] append_bias True if the biases are appended to the reshaped weights.
+     *
+     * @return a status
+     */
+    static Status validate_implicit_gemm(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info, const Size2D &dilation, bool append_bias);
 
 private:
     MemoryGroup                                         _memory_group;
     NEConvolutionLayerReshapeWeights                    _reshape_weights;
     NEIm2ColKernel                                      _im2col_kernel;
     NEGEMM                                              _mm_gemm;
+    NEGEMMAssemblyDispatch                              _mm_implicit_gemm;
+    NEGEMMAssemblyDispatch                              _mm_grouped_gemm;
     NEGEMMLowpMatrixMultiplyCore                        _mm_gemmlowp;
     NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPoint _gemmlowp_output_stage;
     NECol2ImKernel                                      _col2im_kernel;
@@ -197,11 +229,14 @@ private:
     Tensor _gemm_output;
     Tensor _tmp_output;
 
-    DataLayout _data_layout;
+    DataLayout   _data_layout;
+    unsigned int _num_groups;
+    WorkloadCost _cost;
 
     bool _append_bias;
     bool _skip_im2col;
     bool _skip_col2im;
+    bool _use_implicit_gemm;
     bool _is_quantized;
     bool _is_activationlayer_enabled;
     bool _is_prepared;
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEGEMMDECONVOLUTIONLAYER_H__
+#define __ARM_COMPUTE_NEGEMMDECONVOLUTIONLAYER_H__
+
+#include "arm_compute/core/NEON/kernels/NEDeconvolutionCol2ImKernel.h"
+#include "arm_compute/core/NEON/kernels/NEDeconvolutionWeightsReshapeKernel.h"
+#include "arm_compute/core/NEON/kernels/NEIm2ColKernel.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Function to run the deconvolution layer as a GEMM followed by a col2im accumulation.
+ *
+ * Unlike @ref NEDeconvolutionLayer, which convolves an upsampled copy of the input where only 1 / (stride_x * stride_y) of the elements are non-zero,
+ * this function only computes the non-zero contributions: every input pixel is multiplied by all the weights at once, then each output value gathers
+ * the contributions of the input pixels whose kernel footprint covers it. The number of multiply-accumulates is therefore independent of the strides
+ * and no upsampled tensor is ever allocated.
+ *
+ * The output dimensions are the same as the ones of @ref NEDeconvolutionLayer.
+ *
+ * This function calls the following NEON kernels/functions:
+ *
+ * -# @ref NEIm2ColKernel (1x1, to lay the input out as a [IFM, width * height] matrix)
+ * -# @ref NEDeconvolutionWeightsReshapeKernel (executed only once)
+ * -# @ref NEGEMM
+ * -# @ref NEDeconvolutionCol2ImKernel
+ *
+ */
+class NEGEMMDeconvolutionLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NEGEMMDeconvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMDeconvolutionLayer(const NEGEMMDeconvolutionLayer &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMDeconvolutionLayer &operator=(const NEGEMMDeconvolutionLayer &) = delete;
+    /** Allow instances of this class to be moved */
+    NEGEMMDeconvolutionLayer(NEGEMMDeconvolutionLayer &&) = default;
+    /** Allow instances of this class to be moved */
+    NEGEMMDeconvolutionLayer &operator=(NEGEMMDeconvolutionLayer &&) = default;
+    /** Default destructor */
+    virtual ~NEGEMMDeconvolutionLayer() = default;
+    /** Set the input, weights, biases and output tensors.
+     *
+     * @param[in]  input              Input tensor. 3 lower dimensions represent a single input, and an optional 4th dimension for batch of inputs. Data types supported: F32.
+     * @param[in]  weights            The 4d weights with dimensions [width, height, IFM, OFM]. Data type supported: Same as @p input.
+     * @param[in]  bias               Optional, ignored if NULL. The biases have one dimension. Data type supported: Same as @p input.
+     * @param[out] output             Output tensor. The output has the same number of dimensions as the @p input.
+     * @param[in]  info               Contains padding and policies to be used in the deconvolution, this is decribed in @ref PadStrideInfo.
+     * @param[in]  inner_border_right The number of zeros added to right edge of the input.
+     * @param[in]  inner_border_top   The number of zeros added to top edge of the input.
+     *
+     */
+    void configure(const ITensor *input, const ITensor *weights, const ITensor *bias, ITensor *output, const PadStrideInfo &info,
+                   unsigned int inner_border_right, unsigned int inner_border_top);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMDeconvolutionLayer
+     *
+     * @param[in] input              Input tensor info. 3 lower dimensions represent a single input, and an optional 4th dimension for batch of inputs. Data types supported: F32.
+     * @param[in] weights            The 4d weights info with dimensions [width, height, IFM, OFM]. Data type supported: Same as @p input.
+     * @param[in] bias               (Optional) The biases have one dimension. Data type supported: Same as @p input.
+     * @param[in] output             Output tensor info. The output has the same number of dimensions as the @p input.
+     * @param[in] info               Contains padding and policies to be used in the deconvolution, this is decribed in @ref PadStrideInfo.
+     * @param[in] inner_border_right The number of zeros added to right edge of the input.
+     * @param[in] inner_border_top   The number of zeros added to top edge of the input.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *bias, const ITensorInfo *output, const PadStrideInfo &info,
+                           unsigned int inner_border_right, unsigned int inner_border_top);
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    MemoryGroup                         _memory_group;
+    NEIm2ColKernel                      _im2col_kernel;
+    NEDeconvolutionWeightsReshapeKernel _reshape_weights_kernel;
+    NEGEMM                              _mm_gemm;
+    NEDeconvolutionCol2ImKernel         _col2im_kernel;
+    const ITensor                      *_original_weights;
+    Tensor                              _im2col_output;
+    Tensor                              _weights_reshaped;
+    Tensor                              _gemm_output;
+    bool                                _is_prepared;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_NEGEMMDECONVOLUTIONLAYER_H__ */
@@ -75,14 +75,16 @@ protected:
 
 /** Basic function to execute gaussian pyramid with HALF scale factor. This function calls the following NEON kernels:
  *
- * -# @ref NEFillBorderKernel (executed if border_mode == CONSTANT or border_mode == REPLICATE)
- * -# @ref NEGaussianPyramidHorKernel
- * -# @ref NEGaussianPyramidVertKernel
+ * -# @ref NEGaussianPyramidHalfKernel
  *
+ * Each kernel computes up to @ref max_levels_per_pass levels in a single pass over the image.
  */
 class NEGaussianPyramidHalf : public NEGaussianPyramid
 {
 public:
+    /** Maximum number of levels computed per pass over the image */
+    static constexpr size_t max_levels_per_pass = 3;
+
     /** Constructor */
     NEGaussianPyramidHalf();
 
@@ -91,10 +93,8 @@ public:
     void run() override;
 
 private:
-    std::unique_ptr<NEFillBorderKernel[]>          _horizontal_border_handler;
-    std::unique_ptr<NEFillBorderKernel[]>          _vertical_border_handler;
-    std::unique_ptr<NEGaussianPyramidHorKernel[]>  _horizontal_reduction;
-    std::unique_ptr<NEGaussianPyramidVertKernel[]> _vertical_reduction;
+    std::unique_ptr<NEGaussianPyramidHalfKernel[]> _pyramid_kernels;
+    size_t                                         _num_passes;
 };
 
 /** Basic function to execute gaussian pyramid with ORB scale factor. This function calls the following NEON kernels and functions:
@@ -53,9 +53,7 @@ public:
 
 private:
     NEHistogramKernel           _histogram_kernel;
-    std::unique_ptr<uint32_t[]> _local_hist;
     std::unique_ptr<uint32_t[]> _window_lut;
-    size_t                      _local_hist_size;
     /** 256 possible pixel values as we handle only U8 images */
     static constexpr unsigned int window_lut_default_size = 256;
 };
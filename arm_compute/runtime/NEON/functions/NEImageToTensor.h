@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEIMAGETOTENSOR_H__
+#define __ARM_COMPUTE_NEIMAGETOTENSOR_H__
+
+#include "arm_compute/core/NEON/kernels/NEImageToTensorKernel.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+
+namespace arm_compute
+{
+class IMultiImage;
+class ITensor;
+using IImage = ITensor;
+
+/** Basic function to run @ref NEImageToTensorKernel
+ *
+ * Prepares the input tensor of a network from an image in a single pass: resize, colour conversion, normalisation and layout conversion are fused.
+ * The output rows are distributed across the threads of the scheduler.
+ */
+class NEImageToTensor : public IFunction
+{
+public:
+    /** Default constructor */
+    NEImageToTensor();
+    /** Initialise the function's source and destination
+     *
+     * @param[in]  input  Single-planar source image. Formats supported: RGB888/YUYV422/UYVY422
+     * @param[out] output Destination tensor with shape [width, height, 3] (NCHW) or [3, width, height] (NHWC). Data types supported: QASYMM8/F32
+     * @param[in]  info   (Optional) Normalisation, channel order and interpolation policy.
+     */
+    void configure(const IImage *input, ITensor *output, const ImageToTensorInfo &info = ImageToTensorInfo());
+    /** Initialise the function's source and destination
+     *
+     * @param[in]  input  Multi-planar source image. Formats supported: NV12/NV21
+     * @param[out] output Destination tensor with shape [width, height, 3] (NCHW) or [3, width, height] (NHWC). Data types supported: QASYMM8/F32
+     * @param[in]  info   (Optional) Normalisation, channel order and interpolation policy.
+     */
+    void configure(const IMultiImage *input, ITensor *output, const ImageToTensorInfo &info = ImageToTensorInfo());
+    /** Static function to check if given info will lead to a valid configuration of @ref NEImageToTensor
+     *
+     * @param[in] input  Single-planar source image info. Formats supported: RGB888/YUYV422/UYVY422
+     * @param[in] output Destination tensor info with shape [width, height, 3] (NCHW) or [3, width, height] (NHWC). Data types supported: QASYMM8/F32
+     * @param[in] info   (Optional) Normalisation, channel order and interpolation policy.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const ImageToTensorInfo &info = ImageToTensorInfo());
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    NEImageToTensorKernel _kernel;
+};
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEIMAGETOTENSOR_H__ */
@@ -24,22 +24,38 @@
 #ifndef __ARM_COMPUTE_NEINTEGRALIMAGE_H__
 #define __ARM_COMPUTE_NEINTEGRALIMAGE_H__
 
-#include "arm_compute/runtime/NEON/INESimpleFunction.h"
+#include "arm_compute/core/NEON/kernels/NEIntegralImageKernel.h"
+#include "arm_compute/runtime/IFunction.h"
 
 namespace arm_compute
 {
 class ITensor;
 
-/** Basic function to run a @ref NEIntegralImageKernel */
-class NEIntegralImage : public INESimpleFunction
+/** Basic function to compute an image integral on NEON. This function calls the following NEON kernels:
+ *
+ *  -# @ref NEIntegralImageHorKernel (split between the threads by rows)
+ *  -# @ref NEIntegralImageVertKernel (split between the threads by columns)
+ *
+ */
+class NEIntegralImage : public IFunction
 {
 public:
-    /** Initialise the function's source, destinations and border mode.
+    /** Default Constructor. */
+    NEIntegralImage();
+    /** Initialise the function's source and destinations.
      *
-     * @param[in]  input  Source tensor. Data type supported: U8.
-     * @param[out] output Destination tensor. Data type supported: U32.
+     * @param[in]  input          Source tensor. Data type supported: U8.
+     * @param[out] output         Destination tensor. Data type supported: U32.
+     * @param[out] output_squared (Optional) Destination tensor of the integral of the squared pixels. Data type supported: U64.
      */
-    void configure(const ITensor *input, ITensor *output);
+    void configure(const ITensor *input, ITensor *output, ITensor *output_squared = nullptr);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    NEIntegralImageHorKernel  _integral_hor;  /**< Integral Image Horizontal kernel */
+    NEIntegralImageVertKernel _integral_vert; /**< Integral Image Vertical kernel */
 };
 }
 #endif /*__ARM_COMPUTE_NEINTEGRALIMAGE_H__ */
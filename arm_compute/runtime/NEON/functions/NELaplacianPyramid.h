@@ -24,12 +24,9 @@
 #ifndef __ARM_COMPUTE_NELAPLACIANPYRAMID_H__
 #define __ARM_COMPUTE_NELAPLACIANPYRAMID_H__
 
+#include "arm_compute/core/NEON/kernels/NELaplacianPyramidKernel.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
-#include "arm_compute/runtime/NEON/functions/NEArithmeticSubtraction.h"
-#include "arm_compute/runtime/NEON/functions/NEDepthConvertLayer.h"
-#include "arm_compute/runtime/NEON/functions/NEGaussian5x5.h"
-#include "arm_compute/runtime/NEON/functions/NEGaussianPyramid.h"
 #include "arm_compute/runtime/Pyramid.h"
 
 #include <cstddef>
@@ -40,16 +37,16 @@ namespace arm_compute
 {
 class ITensor;
 
-/** Basic function to execute laplacian pyramid. This function calls the following NEON kernels and functions:
+/** Basic function to execute laplacian pyramid. This function calls the following NEON kernels:
  *
- * -# @ref NEGaussianPyramidHalf
- * -# @ref NEGaussian5x5
- * -# @ref NEArithmeticSubtraction
+ * -# @ref NELaplacianPyramidKernel
  *
- *  First a Gaussian pyramid is created. Then, for each level i, the corresponding tensor I(i) is blurred with the Gaussian 5x5 filter, and then
+ *  For each level i, the corresponding tensor I(i) of the Gaussian pyramid is blurred with the Gaussian 5x5 filter, and then
  *  difference between the two tensors is the corresponding level L(i) of the Laplacian pyramid.
  *  L(i) = I(i) - Gaussian5x5(I(i))
  *  Level 0 has always the same first two dimensions as the input tensor.
+ *
+ *  The blur, the subtraction and the decimation into I(i + 1) are computed in a single pass over I(i), so the blurred tensors are never stored.
 */
 class NELaplacianPyramid : public IFunction
 {
@@ -73,13 +70,9 @@ public:
     void run() override;
 
 private:
-    size_t                                     _num_levels;
-    NEGaussianPyramidHalf                      _gaussian_pyr_function;
-    std::unique_ptr<NEGaussian5x5[]>           _convf;
-    std::unique_ptr<NEArithmeticSubtraction[]> _subf;
-    Pyramid                                    _gauss_pyr;
-    Pyramid                                    _conv_pyr;
-    NEDepthConvertLayer                        _depth_function;
+    size_t                                      _num_levels;
+    std::unique_ptr<NELaplacianPyramidKernel[]> _laplacian_kernels;
+    Pyramid                                     _gauss_pyr;
 };
 }
 #endif /*__ARM_COMPUTE_NELAPLACIANPYRAMID_H__ */
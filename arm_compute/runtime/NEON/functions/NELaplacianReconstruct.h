@@ -24,13 +24,12 @@
 #ifndef __ARM_COMPUTE_NELAPLACIANRECONSTRUCT_H__
 #define __ARM_COMPUTE_NELAPLACIANRECONSTRUCT_H__
 
+#include "arm_compute/core/NEON/kernels/NELaplacianPyramidKernel.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
-#include "arm_compute/runtime/NEON/functions/NEArithmeticAddition.h"
-#include "arm_compute/runtime/NEON/functions/NEDepthConvertLayer.h"
-#include "arm_compute/runtime/NEON/functions/NEScale.h"
 #include "arm_compute/runtime/Pyramid.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 
@@ -39,11 +38,9 @@ namespace arm_compute
 class ITensor;
 using IImage = ITensor;
 
-/** Basic function to execute laplacian reconstruction. This function calls the following NEON kernels and functions:
+/** Basic function to execute laplacian reconstruction. This function calls the following NEON kernels:
  *
- * -# @ref NEArithmeticAddition
- * -# @ref NEScale
- * -# @ref NEDepthConvertLayer
+ * -# @ref NELaplacianReconstructKernel
  *
  * This function reconstructs the original image from a Laplacian Image Pyramid.
  *
@@ -56,6 +53,9 @@ using IImage = ITensor;
  *  I(i-1) = upsample(I(i) + L(i))
  *
  *  output = I(0) + L(0)
+ *
+ *  Each level is computed in a single pass: the upsampling, the addition and, for the output, the conversion to U8 are fused.
+ *  The addition input + L(n-1) is fused in the upsampling of the first pass, so neither I(n-1) nor I(0) is stored.
 */
 class NELaplacianReconstruct : public IFunction
 {
@@ -75,6 +75,8 @@ public:
      * @param[in]  border_mode           Border mode to use for the convolution.
      * @param[in]  constant_border_value (Optional) Constant value to use for borders if border_mode is set to CONSTANT.
      *
+     * @note The nearest neighbour upsampling of a half scale pyramid never samples outside the image, so the border mode has no effect.
+     *
      */
     void configure(const IPyramid *pyramid, ITensor *input, ITensor *output, BorderMode border_mode, uint8_t constant_border_value);
 
@@ -82,10 +84,9 @@ public:
     void run() override;
 
 private:
-    Pyramid                                 _tmp_pyr;
-    std::unique_ptr<NEArithmeticAddition[]> _addf;
-    std::unique_ptr<NEScale[]>              _scalef;
-    NEDepthConvertLayer                     _depthf;
+    size_t                                          _num_kernels;
+    std::unique_ptr<NELaplacianReconstructKernel[]> _reconstruct_kernels;
+    Pyramid                                         _tmp_pyr;
 };
 }
 #endif /*__ARM_COMPUTE_NELAPLACIANRECONSTRUCT_H__ */
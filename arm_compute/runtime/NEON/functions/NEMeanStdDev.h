@@ -57,8 +57,6 @@ public:
 private:
     NEMeanStdDevKernel _mean_stddev_kernel; /**< Kernel that standard deviation calculation. */
     NEFillBorderKernel _fill_border_kernel; /**< Kernel that fills tensor's borders with zeroes. */
-    uint64_t           _global_sum;         /**< Variable that holds the global sum among calls in order to ease reduction */
-    uint64_t           _global_sum_squared; /**< Variable that holds the global sum of squared values among calls in order to ease reduction */
 };
 }
 #endif /*__ARM_COMPUTE_NEMEANSTDDEV_H__ */
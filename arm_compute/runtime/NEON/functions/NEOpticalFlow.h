@@ -25,13 +25,14 @@
 #define __ARM_COMPUTE_NEOPTICALFLOW_H__
 
 #include "arm_compute/core/IArray.h"
+#include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
 #include "arm_compute/core/NEON/kernels/NELKTrackerKernel.h"
+#include "arm_compute/core/NEON/kernels/NEScharr3x3Kernel.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/Array.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
-#include "arm_compute/runtime/NEON/functions/NEScharr3x3.h"
 #include "arm_compute/runtime/Tensor.h"
 
 #include <cstddef>
@@ -44,11 +45,15 @@ class Pyramid;
 
 /** Array of LK Internel Keypoints */
 using LKInternalKeypointArray = Array<NELKInternalKeypoint>;
-/** Basic function to execute optical flow. This function calls the following NEON kernels and functions:
+/** Basic function to execute optical flow. This function calls the following NEON kernels:
  *
- * -# @ref NEScharr3x3
+ * -# @ref NEFillBorderKernel
+ * -# @ref NEScharr3x3Kernel
  * -# @ref NELKTrackerKernel
  *
+ * The gradients of all the levels only depend on the old pyramid, so they are computed up front in a single batch
+ * of workloads shared by all the threads. The levels are then tracked from the coarsest to the finest, splitting
+ * the keypoints dynamically among the threads.
  */
 class NEOpticalFlow : public IFunction
 {
@@ -86,17 +91,18 @@ public:
     void run() override;
 
 private:
-    MemoryGroup                          _memory_group;
-    std::unique_ptr<NEScharr3x3[]>       _func_scharr;
-    std::unique_ptr<NELKTrackerKernel[]> _kernel_tracker;
-    std::unique_ptr<Tensor[]>            _scharr_gx;
-    std::unique_ptr<Tensor[]>            _scharr_gy;
-    IKeyPointArray                      *_new_points;
-    const IKeyPointArray                *_new_points_estimates;
-    const IKeyPointArray                *_old_points;
-    LKInternalKeypointArray              _new_points_internal;
-    LKInternalKeypointArray              _old_points_internal;
-    unsigned int                         _num_levels;
+    MemoryGroup                           _memory_group;
+    std::unique_ptr<NEFillBorderKernel[]> _kernel_border;
+    std::unique_ptr<NEScharr3x3Kernel[]>  _kernel_scharr;
+    std::unique_ptr<NELKTrackerKernel[]>  _kernel_tracker;
+    std::unique_ptr<Tensor[]>             _scharr_gx;
+    std::unique_ptr<Tensor[]>             _scharr_gy;
+    IKeyPointArray                       *_new_points;
+    const IKeyPointArray                 *_new_points_estimates;
+    const IKeyPointArray                 *_old_points;
+    LKInternalKeypointArray               _new_points_internal;
+    LKInternalKeypointArray               _old_points_internal;
+    unsigned int                          _num_levels;
 };
 }
 #endif /*__ARM_COMPUTE_NEOPTICALFLOW_H__ */
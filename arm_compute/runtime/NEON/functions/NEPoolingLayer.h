@@ -66,13 +66,15 @@ public:
     static Status validate(const ITensorInfo *input, const ITensorInfo *output, const PoolingLayerInfo &pool_info);
 
     // Inherited methods overridden:
-    void run() override;
+    void         run() override;
+    WorkloadCost cost() const override;
 
 private:
     NEPoolingLayerKernel _pooling_layer_kernel;
     NEFillBorderKernel   _border_handler;
     bool                 _is_global_pooling_layer;
     DataLayout           _data_layout;
+    WorkloadCost         _cost;
 };
 }
 #endif /* __ARM_COMPUTE_NEPOOLINGLAYER_H__ */
@@ -24,21 +24,29 @@
 #ifndef __ARM_COMPUTE_NERNNLAYER_H__
 #define __ARM_COMPUTE_NERNNLAYER_H__
 
-#include "arm_compute/core/NEON/kernels/NEActivationLayerKernel.h"
-#include "arm_compute/core/NEON/kernels/NEArithmeticAdditionKernel.h"
-#include "arm_compute/core/NEON/kernels/NECopyKernel.h"
-#include "arm_compute/runtime/NEON/INESimpleFunction.h"
+#include "arm_compute/core/NEON/kernels/NERNNCellKernel.h"
+#include "arm_compute/core/NEON/kernels/NETransposeKernel.h"
+#include "arm_compute/runtime/IFunction.h"
 
 #include "arm_compute/core/Types.h"
-#include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
+#include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/Tensor.h"
 
 namespace arm_compute
 {
 // Forward declarations
 class ITensor;
 
-/** Basic function to run @ref NERNNLayer */
+/** Basic function to run a Recurrent Neural Network (RNN) layer over one or more time steps.
+ *
+ * This function calls the following NEON kernels and functions:
+ *
+ * -# @ref NETransposeKernel (executed only once, to reshape the input weights)
+ * -# @ref NEGEMM (input contribution of all the time steps, executed once per run)
+ * -# @ref NEGEMM (recurrent contribution, executed once per time step)
+ * -# @ref NERNNCellKernel (bias addition and activation, executed once per time step)
+ */
 class NERNNLayer : public IFunction
 {
 public:
@@ -54,23 +62,27 @@ public:
     NERNNLayer &operator=(NERNNLayer &&) = default;
     /** Initialize the function
      *
-     * @param[in]     input             Input is a 2-D tensor of shape [input_size, batch_size]. Data types supported: F16/F32
+     * @param[in]     input             Input is a 2-D tensor of shape [input_size, batch_size] or a 3-D tensor of shape [input_size, batch_size, num_timesteps] for a sequence.
+     *                                  Data types supported: F16/F32
      * @param[in]     weights           Weights tensor of shape [input_size, num_units] that multiplies the input. Data types supported: Same as @p input
      * @param[in]     recurrent_weights Weights tensor of shape [num_units, num_units] that multiplies the current 'state'. Data types supported: Same as @p input
      * @param[in]     bias              Bias vector of shape [num_units]. Data types supported: Same as @p input
-     * @param[out]    output            Output tensor of shape [num_units, batch_size]. Data types supported: Same as @p input
-     * @param[in,out] hidden_state      Output tensor of shape [num_units, batch_size]. Data types supported: Same as @p input
+     * @param[in,out] hidden_state      Hidden state tensor of shape [num_units, batch_size]. Holds the initial state on input and the state after the last time step on output.
+     *                                  Data types supported: Same as @p input
+     * @param[out]    output            Output tensor of shape [num_units, batch_size] or [num_units, batch_size, num_timesteps] for a sequence, holding the hidden state of each time step.
+     *                                  Data types supported: Same as @p input
      * @param[in]     info              Activation layer parameter.
      */
     void configure(const ITensor *input, const ITensor *weights, const ITensor *recurrent_weights, const ITensor *bias, ITensor *hidden_state, ITensor *output, ActivationLayerInfo &info);
     /** Initialize the function
      *
-     * @param[in] input             Input is a 2-D tensor of shape [input_size, batch_size]. Data types supported: F16/F32
+     * @param[in] input             Input is a 2-D tensor of shape [input_size, batch_size] or a 3-D tensor of shape [input_size, batch_size, num_timesteps] for a sequence.
+     *                              Data types supported: F16/F32
      * @param[in] weights           Weights tensor of shape [input_size, num_units] that multiplies the input. Data types supported: Same as @p input
      * @param[in] recurrent_weights Weights tensor of shape [num_units, num_units] that multiplies the current 'state'. Data types supported: Same as @p input
      * @param[in] bias              Bias vector of shape [num_units]. Data types supported: Same as @p input
-     * @param[in] output            Output tensor of shape [num_units, batch_size]. Data types supported: Same as @p input
-     * @param[in] hidden_state      Output tensor of shape [num_units, batch_size]. Data types supported: Same as @p input
+     * @param[in] hidden_state      Hidden state tensor of shape [num_units, batch_size]. Data types supported: Same as @p input
+     * @param[in] output            Output tensor of shape [num_units, batch_size] or [num_units, batch_size, num_timesteps] for a sequence. Data types supported: Same as @p input
      * @param[in] info              Activation layer parameter.
      *
      * @return a status
@@ -83,16 +95,17 @@ public:
     void prepare() override;
 
 private:
-    MemoryGroup                _memory_group;
-    NEGEMM                     _gemm_state_f;
-    NEArithmeticAdditionKernel _add_kernel;
-    NEActivationLayerKernel    _activation_kernel;
-    NEFullyConnectedLayer      _fully_connected_kernel;
-    NECopyKernel               _copy_kernel;
-    Tensor                     _fully_connected_out;
-    Tensor                     _gemm_output;
-    Tensor                     _add_output;
-    bool                       _is_prepared;
+    MemoryGroup       _memory_group;
+    NETransposeKernel _transpose_weights;
+    NEGEMM            _gemm_input;
+    NEGEMM            _gemm_state_f;
+    NERNNCellKernel   _cell_kernel;
+    Tensor            _weights_transposed;
+    Tensor            _input_projection;
+    Tensor            _gemm_output;
+    const ITensor    *_original_weights;
+    unsigned int      _num_timesteps;
+    bool              _is_prepared;
 };
 } // namespace arm_compute
 #endif /* __ARM_COMPUTE_NERNNLAYER_H__ */
@@ -73,8 +73,9 @@ public:
                    bool enable_fast_math = false);
 
     // Inherited methods overridden:
-    void run() override;
-    void prepare() override;
+    void         run() override;
+    void         prepare() override;
+    WorkloadCost cost() const override;
 
     /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMConvolutionLayer
      *
@@ -121,6 +122,7 @@ private:
     const ITensor *_input;
     const ITensor *_weights;
     ITensor       *_output;
+    WorkloadCost   _cost;
     bool           _is_prepared;
     bool           _is_activationlayer_enabled;
 };
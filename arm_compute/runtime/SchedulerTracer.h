@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_SCHEDULERTRACER_H__
+#define __ARM_COMPUTE_SCHEDULERTRACER_H__
+
+#include "arm_compute/core/CPP/CPPTypes.h"
+#include "arm_compute/runtime/HardwareCounters.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+class ICPPKernel;
+class Window;
+
+/** Records the execution of the kernels' windows by the scheduler threads
+ *
+ * When enabled, the schedulers record for each window a kernel is split into the thread which executed it
+ * and its start and end timestamps. The events can then be exported as a Chrome trace (chrome://tracing, Perfetto)
+ * to inspect the load balancing between the threads and the gaps between the kernels.
+ *
+ * Events are tagged with the label of the calling thread (e.g. the name of the graph node being executed).
+ *
+ * The CPU hardware counters of the executing thread can optionally be sampled around each window, the events can then
+ * be aggregated per label and kernel to find out which ones are compute or memory bound.
+ */
+class SchedulerTracer final
+{
+public:
+    /** Clock used to timestamp the events */
+    using Clock = std::chrono::steady_clock;
+
+    /** Execution of a window of a kernel by a thread */
+    struct Event
+    {
+        std::string              kernel{};              /**< Name of the kernel */
+        std::string              label{};               /**< Label of the thread which scheduled the kernel */
+        unsigned int             thread_id{ 0 };        /**< ID of the thread which executed the window */
+        unsigned int             window_id{ 0 };        /**< Index of the window */
+        unsigned int             num_windows{ 1 };      /**< Number of windows the kernel was split into */
+        Clock::time_point        start{};               /**< Start of the execution */
+        Clock::time_point        end{};                 /**< End of the execution */
+        bool                     has_counters{ false }; /**< True if the hardware counters were sampled */
+        HardwareCounters::Values counters{ {} };        /**< Hardware counters increments during the execution */
+    };
+
+    /** Aggregated executions of a kernel for a given label */
+    struct KernelStats
+    {
+        std::string              kernel{};              /**< Name of the kernel */
+        std::string              label{};               /**< Label of the thread which scheduled the kernel */
+        unsigned int             num_runs{ 0 };         /**< Number of times the kernel was scheduled */
+        unsigned int             num_windows{ 0 };      /**< Number of windows executed */
+        double                   busy_time_us{ 0.0 };   /**< Sum of the execution times of the windows in microseconds */
+        bool                     has_counters{ false }; /**< True if all the windows sampled the hardware counters */
+        HardwareCounters::Values counters{ {} };        /**< Sum of the hardware counters increments of the windows */
+    };
+
+    /** Access the tracer singleton.
+     *
+     * @return The tracer
+     */
+    static SchedulerTracer &get();
+    /** Prevent instances of this class from being copied */
+    SchedulerTracer(const SchedulerTracer &) = delete;
+    /** Prevent instances of this class from being copied */
+    SchedulerTracer &operator=(const SchedulerTracer &) = delete;
+
+    /** Start recording
+     *
+     * Recording is shared by all the users of the tracer (e.g. the graph contexts): the recorded events are only discarded
+     * when nobody else is recording, and recording goes on until every call to start() is matched by a call to @ref stop.
+     * Likewise the hardware counters are sampled as long as one of the users asked for them.
+     *
+     * @param[in] hardware_counters (Optional) True to also sample the hardware counters around each window. Defaults to false.
+     *
+     * @return Time from which the events are recorded for this user, to pass to @ref events, @ref summary or @ref write_chrome_trace
+     */
+    Clock::time_point start(bool hardware_counters = false);
+    /** Stop recording for one user, recording stops once every user stopped
+     *
+     * @param[in] hardware_counters (Optional) Must match the value passed to the corresponding @ref start. Defaults to false.
+     */
+    void stop(bool hardware_counters = false);
+    /** Returns true if the events are being recorded
+     *
+     * @return True if the tracer is enabled
+     */
+    bool is_enabled() const;
+    /** Returns true if the hardware counters are sampled
+     *
+     * @return True if the hardware counters are sampled
+     */
+    bool hardware_counters() const;
+    /** Set the label attached to the kernels scheduled by the calling thread
+     *
+     * @param[in] label Label to use, an empty string removes the label.
+     */
+    static void set_label(std::string label);
+    /** Label attached to the kernels scheduled by the calling thread
+     *
+     * @return The label
+     */
+    static const std::string &label();
+    /** Run a window of a kernel and record its execution
+     *
+     * @param[in] kernel      Kernel to run.
+     * @param[in] window      Window to run the kernel on.
+     * @param[in] info        Info about the executing thread.
+     * @param[in] label       Label of the thread which scheduled the kernel.
+     * @param[in] window_id   Index of the window.
+     * @param[in] num_windows Number of windows the kernel was split into.
+     */
+    void run(ICPPKernel *kernel, const Window &window, const ThreadInfo &info, const std::string &label, unsigned int window_id, unsigned int num_windows);
+    /** Returns a copy of the recorded events
+     *
+     * @param[in] since (Optional) Only return the events which started after this time. Defaults to all the events.
+     *
+     * @return The events ordered by end time
+     */
+    std::vector<Event> events(Clock::time_point since = Clock::time_point()) const;
+    /** Aggregate the recorded events per label and kernel
+     *
+     * @param[in] since (Optional) Only aggregate the events which started after this time. Defaults to all the events.
+     *
+     * @return The statistics of each label and kernel pair in order of first execution
+     */
+    std::vector<KernelStats> summary(Clock::time_point since = Clock::time_point()) const;
+    /** Write the aggregated statistics returned by @ref summary as JSON
+     *
+     * @param[out] os    Output stream.
+     * @param[in]  since (Optional) Only aggregate the events which started after this time. Defaults to all the events.
+     */
+    void write_summary(std::ostream &os, Clock::time_point since = Clock::time_point()) const;
+    /** Write the recorded events in the Chrome trace event format
+     *
+     * @param[out] os    Output stream.
+     * @param[in]  since (Optional) Only write the events which started after this time. Defaults to all the events.
+     */
+    void write_chrome_trace(std::ostream &os, Clock::time_point since = Clock::time_point()) const;
+    /** Write the recorded events in the Chrome trace event format to a file
+     *
+     * @param[in] filename Name of the file to write.
+     * @param[in] since    (Optional) Only write the events which started after this time. Defaults to all the events.
+     */
+    void save_chrome_trace(const std::string &filename, Clock::time_point since = Clock::time_point()) const;
+
+private:
+    /** Default constructor */
+    SchedulerTracer();
+
+    std::atomic<bool>  _enabled;
+    unsigned int       _num_users;
+    unsigned int       _num_counters_users;
+    std::atomic<bool>  _hardware_counters;
+    Clock::time_point  _origin;
+    std::vector<Event> _events;
+    mutable std::mutex _mtx;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_SCHEDULERTRACER_H__ */
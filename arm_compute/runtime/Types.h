@@ -24,6 +24,8 @@
 #ifndef __ARM_COMPUTE_RUNTIME_TYPES_H__
 #define __ARM_COMPUTE_RUNTIME_TYPES_H__
 
+#include <cstddef>
+#include <cstdint>
 #include <map>
 
 namespace arm_compute
@@ -45,5 +47,12 @@ using MemoryMappings = std::map<void **, size_t>;
 /** A map of the groups and memory mappings */
 using GroupMappings = std::map<size_t, MemoryMappings>;
 
+/** Amount of work done by a run of a function */
+struct WorkloadCost
+{
+    uint64_t flops{ 0 }; /**< Number of arithmetic operations, a multiply-accumulate counts as two operations */
+    uint64_t bytes{ 0 }; /**< Number of bytes of the inputs, weights and outputs, i.e. the memory traffic if each of them is accessed once */
+};
+
 } // arm_compute
 #endif /* __ARM_COMPUTE_RUNTIME_TYPES_H__ */
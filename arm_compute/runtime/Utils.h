@@ -25,11 +25,15 @@
 #define __ARM_COMPUTE_RUNTIME_UTILS_H__
 
 #include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/Types.h"
 
+#include <initializer_list>
 #include <string>
 
 namespace arm_compute
 {
+class ITensorInfo;
+
 /** Convert a Scheduler::Type into a string.
  *
  * @param[in] t @ref Scheduler::Type to be translated to string.
@@ -37,5 +41,21 @@ namespace arm_compute
  * @return The string describing the scheduler type.
  */
 const std::string &string_from_scheduler_type(Scheduler::Type t);
+/** Number of bytes of the elements of a tensor, excluding the padding
+ *
+ * @param[in] info Tensor info. If nullptr 0 is returned.
+ *
+ * @return The size of the tensor's elements in bytes
+ */
+uint64_t tensor_size_in_bytes(const ITensorInfo *info);
+/** Cost of a function computing each output element with the same number of operations
+ *
+ * @param[in] flops_per_output Number of operations computing an output element.
+ * @param[in] output           Output tensor info.
+ * @param[in] inputs           Input tensors' info (inputs, weights, biases, ...). nullptr entries are ignored.
+ *
+ * @return The cost of the function
+ */
+WorkloadCost compute_workload_cost(uint64_t flops_per_output, const ITensorInfo *output, std::initializer_list<const ITensorInfo *> inputs);
 }
 #endif /* __ARM_COMPUTE_RUNTIME_UTILS_H__ */
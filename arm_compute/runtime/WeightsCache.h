@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_WEIGHTSCACHE_H__
+#define __ARM_COMPUTE_WEIGHTSCACHE_H__
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace arm_compute
+{
+class IMemoryRegion;
+class Tensor;
+
+/** Process wide cache of read-only tensors shared between function instances
+ *
+ * Several instances of the same network (e.g. one graph per worker thread) hold identical constant tensors:
+ * the raw weights and the weights reshaped or pretransposed by the functions when they get prepared.
+ * The cache lets these instances reference a single copy of the data.
+ *
+ * Entries are keyed by a string identifying the data (e.g. the file the weights are loaded from and the transforms applied to them)
+ * and the size of the tensor. An entry only holds a weak reference to its memory: it is released once all the tensors importing it are freed.
+ *
+ * The functions derive the keys of their prepared tensors from the scope of the calling thread (see @ref WeightsCache::Scope),
+ * outside of a scope they allocate their tensors as usual.
+ */
+class WeightsCache final
+{
+public:
+    /** Identifies the weights prepared by the functions on the calling thread while the object is alive */
+    class Scope final
+    {
+    public:
+        /** Constructor
+         *
+         * @param[in] key Key identifying the data of the weights of the function(s) being prepared. Sharing is disabled if empty.
+         */
+        explicit Scope(std::string key);
+        /** Restores the previous scope of the calling thread */
+        ~Scope();
+        /** Prevent instances of this class from being copied */
+        Scope(const Scope &) = delete;
+        /** Prevent instances of this class from being copied */
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        std::string _previous_key;
+    };
+
+    /** Access the cache
+     *
+     * @return The cache instance
+     */
+    static WeightsCache &get();
+    /** Key of a tensor prepared within the scope of the calling thread
+     *
+     * @param[in] tag Name of the tensor in the function preparing it (e.g. "reshaped_weights")
+     *
+     * @return The key of the tensor or an empty string outside of a scope
+     */
+    static std::string scoped_key(const std::string &tag);
+    /** Provide the memory of a read-only tensor
+     *
+     * If an entry with the same key and size has been published, its memory is imported into @p tensor.
+     * Otherwise the memory of @p tensor is allocated (if not already) and the caller has to fill it then call @ref publish.
+     *
+     * @note The tensor must not be managed by a memory group.
+     *
+     * @param[in]      key    Key of the data. The tensor is simply allocated if empty.
+     * @param[in, out] tensor Tensor to provide the memory of. Its info must be initialised.
+     *
+     * @return True if the memory of a published entry was imported, in which case @p tensor holds the data already
+     */
+    bool acquire(const std::string &key, Tensor &tensor);
+    /** Make the data of a tensor filled after a call to @ref acquire available to the other tensors with the same key
+     *
+     * @param[in] key    Key of the data. Nothing is done if empty.
+     * @param[in] tensor Tensor holding the data.
+     */
+    void publish(const std::string &key, const Tensor &tensor);
+    /** Total size of the entries currently alive
+     *
+     * @return Size in bytes
+     */
+    size_t size_in_bytes();
+    /** Drop all the entries
+     *
+     * @note The tensors which imported the memory of an entry keep it
+     */
+    void clear();
+
+private:
+    /** Default constructor */
+    WeightsCache();
+
+    /** Memory of an entry */
+    struct Entry
+    {
+        std::weak_ptr<IMemoryRegion> region{};              /**< Memory holding the data */
+        bool                         is_published{ false }; /**< True once the memory holds the data */
+    };
+
+    std::mutex                   _mtx;
+    std::map<std::string, Entry> _entries;
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_WEIGHTSCACHE_H__ */
@@ -109,9 +109,12 @@ public:
 
         // Finalize graph
         GraphConfig config;
-        config.num_threads = common_params.threads;
-        config.use_tuner   = common_params.enable_tuner;
-        config.tuner_file  = common_params.tuner_file;
+        config.num_threads       = common_params.threads;
+        config.use_tuner         = common_params.enable_tuner;
+        config.tuner_file        = common_params.tuner_file;
+        config.trace_file        = common_params.trace_file;
+        config.profile_file      = common_params.profile_file;
+        config.use_implicit_gemm = common_params.implicit_gemm;
 
         graph.finalize(common_params.target, config);
 
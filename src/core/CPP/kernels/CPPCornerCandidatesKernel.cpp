@@ -37,27 +37,18 @@ using namespace arm_compute;
 
 namespace
 {
-inline void check_corner(float x, float y, float strength, InternalKeypoint *output, int32_t *num_corner_candidates, arm_compute::Mutex *corner_candidates_mutex)
+inline void check_corner(float x, float y, float strength, std::vector<InternalKeypoint> &candidates)
 {
     if(strength != 0.0f)
     {
-        /* Set index and update num_corner_candidate */
-        std::unique_lock<arm_compute::Mutex> lock(*corner_candidates_mutex);
-
-        const int32_t idx = *num_corner_candidates;
-
-        *num_corner_candidates += 1;
-
-        lock.unlock();
-
         /* Add keypoint */
-        output[idx] = std::make_tuple(x, y, strength);
+        candidates.emplace_back(x, y, strength);
     }
 }
 
-inline void corner_candidates(const float *__restrict input, InternalKeypoint *__restrict output, int32_t x, int32_t y, int32_t *num_corner_candidates, arm_compute::Mutex *corner_candidates_mutex)
+inline void corner_candidates(const float *__restrict input, std::vector<InternalKeypoint> &candidates, int32_t x, int32_t y)
 {
-    check_corner(x, y, *input, output, num_corner_candidates, corner_candidates_mutex);
+    check_corner(x, y, *input, candidates);
 }
 } // namespace
 
@@ -67,7 +58,7 @@ bool keypoint_compare(const InternalKeypoint &lhs, const InternalKeypoint &rhs)
 }
 
 CPPCornerCandidatesKernel::CPPCornerCandidatesKernel()
-    : _num_corner_candidates(nullptr), _corner_candidates_mutex(), _input(nullptr), _output(nullptr)
+    : _num_corner_candidates(nullptr), _local_candidates(), _input(nullptr), _output(nullptr)
 {
 }
 
@@ -93,16 +84,39 @@ void CPPCornerCandidatesKernel::configure(const IImage *input, InternalKeypoint
     INEKernel::configure(win);
 }
 
+void CPPCornerCandidatesKernel::reset(unsigned int num_threads)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+
+    _local_candidates.reset(num_threads);
+}
+
+void CPPCornerCandidatesKernel::merge()
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+
+    int32_t num_corner_candidates = 0;
+
+    _local_candidates.merge([&](const InternalKeypoint & candidate)
+    {
+        _output[num_corner_candidates++] = candidate;
+        return true;
+    });
+
+    *_num_corner_candidates = num_corner_candidates;
+}
+
 void CPPCornerCandidatesKernel::run(const Window &window, const ThreadInfo &info)
 {
-    ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
     Iterator input(_input, window);
 
+    std::vector<InternalKeypoint> &candidates = _local_candidates.begin_window(info.thread_id, window);
+
     execute_window_loop(window, [&](const Coordinates & id)
     {
-        corner_candidates(reinterpret_cast<float *>(input.ptr()), &_output[0], id.x(), id.y(), _num_corner_candidates, &_corner_candidates_mutex);
+        corner_candidates(reinterpret_cast<float *>(input.ptr()), candidates, id.x(), id.y());
     },
     input);
 }
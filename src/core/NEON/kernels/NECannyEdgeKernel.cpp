@@ -32,10 +32,13 @@
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
 
+#include <algorithm>
 #include <arm_neon.h>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <tuple>
+#include <vector>
 
 using namespace arm_compute;
 
@@ -1857,3 +1860,491 @@ void NEEdgeTraceKernel::run(const Window &window, const ThreadInfo &info)
     },
     input, output);
 }
+
+namespace
+{
+/** Number of rows of a tile of @ref NEGradientNonMaxSuppressionKernel */
+constexpr int tile_rows = 32;
+
+/** Values of the roots of the union-find forest of the candidate edges, the other points store the index of their parent */
+constexpr int32_t WEAK_ROOT   = -1;
+constexpr int32_t STRONG_ROOT = -2;
+
+template <typename T>
+inline void fill_magnitude_row(uint8_t *row_ptr, int width, uint32_t value)
+{
+    std::fill_n(reinterpret_cast<T *>(row_ptr), width + 2, static_cast<T>(value));
+}
+
+template <typename T>
+inline void fill_magnitude_border(uint8_t *row_ptr, int width, bool constant, uint32_t value)
+{
+    const auto row = reinterpret_cast<T *>(row_ptr);
+    row[0]         = constant ? static_cast<T>(value) : row[1];
+    row[width + 1] = constant ? static_cast<T>(value) : row[width];
+}
+
+inline bool is_no_edge(const uint8x16_t &values)
+{
+    const uint8x8_t any = vorr_u8(vget_low_u8(values), vget_high_u8(values));
+    return vget_lane_u64(vreinterpret_u64_u8(any), 0) == 0;
+}
+
+/** Call f(x) for each point of the row which is not NO_EDGE, skipping 16 points at a time */
+template <typename F>
+inline void for_each_candidate(const uint8_t *row, int width, F &&f)
+{
+    int x = 0;
+    while(x < width)
+    {
+        if(x + 16 <= width && is_no_edge(vld1q_u8(row + x)))
+        {
+            x += 16;
+            continue;
+        }
+
+        const int end_x = std::min(x + 16, width);
+        for(; x < end_x; ++x)
+        {
+            if(row[x] != NO_EDGE)
+            {
+                f(x);
+            }
+        }
+    }
+}
+
+inline int32_t find_root(int32_t *labels, int32_t index)
+{
+    // Path halving
+    while(labels[index] >= 0)
+    {
+        const int32_t parent = labels[index];
+        if(labels[parent] >= 0)
+        {
+            labels[index] = labels[parent];
+        }
+        index = parent;
+    }
+    return index;
+}
+
+inline void join(int32_t *labels, int32_t a, int32_t b)
+{
+    a = find_root(labels, a);
+    b = find_root(labels, b);
+
+    if(a != b)
+    {
+        // The smallest index becomes the root: parents always come before their children in raster order
+        if(a > b)
+        {
+            std::swap(a, b);
+        }
+        labels[a] = std::min(labels[a], labels[b]);
+        labels[b] = a;
+    }
+}
+
+/** Join the candidates of row y with their neighbours in row y - 1 */
+inline void join_rows(const uint8_t *input, size_t input_stride, int32_t *labels, int32_t labels_stride, int width, int y)
+{
+    const uint8_t *row   = input + y * input_stride;
+    const uint8_t *above = row - input_stride;
+
+    for_each_candidate(row, width, [&](int x)
+    {
+        const int32_t index = y * labels_stride + x;
+        for(int nx = std::max(x - 1, 0); nx <= std::min(x + 1, width - 1); ++nx)
+        {
+            if(above[nx] != NO_EDGE)
+            {
+                join(labels, index, index - labels_stride + nx - x);
+            }
+        }
+    });
+}
+} // namespace
+
+NEGradientNonMaxSuppressionKernel::NEGradientNonMaxSuppressionKernel()
+    : _gradient_func(nullptr), _non_max_suppr_func(nullptr), _gx(nullptr), _gy(nullptr), _output(nullptr), _lower_thr(0), _upper_thr(0), _border_mode(BorderMode::UNDEFINED),
+      _constant_border_value(0)
+{
+}
+
+void NEGradientNonMaxSuppressionKernel::configure(const ITensor *gx, const ITensor *gy, ITensor *output, int32_t upper_thr, int32_t lower_thr, int32_t norm_type,
+                                                  BorderMode border_mode, uint8_t constant_border_value, bool use_fp16)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(gx, gy, output);
+
+    set_shape_if_empty(*output->info(), gx->info()->tensor_shape());
+    set_format_if_unknown(*output->info(), Format::U8);
+
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(gx, gy, output);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(gx, 1, DataType::S16, DataType::S32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(gy, 1, DataType::S16, DataType::S32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(gx, gy);
+
+    _gx                    = gx;
+    _gy                    = gy;
+    _output                = output;
+    _lower_thr             = lower_thr;
+    _upper_thr             = upper_thr;
+    _border_mode           = border_mode;
+    _constant_border_value = constant_border_value;
+
+    const bool is_s16 = (gx->info()->data_type() == DataType::S16);
+
+    if(is_s16)
+    {
+        _gradient_func      = (norm_type == 1) ? &mag_phase_l1norm_S16_S16_U16_U8 : &mag_phase_l2norm_S16_S16_U16_U8;
+        _non_max_suppr_func = &non_max_suppression_U16_U8_U8;
+    }
+    else
+    {
+        _gradient_func      = (norm_type == 1) ? &mag_phase_l1norm_S32_S32_U32_U8 : &mag_phase_l2norm_S32_S32_U32_U8;
+        _non_max_suppr_func = &non_max_suppression_U32_U8_U8;
+    }
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+    if(use_fp16)
+    {
+        if(is_s16)
+        {
+            _gradient_func = (norm_type == 1) ? &fp16::mag_phase_l1norm_S16_S16_U16_U8 : &fp16::mag_phase_l2norm_S16_S16_U16_U8;
+        }
+        else
+        {
+            _gradient_func = (norm_type == 1) ? &fp16::mag_phase_l1norm_S32_S32_U32_U8 : &fp16::mag_phase_l2norm_S32_S32_U32_U8;
+        }
+    }
+#else  /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+    ARM_COMPUTE_UNUSED(use_fp16);
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+    constexpr unsigned int num_elems_processed_per_iteration = 32;
+
+    // The rows are processed 32 elements at a time: Gx, Gy and the output must be padded accordingly
+    Window win = calculate_max_window(*gx->info(), Steps(num_elems_processed_per_iteration));
+
+    AccessWindowHorizontal gx_access(gx->info(), 0, num_elems_processed_per_iteration);
+    AccessWindowHorizontal gy_access(gy->info(), 0, num_elems_processed_per_iteration);
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+
+    update_window_and_padding(win, gx_access, gy_access, output_access);
+
+    output_access.set_valid_region(win, gx->info()->valid_region(), border_mode == BorderMode::UNDEFINED, BorderSize(1));
+
+    // Configure kernel window: one iteration per row of the output
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    INEKernel::configure(win);
+}
+
+void NEGradientNonMaxSuppressionKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_gradient_func == nullptr);
+    ARM_COMPUTE_ERROR_ON(_non_max_suppr_func == nullptr);
+
+    constexpr int num_elems_processed_per_iteration = 32;
+
+    const int    width        = _gx->info()->dimension(0);
+    const int    height       = _gx->info()->dimension(1);
+    const size_t element_size = _gx->info()->element_size();
+    const bool   is_16bit     = (element_size == 2);
+    const bool   constant     = (_border_mode == BorderMode::CONSTANT);
+
+    // The magnitude of a row is stored after its left border, the right border and the slack read by the non-maxima suppression follow
+    const int magnitude_stride = ceil_to_multiple(width, num_elems_processed_per_iteration) + num_elems_processed_per_iteration;
+
+    const ValidRegion &valid_region = _output->info()->valid_region();
+    const int          valid_start_x = valid_region.anchor[0];
+    const int          valid_end_x   = valid_region.end(0);
+    const int          valid_start_y = valid_region.anchor[1];
+    const int          valid_end_y   = valid_region.end(1);
+
+    // Magnitude and phase of the rows of a tile plus the row above and the row below it
+    std::vector<uint8_t> magnitude((tile_rows + 2) * magnitude_stride * element_size);
+    std::vector<uint8_t> phase((tile_rows + 2) * magnitude_stride);
+
+    auto compute_row = [&](int y, int slot)
+    {
+        uint8_t *magnitude_row = magnitude.data() + slot * magnitude_stride * element_size;
+        uint8_t *phase_row     = phase.data() + slot * magnitude_stride;
+
+        if(constant && (y < 0 || y >= height))
+        {
+            if(is_16bit)
+            {
+                fill_magnitude_row<uint16_t>(magnitude_row, width, _constant_border_value);
+            }
+            else
+            {
+                fill_magnitude_row<uint32_t>(magnitude_row, width, _constant_border_value);
+            }
+            return;
+        }
+
+        // Rows outside of the tensor are replicated
+        y = std::min(std::max(y, 0), height - 1);
+
+        const uint8_t *gx_row = _gx->buffer() + _gx->info()->offset_element_in_bytes(Coordinates(0, y));
+        const uint8_t *gy_row = _gy->buffer() + _gy->info()->offset_element_in_bytes(Coordinates(0, y));
+
+        for(int x = 0; x < width; x += num_elems_processed_per_iteration)
+        {
+            (*_gradient_func)(gx_row + x * element_size, gy_row + x * element_size, magnitude_row + (x + 1) * element_size, phase_row + x + 1);
+        }
+
+        if(is_16bit)
+        {
+            fill_magnitude_border<uint16_t>(magnitude_row, width, constant, _constant_border_value);
+        }
+        else
+        {
+            fill_magnitude_border<uint32_t>(magnitude_row, width, constant, _constant_border_value);
+        }
+    };
+
+    auto non_max_suppr_row = [&](int y, int slot)
+    {
+        uint8_t *output_row = _output->buffer() + _output->info()->offset_element_in_bytes(Coordinates(0, y));
+
+        if(y < valid_start_y || y >= valid_end_y)
+        {
+            std::memset(output_row, NO_EDGE, width);
+            return;
+        }
+
+        const uint8_t *magnitude_row = magnitude.data() + slot * magnitude_stride * element_size;
+        const uint8_t *phase_row     = phase.data() + slot * magnitude_stride;
+
+        for(int x = 0; x < width; x += 8)
+        {
+            (*_non_max_suppr_func)(magnitude_row + (x + 1) * element_size, phase_row + x + 1, output_row + x, magnitude_stride, _lower_thr, _upper_thr);
+        }
+
+        std::memset(output_row, NO_EDGE, valid_start_x);
+        std::memset(output_row + valid_end_x, NO_EDGE, width - valid_end_x);
+    };
+
+    const int start_y = window.y().start();
+    const int end_y   = window.y().end();
+
+    for(int y = start_y; y < end_y; y += tile_rows)
+    {
+        const int num_rows   = std::min(tile_rows, end_y - y);
+        int       first_slot = 0;
+
+        if(y != start_y)
+        {
+            // The last two rows of the previous tile are the first two rows of this one
+            std::memcpy(magnitude.data(), magnitude.data() + tile_rows * magnitude_stride * element_size, 2 * magnitude_stride * element_size);
+            std::memcpy(phase.data(), phase.data() + tile_rows * magnitude_stride, 2 * magnitude_stride);
+            first_slot = 2;
+        }
+
+        for(int slot = first_slot; slot < num_rows + 2; ++slot)
+        {
+            compute_row(y + slot - 1, slot);
+        }
+
+        for(int row = 0; row < num_rows; ++row)
+        {
+            non_max_suppr_row(y + row, row + 1);
+        }
+    }
+}
+
+NEEdgeLabelKernel::NEEdgeLabelKernel()
+    : _input(nullptr), _labels(nullptr), _window_rows()
+{
+}
+
+void NEEdgeLabelKernel::configure(const ITensor *input, ITensor *labels)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, labels);
+
+    set_shape_if_empty(*labels->info(), input->info()->tensor_shape());
+    set_format_if_unknown(*labels->info(), Format::S32);
+
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, labels);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(labels, 1, DataType::S32);
+
+    _input  = input;
+    _labels = labels;
+
+    // Configure kernel window: one iteration per row of the input
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, input->info()->dimension(1), 1));
+
+    INEKernel::configure(win);
+}
+
+void NEEdgeLabelKernel::reset(unsigned int num_threads)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+
+    _window_rows.reset(num_threads);
+}
+
+void NEEdgeLabelKernel::merge()
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+
+    const int      width         = _input->info()->dimension(0);
+    const size_t   input_stride  = _input->info()->strides_in_bytes()[1];
+    const int32_t  labels_stride = _labels->info()->strides_in_bytes()[1] / sizeof(int32_t);
+    const uint8_t *input         = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    auto           labels        = reinterpret_cast<int32_t *>(_labels->buffer() + _labels->info()->offset_first_element_in_bytes());
+
+    _window_rows.merge([&](int y)
+    {
+        if(y > 0)
+        {
+            join_rows(input, input_stride, labels, labels_stride, width, y);
+        }
+        return true;
+    });
+}
+
+void NEEdgeLabelKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int      width         = _input->info()->dimension(0);
+    const size_t   input_stride  = _input->info()->strides_in_bytes()[1];
+    const int32_t  labels_stride = _labels->info()->strides_in_bytes()[1] / sizeof(int32_t);
+    const uint8_t *input         = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    auto           labels        = reinterpret_cast<int32_t *>(_labels->buffer() + _labels->info()->offset_first_element_in_bytes());
+
+    const int start_y = window.y().start();
+    const int end_y   = window.y().end();
+
+    // The components are joined across the first row of the window by merge()
+    _window_rows.begin_window(info.thread_id, window).push_back(start_y);
+
+    for(int y = start_y; y < end_y; ++y)
+    {
+        const uint8_t *row = input + y * input_stride;
+
+        for_each_candidate(row, width, [&](int x)
+        {
+            const int32_t index = y * labels_stride + x;
+
+            labels[index] = (row[x] == EDGE) ? STRONG_ROOT : WEAK_ROOT;
+
+            if(x > 0 && row[x - 1] != NO_EDGE)
+            {
+                join(labels, index, index - 1);
+            }
+        });
+
+        if(y > start_y)
+        {
+            join_rows(input, input_stride, labels, labels_stride, width, y);
+        }
+    }
+
+    // Point every candidate to the root of its component within the window.
+    // As parents come first in raster order, their own parent is already a root.
+    for(int y = start_y; y < end_y; ++y)
+    {
+        for_each_candidate(input + y * input_stride, width, [&](int x)
+        {
+            const int32_t index  = y * labels_stride + x;
+            const int32_t parent = labels[index];
+
+            if(parent >= 0 && labels[parent] >= 0)
+            {
+                labels[index] = labels[parent];
+            }
+        });
+    }
+}
+
+NEEdgeHysteresisKernel::NEEdgeHysteresisKernel()
+    : _input(nullptr), _labels(nullptr), _output(nullptr)
+{
+}
+
+void NEEdgeHysteresisKernel::configure(const ITensor *input, const ITensor *labels, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, labels, output);
+
+    set_shape_if_empty(*output->info(), input->info()->tensor_shape());
+    set_format_if_unknown(*output->info(), Format::U8);
+
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, labels, output);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(labels, 1, DataType::S32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
+
+    _input  = input;
+    _labels = labels;
+    _output = output;
+
+    // All the points of the output are written
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    // Configure kernel window: one iteration per row of the output
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, output->info()->dimension(1), 1));
+
+    INEKernel::configure(win);
+}
+
+void NEEdgeHysteresisKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int        width         = _input->info()->dimension(0);
+    const int32_t    labels_stride = _labels->info()->strides_in_bytes()[1] / sizeof(int32_t);
+    const auto       labels        = reinterpret_cast<const int32_t *>(_labels->buffer() + _labels->info()->offset_first_element_in_bytes());
+    const uint8x16_t no_edge       = vdupq_n_u8(NO_EDGE);
+
+    for(int y = window.y().start(); y < window.y().end(); ++y)
+    {
+        const uint8_t *input_row  = _input->buffer() + _input->info()->offset_element_in_bytes(Coordinates(0, y));
+        uint8_t       *output_row = _output->buffer() + _output->info()->offset_element_in_bytes(Coordinates(0, y));
+
+        int x = 0;
+        while(x < width)
+        {
+            if(x + 16 <= width && is_no_edge(vld1q_u8(input_row + x)))
+            {
+                vst1q_u8(output_row + x, no_edge);
+                x += 16;
+                continue;
+            }
+
+            const int end_x = std::min(x + 16, width);
+            for(; x < end_x; ++x)
+            {
+                uint8_t value = NO_EDGE;
+
+                if(input_row[x] != NO_EDGE)
+                {
+                    int32_t root = y * labels_stride + x;
+                    while(labels[root] >= 0)
+                    {
+                        root = labels[root];
+                    }
+                    value = (labels[root] == STRONG_ROOT) ? EDGE : NO_EDGE;
+                }
+
+                output_row[x] = value;
+            }
+        }
+    }
+}
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEChannelShuffleLayerKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <cstring>
+
+namespace arm_compute
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, unsigned int num_groups)
+{
+    //Note: ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input) is not needed here as this kernel doesn't use NEON FP16 instructions.
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::S8, DataType::QASYMM8,
+                                                         DataType::U16, DataType::S16,
+                                                         DataType::U32, DataType::S32,
+                                                         DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_groups < 2, "Channel shuffling with less than 2 groups would be inefficient");
+
+    const unsigned int channels = input->dimension(get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::CHANNEL));
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_groups == channels, "Channel shuffling with same number of groups as number of channels would be inefficient");
+    // There cannot be more groups than channels
+    ARM_COMPUTE_RETURN_ERROR_ON(num_groups > channels);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((channels % num_groups) != 0, "The number of channels must be a multiple of the number of groups");
+
+    // Checks performed when output is configured
+    if(output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, output);
+    }
+
+    return Status{};
+}
+} // namespace
+
+void NEChannelShuffleLayerKernel::shuffle_nchw(const Window &window)
+{
+    const unsigned int channels          = _input->info()->dimension(2);
+    const unsigned int channels_in_group = channels / _num_groups;
+    const size_t       row_size          = _input->info()->dimension(0) * _input->info()->element_size();
+    const Strides     &out_strides       = _output->info()->strides_in_bytes();
+    uint8_t           *out_base          = _output->buffer() + _output->info()->offset_first_element_in_bytes();
+
+    Iterator in(_input, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        // Channel k of group g is moved to channel k * num_groups + g
+        const unsigned int in_channel  = id.z();
+        const unsigned int out_channel = (in_channel % channels_in_group) * _num_groups + in_channel / channels_in_group;
+
+        uint8_t *out_ptr = out_base + id.y() * out_strides.y() + out_channel * out_strides.z() + id[3] * out_strides[3];
+        std::memcpy(out_ptr, in.ptr(), row_size);
+    },
+    in);
+}
+
+template <typename T>
+void NEChannelShuffleLayerKernel::shuffle_nhwc(const Window &window)
+{
+    const unsigned int channels_in_group = _input->info()->dimension(0) / _num_groups;
+    const unsigned int num_groups        = _num_groups;
+
+    Iterator in(_input, window);
+    Iterator out(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto in_ptr  = reinterpret_cast<const T *>(in.ptr());
+        const auto out_ptr = reinterpret_cast<T *>(out.ptr());
+
+        // Read each group contiguously and scatter it with a stride of num_groups elements
+        for(unsigned int g = 0; g < num_groups; ++g)
+        {
+            const T *group_in_ptr  = in_ptr + g * channels_in_group;
+            T       *group_out_ptr = out_ptr + g;
+            for(unsigned int k = 0; k < channels_in_group; ++k)
+            {
+                group_out_ptr[k * num_groups] = group_in_ptr[k];
+            }
+        }
+    },
+    in, out);
+}
+
+NEChannelShuffleLayerKernel::NEChannelShuffleLayerKernel()
+    : _func(nullptr), _input(nullptr), _output(nullptr), _num_groups(0)
+{
+}
+
+void NEChannelShuffleLayerKernel::configure(const ITensor *input, ITensor *output, unsigned int num_groups)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+
+    // Output tensor auto initialization if not yet initialized
+    auto_init_if_empty(*output->info(), *input->info()->clone());
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), num_groups));
+
+    _input      = input;
+    _output     = output;
+    _num_groups = num_groups;
+
+    // Configure kernel window: the innermost dimension is processed as a whole
+    Window win = calculate_max_window(*input->info(), Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    if(input->info()->data_layout() == DataLayout::NCHW)
+    {
+        _func = &NEChannelShuffleLayerKernel::shuffle_nchw;
+    }
+    else
+    {
+        switch(input->info()->element_size())
+        {
+            case 1:
+                _func = &NEChannelShuffleLayerKernel::shuffle_nhwc<uint8_t>;
+                break;
+            case 2:
+                _func = &NEChannelShuffleLayerKernel::shuffle_nhwc<uint16_t>;
+                break;
+            case 4:
+                _func = &NEChannelShuffleLayerKernel::shuffle_nhwc<uint32_t>;
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Element size not supported");
+                break;
+        }
+    }
+
+    // The NEChannelShuffleLayerKernel doesn't need padding so update_window_and_padding() can be skipped
+    Coordinates coord;
+    coord.set_num_dimensions(output->info()->num_dimensions());
+    output->info()->set_valid_region(ValidRegion(coord, output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+Status NEChannelShuffleLayerKernel::validate(const ITensorInfo *input, const ITensorInfo *output, unsigned int num_groups)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, num_groups));
+    return Status{};
+}
+
+void NEChannelShuffleLayerKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
+} // namespace arm_compute
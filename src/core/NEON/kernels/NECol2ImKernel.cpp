@@ -38,29 +38,32 @@ using namespace arm_compute;
 
 namespace
 {
-TensorShape get_output_shape(const ITensorInfo *input, const Size2D &convolved_dims)
+TensorShape get_output_shape(const ITensorInfo *input, const Size2D &convolved_dims, unsigned int num_groups)
 {
     TensorShape output_shape = input->tensor_shape();
     output_shape.set(0, convolved_dims.width);
     output_shape.set(1, convolved_dims.height);
-    output_shape.set(2, input->tensor_shape()[0]);
-    output_shape.set(3, input->tensor_shape()[3]); // For NEON the batch size is on the fourth dimension of the input tensor
+    output_shape.set(2, input->tensor_shape()[0] * num_groups);
+    // For NEON the batch size is on the fourth dimension of the input tensor, or on the third one when grouping
+    output_shape.set(3, (num_groups > 1) ? input->tensor_shape()[2] : input->tensor_shape()[3]);
 
     return output_shape;
 }
 
-Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const Size2D &convolved_dims)
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const Size2D &convolved_dims, unsigned int num_groups)
 {
     //Note: ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input) is not needed here as this kernel doesn't use NEON FP16 instructions.
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::S8, DataType::QASYMM8,
                                                          DataType::U16, DataType::S16,
                                                          DataType::U32, DataType::S32,
                                                          DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(num_groups == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON((num_groups > 1) && (input->dimension(3) != num_groups));
 
     // Validate configured output
     if(output->total_size() != 0)
     {
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), get_output_shape(input, convolved_dims));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), get_output_shape(input, convolved_dims, num_groups));
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
     }
 
@@ -74,11 +77,20 @@ void NECol2ImKernel::run_col2im(const Window &window)
     const int output_stride_x = _output->info()->strides_in_bytes().x();
     const int output_stride_y = _output->info()->strides_in_bytes().y();
     const int output_stride_z = _output->info()->strides_in_bytes().z();
+    const int output_stride_w = _output->info()->strides_in_bytes()[3];
+
+    // With grouping the input is [OFM / num_groups, M, batches, num_groups]: the batch and the group are handled by hand
+    const bool is_grouped    = _num_groups > 1;
+    const int  ofm_per_group = _input->info()->dimension(0);
 
     Window window_out(window);
     window_out.set(Window::DimX, Window::Dimension(0, 0, 0));
     window_out.set(Window::DimY, Window::Dimension(0, 0, 0));
     window_out.set(Window::DimZ, Window::Dimension(0, 0, 0));
+    if(is_grouped)
+    {
+        window_out.set(3, Window::Dimension(0, 0, 0));
+    }
 
     // Create iterators
     Iterator in(_input, window);
@@ -86,8 +98,10 @@ void NECol2ImKernel::run_col2im(const Window &window)
 
     execute_window_loop(window, [&](const Coordinates & id)
     {
-        const int hidx = id.y();
-        const int idx  = id.x() * output_stride_z + (hidx / _convolved_dims.width) * output_stride_y + (hidx % _convolved_dims.width) * output_stride_x;
+        const int hidx    = id.y();
+        const int channel = is_grouped ? id[3] * ofm_per_group + id.x() : id.x();
+        const int batch   = is_grouped ? id.z() * output_stride_w : 0;
+        const int idx     = batch + channel * output_stride_z + (hidx / _convolved_dims.width) * output_stride_y + (hidx % _convolved_dims.width) * output_stride_x;
 
         *(reinterpret_cast<T *>(out.ptr() + idx)) = *(reinterpret_cast<const T *>(in.ptr()));
     },
@@ -95,23 +109,24 @@ void NECol2ImKernel::run_col2im(const Window &window)
 }
 
 NECol2ImKernel::NECol2ImKernel()
-    : _func(), _input(nullptr), _output(nullptr), _convolved_dims()
+    : _func(), _input(nullptr), _output(nullptr), _convolved_dims(), _num_groups(1)
 {
 }
 
-void NECol2ImKernel::configure(const ITensor *input, ITensor *output, const Size2D &convolved_dims)
+void NECol2ImKernel::configure(const ITensor *input, ITensor *output, const Size2D &convolved_dims, unsigned int num_groups)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
 
     // Output auto inizialitation if not yet initialized
-    auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(get_output_shape(input->info(), convolved_dims)));
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(get_output_shape(input->info(), convolved_dims, num_groups)));
 
     // Perform validation step
-    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), convolved_dims));
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), convolved_dims, num_groups));
 
     _input          = input;
     _output         = output;
     _convolved_dims = convolved_dims;
+    _num_groups     = num_groups;
 
     switch(input->info()->element_size())
     {
@@ -140,9 +155,9 @@ void NECol2ImKernel::configure(const ITensor *input, ITensor *output, const Size
     INEKernel::configure(win);
 }
 
-Status NECol2ImKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const Size2D &convolved_dims)
+Status NECol2ImKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const Size2D &convolved_dims, unsigned int num_groups)
 {
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, convolved_dims));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, convolved_dims, num_groups));
     return Status{};
 }
 
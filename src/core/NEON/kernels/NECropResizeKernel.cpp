@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NECropResizeKernel.h"
+
+#include "arm_compute/core/AccessWindowStatic.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cstdint>
+#include <vector>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Compute the input position sampled by an output element along one dimension
+ *
+ * @param[in]  roi_start Scaled start coordinate of the ROI.
+ * @param[in]  bin_size  Scaled size of the ROI divided by the number of output elements.
+ * @param[in]  idx       Index of the output element.
+ * @param[in]  size      Size of the input plane along this dimension.
+ * @param[out] low       Index of the first neighbour.
+ * @param[out] high      Index of the second neighbour.
+ * @param[out] delta     Distance between the sampled coordinate and @p low.
+ *
+ * @return False if the sample falls outside of the input plane and has to be extrapolated.
+ */
+inline bool compute_sample(float roi_start, float bin_size, int idx, int size, int &low, int &high, float &delta)
+{
+    float coord = roi_start + (idx + 0.5f) * bin_size - 0.5f;
+
+    low   = 0;
+    high  = 0;
+    delta = 0.f;
+
+    if(coord < -1.f || coord > size)
+    {
+        return false;
+    }
+
+    coord = utility::clamp<float>(coord, 0.f, size - 1);
+    low   = static_cast<int>(coord);
+    high  = std::min(low + 1, size - 1);
+    delta = coord - low;
+
+    return true;
+}
+
+/** Bilinear interpolation of four neighbours, with the same weights and order of operations as @ref delta_bilinear_c1
+ *
+ * @param[in] a00 Top-left neighbours.
+ * @param[in] a01 Top-right neighbours.
+ * @param[in] a10 Bottom-left neighbours.
+ * @param[in] a11 Bottom-right neighbours.
+ * @param[in] dx  Horizontal distances between the sampled coordinates and the left neighbours.
+ * @param[in] dy  Vertical distances between the sampled coordinates and the top neighbours.
+ *
+ * @return The interpolated values
+ */
+inline float32x4_t delta_bilinear(float32x4_t a00, float32x4_t a01, float32x4_t a10, float32x4_t a11, float32x4_t dx, float32x4_t dy)
+{
+    const float32x4_t dx1 = vsubq_f32(vdupq_n_f32(1.f), dx);
+    const float32x4_t dy1 = vsubq_f32(vdupq_n_f32(1.f), dy);
+
+    const float32x4_t w1 = vmulq_f32(dx1, dy1);
+    const float32x4_t w2 = vmulq_f32(dx, dy1);
+    const float32x4_t w3 = vmulq_f32(dx1, dy);
+    const float32x4_t w4 = vmulq_f32(dx, dy);
+
+    float32x4_t res = vmulq_f32(a00, w1);
+    res             = vmlaq_f32(res, a01, w2);
+    res             = vmlaq_f32(res, a10, w3);
+    res             = vmlaq_f32(res, a11, w4);
+    return res;
+}
+} // namespace
+
+NECropResizeKernel::NECropResizeKernel()
+    : _input(nullptr), _rois(nullptr), _output(nullptr), _crop_info(0, 0, 0.f), _extrapolation_value(0.f)
+{
+}
+
+void NECropResizeKernel::configure(const ITensor *input, const IROIArray *rois, ITensor *output, const ROIPoolingLayerInfo &crop_info, float extrapolation_value)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, rois, output);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON((crop_info.pooled_width() == 0) || (crop_info.pooled_height() == 0));
+    ARM_COMPUTE_ERROR_ON(rois->num_values() == 0);
+
+    // Output auto inizialitation if not yet initialized
+    TensorShape output_shape(crop_info.pooled_width(), crop_info.pooled_height(), input->info()->dimension(2), rois->num_values());
+    auto_init_if_empty(*output->info(), output_shape, 1, input->info()->data_type());
+
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_ERROR_ON((output->info()->dimension(0) != crop_info.pooled_width()) || (output->info()->dimension(1) != crop_info.pooled_height()));
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(2) != input->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(3) != rois->num_values());
+
+    // Set instance variables
+    _input               = input;
+    _rois                = rois;
+    _output              = output;
+    _crop_info           = crop_info;
+    _extrapolation_value = extrapolation_value;
+
+    // Configure kernel window: the ROIs are distributed across the threads
+    Window window;
+    window.set(Window::DimX, Window::Dimension(0, rois->num_values()));
+    window.set(Window::DimY, Window::Dimension(0, 1));
+
+    AccessWindowStatic input_access(input->info(),
+                                    input->info()->valid_region().start(0),
+                                    input->info()->valid_region().start(1),
+                                    input->info()->valid_region().end(0),
+                                    input->info()->valid_region().end(1));
+    AccessWindowStatic output_access(output->info(), 0, 0, crop_info.pooled_width(), crop_info.pooled_height());
+
+    update_window_and_padding(window, input_access, output_access);
+    output_access.set_valid_region(window, ValidRegion(Coordinates(), output->info()->tensor_shape()));
+    INEKernel::configure(window);
+}
+
+void NECropResizeKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int   roi_list_start = window.x().start();
+    const int   roi_list_end   = window.x().end();
+    const int   width          = _input->info()->dimension(Window::DimX);
+    const int   height         = _input->info()->dimension(Window::DimY);
+    const int   fms            = _input->info()->dimension(Window::DimZ);
+    const int   crop_w         = _crop_info.pooled_width();
+    const int   crop_h         = _crop_info.pooled_height();
+    const float spatial_scale  = _crop_info.spatial_scale();
+
+    const Strides &in_strides  = _input->info()->strides_in_bytes();
+    const Strides &out_strides = _output->info()->strides_in_bytes();
+    const uint8_t *in_base     = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    uint8_t       *out_base    = _output->buffer() + _output->info()->offset_first_element_in_bytes();
+
+    // Sampling tables of the current ROI, shared by all its feature maps
+    std::vector<int>      x_low(crop_w);
+    std::vector<int>      x_high(crop_w);
+    std::vector<float>    x_delta(crop_w);
+    std::vector<uint32_t> x_mask(crop_w);
+    std::vector<int>      y_low(crop_h);
+    std::vector<int>      y_high(crop_h);
+    std::vector<float>    y_delta(crop_h);
+    std::vector<uint8_t>  y_valid(crop_h);
+
+    const float32x4_t extrapolation_value = vdupq_n_f32(_extrapolation_value);
+
+    for(int roi_indx = roi_list_start; roi_indx < roi_list_end; ++roi_indx)
+    {
+        const ROI &curr_roi = _rois->at(roi_indx);
+
+        // Scale ROI
+        const float roi_anchor_x = curr_roi.rect.x * spatial_scale;
+        const float roi_anchor_y = curr_roi.rect.y * spatial_scale;
+        const float roi_width    = std::max(curr_roi.rect.width * spatial_scale, 1.f);
+        const float roi_height   = std::max(curr_roi.rect.height * spatial_scale, 1.f);
+        const float bin_w        = roi_width / crop_w;
+        const float bin_h        = roi_height / crop_h;
+
+        for(int px = 0; px < crop_w; ++px)
+        {
+            const bool valid = compute_sample(roi_anchor_x, bin_w, px, width, x_low[px], x_high[px], x_delta[px]);
+            x_mask[px]       = valid ? 0xFFFFFFFF : 0;
+        }
+        for(int py = 0; py < crop_h; ++py)
+        {
+            y_valid[py] = compute_sample(roi_anchor_y, bin_h, py, height, y_low[py], y_high[py], y_delta[py]);
+        }
+
+        const uint8_t *in_batch = in_base + curr_roi.batch_idx * in_strides[3];
+        uint8_t       *out_roi  = out_base + roi_indx * out_strides[3];
+
+        // Iterate through all feature maps
+        for(int fm = 0; fm < fms; ++fm)
+        {
+            const uint8_t *in_plane  = in_batch + fm * in_strides[2];
+            uint8_t       *out_plane = out_roi + fm * out_strides[2];
+
+            for(int py = 0; py < crop_h; ++py)
+            {
+                const auto out_row = reinterpret_cast<float *>(out_plane + py * out_strides[1]);
+
+                if(!y_valid[py])
+                {
+                    std::fill_n(out_row, crop_w, _extrapolation_value);
+                    continue;
+                }
+
+                const auto        top    = reinterpret_cast<const float *>(in_plane + y_low[py] * in_strides[1]);
+                const auto        bottom = reinterpret_cast<const float *>(in_plane + y_high[py] * in_strides[1]);
+                const float32x4_t dy     = vdupq_n_f32(y_delta[py]);
+
+                int px = 0;
+                for(; px <= crop_w - 4; px += 4)
+                {
+                    // Gather the four neighbours of each output element
+                    float a00[4];
+                    float a01[4];
+                    float a10[4];
+                    float a11[4];
+                    for(int i = 0; i < 4; ++i)
+                    {
+                        a00[i] = top[x_low[px + i]];
+                        a01[i] = top[x_high[px + i]];
+                        a10[i] = bottom[x_low[px + i]];
+                        a11[i] = bottom[x_high[px + i]];
+                    }
+
+                    const float32x4_t res = delta_bilinear(vld1q_f32(a00), vld1q_f32(a01), vld1q_f32(a10), vld1q_f32(a11), vld1q_f32(x_delta.data() + px), dy);
+                    vst1q_f32(out_row + px, vbslq_f32(vld1q_u32(x_mask.data() + px), res, extrapolation_value));
+                }
+
+                // Left-over elements
+                for(; px < crop_w; ++px)
+                {
+                    if(x_mask[px] == 0)
+                    {
+                        out_row[px] = _extrapolation_value;
+                        continue;
+                    }
+
+                    const float dx  = x_delta[px];
+                    const float dx1 = 1.f - dx;
+                    const float dy1 = 1.f - y_delta[py];
+
+                    out_row[px] = top[x_low[px]] * (dx1 * dy1) + top[x_high[px]] * (dx * dy1) + bottom[x_low[px]] * (dx1 * y_delta[py]) + bottom[x_high[px]] * (dx * y_delta[py]);
+                }
+            }
+        }
+    }
+}
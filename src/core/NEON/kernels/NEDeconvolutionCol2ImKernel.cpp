@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEDeconvolutionCol2ImKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+
+#include <algorithm>
+
+using namespace arm_compute;
+
+namespace
+{
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *bias, const ITensorInfo *output, const Size2D &input_dims, const Size2D &kernel_dims, const PadStrideInfo &info,
+                          unsigned int inner_border_right, unsigned int inner_border_top)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(kernel_dims.area() == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(0) % kernel_dims.area() != 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(1) != input_dims.area());
+    ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(2) != 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(!info.padding_is_symmetric());
+    ARM_COMPUTE_RETURN_ERROR_ON(info.pad().first >= kernel_dims.width || info.pad().second >= kernel_dims.height);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(inner_border_right > info.stride().first - 1, "inner_border_right must be smaller than stride_x");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(inner_border_top > info.stride().second - 1, "inner_border_top must be smaller than stride_y");
+
+    const size_t num_kernels = input->dimension(0) / kernel_dims.area();
+
+    if(bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, bias);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != num_kernels);
+    }
+
+    const auto out_dims = deconvolution_output_dimensions(input_dims.width, input_dims.height, kernel_dims.width, kernel_dims.height,
+                                                          info.pad().first, info.pad().second, inner_border_right, inner_border_top,
+                                                          info.stride().first, info.stride().second);
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON(output->data_layout() != DataLayout::NCHW);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(output->dimension(0) != out_dims.first, "Output's width is invalid.");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(output->dimension(1) != out_dims.second, "Output's height is invalid.");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(output->dimension(2) != num_kernels, "Output's depth is invalid.");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(output->tensor_shape().total_size_upper(3) != input->tensor_shape().total_size_upper(3), "Output's batches are invalid.");
+
+    return Status{};
+}
+} // namespace
+
+NEDeconvolutionCol2ImKernel::NEDeconvolutionCol2ImKernel()
+    : _input(nullptr), _bias(nullptr), _output(nullptr), _input_dims(), _kernel_dims(), _info(), _x_kernel_start(), _x_input_start(), _y_kernel_start(), _y_input_start()
+{
+}
+
+void NEDeconvolutionCol2ImKernel::compute_start_tables(int output_size, int kernel_size, int stride, int offset, std::vector<int> &kernel_start, std::vector<int> &input_start)
+{
+    kernel_start.resize(output_size);
+    input_start.resize(output_size);
+
+    // Input element i lands at offset + i * stride in the upsampled image, which output o reads through the kernel tap k = offset + i * stride - o
+    for(int o = 0; o < output_size; ++o)
+    {
+        const int t = o - offset;
+        if(t >= 0)
+        {
+            kernel_start[o] = (stride - t % stride) % stride;
+            input_start[o]  = (t + kernel_start[o]) / stride;
+        }
+        else
+        {
+            // Taps beyond kernel_size simply don't contribute
+            kernel_start[o] = std::min(-t, kernel_size);
+            input_start[o]  = 0;
+        }
+    }
+}
+
+void NEDeconvolutionCol2ImKernel::configure(const ITensor *input, const ITensor *bias, ITensor *output, const Size2D &input_dims, const Size2D &kernel_dims, const PadStrideInfo &info,
+                                            unsigned int inner_border_right, unsigned int inner_border_top)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_UNUSED(inner_border_right);
+
+    // Perform validation step
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), (bias != nullptr) ? bias->info() : nullptr, output->info(), input_dims, kernel_dims, info, inner_border_right, inner_border_top));
+
+    _input       = input;
+    _bias        = bias;
+    _output      = output;
+    _input_dims  = input_dims;
+    _kernel_dims = kernel_dims;
+    _info        = info;
+
+    compute_start_tables(output->info()->dimension(0), kernel_dims.width, info.stride().first, info.pad().first, _x_kernel_start, _x_input_start);
+    compute_start_tables(output->info()->dimension(1), kernel_dims.height, info.stride().second, inner_border_top + info.pad().second, _y_kernel_start, _y_input_start);
+
+    // Configure kernel window: each iteration computes a full output row
+    Window win = calculate_max_window(*output->info(), Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    // The NEDeconvolutionCol2ImKernel doesn't need padding so update_window_and_padding() can be skipped
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+Status NEDeconvolutionCol2ImKernel::validate(const ITensorInfo *input, const ITensorInfo *bias, const ITensorInfo *output, const Size2D &input_dims, const Size2D &kernel_dims,
+                                             const PadStrideInfo &info, unsigned int inner_border_right, unsigned int inner_border_top)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, bias, output, input_dims, kernel_dims, info, inner_border_right, inner_border_top));
+    return Status{};
+}
+
+void NEDeconvolutionCol2ImKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int input_w      = _input_dims.width;
+    const int input_h      = _input_dims.height;
+    const int kernel_w     = _kernel_dims.width;
+    const int kernel_h     = _kernel_dims.height;
+    const int stride_x     = _info.stride().first;
+    const int stride_y     = _info.stride().second;
+    const int output_w     = _output->info()->dimension(0);
+    const int col_stride_y = _input->info()->strides_in_bytes().y();
+    const int col_stride_b = _input->info()->strides_in_bytes()[3];
+
+    const uint8_t *col_base = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+
+    Iterator out(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int ofm = id.z();
+
+        // All the contributions to this output row come from the same (ofm, batch) block of columns
+        const uint8_t *col_ptr = col_base + id[3] * col_stride_b + kernel_w * kernel_h * ofm * sizeof(float);
+        const float    b       = (_bias != nullptr) ? *reinterpret_cast<const float *>(_bias->ptr_to_element(Coordinates(ofm))) : 0.f;
+        float *const   out_ptr = reinterpret_cast<float *>(out.ptr());
+        const int      ky0     = _y_kernel_start[id.y()];
+        const int      iy0     = _y_input_start[id.y()];
+
+        for(int ox = 0; ox < output_w; ++ox)
+        {
+            const int kx0 = _x_kernel_start[ox];
+            const int ix0 = _x_input_start[ox];
+
+            float acc = b;
+            for(int ky = ky0, iy = iy0; ky < kernel_h && iy < input_h; ky += stride_y, ++iy)
+            {
+                const uint8_t *row_ptr = col_ptr + iy * input_w * col_stride_y;
+                for(int kx = kx0, ix = ix0; kx < kernel_w && ix < input_w; kx += stride_x, ++ix)
+                {
+                    acc += *(reinterpret_cast<const float *>(row_ptr + ix * col_stride_y) + kx + kernel_w * ky);
+                }
+            }
+            out_ptr[ox] = acc;
+        }
+    },
+    out);
+}
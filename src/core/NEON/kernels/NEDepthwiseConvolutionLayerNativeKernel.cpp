@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEDepthwiseConvolutionLayerNativeKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEAsymm.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+
+using namespace arm_compute;
+using namespace arm_compute::misc::shape_calculator;
+
+namespace
+{
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info, unsigned int depth_multiplier,
+                          const Size2D &dilation)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->data_layout() != DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON(depth_multiplier == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(dilation.x() < 1 || dilation.y() < 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) != input->dimension(0) * depth_multiplier);
+    ARM_COMPUTE_RETURN_ERROR_ON((weights->dimension(1) - 1) * dilation.x() + 1 > input->dimension(1) + conv_info.pad_left() + conv_info.pad_right());
+    ARM_COMPUTE_RETURN_ERROR_ON((weights->dimension(2) - 1) * dilation.y() + 1 > input->dimension(2) + conv_info.pad_top() + conv_info.pad_bottom());
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->dimension(0) != weights->dimension(0));
+
+        if(is_data_type_quantized_asymmetric(input->data_type()))
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::S32);
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        }
+    }
+
+    if(output->total_size() != 0)
+    {
+        const TensorShape output_shape = compute_depthwise_convolution_shape(*input, *weights, conv_info, depth_multiplier, dilation);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), output_shape);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, output);
+    }
+
+    return Status{};
+}
+
+std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *weights, ITensorInfo *output, const PadStrideInfo &conv_info, unsigned int depth_multiplier,
+                                                        const Size2D &dilation)
+{
+    const TensorShape output_shape = compute_depthwise_convolution_shape(*input, *weights, conv_info, depth_multiplier, dilation);
+
+    // Output auto inizialitation if not yet initialized
+    auto_init_if_empty(*output, input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(output_shape));
+
+    // The channels of an output pixel are computed by a single iteration, with leftovers handled within the kernel.
+    // Taps falling outside the input are skipped, hence no padding is required.
+    Window win = calculate_max_window(*output, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    output->set_valid_region(ValidRegion(Coordinates(), output->tensor_shape()));
+
+    return std::make_pair(Status{}, win);
+}
+} // namespace
+
+NEDepthwiseConvolutionLayerNativeKernel::NEDepthwiseConvolutionLayerNativeKernel()
+    : _func(nullptr), _input(nullptr), _weights(nullptr), _biases(nullptr), _output(nullptr), _conv_info(), _depth_multiplier(1), _dilation(1U, 1U), _output_multiplier(0), _output_shift(0)
+{
+}
+
+void NEDepthwiseConvolutionLayerNativeKernel::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                                                        unsigned int depth_multiplier, const Size2D &dilation)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+
+    // Output auto inizialitation if not yet initialized
+    const TensorShape output_shape = compute_depthwise_convolution_shape(*input->info(), *weights->info(), conv_info, depth_multiplier, dilation);
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(output_shape));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr, output->info(), conv_info, depth_multiplier, dilation));
+
+    _input            = input;
+    _weights          = weights;
+    _biases           = biases;
+    _output           = output;
+    _conv_info        = conv_info;
+    _depth_multiplier = depth_multiplier;
+    _dilation         = dilation;
+
+    if(is_data_type_quantized_asymmetric(input->info()->data_type()))
+    {
+        const QuantizationInfo input_qinfo   = input->info()->quantization_info();
+        const QuantizationInfo weights_qinfo = weights->info()->quantization_info();
+        const QuantizationInfo output_qinfo  = output->info()->quantization_info();
+
+        const float multiplier = input_qinfo.scale * weights_qinfo.scale / output_qinfo.scale;
+        quantization::calculate_quantized_multiplier_less_than_one(multiplier, &_output_multiplier, &_output_shift);
+
+        _func = &NEDepthwiseConvolutionLayerNativeKernel::run_quantized;
+    }
+    else
+    {
+        _func = &NEDepthwiseConvolutionLayerNativeKernel::run_float;
+    }
+
+    // Configure kernel window
+    auto win_config = validate_and_configure_window(input->info(), weights->info(), output->info(), conv_info, depth_multiplier, dilation);
+    ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
+    INEKernel::configure(win_config.second);
+}
+
+Status NEDepthwiseConvolutionLayerNativeKernel::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                                         unsigned int depth_multiplier, const Size2D &dilation)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, weights, biases, output, conv_info, depth_multiplier, dilation));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), weights->clone().get(), output->clone().get(), conv_info, depth_multiplier, dilation).first);
+    return Status{};
+}
+
+void NEDepthwiseConvolutionLayerNativeKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
+
+void NEDepthwiseConvolutionLayerNativeKernel::run_float(const Window &window)
+{
+    const int num_channels   = _output->info()->dimension(0);
+    const int input_width    = _input->info()->dimension(1);
+    const int input_height   = _input->info()->dimension(2);
+    const int kernel_width   = _weights->info()->dimension(1);
+    const int kernel_height  = _weights->info()->dimension(2);
+    const int conv_stride_x  = _conv_info.stride().first;
+    const int conv_stride_y  = _conv_info.stride().second;
+    const int conv_pad_left  = _conv_info.pad_left();
+    const int conv_pad_top   = _conv_info.pad_top();
+    const int dilation_x     = _dilation.x();
+    const int dilation_y     = _dilation.y();
+    const int dm             = _depth_multiplier;
+    const int num_vectorized = (dm == 1) ? (num_channels / 4) * 4 : 0;
+
+    const size_t input_stride_y   = _input->info()->strides_in_bytes()[1];
+    const size_t input_stride_z   = _input->info()->strides_in_bytes()[2];
+    const size_t input_stride_w   = _input->info()->strides_in_bytes()[3];
+    const size_t weights_stride_y = _weights->info()->strides_in_bytes()[1];
+    const size_t weights_stride_z = _weights->info()->strides_in_bytes()[2];
+
+    const uint8_t *input_base   = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    const uint8_t *weights_base = _weights->buffer() + _weights->info()->offset_first_element_in_bytes();
+    const float   *biases_ptr   = (_biases != nullptr) ? reinterpret_cast<const float *>(_biases->buffer() + _biases->info()->offset_first_element_in_bytes()) : nullptr;
+
+    Iterator out(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int      in_x0    = id.y() * conv_stride_x - conv_pad_left;
+        const int      in_y0    = id.z() * conv_stride_y - conv_pad_top;
+        const uint8_t *in_batch = input_base + id[3] * input_stride_w;
+        auto           out_ptr  = reinterpret_cast<float *>(out.ptr());
+
+        int c = 0;
+        for(; c < num_vectorized; c += 4)
+        {
+            float32x4_t acc = (biases_ptr != nullptr) ? vld1q_f32(biases_ptr + c) : vdupq_n_f32(0.f);
+
+            for(int ky = 0; ky < kernel_height; ++ky)
+            {
+                const int in_y = in_y0 + ky * dilation_y;
+                if(in_y < 0 || in_y >= input_height)
+                {
+                    continue;
+                }
+
+                for(int kx = 0; kx < kernel_width; ++kx)
+                {
+                    const int in_x = in_x0 + kx * dilation_x;
+                    if(in_x < 0 || in_x >= input_width)
+                    {
+                        continue;
+                    }
+
+                    const auto in_ptr = reinterpret_cast<const float *>(in_batch + in_x * input_stride_y + in_y * input_stride_z);
+                    const auto w_ptr  = reinterpret_cast<const float *>(weights_base + kx * weights_stride_y + ky * weights_stride_z);
+                    acc               = vmlaq_f32(acc, vld1q_f32(in_ptr + c), vld1q_f32(w_ptr + c));
+                }
+            }
+
+            vst1q_f32(out_ptr + c, acc);
+        }
+
+        // Left-over channels and depth multipliers greater than one
+        for(; c < num_channels; ++c)
+        {
+            const int in_c = c / dm;
+            float     acc  = (biases_ptr != nullptr) ? biases_ptr[c] : 0.f;
+
+            for(int ky = 0; ky < kernel_height; ++ky)
+            {
+                const int in_y = in_y0 + ky * dilation_y;
+                if(in_y < 0 || in_y >= input_height)
+                {
+                    continue;
+                }
+
+                for(int kx = 0; kx < kernel_width; ++kx)
+                {
+                    const int in_x = in_x0 + kx * dilation_x;
+                    if(in_x < 0 || in_x >= input_width)
+                    {
+                        continue;
+                    }
+
+                    const auto in_ptr = reinterpret_cast<const float *>(in_batch + in_x * input_stride_y + in_y * input_stride_z);
+                    const auto w_ptr  = reinterpret_cast<const float *>(weights_base + kx * weights_stride_y + ky * weights_stride_z);
+                    acc += in_ptr[in_c] * w_ptr[c];
+                }
+            }
+
+            out_ptr[c] = acc;
+        }
+    },
+    out);
+}
+
+void NEDepthwiseConvolutionLayerNativeKernel::run_quantized(const Window &window)
+{
+    const int num_channels   = _output->info()->dimension(0);
+    const int input_width    = _input->info()->dimension(1);
+    const int input_height   = _input->info()->dimension(2);
+    const int kernel_width   = _weights->info()->dimension(1);
+    const int kernel_height  = _weights->info()->dimension(2);
+    const int conv_stride_x  = _conv_info.stride().first;
+    const int conv_stride_y  = _conv_info.stride().second;
+    const int conv_pad_left  = _conv_info.pad_left();
+    const int conv_pad_top   = _conv_info.pad_top();
+    const int dilation_x     = _dilation.x();
+    const int dilation_y     = _dilation.y();
+    const int dm             = _depth_multiplier;
+    const int num_vectorized = (dm == 1) ? (num_channels / 16) * 16 : 0;
+
+    const int input_offset   = -_input->info()->quantization_info().offset;
+    const int weights_offset = -_weights->info()->quantization_info().offset;
+    const int output_offset  = _output->info()->quantization_info().offset;
+
+    const int16x8_t  input_offset_s16   = vdupq_n_s16(input_offset);
+    const int16x8_t  weights_offset_s16 = vdupq_n_s16(weights_offset);
+    const int32x4_t  output_offset_s32  = vdupq_n_s32(output_offset);
+    const int32x4_t  zero_s32           = vdupq_n_s32(0);
+    const uint8x16_t min_u8             = vdupq_n_u8(0);
+    const uint8x16_t max_u8             = vdupq_n_u8(255);
+
+    const size_t input_stride_y   = _input->info()->strides_in_bytes()[1];
+    const size_t input_stride_z   = _input->info()->strides_in_bytes()[2];
+    const size_t input_stride_w   = _input->info()->strides_in_bytes()[3];
+    const size_t weights_stride_y = _weights->info()->strides_in_bytes()[1];
+    const size_t weights_stride_z = _weights->info()->strides_in_bytes()[2];
+
+    const uint8_t *input_base   = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    const uint8_t *weights_base = _weights->buffer() + _weights->info()->offset_first_element_in_bytes();
+    const int32_t *biases_ptr   = (_biases != nullptr) ? reinterpret_cast<const int32_t *>(_biases->buffer() + _biases->info()->offset_first_element_in_bytes()) : nullptr;
+
+    Iterator out(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int      in_x0    = id.y() * conv_stride_x - conv_pad_left;
+        const int      in_y0    = id.z() * conv_stride_y - conv_pad_top;
+        const uint8_t *in_batch = input_base + id[3] * input_stride_w;
+        uint8_t       *out_ptr  = out.ptr();
+
+        int c = 0;
+        for(; c < num_vectorized; c += 16)
+        {
+            int32x4x4_t acc =
+            {
+                {
+                    (biases_ptr != nullptr) ? vld1q_s32(biases_ptr + c) : zero_s32,
+                    (biases_ptr != nullptr) ? vld1q_s32(biases_ptr + c + 4) : zero_s32,
+                    (biases_ptr != nullptr) ? vld1q_s32(biases_ptr + c + 8) : zero_s32,
+                    (biases_ptr != nullptr) ? vld1q_s32(biases_ptr + c + 12) : zero_s32
+                }
+            };
+
+            for(int ky = 0; ky < kernel_height; ++ky)
+            {
+                const int in_y = in_y0 + ky * dilation_y;
+                if(in_y < 0 || in_y >= input_height)
+                {
+                    continue;
+                }
+
+                for(int kx = 0; kx < kernel_width; ++kx)
+                {
+                    const int in_x = in_x0 + kx * dilation_x;
+                    if(in_x < 0 || in_x >= input_width)
+                    {
+                        continue;
+                    }
+
+                    const uint8x16_t in_u8 = vld1q_u8(in_batch + in_x * input_stride_y + in_y * input_stride_z + c);
+                    const uint8x16_t w_u8  = vld1q_u8(weights_base + kx * weights_stride_y + ky * weights_stride_z + c);
+
+                    const int16x8_t in_low  = vaddq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(in_u8))), input_offset_s16);
+                    const int16x8_t in_high = vaddq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(in_u8))), input_offset_s16);
+                    const int16x8_t w_low   = vaddq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(w_u8))), weights_offset_s16);
+                    const int16x8_t w_high  = vaddq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(w_u8))), weights_offset_s16);
+
+                    acc.val[0] = vmlal_s16(acc.val[0], vget_low_s16(in_low), vget_low_s16(w_low));
+                    acc.val[1] = vmlal_s16(acc.val[1], vget_high_s16(in_low), vget_high_s16(w_low));
+                    acc.val[2] = vmlal_s16(acc.val[2], vget_low_s16(in_high), vget_low_s16(w_high));
+                    acc.val[3] = vmlal_s16(acc.val[3], vget_high_s16(in_high), vget_high_s16(w_high));
+                }
+            }
+
+            vst1q_u8(out_ptr + c, finalize_quantization<false>(acc, _output_multiplier, _output_shift, output_offset_s32, min_u8, max_u8));
+        }
+
+        // Left-over channels and depth multipliers greater than one: accumulate up to 16 channels and requantize them together
+        for(; c < num_channels; c += 16)
+        {
+            const int num_left       = std::min(16, num_channels - c);
+            int32_t   acc_buffer[16] = { 0 };
+
+            for(int i = 0; i < num_left; ++i)
+            {
+                const int oc   = c + i;
+                const int in_c = oc / dm;
+                int32_t   acc  = (biases_ptr != nullptr) ? biases_ptr[oc] : 0;
+
+                for(int ky = 0; ky < kernel_height; ++ky)
+                {
+                    const int in_y = in_y0 + ky * dilation_y;
+                    if(in_y < 0 || in_y >= input_height)
+                    {
+                        continue;
+                    }
+
+                    for(int kx = 0; kx < kernel_width; ++kx)
+                    {
+                        const int in_x = in_x0 + kx * dilation_x;
+                        if(in_x < 0 || in_x >= input_width)
+                        {
+                            continue;
+                        }
+
+                        const uint8_t in_val = *(in_batch + in_x * input_stride_y + in_y * input_stride_z + in_c);
+                        const uint8_t w_val  = *(weights_base + kx * weights_stride_y + ky * weights_stride_z + oc);
+                        acc += (in_val + input_offset) * (w_val + weights_offset);
+                    }
+                }
+
+                acc_buffer[i] = acc;
+            }
+
+            int32x4x4_t acc =
+            {
+                {
+                    vld1q_s32(acc_buffer),
+                    vld1q_s32(acc_buffer + 4),
+                    vld1q_s32(acc_buffer + 8),
+                    vld1q_s32(acc_buffer + 12)
+                }
+            };
+
+            uint8_t res_buffer[16];
+            vst1q_u8(res_buffer, finalize_quantization<false>(acc, _output_multiplier, _output_shift, output_offset_s32, min_u8, max_u8));
+            std::copy_n(res_buffer, num_left, out_ptr + c);
+        }
+    },
+    out);
+}
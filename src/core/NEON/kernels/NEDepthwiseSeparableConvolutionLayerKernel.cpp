@@ -0,0 +1,416 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEDepthwiseSeparableConvolutionLayerKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <limits>
+#include <vector>
+
+using namespace arm_compute;
+using namespace arm_compute::misc::shape_calculator;
+
+namespace
+{
+constexpr int num_pixels_tile      = 4;
+constexpr int num_outputs_per_pass = 4;
+
+bool is_supported_activation(const ActivationLayerInfo &act_info)
+{
+    if(!act_info.enabled())
+    {
+        return true;
+    }
+
+    switch(act_info.activation())
+    {
+        case ActivationLayerInfo::ActivationFunction::RELU:
+        case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+        case ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/** Get the clamping interval corresponding to a rectifier activation */
+std::pair<float, float> get_activation_bounds(const ActivationLayerInfo &act_info)
+{
+    float min_val = std::numeric_limits<float>::lowest();
+    float max_val = std::numeric_limits<float>::max();
+
+    if(act_info.enabled())
+    {
+        switch(act_info.activation())
+        {
+            case ActivationLayerInfo::ActivationFunction::RELU:
+                min_val = 0.f;
+                break;
+            case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+                min_val = 0.f;
+                max_val = act_info.a();
+                break;
+            case ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU:
+                min_val = act_info.b();
+                max_val = act_info.a();
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Activation function not supported");
+        }
+    }
+
+    return std::make_pair(min_val, max_val);
+}
+
+inline float reduce_add(float32x4_t v)
+{
+    const float32x2_t sum = vpadd_f32(vget_low_f32(v), vget_high_f32(v));
+    return vget_lane_f32(vpadd_f32(sum, sum), 0);
+}
+
+TensorShape compute_output_shape(const ITensorInfo &input, const ITensorInfo &depthwise_weights, const ITensorInfo &pointwise_weights, const PadStrideInfo &depthwise_conv_info)
+{
+    TensorShape output_shape = compute_depthwise_convolution_shape(input, depthwise_weights, depthwise_conv_info, 1);
+    output_shape.set(0, pointwise_weights.dimension(3));
+    return output_shape;
+}
+
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *depthwise_weights, const ITensorInfo *depthwise_biases, const ITensorInfo *pointwise_weights,
+                          const ITensorInfo *pointwise_biases, const ITensorInfo *output, const PadStrideInfo &depthwise_conv_info,
+                          const ActivationLayerInfo &depthwise_act_info, const ActivationLayerInfo &pointwise_act_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, depthwise_weights, pointwise_weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, depthwise_weights, pointwise_weights);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->data_layout() != DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON(!is_supported_activation(depthwise_act_info));
+    ARM_COMPUTE_RETURN_ERROR_ON(!is_supported_activation(pointwise_act_info));
+
+    const unsigned int num_channels = input->dimension(0);
+
+    ARM_COMPUTE_RETURN_ERROR_ON(depthwise_weights->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(depthwise_weights->dimension(0) != num_channels);
+    ARM_COMPUTE_RETURN_ERROR_ON(depthwise_weights->dimension(1) > input->dimension(1) + depthwise_conv_info.pad_left() + depthwise_conv_info.pad_right());
+    ARM_COMPUTE_RETURN_ERROR_ON(depthwise_weights->dimension(2) > input->dimension(2) + depthwise_conv_info.pad_top() + depthwise_conv_info.pad_bottom());
+    ARM_COMPUTE_RETURN_ERROR_ON(pointwise_weights->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(pointwise_weights->dimension(0) != num_channels);
+    ARM_COMPUTE_RETURN_ERROR_ON(pointwise_weights->dimension(1) != 1 || pointwise_weights->dimension(2) != 1);
+
+    if(depthwise_biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, depthwise_biases);
+        ARM_COMPUTE_RETURN_ERROR_ON(depthwise_biases->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(depthwise_biases->dimension(0) != num_channels);
+    }
+
+    if(pointwise_biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, pointwise_biases);
+        ARM_COMPUTE_RETURN_ERROR_ON(pointwise_biases->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(pointwise_biases->dimension(0) != pointwise_weights->dimension(3));
+    }
+
+    if(output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), compute_output_shape(*input, *depthwise_weights, *pointwise_weights, depthwise_conv_info));
+    }
+
+    return Status{};
+}
+
+std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *depthwise_weights, ITensorInfo *pointwise_weights, ITensorInfo *output,
+                                                        const PadStrideInfo &depthwise_conv_info)
+{
+    // Output auto inizialitation if not yet initialized
+    auto_init_if_empty(*output, input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_output_shape(*input, *depthwise_weights, *pointwise_weights, depthwise_conv_info)));
+
+    // Each iteration computes all the output channels of a tile of pixels along the width, left-over pixels are handled within the kernel
+    Window win = calculate_max_window(*output, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, ceil_to_multiple(output->dimension(1), num_pixels_tile), num_pixels_tile));
+
+    output->set_valid_region(ValidRegion(Coordinates(), output->tensor_shape()));
+
+    return std::make_pair(Status{}, win);
+}
+} // namespace
+
+NEDepthwiseSeparableConvolutionLayerKernel::NEDepthwiseSeparableConvolutionLayerKernel()
+    : _input(nullptr), _depthwise_weights(nullptr), _depthwise_biases(nullptr), _pointwise_weights(nullptr), _pointwise_biases(nullptr), _output(nullptr),
+      _depthwise_conv_info(), _depthwise_min(0.f), _depthwise_max(0.f), _pointwise_min(0.f), _pointwise_max(0.f)
+{
+}
+
+unsigned int NEDepthwiseSeparableConvolutionLayerKernel::num_pixels_per_tile()
+{
+    return num_pixels_tile;
+}
+
+void NEDepthwiseSeparableConvolutionLayerKernel::configure(const ITensor *input, const ITensor *depthwise_weights, const ITensor *depthwise_biases, const ITensor *pointwise_weights,
+                                                           const ITensor *pointwise_biases, ITensor *output, const PadStrideInfo &depthwise_conv_info,
+                                                           const ActivationLayerInfo &depthwise_act_info, const ActivationLayerInfo &pointwise_act_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, depthwise_weights, pointwise_weights, output);
+
+    // Output auto inizialitation if not yet initialized
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_output_shape(*input->info(), *depthwise_weights->info(),
+                                                                                                                                                 *pointwise_weights->info(), depthwise_conv_info)));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), depthwise_weights->info(), (depthwise_biases != nullptr) ? depthwise_biases->info() : nullptr, pointwise_weights->info(),
+                                                  (pointwise_biases != nullptr) ? pointwise_biases->info() : nullptr, output->info(), depthwise_conv_info,
+                                                  depthwise_act_info, pointwise_act_info));
+
+    _input               = input;
+    _depthwise_weights   = depthwise_weights;
+    _depthwise_biases    = depthwise_biases;
+    _pointwise_weights   = pointwise_weights;
+    _pointwise_biases    = pointwise_biases;
+    _output              = output;
+    _depthwise_conv_info = depthwise_conv_info;
+
+    std::tie(_depthwise_min, _depthwise_max) = get_activation_bounds(depthwise_act_info);
+    std::tie(_pointwise_min, _pointwise_max) = get_activation_bounds(pointwise_act_info);
+
+    // Configure kernel window
+    auto win_config = validate_and_configure_window(input->info(), depthwise_weights->info(), pointwise_weights->info(), output->info(), depthwise_conv_info);
+    ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
+    INEKernel::configure(win_config.second);
+}
+
+Status NEDepthwiseSeparableConvolutionLayerKernel::validate(const ITensorInfo *input, const ITensorInfo *depthwise_weights, const ITensorInfo *depthwise_biases,
+                                                            const ITensorInfo *pointwise_weights, const ITensorInfo *pointwise_biases, const ITensorInfo *output,
+                                                            const PadStrideInfo &depthwise_conv_info,
+                                                            const ActivationLayerInfo &depthwise_act_info, const ActivationLayerInfo &pointwise_act_info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, depthwise_weights, depthwise_biases, pointwise_weights, pointwise_biases, output, depthwise_conv_info,
+                                                   depthwise_act_info, pointwise_act_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), depthwise_weights->clone().get(), pointwise_weights->clone().get(), output->clone().get(),
+                                                              depthwise_conv_info)
+                                .first);
+    return Status{};
+}
+
+void NEDepthwiseSeparableConvolutionLayerKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_UNUSED(info);
+
+    const int num_channels  = _input->info()->dimension(0);
+    const int input_width   = _input->info()->dimension(1);
+    const int input_height  = _input->info()->dimension(2);
+    const int kernel_width  = _depthwise_weights->info()->dimension(1);
+    const int kernel_height = _depthwise_weights->info()->dimension(2);
+    const int num_outputs   = _output->info()->dimension(0);
+    const int output_width  = _output->info()->dimension(1);
+    const int conv_stride_x = _depthwise_conv_info.stride().first;
+    const int conv_stride_y = _depthwise_conv_info.stride().second;
+    const int conv_pad_left = _depthwise_conv_info.pad_left();
+    const int conv_pad_top  = _depthwise_conv_info.pad_top();
+    const int num_vectors   = num_channels / 4;
+
+    const size_t input_stride_y             = _input->info()->strides_in_bytes()[1];
+    const size_t input_stride_z             = _input->info()->strides_in_bytes()[2];
+    const size_t input_stride_w             = _input->info()->strides_in_bytes()[3];
+    const size_t depthwise_weights_stride_y = _depthwise_weights->info()->strides_in_bytes()[1];
+    const size_t depthwise_weights_stride_z = _depthwise_weights->info()->strides_in_bytes()[2];
+    const size_t pointwise_weights_stride_w = _pointwise_weights->info()->strides_in_bytes()[3];
+    const size_t output_stride_y            = _output->info()->strides_in_bytes()[1];
+
+    const uint8_t *input_base             = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    const uint8_t *depthwise_weights_base = _depthwise_weights->buffer() + _depthwise_weights->info()->offset_first_element_in_bytes();
+    const uint8_t *pointwise_weights_base = _pointwise_weights->buffer() + _pointwise_weights->info()->offset_first_element_in_bytes();
+    const float   *depthwise_biases_ptr   = (_depthwise_biases != nullptr) ? reinterpret_cast<const float *>(_depthwise_biases->buffer() + _depthwise_biases->info()->offset_first_element_in_bytes()) :
+                                            nullptr;
+    const float *pointwise_biases_ptr = (_pointwise_biases != nullptr) ? reinterpret_cast<const float *>(_pointwise_biases->buffer() + _pointwise_biases->info()->offset_first_element_in_bytes()) :
+                                        nullptr;
+
+    // Depthwise results of the current tile, one row of channels per pixel.
+    // The buffer is owned by this call so that it does not depend on the number of threads the scheduler had at configuration time
+    std::vector<float> tile_buffer(num_pixels_tile * num_channels);
+    float             *tile = tile_buffer.data();
+
+    const float32x4_t depthwise_min = vdupq_n_f32(_depthwise_min);
+    const float32x4_t depthwise_max = vdupq_n_f32(_depthwise_max);
+
+    Iterator out(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int      num_pixels = std::min(num_pixels_tile, output_width - id.y());
+        const int      in_y0      = id.z() * conv_stride_y - conv_pad_top;
+        const uint8_t *in_batch   = input_base + id[3] * input_stride_w;
+
+        // Depthwise stage: compute the tile and keep it in the workspace
+        for(int p = 0; p < num_pixels; ++p)
+        {
+            const int in_x0    = (id.y() + p) * conv_stride_x - conv_pad_left;
+            float    *tile_row = tile + p * num_channels;
+
+            for(int c = 0; c < num_channels; c += 4)
+            {
+                const bool  is_leftover = (c + 4 > num_channels);
+                float32x4_t acc         = vdupq_n_f32(0.f);
+                float       acc_left[4] = { 0.f, 0.f, 0.f, 0.f };
+
+                for(int ky = 0; ky < kernel_height; ++ky)
+                {
+                    const int in_y = in_y0 + ky;
+                    if(in_y < 0 || in_y >= input_height)
+                    {
+                        continue;
+                    }
+
+                    for(int kx = 0; kx < kernel_width; ++kx)
+                    {
+                        const int in_x = in_x0 + kx;
+                        if(in_x < 0 || in_x >= input_width)
+                        {
+                            continue;
+                        }
+
+                        const auto in_ptr = reinterpret_cast<const float *>(in_batch + in_x * input_stride_y + in_y * input_stride_z) + c;
+                        const auto w_ptr  = reinterpret_cast<const float *>(depthwise_weights_base + kx * depthwise_weights_stride_y + ky * depthwise_weights_stride_z) + c;
+
+                        if(is_leftover)
+                        {
+                            for(int i = 0; i < num_channels - c; ++i)
+                            {
+                                acc_left[i] += in_ptr[i] * w_ptr[i];
+                            }
+                        }
+                        else
+                        {
+                            acc = vmlaq_f32(acc, vld1q_f32(in_ptr), vld1q_f32(w_ptr));
+                        }
+                    }
+                }
+
+                if(is_leftover)
+                {
+                    for(int i = 0; i < num_channels - c; ++i)
+                    {
+                        const float res = acc_left[i] + ((depthwise_biases_ptr != nullptr) ? depthwise_biases_ptr[c + i] : 0.f);
+                        tile_row[c + i] = std::min(std::max(res, _depthwise_min), _depthwise_max);
+                    }
+                }
+                else
+                {
+                    if(depthwise_biases_ptr != nullptr)
+                    {
+                        acc = vaddq_f32(acc, vld1q_f32(depthwise_biases_ptr + c));
+                    }
+                    vst1q_f32(tile_row + c, vminq_f32(vmaxq_f32(acc, depthwise_min), depthwise_max));
+                }
+            }
+        }
+
+        // Zero the unused rows of a partial tile so the pointwise stage can always process full tiles
+        std::fill(tile + num_pixels * num_channels, tile + num_pixels_tile * num_channels, 0.f);
+
+        // Pointwise stage: each row of pointwise weights is loaded once for the whole tile
+        for(int o = 0; o < num_outputs; o += num_outputs_per_pass)
+        {
+            const int num_left = std::min(num_outputs_per_pass, num_outputs - o);
+
+            float32x4_t acc[num_outputs_per_pass][num_pixels_tile];
+            float       res[num_pixels_tile][num_outputs_per_pass];
+            for(int k = 0; k < num_outputs_per_pass; ++k)
+            {
+                for(int p = 0; p < num_pixels_tile; ++p)
+                {
+                    acc[k][p] = vdupq_n_f32(0.f);
+                }
+            }
+
+            const float *w_rows[num_outputs_per_pass];
+            for(int k = 0; k < num_outputs_per_pass; ++k)
+            {
+                // Re-read the last row for the left-over outputs, their results are discarded
+                w_rows[k] = reinterpret_cast<const float *>(pointwise_weights_base + std::min(o + k, num_outputs - 1) * pointwise_weights_stride_w);
+            }
+
+            for(int v = 0; v < num_vectors; ++v)
+            {
+                float32x4_t d[num_pixels_tile];
+                for(int p = 0; p < num_pixels_tile; ++p)
+                {
+                    d[p] = vld1q_f32(tile + p * num_channels + v * 4);
+                }
+
+                for(int k = 0; k < num_outputs_per_pass; ++k)
+                {
+                    const float32x4_t w = vld1q_f32(w_rows[k] + v * 4);
+                    for(int p = 0; p < num_pixels_tile; ++p)
+                    {
+                        acc[k][p] = vmlaq_f32(acc[k][p], w, d[p]);
+                    }
+                }
+            }
+
+            for(int k = 0; k < num_outputs_per_pass; ++k)
+            {
+                const float bias = (pointwise_biases_ptr != nullptr) ? pointwise_biases_ptr[std::min(o + k, num_outputs - 1)] : 0.f;
+                for(int p = 0; p < num_pixels_tile; ++p)
+                {
+                    float sum = reduce_add(acc[k][p]) + bias;
+
+                    // Left-over channels
+                    for(int c = num_vectors * 4; c < num_channels; ++c)
+                    {
+                        sum += w_rows[k][c] * tile[p * num_channels + c];
+                    }
+
+                    res[p][k] = std::min(std::max(sum, _pointwise_min), _pointwise_max);
+                }
+            }
+
+            for(int p = 0; p < num_pixels; ++p)
+            {
+                auto out_ptr = reinterpret_cast<float *>(out.ptr() + p * output_stride_y) + o;
+                if(num_left == num_outputs_per_pass)
+                {
+                    vst1q_f32(out_ptr, vld1q_f32(res[p]));
+                }
+                else
+                {
+                    std::copy_n(res[p], num_left, out_ptr);
+                }
+            }
+        }
+    },
+    out);
+}
@@ -32,7 +32,7 @@
 using namespace arm_compute;
 
 NEFillArrayKernel::NEFillArrayKernel()
-    : _input(nullptr), _output(nullptr), _threshold(0)
+    : _input(nullptr), _output(nullptr), _threshold(0), _local_keypoints()
 {
 }
 
@@ -57,19 +57,32 @@ void NEFillArrayKernel::configure(const IImage *input, uint8_t threshold, IKeyPo
     INEKernel::configure(win);
 }
 
-bool NEFillArrayKernel::is_parallelisable() const
+void NEFillArrayKernel::reset(unsigned int num_threads)
 {
-    return false;
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+
+    _local_keypoints.reset(num_threads);
+}
+
+void NEFillArrayKernel::merge()
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+
+    _local_keypoints.merge([&](const KeyPoint & p)
+    {
+        return _output->push_back(p); //Stop once the array has overflowed
+    });
 }
 
 void NEFillArrayKernel::run(const Window &window, const ThreadInfo &info)
 {
-    ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
 
     Iterator input(_input, window);
 
+    std::vector<KeyPoint> &keypoints = _local_keypoints.begin_window(info.thread_id, window);
+
     execute_window_loop(window, [&](const Coordinates & id)
     {
         const uint8_t value = *input.ptr();
@@ -85,10 +98,7 @@ void NEFillArrayKernel::run(const Window &window, const ThreadInfo &info)
             p.orientation     = 0.f;
             p.error           = 0.f;
 
-            if(!_output->push_back(p))
-            {
-                return; //Overflowed: stop trying to add more points
-            }
+            keypoints.push_back(p);
         }
     },
     input);
@@ -33,13 +33,89 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
 
+#include <algorithm>
 #include <arm_neon.h>
+#include <climits>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <tuple>
 
 using namespace arm_compute;
 
+namespace
+{
+/** Horizontal pass of the Gaussian 5 filter with decimation by 2
+ *
+ * @param[in]  row      Input row extended by two border pixels on each side. Must be readable up to 32 bytes past the last pixel read.
+ * @param[out] out      Filtered row. Must be writable up to @p width rounded up to a multiple of 8.
+ * @param[in]  width    Width of the filtered row.
+ * @param[in]  offset_x Column of the input row sampled for the first column of the filtered row.
+ */
+inline void gaussian5_hor_half(const uint8_t *row, uint16_t *out, int width, int offset_x)
+{
+    const uint16x8_t six  = vdupq_n_u16(6);
+    const uint16x8_t four = vdupq_n_u16(4);
+
+    for(int x = 0; x < width; x += 8)
+    {
+        const uint8x16x2_t data_2q   = vld2q_u8(row + 2 * x + offset_x);
+        const uint8x16_t &data_even = data_2q.val[0];
+        const uint8x16_t &data_odd  = data_2q.val[1];
+
+        const uint16x8_t data_l2 = vmovl_u8(vget_low_u8(data_even));
+        const uint16x8_t data_l1 = vmovl_u8(vget_low_u8(data_odd));
+        const uint16x8_t data_m  = vmovl_u8(vget_low_u8(vextq_u8(data_even, data_even, 1)));
+        const uint16x8_t data_r1 = vmovl_u8(vget_low_u8(vextq_u8(data_odd, data_odd, 1)));
+        const uint16x8_t data_r2 = vmovl_u8(vget_low_u8(vextq_u8(data_even, data_even, 2)));
+
+        uint16x8_t out_val = vaddq_u16(data_l2, data_r2);
+        out_val            = vmlaq_u16(out_val, data_l1, four);
+        out_val            = vmlaq_u16(out_val, data_m, six);
+        out_val            = vmlaq_u16(out_val, data_r1, four);
+
+        vst1q_u16(out + x, out_val);
+    }
+}
+
+/** Vertical pass of the Gaussian 5 filter
+ *
+ * @param[in]  rows  Horizontally filtered rows, from top to bottom.
+ * @param[out] out   Output row.
+ * @param[in]  width Width of the output row.
+ */
+inline void gaussian5_vert(const uint16_t *const *rows, uint8_t *out, int width)
+{
+    const uint16x8_t six  = vdupq_n_u16(6);
+    const uint16x8_t four = vdupq_n_u16(4);
+
+    int x = 0;
+
+    for(; x <= width - 8; x += 8)
+    {
+        uint16x8_t out_val = vaddq_u16(vld1q_u16(rows[0] + x), vld1q_u16(rows[4] + x));
+        out_val            = vmlaq_u16(out_val, vld1q_u16(rows[1] + x), four);
+        out_val            = vmlaq_u16(out_val, vld1q_u16(rows[2] + x), six);
+        out_val            = vmlaq_u16(out_val, vld1q_u16(rows[3] + x), four);
+
+        vst1_u8(out + x, vqshrn_n_u16(out_val, 8));
+    }
+
+    // Left-overs loop
+    for(; x < width; ++x)
+    {
+        const uint16_t out_val = rows[0][x] + rows[4][x] + 4 * (rows[1][x] + rows[3][x]) + 6 * rows[2][x];
+
+        out[x] = static_cast<uint8_t>(out_val >> 8);
+    }
+}
+
+inline uint8_t *row_ptr(const ITensor *tensor, int y)
+{
+    return tensor->buffer() + tensor->info()->offset_first_element_in_bytes() + y * tensor->info()->strides_in_bytes()[1];
+}
+} // namespace
+
 NEGaussianPyramidHorKernel::NEGaussianPyramidHorKernel()
     : _l2_load_offset(0)
 {
@@ -268,3 +344,171 @@ void NEGaussianPyramidVertKernel::run(const Window &window, const ThreadInfo &in
     },
     in, out);
 }
+
+NEGaussianPyramidHalfKernel::NEGaussianPyramidHalfKernel()
+    : _levels(), _border_mode(BorderMode::UNDEFINED), _constant_border_value(0)
+{
+}
+
+void NEGaussianPyramidHalfKernel::configure(IPyramid *pyramid, size_t first_level, size_t num_levels, BorderMode border_mode, uint8_t constant_border_value)
+{
+    ARM_COMPUTE_ERROR_ON(nullptr == pyramid);
+    ARM_COMPUTE_ERROR_ON(SCALE_PYRAMID_HALF != pyramid->info()->scale());
+    ARM_COMPUTE_ERROR_ON(0 == num_levels);
+    ARM_COMPUTE_ERROR_ON(first_level + num_levels >= pyramid->info()->num_levels());
+
+    _border_mode           = border_mode;
+    _constant_border_value = constant_border_value;
+
+    _levels.clear();
+
+    for(size_t i = first_level; i <= first_level + num_levels; ++i)
+    {
+        ITensor *tensor = pyramid->get_pyramid_level(i);
+
+        ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(tensor);
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(tensor, 1, DataType::U8);
+
+        Level level{ tensor, static_cast<int>(tensor->info()->dimension(0)), static_cast<int>(tensor->info()->dimension(1)), 0, 0 };
+
+        if(i != first_level)
+        {
+            const Level       &prev_level        = _levels.back();
+            const ValidRegion &prev_valid_region = prev_level.tensor->info()->valid_region();
+
+            ARM_COMPUTE_ERROR_ON(level.width != (prev_level.width + 1) / 2);
+            ARM_COMPUTE_ERROR_ON(level.height != (prev_level.height + 1) / 2);
+
+            // Sub sampling selects odd pixels for even sizes and even pixels for odd sizes,
+            // see NEGaussianPyramidHorKernel for a detailed explanation.
+            level.offset_x = ((prev_valid_region.anchor[0] + prev_valid_region.shape[0]) % 2 == 0) ? 1 : 0;
+            level.offset_y = ((prev_valid_region.anchor[1] + prev_valid_region.shape[1]) % 2 == 0) ? 1 : 0;
+
+            tensor->info()->set_valid_region(ValidRegion(Coordinates(), tensor->info()->tensor_shape()));
+        }
+
+        _levels.push_back(level);
+    }
+
+    // Configure kernel window: one iteration per row of the last level
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, _levels.back().height, 1));
+
+    INEKernel::configure(win);
+}
+
+void NEGaussianPyramidHalfKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    constexpr int num_taps   = 5;
+    constexpr int border     = num_taps / 2;
+    constexpr int read_slack = 32;
+
+    const int last_level = static_cast<int>(_levels.size()) - 1;
+
+    // Rows of each level owned by the window, and rows the window has to compute to produce them.
+    // The rows of the intermediate levels are owned by the window producing the rows of the last level they are decimated into.
+    std::vector<int> own_start(_levels.size()), own_end(_levels.size()), compute_start(_levels.size()), compute_end(_levels.size());
+
+    own_start[last_level]     = window.y().start();
+    own_end[last_level]       = window.y().end();
+    compute_start[last_level] = own_start[last_level];
+    compute_end[last_level]   = own_end[last_level];
+
+    for(int l = last_level - 1; l > 0; --l)
+    {
+        const int    shift      = last_level - l;
+        const Level &next_level = _levels[l + 1];
+
+        own_start[l]     = own_start[last_level] << shift;
+        own_end[l]       = (own_end[last_level] == _levels[last_level].height) ? _levels[l].height : (own_end[last_level] << shift);
+        compute_start[l] = std::min(own_start[l], std::max(0, 2 * compute_start[l + 1] + next_level.offset_y - border));
+        compute_end[l]   = std::max(own_end[l], std::min(_levels[l].height, 2 * (compute_end[l + 1] - 1) + next_level.offset_y + border + 1));
+    }
+
+    // Rows of the intermediate levels computed but not owned by the window are kept in a scratch buffer
+    std::vector<std::vector<uint8_t>> scratch(_levels.size());
+
+    for(int l = 1; l < last_level; ++l)
+    {
+        scratch[l].resize(static_cast<size_t>(compute_end[l] - compute_start[l]) * _levels[l].width);
+    }
+
+    auto level_row = [&](int l, int y) -> uint8_t *
+    {
+        if(l == 0 || (y >= own_start[l] && y < own_end[l]))
+        {
+            return row_ptr(_levels[l].tensor, y);
+        }
+        return scratch[l].data() + static_cast<size_t>(y - compute_start[l]) * _levels[l].width;
+    };
+
+    for(int l = 1; l <= last_level; ++l)
+    {
+        const Level &in_level  = _levels[l - 1];
+        const Level &out_level = _levels[l];
+        const int    hor_width = ceil_to_multiple(out_level.width, 8);
+
+        // Input row extended with its borders
+        std::vector<uint8_t> extended_row(in_level.width + 2 * border + read_slack);
+
+        // Line buffer of the horizontally filtered input rows, followed by the filtered constant border row
+        std::vector<uint16_t> line_buffer((num_taps + 1) * hor_width);
+        int                   line_rows[num_taps];
+        std::fill_n(line_rows, num_taps, INT_MIN);
+
+        uint16_t *constant_row = line_buffer.data() + num_taps * hor_width;
+        std::fill_n(constant_row, hor_width, static_cast<uint16_t>(_constant_border_value * 16));
+
+        auto hor_row = [&](int y) -> const uint16_t *
+        {
+            if(y < 0 || y >= in_level.height)
+            {
+                if(_border_mode == BorderMode::CONSTANT)
+                {
+                    return constant_row;
+                }
+                // Replicate the border for BorderMode::UNDEFINED too
+                y = std::max(0, std::min(y, in_level.height - 1));
+            }
+
+            const int slot = y % num_taps;
+            uint16_t *out  = line_buffer.data() + slot * hor_width;
+
+            if(line_rows[slot] != y)
+            {
+                const uint8_t *in          = level_row(l - 1, y);
+                const bool     constant    = (_border_mode == BorderMode::CONSTANT);
+                const uint8_t  left_value  = constant ? _constant_border_value : in[0];
+                const uint8_t  right_value = constant ? _constant_border_value : in[in_level.width - 1];
+
+                std::fill_n(extended_row.data(), border, left_value);
+                std::memcpy(extended_row.data() + border, in, in_level.width);
+                std::fill(extended_row.begin() + border + in_level.width, extended_row.end(), right_value);
+
+                gaussian5_hor_half(extended_row.data(), out, out_level.width, out_level.offset_x);
+
+                line_rows[slot] = y;
+            }
+
+            return out;
+        };
+
+        for(int y = compute_start[l]; y < compute_end[l]; ++y)
+        {
+            const int       in_y = 2 * y + out_level.offset_y;
+            const uint16_t *rows[num_taps];
+
+            for(int i = 0; i < num_taps; ++i)
+            {
+                rows[i] = hor_row(in_y - border + i);
+            }
+
+            gaussian5_vert(rows, level_row(l, y), out_level.width);
+        }
+    }
+}
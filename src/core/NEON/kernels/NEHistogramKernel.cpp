@@ -33,7 +33,7 @@
 
 #include <algorithm>
 #include <arm_neon.h>
-#include <array>
+#include <vector>
 
 using namespace arm_compute;
 
@@ -42,27 +42,8 @@ namespace arm_compute
 class Coordinates;
 } // namespace arm_compute
 
-inline void NEHistogramKernel::merge_histogram(uint32_t *global_hist, const uint32_t *local_hist, size_t bins)
-{
-    std::lock_guard<arm_compute::Mutex> lock(_hist_mtx);
-
-    const unsigned int v_end = (bins / 4) * 4;
-
-    for(unsigned int b = 0; b < v_end; b += 4)
-    {
-        const uint32x4_t tmp_global = vld1q_u32(global_hist + b);
-        const uint32x4_t tmp_local  = vld1q_u32(local_hist + b);
-        vst1q_u32(global_hist + b, vaddq_u32(tmp_global, tmp_local));
-    }
-
-    for(unsigned int b = v_end; b < bins; ++b)
-    {
-        global_hist[b] += local_hist[b];
-    }
-}
-
 NEHistogramKernel::NEHistogramKernel()
-    : _func(nullptr), _input(nullptr), _output(nullptr), _local_hist(nullptr), _window_lut(nullptr), _hist_mtx()
+    : _func(nullptr), _input(nullptr), _output(nullptr), _local_hist(), _window_lut(nullptr)
 {
 }
 
@@ -70,14 +51,12 @@ void NEHistogramKernel::histogram_U8(Window win, const ThreadInfo &info)
 {
     ARM_COMPUTE_ERROR_ON(_output->buffer() == nullptr);
 
-    const size_t          bins       = _output->num_bins();
     const int32_t         offset     = _output->offset();
     const uint32_t        offrange   = offset + _output->range();
     const uint32_t *const w_lut      = _window_lut;
-    uint32_t *const       local_hist = _local_hist + info.thread_id * bins;
+    uint32_t *const       local_hist = _local_hist[info.thread_id].data();
 
-    // Clear local_histogram
-    std::fill_n(local_hist, bins, 0);
+    ARM_COMPUTE_ERROR_ON(_local_hist[info.thread_id].size() != _output->num_bins());
 
     auto update_local_hist = [&](uint8_t p)
     {
@@ -124,17 +103,14 @@ void NEHistogramKernel::histogram_U8(Window win, const ThreadInfo &info)
         }
     },
     input);
-
-    // Merge histograms
-    merge_histogram(_output->buffer(), local_hist, bins);
 }
 
 void NEHistogramKernel::histogram_fixed_U8(Window win, const ThreadInfo &info)
 {
-    ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_ERROR_ON(_output->buffer() == nullptr);
+    ARM_COMPUTE_ERROR_ON(_local_hist[info.thread_id].size() != _max_range_size);
 
-    std::array<uint32_t, _max_range_size> local_hist{ { 0 } };
+    uint32_t *const local_hist = _local_hist[info.thread_id].data();
 
     const int x_start = win.x().start();
     const int x_end   = win.x().end();
@@ -173,9 +149,6 @@ void NEHistogramKernel::histogram_fixed_U8(Window win, const ThreadInfo &info)
         }
     },
     input);
-
-    // Merge histograms
-    merge_histogram(_output->buffer(), local_hist.data(), _max_range_size);
 }
 
 void NEHistogramKernel::calculate_window_lut() const
@@ -192,17 +165,15 @@ void NEHistogramKernel::calculate_window_lut() const
     }
 }
 
-void NEHistogramKernel::configure(const IImage *input, IDistribution1D *output, uint32_t *local_hist, uint32_t *window_lut)
+void NEHistogramKernel::configure(const IImage *input, IDistribution1D *output, uint32_t *window_lut)
 {
     ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON(nullptr == output);
-    ARM_COMPUTE_ERROR_ON(nullptr == local_hist);
     ARM_COMPUTE_ERROR_ON(nullptr == window_lut);
 
     _input      = input;
     _output     = output;
-    _local_hist = local_hist;
     _window_lut = window_lut;
 
     //Check offset
@@ -243,6 +214,42 @@ void NEHistogramKernel::configure(const IImage *input, IDistribution1D *output)
     INEKernel::configure(win);
 }
 
+void NEHistogramKernel::reset(unsigned int num_threads)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+
+    const size_t bins = (_func == &NEHistogramKernel::histogram_fixed_U8) ? _max_range_size : _output->num_bins();
+    _local_hist.reset(num_threads, std::vector<uint32_t>(bins, 0));
+}
+
+void NEHistogramKernel::merge()
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON(_output->buffer() == nullptr);
+
+    uint32_t *const global_hist = _output->buffer();
+    const size_t    bins        = _local_hist[0].size();
+
+    std::fill_n(global_hist, bins, 0);
+
+    _local_hist.merge(global_hist, [bins](uint32_t *hist, const std::vector<uint32_t> &local_hist)
+    {
+        const unsigned int v_end = (bins / 4) * 4;
+
+        for(unsigned int b = 0; b < v_end; b += 4)
+        {
+            const uint32x4_t tmp_global = vld1q_u32(hist + b);
+            const uint32x4_t tmp_local  = vld1q_u32(local_hist.data() + b);
+            vst1q_u32(hist + b, vaddq_u32(tmp_global, tmp_local));
+        }
+
+        for(unsigned int b = v_end; b < bins; ++b)
+        {
+            hist[b] += local_hist[b];
+        }
+    });
+}
+
 void NEHistogramKernel::run(const Window &window, const ThreadInfo &info)
 {
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
@@ -44,6 +44,21 @@ using namespace arm_compute;
 
 namespace
 {
+TensorShape get_output_shape(const ITensorInfo *input, const Size2D &kernel_dims, const PadStrideInfo &conv_info, bool has_bias, const Size2D &dilation, unsigned int num_groups)
+{
+    TensorShape output_shape = misc::shape_calculator::compute_im2col_conv_shape(input, kernel_dims, conv_info, has_bias, dilation, false, num_groups);
+
+    // With grouping the groups are moved to the fourth dimension so that each group is a separate multi of the GEMM
+    if(num_groups > 1)
+    {
+        const size_t batches = output_shape[3];
+        output_shape.set(2, batches);
+        output_shape.set(3, num_groups);
+    }
+
+    return output_shape;
+}
+
 Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info,
                           bool has_bias, const Size2D &dilation, unsigned int num_groups, bool is_fully_connected, bool is_flatten)
 {
@@ -51,7 +66,11 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, c
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON(input->data_type() == DataType::QASYMM8 && has_bias);
     ARM_COMPUTE_RETURN_ERROR_ON((dilation.x() < 1) || (dilation.y() < 1));
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_groups > 1, "Number of groups greater than one are not supported on NEON");
+    ARM_COMPUTE_RETURN_ERROR_ON(num_groups == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups > 1) && (input->data_layout() != DataLayout::NCHW), "Grouping (num_groups != 1) is only supported with NCHW data layout");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups > 1) && (is_fully_connected || is_flatten), "Grouping (num_groups != 1) is not supported by the fully connected and flatten layers");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups > 1) && (input->num_dimensions() > 4), "Grouping (num_groups != 1) is not supported with more than one batch dimension");
+    ARM_COMPUTE_RETURN_ERROR_ON((input->dimension(get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::CHANNEL)) % num_groups) != 0);
 
     if(output->total_size() > 0)
     {
@@ -63,7 +82,7 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, c
         }
         else
         {
-            expected_output_shape = misc::shape_calculator::compute_im2col_conv_shape(input, kernel_dims, conv_info, has_bias, dilation, false);
+            expected_output_shape = get_output_shape(input, kernel_dims, conv_info, has_bias, dilation, num_groups);
         }
 
         TensorInfo expected_output = output->clone()->set_tensor_shape(expected_output_shape);
@@ -184,7 +203,7 @@ void NEIm2ColKernel::run_generic(const Window &window)
     const unsigned int height_idx  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
     const unsigned int channel_idx = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
 
-    const int kernel_depth   = _input->info()->dimension(channel_idx);
+    const int kernel_depth   = _input->info()->dimension(channel_idx) / _num_groups;
     const int input_w        = _input->info()->dimension(width_idx);
     const int input_h        = _input->info()->dimension(height_idx);
     const int input_stride_x = _input->info()->strides_in_bytes()[width_idx];
@@ -210,18 +229,31 @@ void NEIm2ColKernel::run_generic(const Window &window)
     window_in_out.set(Window::DimY, Window::Dimension(0, 0, 0));
     window_in_out.set(Window::DimZ, Window::Dimension(0, 0, 0));
 
+    // With grouping the output is [K / num_groups, M, batches, num_groups]: batches and groups are placed by hand
+    const bool     is_grouped  = _num_groups > 1;
+    const Strides &out_strides = _output->info()->strides_in_bytes();
+    Window         window_out(window_in_out);
+    if(is_grouped)
+    {
+        window_out.set(3, Window::Dimension(0, 0, 0));
+    }
+
     // Create iterators
     Iterator in(_input, window_in_out);
-    Iterator out(_output, window_in_out);
+    Iterator out(_output, window_out);
 
     execute_window_loop(window, [&](const Coordinates & id)
     {
         const int top_left_x = id[width_idx] * stride_x + start_x;
         const int top_left_y = id[height_idx] * stride_y + start_y;
 
+        // Each group reads its own slice of input channels
+        const size_t group_in_offset  = is_grouped ? id[channel_idx] * kernel_depth * input_stride_z : 0;
+        const size_t group_out_offset = is_grouped ? id[channel_idx] * out_strides[3] + id[3] * out_strides[2] : 0;
+
         // Get pointers
-        const uint8_t *const input_ptr  = in.ptr();
-        auto                 output_ptr = reinterpret_cast<T *>(out.ptr() + (id[width_idx] + id[height_idx] * _convolved_dims.first) * _output->info()->strides_in_bytes().y());
+        const uint8_t *const input_ptr  = in.ptr() + group_in_offset;
+        auto                 output_ptr = reinterpret_cast<T *>(out.ptr() + group_out_offset + (id[width_idx] + id[height_idx] * _convolved_dims.first) * out_strides.y());
 
         // Linearize volume
         linearize_volume<T, has_pads>(input_ptr,
@@ -286,7 +318,7 @@ void NEIm2ColKernel::run_reduced(const Window &window)
 }
 
 NEIm2ColKernel::NEIm2ColKernel()
-    : _func(), _input(nullptr), _output(nullptr), _convolved_dims(), _conv_info(), _kernel_width(0), _kernel_height(0), _has_bias(false), _dilation(1U, 1U)
+    : _func(), _input(nullptr), _output(nullptr), _convolved_dims(), _conv_info(), _kernel_width(0), _kernel_height(0), _has_bias(false), _dilation(1U, 1U), _num_groups(1)
 {
 }
 
@@ -297,7 +329,6 @@ void NEIm2ColKernel::configure(const ITensor *input, ITensor *output, const Size
 
     // Perform validation step
     ARM_COMPUTE_UNUSED(is_fully_connected, is_flatten);
-    ARM_COMPUTE_UNUSED(num_groups);
     ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), kernel_dims, conv_info, has_bias, dilation, num_groups, is_fully_connected, is_flatten));
 
     const DataLayout   data_layout = input->info()->data_layout();
@@ -314,7 +345,8 @@ void NEIm2ColKernel::configure(const ITensor *input, ITensor *output, const Size
     _convolved_dims = scaled_dimensions(input->info()->dimension(width_idx), input->info()->dimension(height_idx),
                                         _kernel_width, _kernel_height,
                                         _conv_info, _dilation);
-    _has_bias = has_bias;
+    _has_bias   = has_bias;
+    _num_groups = num_groups;
 
     unsigned int stride_x = 0;
     unsigned int stride_y = 0;
@@ -325,7 +357,8 @@ void NEIm2ColKernel::configure(const ITensor *input, ITensor *output, const Size
                                               input->info()->tensor_shape().cend(),
                                               output->info()->tensor_shape().cbegin() + 1))
                                && ((stride_x == 1) && (stride_y == 1) && !conv_info.has_padding())
-                               && ((dilation.x() == 1) && (dilation.y() == 1));
+                               && ((dilation.x() == 1) && (dilation.y() == 1))
+                               && (num_groups == 1);
 
     Window window = calculate_max_window(*input->info(), Steps());
 
@@ -370,7 +403,7 @@ void NEIm2ColKernel::configure(const ITensor *input, ITensor *output, const Size
         }
         window.set(width_idx, Window::Dimension(0, _convolved_dims.first, 1));
         window.set(height_idx, Window::Dimension(0, _convolved_dims.second, 1));
-        window.set(channel_idx, Window::Dimension(0, 1, 1));
+        window.set(channel_idx, Window::Dimension(0, num_groups, 1));
     }
 
     // The NEIm2ColKernel doesn't need padding so update_window_and_padding() can be skipped
@@ -0,0 +1,522 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEImageToTensorKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/IMultiImage.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/MultiImageInfo.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace
+{
+Status validate_output(const ITensorInfo *output, const ImageToTensorInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(output);
+    //Note: ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(output) is not needed here as this kernel doesn't use NEON FP16 instructions.
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::QASYMM8, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(output->data_layout() == DataLayout::UNKNOWN);
+    ARM_COMPUTE_RETURN_ERROR_ON(output->tensor_shape().total_size() == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(output->dimension(get_data_layout_dimension_index(output->data_layout(), DataLayoutDimension::CHANNEL)) != 3,
+                                    "The output tensor must have 3 channels");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(output->tensor_shape().total_size_upper(3) != 1, "Only a single batch can be written");
+    ARM_COMPUTE_RETURN_ERROR_ON(info.interpolation_policy() != InterpolationPolicy::NEAREST_NEIGHBOR && info.interpolation_policy() != InterpolationPolicy::BILINEAR);
+    ARM_COMPUTE_RETURN_ERROR_ON(output->data_type() == DataType::QASYMM8 && output->quantization_info().scale == 0.f);
+
+    return Status{};
+}
+
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const ImageToTensorInfo &info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_TENSOR_NOT_2D(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->format() != Format::RGB888 && input->format() != Format::YUYV422 && input->format() != Format::UYVY422,
+                                    "Only RGB888, YUYV422 and UYVY422 images are supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->format() != Format::RGB888 && (input->dimension(0) % 2) != 0, "The width of a YUV 4:2:2 image must be even");
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_output(output, info));
+
+    return Status{};
+}
+
+constexpr float yuv_red_v    = 1.5748f;
+constexpr float yuv_green_u  = -0.1873f;
+constexpr float yuv_green_v  = -0.4681f;
+constexpr float yuv_blue_u   = 1.8556f;
+constexpr float yuv_c_offset = 128.f;
+
+/** Load the three channels of the pixel @p x of a row
+ *
+ * The channels are red, green, blue for RGB888 and Y, U, V for the YUV formats.
+ *
+ * @param[in]  luma   Pointer to the row of the first plane.
+ * @param[in]  chroma Pointer to the row of the UV plane (NV12/NV21 only).
+ * @param[in]  x      Horizontal coordinate of the pixel.
+ * @param[out] c      Channels of the pixel.
+ * @param[in]  i      Lane of @p c in which the pixel is written.
+ */
+template <Format format>
+inline void load_pixel(const uint8_t *luma, const uint8_t *chroma, int x, float c[3][4], int i)
+{
+    switch(format)
+    {
+        case Format::RGB888:
+            c[0][i] = luma[3 * x];
+            c[1][i] = luma[3 * x + 1];
+            c[2][i] = luma[3 * x + 2];
+            break;
+        case Format::YUYV422:
+            c[0][i] = luma[2 * x];
+            c[1][i] = luma[4 * (x / 2) + 1];
+            c[2][i] = luma[4 * (x / 2) + 3];
+            break;
+        case Format::UYVY422:
+            c[0][i] = luma[2 * x + 1];
+            c[1][i] = luma[4 * (x / 2)];
+            c[2][i] = luma[4 * (x / 2) + 2];
+            break;
+        case Format::NV12:
+            c[0][i] = luma[x];
+            c[1][i] = chroma[2 * (x / 2)];
+            c[2][i] = chroma[2 * (x / 2) + 1];
+            break;
+        case Format::NV21:
+            c[0][i] = luma[x];
+            c[1][i] = chroma[2 * (x / 2) + 1];
+            c[2][i] = chroma[2 * (x / 2)];
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Not supported");
+    }
+}
+
+inline float32x4_t lerp(float32x4_t a, float32x4_t b, float32x4_t w)
+{
+    return vmlaq_f32(a, vsubq_f32(b, a), w);
+}
+
+inline float32x4_t clamp_u8(float32x4_t v)
+{
+    return vminq_f32(vmaxq_f32(v, vdupq_n_f32(0.f)), vdupq_n_f32(255.f));
+}
+
+/** Quantize 8 normalised values to QASYMM8
+ *
+ * @param[in] v      Values to quantize.
+ * @param[in] scale  Inverse of the quantization scale.
+ * @param[in] offset Quantization offset plus 0.5 to round to nearest.
+ *
+ * @return The quantized values.
+ */
+inline uint8x8_t quantize(const float32x4x2_t &v, float32x4_t scale, float32x4_t offset)
+{
+    const uint32x4_t lo = vcvtq_u32_f32(clamp_u8(vmlaq_f32(offset, v.val[0], scale)));
+    const uint32x4_t hi = vcvtq_u32_f32(clamp_u8(vmlaq_f32(offset, v.val[1], scale)));
+    return vmovn_u16(vcombine_u16(vmovn_u32(lo), vmovn_u32(hi)));
+}
+
+/** Channel normalisation parameters in output order */
+struct NormalisationParams
+{
+    NormalisationParams(const ImageToTensorInfo &info)
+    {
+        for(unsigned int i = 0; i < 3; ++i)
+        {
+            // The output channel i is read from the plane src[i] of the row
+            src[i]   = info.bgr() ? 2 - i : i;
+            scale[i] = info.scale()[src[i]];
+            bias[i]  = -info.mean()[src[i]] * scale[i];
+        }
+    }
+    unsigned int src[3];
+    float        scale[3];
+    float        bias[3];
+};
+
+inline float32x4_t normalise(const float *ptr, float scale, float bias)
+{
+    return vmlaq_f32(vdupq_n_f32(bias), vld1q_f32(ptr), vdupq_n_f32(scale));
+}
+} // namespace
+
+NEImageToTensorKernel::NEImageToTensorKernel()
+    : _sample_row(nullptr), _store_row(nullptr), _input(nullptr), _chroma(nullptr), _output(nullptr), _format(Format::UNKNOWN), _info(), _is_identity(false), _x0(), _x1(), _wx(), _y0(), _y1(),
+      _wy()
+{
+}
+
+template <Format format, bool is_bilinear>
+void NEImageToTensorKernel::sample_row(int y, float *rgb) const
+{
+    constexpr bool is_yuv = format != Format::RGB888;
+    const size_t   stride = _x0.size();
+
+    const auto luma_row = [&](int row)
+    {
+        return _input->buffer() + _input->info()->offset_first_element_in_bytes() + row * _input->info()->strides_in_bytes().y();
+    };
+    const auto chroma_row = [&](int row) -> const uint8_t *
+    {
+        // The UV plane of NV12 and NV21 images is subsampled vertically
+        return (_chroma != nullptr) ? _chroma->buffer() + _chroma->info()->offset_first_element_in_bytes() + (row / 2) * _chroma->info()->strides_in_bytes().y() : nullptr;
+    };
+
+    const uint8_t *top_luma      = luma_row(_y0[y]);
+    const uint8_t *top_chroma    = chroma_row(_y0[y]);
+    const uint8_t *bottom_luma   = luma_row(_y1[y]);
+    const uint8_t *bottom_chroma = chroma_row(_y1[y]);
+
+    int x = 0;
+
+    if(format == Format::RGB888 && _is_identity)
+    {
+        // Same size RGB888 image: deinterleave 8 pixels at a time
+        const int width = _input->info()->dimension(0);
+        for(; x <= width - 8; x += 8)
+        {
+            const uint8x8x3_t pixels = vld3_u8(top_luma + 3 * x);
+            for(unsigned int c = 0; c < 3; ++c)
+            {
+                const uint16x8_t values = vmovl_u8(pixels.val[c]);
+                vst1q_f32(rgb + c * stride + x, vcvtq_f32_u32(vmovl_u16(vget_low_u16(values))));
+                vst1q_f32(rgb + c * stride + x + 4, vcvtq_f32_u32(vmovl_u16(vget_high_u16(values))));
+            }
+        }
+    }
+
+    const float32x4_t wy = vdupq_n_f32(_wy[y]);
+
+    for(; x < static_cast<int>(stride); x += 4)
+    {
+        float tl[3][4];
+        float tr[3][4];
+        float bl[3][4];
+        float br[3][4];
+
+        for(int i = 0; i < 4; ++i)
+        {
+            load_pixel<format>(top_luma, top_chroma, _x0[x + i], tl, i);
+            if(is_bilinear)
+            {
+                load_pixel<format>(top_luma, top_chroma, _x1[x + i], tr, i);
+                load_pixel<format>(bottom_luma, bottom_chroma, _x0[x + i], bl, i);
+                load_pixel<format>(bottom_luma, bottom_chroma, _x1[x + i], br, i);
+            }
+        }
+
+        float32x4_t c[3];
+        if(is_bilinear)
+        {
+            const float32x4_t wx = vld1q_f32(_wx.data() + x);
+            for(unsigned int k = 0; k < 3; ++k)
+            {
+                const float32x4_t top    = lerp(vld1q_f32(tl[k]), vld1q_f32(tr[k]), wx);
+                const float32x4_t bottom = lerp(vld1q_f32(bl[k]), vld1q_f32(br[k]), wx);
+                c[k]                     = lerp(top, bottom, wy);
+            }
+        }
+        else
+        {
+            for(unsigned int k = 0; k < 3; ++k)
+            {
+                c[k] = vld1q_f32(tl[k]);
+            }
+        }
+
+        if(is_yuv)
+        {
+            // The conversion is affine so the channels can be interpolated before being converted
+            const float32x4_t u = vsubq_f32(c[1], vdupq_n_f32(yuv_c_offset));
+            const float32x4_t v = vsubq_f32(c[2], vdupq_n_f32(yuv_c_offset));
+            c[1]                = clamp_u8(vmlaq_n_f32(vmlaq_n_f32(c[0], u, yuv_green_u), v, yuv_green_v));
+            c[2]                = clamp_u8(vmlaq_n_f32(c[0], u, yuv_blue_u));
+            c[0]                = clamp_u8(vmlaq_n_f32(c[0], v, yuv_red_v));
+        }
+
+        for(unsigned int k = 0; k < 3; ++k)
+        {
+            vst1q_f32(rgb + k * stride + x, c[k]);
+        }
+    }
+}
+
+template <>
+void NEImageToTensorKernel::store_row<float>(int y, const float *rgb) const
+{
+    const NormalisationParams norm(_info);
+    const size_t              stride  = _x0.size();
+    const Strides            &strides = _output->info()->strides_in_bytes();
+    uint8_t                  *out     = _output->buffer() + _output->info()->offset_first_element_in_bytes();
+    const float              *r       = rgb + norm.src[0] * stride;
+    const float              *g       = rgb + norm.src[1] * stride;
+    const float              *b       = rgb + norm.src[2] * stride;
+
+    if(_output->info()->data_layout() == DataLayout::NCHW)
+    {
+        const int width = _output->info()->dimension(0);
+        for(unsigned int k = 0; k < 3; ++k)
+        {
+            const float *in  = rgb + norm.src[k] * stride;
+            auto         dst = reinterpret_cast<float *>(out + y * strides[1] + k * strides[2]);
+
+            int x = 0;
+            for(; x <= width - 4; x += 4)
+            {
+                vst1q_f32(dst + x, normalise(in + x, norm.scale[k], norm.bias[k]));
+            }
+            for(; x < width; ++x)
+            {
+                dst[x] = in[x] * norm.scale[k] + norm.bias[k];
+            }
+        }
+    }
+    else
+    {
+        const int width = _output->info()->dimension(1);
+        uint8_t  *row   = out + y * strides[2];
+
+        int x = 0;
+        if(strides[1] == 3 * sizeof(float))
+        {
+            // Channels of consecutive pixels are contiguous: interleave 4 pixels at a time
+            for(; x <= width - 4; x += 4)
+            {
+                float32x4x3_t pixels;
+                pixels.val[0] = normalise(r + x, norm.scale[0], norm.bias[0]);
+                pixels.val[1] = normalise(g + x, norm.scale[1], norm.bias[1]);
+                pixels.val[2] = normalise(b + x, norm.scale[2], norm.bias[2]);
+                vst3q_f32(reinterpret_cast<float *>(row) + 3 * x, pixels);
+            }
+        }
+        for(; x < width; ++x)
+        {
+            for(unsigned int k = 0; k < 3; ++k)
+            {
+                *reinterpret_cast<float *>(row + x * strides[1] + k * strides[0]) = rgb[norm.src[k] * stride + x] * norm.scale[k] + norm.bias[k];
+            }
+        }
+    }
+}
+
+template <>
+void NEImageToTensorKernel::store_row<uint8_t>(int y, const float *rgb) const
+{
+    const NormalisationParams norm(_info);
+    const QuantizationInfo    qinfo   = _output->info()->quantization_info();
+    const float               qscale  = 1.f / qinfo.scale;
+    const float               qoffset = qinfo.offset + 0.5f;
+    const size_t              stride  = _x0.size();
+    const Strides            &strides = _output->info()->strides_in_bytes();
+    uint8_t                  *out     = _output->buffer() + _output->info()->offset_first_element_in_bytes();
+
+    const auto normalise_x8 = [&](unsigned int k, int x)
+    {
+        const float *in = rgb + norm.src[k] * stride + x;
+        return quantize({ { normalise(in, norm.scale[k], norm.bias[k]), normalise(in + 4, norm.scale[k], norm.bias[k]) } }, vdupq_n_f32(qscale), vdupq_n_f32(qoffset));
+    };
+    const auto quantize_x1 = [&](unsigned int k, int x)
+    {
+        const float value = (rgb[norm.src[k] * stride + x] * norm.scale[k] + norm.bias[k]) * qscale + qoffset;
+        return static_cast<uint8_t>(std::min(std::max(value, 0.f), 255.f));
+    };
+
+    if(_output->info()->data_layout() == DataLayout::NCHW)
+    {
+        const int width = _output->info()->dimension(0);
+        for(unsigned int k = 0; k < 3; ++k)
+        {
+            uint8_t *dst = out + y * strides[1] + k * strides[2];
+
+            int x = 0;
+            for(; x <= width - 8; x += 8)
+            {
+                vst1_u8(dst + x, normalise_x8(k, x));
+            }
+            for(; x < width; ++x)
+            {
+                dst[x] = quantize_x1(k, x);
+            }
+        }
+    }
+    else
+    {
+        const int width = _output->info()->dimension(1);
+        uint8_t  *row   = out + y * strides[2];
+
+        int x = 0;
+        if(strides[1] == 3)
+        {
+            // Channels of consecutive pixels are contiguous: interleave 8 pixels at a time
+            for(; x <= width - 8; x += 8)
+            {
+                uint8x8x3_t pixels;
+                pixels.val[0] = normalise_x8(0, x);
+                pixels.val[1] = normalise_x8(1, x);
+                pixels.val[2] = normalise_x8(2, x);
+                vst3_u8(row + 3 * x, pixels);
+            }
+        }
+        for(; x < width; ++x)
+        {
+            for(unsigned int k = 0; k < 3; ++k)
+            {
+                row[x * strides[1] + k * strides[0]] = quantize_x1(k, x);
+            }
+        }
+    }
+}
+
+void NEImageToTensorKernel::configure(const IImage *input, ITensor *output, const ImageToTensorInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), info));
+
+    _input  = input;
+    _chroma = nullptr;
+    _output = output;
+    _format = input->info()->format();
+    _info   = info;
+
+    configure_common(input->info()->dimension(0), input->info()->dimension(1));
+}
+
+void NEImageToTensorKernel::configure(const IMultiImage *input, ITensor *output, const ImageToTensorInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_ON_FORMAT_NOT_IN(input, Format::NV12, Format::NV21);
+    ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input->plane(0));
+    ARM_COMPUTE_ERROR_THROW_ON(validate_output(output->info(), info));
+
+    _input  = input->plane(0);
+    _chroma = input->plane(1);
+    _output = output;
+    _format = input->info()->format();
+    _info   = info;
+
+    configure_common(input->info()->width(), input->info()->height());
+}
+
+void NEImageToTensorKernel::configure_common(unsigned int width, unsigned int height)
+{
+    const DataLayout   data_layout = _output->info()->data_layout();
+    const unsigned int out_width   = _output->info()->dimension(get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH));
+    const unsigned int out_height  = _output->info()->dimension(get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT));
+    const bool         is_bilinear = _info.interpolation_policy() == InterpolationPolicy::BILINEAR;
+
+    _is_identity = (width == out_width) && (height == out_height);
+
+    // Source coordinates and weights of each output column and row, centre aligned. Columns are padded to a multiple of 8.
+    const auto compute_coordinates = [&](unsigned int in_size, unsigned int out_size, unsigned int padded_size, std::vector<int> &c0, std::vector<int> &c1, std::vector<float> &w)
+    {
+        const float scale = static_cast<float>(in_size) / out_size;
+        const int   last  = static_cast<int>(in_size) - 1;
+
+        c0.resize(padded_size);
+        c1.resize(padded_size);
+        w.resize(padded_size);
+        for(unsigned int i = 0; i < padded_size; ++i)
+        {
+            const unsigned int o = std::min(i, out_size - 1);
+            if(is_bilinear)
+            {
+                const float in = std::min(std::max((o + 0.5f) * scale - 0.5f, 0.f), static_cast<float>(last));
+                c0[i]          = static_cast<int>(std::floor(in));
+                c1[i]          = std::min(c0[i] + 1, last);
+                w[i]           = in - c0[i];
+            }
+            else
+            {
+                c0[i] = std::min(static_cast<int>(std::floor((o + 0.5f) * scale)), last);
+                c1[i] = c0[i];
+                w[i]  = 0.f;
+            }
+        }
+    };
+    compute_coordinates(width, out_width, ceil_to_multiple(out_width, 8u), _x0, _x1, _wx);
+    compute_coordinates(height, out_height, out_height, _y0, _y1, _wy);
+
+    // Interpolation is not needed if the image is not resized
+    const bool use_bilinear = is_bilinear && !_is_identity;
+
+    switch(_format)
+    {
+        case Format::RGB888:
+            _sample_row = use_bilinear ? &NEImageToTensorKernel::sample_row<Format::RGB888, true> : &NEImageToTensorKernel::sample_row<Format::RGB888, false>;
+            break;
+        case Format::YUYV422:
+            _sample_row = use_bilinear ? &NEImageToTensorKernel::sample_row<Format::YUYV422, true> : &NEImageToTensorKernel::sample_row<Format::YUYV422, false>;
+            break;
+        case Format::UYVY422:
+            _sample_row = use_bilinear ? &NEImageToTensorKernel::sample_row<Format::UYVY422, true> : &NEImageToTensorKernel::sample_row<Format::UYVY422, false>;
+            break;
+        case Format::NV12:
+            _sample_row = use_bilinear ? &NEImageToTensorKernel::sample_row<Format::NV12, true> : &NEImageToTensorKernel::sample_row<Format::NV12, false>;
+            break;
+        case Format::NV21:
+            _sample_row = use_bilinear ? &NEImageToTensorKernel::sample_row<Format::NV21, true> : &NEImageToTensorKernel::sample_row<Format::NV21, false>;
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Not supported");
+    }
+    _store_row = (_output->info()->data_type() == DataType::F32) ? &NEImageToTensorKernel::store_row<float> : &NEImageToTensorKernel::store_row<uint8_t>;
+
+    // Configure kernel window: each thread processes whole output rows
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, out_height, 1));
+    INEKernel::configure(win);
+}
+
+Status NEImageToTensorKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const ImageToTensorInfo &info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, info));
+    return Status{};
+}
+
+void NEImageToTensorKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_sample_row == nullptr || _store_row == nullptr);
+
+    // Converted row, kept in the cache between the sampling and the store
+    std::vector<float> rgb(3 * _x0.size());
+
+    for(int y = window.y().start(); y < window.y().end(); y += window.y().step())
+    {
+        (this->*_sample_row)(y, rgb.data());
+        (this->*_store_row)(y, rgb.data());
+    }
+}
+} // namespace arm_compute
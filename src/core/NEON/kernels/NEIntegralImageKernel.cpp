@@ -140,3 +140,262 @@ void NEIntegralImageKernel::run(const Window &window, const ThreadInfo &info)
     },
     input, output);
 }
+
+namespace
+{
+/** Inclusive prefix sum of the lanes of a vector */
+inline uint16x8_t prefix_sum(uint16x8_t values)
+{
+    const uint16x8_t zero = vdupq_n_u16(0);
+
+    values = vaddq_u16(values, vextq_u16(zero, values, 7));
+    values = vaddq_u16(values, vextq_u16(zero, values, 6));
+    return vaddq_u16(values, vextq_u16(zero, values, 4));
+}
+
+/** Inclusive prefix sum of the lanes of a vector */
+inline uint32x4_t prefix_sum(uint32x4_t values)
+{
+    const uint32x4_t zero = vdupq_n_u32(0);
+
+    values = vaddq_u32(values, vextq_u32(zero, values, 3));
+    return vaddq_u32(values, vextq_u32(zero, values, 2));
+}
+
+/** Compute the prefix sums of 16 pixels, offset by the sum of the previous pixels of the row
+ *
+ * @param[in]      pixels Pixels to accumulate.
+ * @param[out]     output Pointer to the 16 prefix sums.
+ * @param[in, out] carry  Sum of the previous pixels of the row, updated with the sum of @p pixels.
+ */
+inline void integral_row(const uint8x16_t &pixels, uint32_t *output, uint32_t &carry)
+{
+    // The sum of 16 pixels fits in 16 bits
+    const uint16x8_t low  = prefix_sum(vmovl_u8(vget_low_u8(pixels)));
+    const uint16x8_t high = vaddq_u16(prefix_sum(vmovl_u8(vget_high_u8(pixels))), vdupq_n_u16(vgetq_lane_u16(low, 7)));
+
+    const uint32x4_t carry_values = vdupq_n_u32(carry);
+
+    vst1q_u32(output, vaddw_u16(carry_values, vget_low_u16(low)));
+    vst1q_u32(output + 4, vaddw_u16(carry_values, vget_high_u16(low)));
+    vst1q_u32(output + 8, vaddw_u16(carry_values, vget_low_u16(high)));
+    vst1q_u32(output + 12, vaddw_u16(carry_values, vget_high_u16(high)));
+
+    carry += vgetq_lane_u16(high, 7);
+}
+
+/** Compute the prefix sums of 16 squared pixels, offset by the sum of the previous squared pixels of the row
+ *
+ * @param[in]      pixels Pixels to accumulate.
+ * @param[out]     output Pointer to the 16 prefix sums.
+ * @param[in, out] carry  Sum of the previous squared pixels of the row, updated with the sum of the squares of @p pixels.
+ */
+inline void integral_squared_row(const uint8x16_t &pixels, uint64_t *output, uint64_t &carry)
+{
+    const uint16x8_t squares_low  = vmull_u8(vget_low_u8(pixels), vget_low_u8(pixels));
+    const uint16x8_t squares_high = vmull_u8(vget_high_u8(pixels), vget_high_u8(pixels));
+
+    // The sum of 16 squared pixels fits in 32 bits
+    uint32x4_t sums[4] =
+    {
+        prefix_sum(vmovl_u16(vget_low_u16(squares_low))),
+        prefix_sum(vmovl_u16(vget_high_u16(squares_low))),
+        prefix_sum(vmovl_u16(vget_low_u16(squares_high))),
+        prefix_sum(vmovl_u16(vget_high_u16(squares_high)))
+    };
+
+    const uint64x2_t carry_values = vdupq_n_u64(carry);
+
+    for(int i = 0; i < 4; ++i)
+    {
+        if(i > 0)
+        {
+            sums[i] = vaddq_u32(sums[i], vdupq_n_u32(vgetq_lane_u32(sums[i - 1], 3)));
+        }
+
+        vst1q_u64(output + 4 * i, vaddw_u32(carry_values, vget_low_u32(sums[i])));
+        vst1q_u64(output + 4 * i + 2, vaddw_u32(carry_values, vget_high_u32(sums[i])));
+    }
+
+    carry += vgetq_lane_u32(sums[3], 3);
+}
+} // namespace
+
+NEIntegralImageHorKernel::NEIntegralImageHorKernel()
+    : _input(nullptr), _output(nullptr), _output_squared(nullptr)
+{
+}
+
+void NEIntegralImageHorKernel::configure(const ITensor *input, ITensor *output, ITensor *output_squared)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, output);
+
+    if(output_squared != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output_squared, 1, DataType::U64);
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, output_squared);
+    }
+
+    _input          = input;
+    _output         = output;
+    _output_squared = output_squared;
+
+    constexpr unsigned int num_elems_processed_per_iteration = 16;
+
+    // Configure kernel window
+    Window win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration));
+
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+    AccessWindowHorizontal output_squared_access(output_squared != nullptr ? output_squared->info() : nullptr, 0, num_elems_processed_per_iteration);
+
+    update_window_and_padding(win,
+                              AccessWindowHorizontal(input->info(), 0, num_elems_processed_per_iteration),
+                              output_access, output_squared_access);
+
+    output_access.set_valid_region(win, input->info()->valid_region());
+    output_squared_access.set_valid_region(win, input->info()->valid_region());
+
+    // Each row is processed from left to right in one iteration
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    INEKernel::configure(win);
+}
+
+void NEIntegralImageHorKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    constexpr int num_elems_processed_per_iteration = 16;
+
+    const int width = _input->info()->dimension(0);
+
+    Iterator input(_input, window);
+    Iterator output(_output, window);
+
+    if(_output_squared == nullptr)
+    {
+        execute_window_loop(window, [&](const Coordinates & id)
+        {
+            const auto input_ptr  = input.ptr();
+            const auto output_ptr = reinterpret_cast<uint32_t *>(output.ptr());
+
+            uint32_t carry = 0;
+            for(int x = 0; x < width; x += num_elems_processed_per_iteration)
+            {
+                integral_row(vld1q_u8(input_ptr + x), output_ptr + x, carry);
+            }
+        },
+        input, output);
+    }
+    else
+    {
+        Iterator output_squared(_output_squared, window);
+
+        execute_window_loop(window, [&](const Coordinates & id)
+        {
+            const auto input_ptr          = input.ptr();
+            const auto output_ptr         = reinterpret_cast<uint32_t *>(output.ptr());
+            const auto output_squared_ptr = reinterpret_cast<uint64_t *>(output_squared.ptr());
+
+            uint32_t carry         = 0;
+            uint64_t carry_squared = 0;
+            for(int x = 0; x < width; x += num_elems_processed_per_iteration)
+            {
+                const uint8x16_t pixels = vld1q_u8(input_ptr + x);
+
+                integral_row(pixels, output_ptr + x, carry);
+                integral_squared_row(pixels, output_squared_ptr + x, carry_squared);
+            }
+        },
+        input, output, output_squared);
+    }
+}
+
+NEIntegralImageVertKernel::NEIntegralImageVertKernel()
+    : _in_out(nullptr), _in_out_squared(nullptr)
+{
+}
+
+void NEIntegralImageVertKernel::configure(ITensor *in_out, ITensor *in_out_squared)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(in_out);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(in_out, 1, DataType::U32);
+
+    if(in_out_squared != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(in_out_squared, 1, DataType::U64);
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(in_out, in_out_squared);
+    }
+
+    _in_out         = in_out;
+    _in_out_squared = in_out_squared;
+
+    constexpr unsigned int num_elems_processed_per_iteration = 16;
+
+    // Configure kernel window
+    Window win = calculate_max_window(*in_out->info(), Steps(num_elems_processed_per_iteration));
+
+    update_window_and_padding(win,
+                              AccessWindowHorizontal(in_out->info(), 0, num_elems_processed_per_iteration),
+                              AccessWindowHorizontal(in_out_squared != nullptr ? in_out_squared->info() : nullptr, 0, num_elems_processed_per_iteration));
+
+    // The columns are split between the threads, each of them going through all the rows from top to bottom
+    win.set(Window::DimY, Window::Dimension(0, 1, 1));
+
+    INEKernel::configure(win);
+}
+
+void NEIntegralImageVertKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    constexpr int num_elems_processed_per_iteration = 16;
+
+    const int    height         = _in_out->info()->dimension(1);
+    const int    start_x        = window.x().start();
+    const int    end_x          = window.x().end();
+    const size_t stride         = _in_out->info()->strides_in_bytes()[1];
+    const size_t stride_squared = (_in_out_squared != nullptr) ? _in_out_squared->info()->strides_in_bytes()[1] : 0;
+
+    // Iterate over the planes, the rows and columns of each plane are processed below
+    Window win_planes(window);
+    win_planes.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    execute_window_loop(win_planes, [&](const Coordinates & id)
+    {
+        uint8_t *plane         = _in_out->ptr_to_element(id);
+        uint8_t *plane_squared = (_in_out_squared != nullptr) ? _in_out_squared->ptr_to_element(id) : nullptr;
+
+        for(int y = 1; y < height; ++y)
+        {
+            const auto above = reinterpret_cast<const uint32_t *>(plane + (y - 1) * stride);
+            const auto row   = reinterpret_cast<uint32_t *>(plane + y * stride);
+
+            for(int x = start_x; x < end_x; x += num_elems_processed_per_iteration)
+            {
+                vst1q_u32(row + x, vaddq_u32(vld1q_u32(row + x), vld1q_u32(above + x)));
+                vst1q_u32(row + x + 4, vaddq_u32(vld1q_u32(row + x + 4), vld1q_u32(above + x + 4)));
+                vst1q_u32(row + x + 8, vaddq_u32(vld1q_u32(row + x + 8), vld1q_u32(above + x + 8)));
+                vst1q_u32(row + x + 12, vaddq_u32(vld1q_u32(row + x + 12), vld1q_u32(above + x + 12)));
+            }
+
+            if(plane_squared != nullptr)
+            {
+                const auto above_squared = reinterpret_cast<const uint64_t *>(plane_squared + (y - 1) * stride_squared);
+                const auto row_squared   = reinterpret_cast<uint64_t *>(plane_squared + y * stride_squared);
+
+                for(int x = start_x; x < end_x; x += 2)
+                {
+                    vst1q_u64(row_squared + x, vaddq_u64(vld1q_u64(row_squared + x), vld1q_u64(above_squared + x)));
+                }
+            }
+        }
+    });
+}
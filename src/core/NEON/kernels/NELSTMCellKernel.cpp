@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NELSTMCellKernel.h"
+
+#include "arm_compute/core/CPP/Validate.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEMath.h"
+#include "arm_compute/core/NEON/kernels/detail/NERecurrentCellDetail.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+#include <cmath>
+
+using namespace arm_compute;
+
+namespace
+{
+Status validate_vector(const ITensorInfo *vector, const ITensorInfo *reference, unsigned int num_units)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(reference, vector);
+    ARM_COMPUTE_RETURN_ERROR_ON(vector->num_dimensions() > 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(vector->dimension(0) != num_units);
+
+    return Status{};
+}
+
+Status validate_arguments(const ITensorInfo *input_gates, const ITensorInfo *recurrent_gates,
+                          const ITensorInfo *input_gate_bias, const ITensorInfo *forget_gate_bias, const ITensorInfo *cell_bias, const ITensorInfo *output_gate_bias,
+                          const ITensorInfo *cell_to_input_weights, const ITensorInfo *cell_to_forget_weights, const ITensorInfo *cell_to_output_weights,
+                          const ITensorInfo *cell_state, const ITensorInfo *cell_output, const ITensorInfo *output, const ITensorInfo *scratch_buffer,
+                          const ActivationLayerInfo &activation_info, float cell_threshold)
+{
+    using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input_gates, recurrent_gates, forget_gate_bias, cell_bias, output_gate_bias, cell_state, cell_output, scratch_buffer);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input_gates);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input_gates, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input_gates, recurrent_gates, cell_state, cell_output, scratch_buffer);
+
+    const bool         has_cifg    = input_gate_bias == nullptr;
+    const unsigned int num_units   = cell_state->dimension(0);
+    const unsigned int num_batches = cell_state->dimension(1);
+    const unsigned int num_gates   = has_cifg ? 3 : 4;
+
+    ARM_COMPUTE_RETURN_ERROR_ON(cell_state->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(input_gates->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(input_gates->dimension(0) != num_gates * num_units);
+    ARM_COMPUTE_RETURN_ERROR_ON(input_gates->dimension(1) != num_batches);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(recurrent_gates->tensor_shape(), TensorShape(num_gates * num_units, num_batches));
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(cell_state, cell_output);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(scratch_buffer->tensor_shape(), TensorShape((num_gates == 3 ? 4 : 3) * num_units, num_batches));
+
+    // Biases
+    if(!has_cifg)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(input_gate_bias, input_gates, num_units));
+    }
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(forget_gate_bias, input_gates, num_units));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(cell_bias, input_gates, num_units));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(output_gate_bias, input_gates, num_units));
+
+    // Peephole connections
+    ARM_COMPUTE_RETURN_ERROR_ON((cell_to_forget_weights == nullptr) != (cell_to_output_weights == nullptr));
+    ARM_COMPUTE_RETURN_ERROR_ON(has_cifg && cell_to_input_weights != nullptr);
+    ARM_COMPUTE_RETURN_ERROR_ON(!has_cifg && cell_to_forget_weights != nullptr && cell_to_input_weights == nullptr);
+    if(cell_to_forget_weights != nullptr)
+    {
+        if(!has_cifg)
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(cell_to_input_weights, input_gates, num_units));
+        }
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(cell_to_forget_weights, input_gates, num_units));
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_vector(cell_to_output_weights, input_gates, num_units));
+    }
+
+    // Sequence output
+    if(output != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input_gates, output);
+        ARM_COMPUTE_RETURN_ERROR_ON(output->num_dimensions() > 3);
+        ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(0) != num_units);
+        ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(1) != num_batches);
+        ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(2) != input_gates->dimension(2));
+    }
+
+    ARM_COMPUTE_RETURN_ERROR_ON(activation_info.activation() != ActivationFunction::RELU && activation_info.activation() != ActivationFunction::BOUNDED_RELU
+                                && activation_info.activation() != ActivationFunction::LU_BOUNDED_RELU && activation_info.activation() != ActivationFunction::LOGISTIC
+                                && activation_info.activation() != ActivationFunction::TANH);
+    ARM_COMPUTE_RETURN_ERROR_ON(cell_threshold < 0.f);
+
+    return Status{};
+}
+} // namespace
+
+NELSTMCellKernel::NELSTMCellKernel()
+    : _func(nullptr), _input_gates(nullptr), _recurrent_gates(nullptr), _input_gate_bias(nullptr), _forget_gate_bias(nullptr), _cell_bias(nullptr), _output_gate_bias(nullptr),
+      _cell_to_input_weights(nullptr), _cell_to_forget_weights(nullptr), _cell_to_output_weights(nullptr), _cell_state(nullptr), _cell_output(nullptr), _output(nullptr), _scratch_buffer(nullptr),
+      _activation_info(), _cell_threshold(0.f), _timestep(0)
+{
+}
+
+template <typename T>
+void NELSTMCellKernel::run_lstm_cell(const Window &window)
+{
+    const bool has_cifg     = _input_gate_bias == nullptr;
+    const bool has_peephole = _cell_to_forget_weights != nullptr;
+    const bool has_clipping = _cell_threshold != 0.f;
+    const int  num_units    = _cell_state->info()->dimension(0);
+
+    // Offsets of the gates inside a row of the gate tensors
+    const int input_gate_offset  = 0;
+    const int forget_gate_offset = has_cifg ? 0 : num_units;
+    const int cell_gate_offset   = forget_gate_offset + num_units;
+    const int output_gate_offset = cell_gate_offset + num_units;
+
+    // Offsets of the activated gates inside a row of the scratch buffer
+    const int scratch_cell_offset   = has_cifg ? num_units : 0;
+    const int scratch_forget_offset = scratch_cell_offset + num_units;
+    const int scratch_output_offset = scratch_forget_offset + num_units;
+
+    const T *input_gate_bias        = detail::row_ptr<T>(_input_gate_bias, 0);
+    const T *forget_gate_bias       = detail::row_ptr<T>(_forget_gate_bias, 0);
+    const T *cell_bias              = detail::row_ptr<T>(_cell_bias, 0);
+    const T *output_gate_bias       = detail::row_ptr<T>(_output_gate_bias, 0);
+    const T *cell_to_input_weights  = detail::row_ptr<T>(_cell_to_input_weights, 0);
+    const T *cell_to_forget_weights = detail::row_ptr<T>(_cell_to_forget_weights, 0);
+    const T *cell_to_output_weights = detail::row_ptr<T>(_cell_to_output_weights, 0);
+
+    const float32x4_t vone            = vdupq_n_f32(1.f);
+    const float32x4_t vcell_threshold = vdupq_n_f32(_cell_threshold);
+
+    const int window_start_x = window.x().start();
+    const int window_end_x   = window.x().end();
+
+    for(int y = window.y().start(); y < window.y().end(); ++y)
+    {
+        const T *input_gates     = detail::row_ptr<T>(_input_gates, y, _timestep);
+        const T *recurrent_gates = detail::row_ptr<T>(_recurrent_gates, y);
+        T       *cell_state      = detail::row_ptr<T>(_cell_state, y);
+        T       *cell_output     = detail::row_ptr<T>(_cell_output, y);
+        T       *output          = detail::row_ptr<T>(_output, y, _timestep);
+        T       *scratch         = detail::row_ptr<T>(_scratch_buffer, y);
+
+        int x = window_start_x;
+        for(; x <= (window_end_x - 4); x += 4)
+        {
+            const float32x4_t cell_in = detail::vload(cell_state + x);
+
+            // Forget gate
+            float32x4_t forget_gate = vaddq_f32(vaddq_f32(detail::vload(input_gates + forget_gate_offset + x), detail::vload(recurrent_gates + forget_gate_offset + x)), detail::vload(forget_gate_bias + x));
+            if(has_peephole)
+            {
+                forget_gate = vmlaq_f32(forget_gate, cell_in, detail::vload(cell_to_forget_weights + x));
+            }
+            forget_gate = detail::vlogistic(forget_gate);
+
+            // Input gate
+            float32x4_t input_gate{};
+            if(has_cifg)
+            {
+                input_gate = vsubq_f32(vone, forget_gate);
+            }
+            else
+            {
+                input_gate = vaddq_f32(vaddq_f32(detail::vload(input_gates + input_gate_offset + x), detail::vload(recurrent_gates + input_gate_offset + x)), detail::vload(input_gate_bias + x));
+                if(has_peephole)
+                {
+                    input_gate = vmlaq_f32(input_gate, cell_in, detail::vload(cell_to_input_weights + x));
+                }
+                input_gate = detail::vlogistic(input_gate);
+            }
+
+            // Cell state
+            float32x4_t cell_gate = vaddq_f32(vaddq_f32(detail::vload(input_gates + cell_gate_offset + x), detail::vload(recurrent_gates + cell_gate_offset + x)), detail::vload(cell_bias + x));
+            cell_gate             = detail::vactivation(cell_gate, _activation_info);
+            float32x4_t cell_out  = vmlaq_f32(vmulq_f32(input_gate, cell_gate), forget_gate, cell_in);
+            if(has_clipping)
+            {
+                cell_out = vminq_f32(vcell_threshold, vmaxq_f32(vnegq_f32(vcell_threshold), cell_out));
+            }
+
+            // Output gate
+            float32x4_t output_gate = vaddq_f32(vaddq_f32(detail::vload(input_gates + output_gate_offset + x), detail::vload(recurrent_gates + output_gate_offset + x)), detail::vload(output_gate_bias + x));
+            if(has_peephole)
+            {
+                output_gate = vmlaq_f32(output_gate, cell_out, detail::vload(cell_to_output_weights + x));
+            }
+            output_gate = detail::vlogistic(output_gate);
+
+            const float32x4_t result = vmulq_f32(output_gate, detail::vactivation(cell_out, _activation_info));
+
+            detail::vstore(cell_state + x, cell_out);
+            detail::vstore(cell_output + x, result);
+            if(output != nullptr)
+            {
+                detail::vstore(output + x, result);
+            }
+            if(has_cifg)
+            {
+                detail::vstore(scratch + x, input_gate);
+            }
+            detail::vstore(scratch + scratch_cell_offset + x, cell_out);
+            detail::vstore(scratch + scratch_forget_offset + x, forget_gate);
+            detail::vstore(scratch + scratch_output_offset + x, output_gate);
+        }
+
+        // Compute left-over elements
+        for(; x < window_end_x; ++x)
+        {
+            const float cell_in = static_cast<float>(cell_state[x]);
+
+            float forget_gate = static_cast<float>(input_gates[forget_gate_offset + x]) + static_cast<float>(recurrent_gates[forget_gate_offset + x]) + static_cast<float>(forget_gate_bias[x]);
+            if(has_peephole)
+            {
+                forget_gate += cell_in * static_cast<float>(cell_to_forget_weights[x]);
+            }
+            forget_gate = detail::logistic(forget_gate);
+
+            float input_gate = 0.f;
+            if(has_cifg)
+            {
+                input_gate = 1.f - forget_gate;
+            }
+            else
+            {
+                input_gate = static_cast<float>(input_gates[input_gate_offset + x]) + static_cast<float>(recurrent_gates[input_gate_offset + x]) + static_cast<float>(input_gate_bias[x]);
+                if(has_peephole)
+                {
+                    input_gate += cell_in * static_cast<float>(cell_to_input_weights[x]);
+                }
+                input_gate = detail::logistic(input_gate);
+            }
+
+            float cell_gate = static_cast<float>(input_gates[cell_gate_offset + x]) + static_cast<float>(recurrent_gates[cell_gate_offset + x]) + static_cast<float>(cell_bias[x]);
+            cell_gate       = detail::activation(cell_gate, _activation_info);
+            float cell_out  = input_gate * cell_gate + forget_gate * cell_in;
+            if(has_clipping)
+            {
+                cell_out = std::min(_cell_threshold, std::max(-_cell_threshold, cell_out));
+            }
+
+            float output_gate = static_cast<float>(input_gates[output_gate_offset + x]) + static_cast<float>(recurrent_gates[output_gate_offset + x]) + static_cast<float>(output_gate_bias[x]);
+            if(has_peephole)
+            {
+                output_gate += cell_out * static_cast<float>(cell_to_output_weights[x]);
+            }
+            output_gate = detail::logistic(output_gate);
+
+            const float result = output_gate * detail::activation(cell_out, _activation_info);
+
+            cell_state[x]  = static_cast<T>(cell_out);
+            cell_output[x] = static_cast<T>(result);
+            if(output != nullptr)
+            {
+                output[x] = static_cast<T>(result);
+            }
+            if(has_cifg)
+            {
+                scratch[x] = static_cast<T>(input_gate);
+            }
+            scratch[scratch_cell_offset + x]   = static_cast<T>(cell_out);
+            scratch[scratch_forget_offset + x] = static_cast<T>(forget_gate);
+            scratch[scratch_output_offset + x] = static_cast<T>(output_gate);
+        }
+    }
+}
+
+void NELSTMCellKernel::configure(const ITensor *input_gates, const ITensor *recurrent_gates,
+                                 const ITensor *input_gate_bias, const ITensor *forget_gate_bias, const ITensor *cell_bias, const ITensor *output_gate_bias,
+                                 const ITensor *cell_to_input_weights, const ITensor *cell_to_forget_weights, const ITensor *cell_to_output_weights,
+                                 ITensor *cell_state, ITensor *cell_output, ITensor *output, ITensor *scratch_buffer,
+                                 const ActivationLayerInfo &activation_info, float cell_threshold)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input_gates, recurrent_gates, forget_gate_bias, cell_bias, output_gate_bias, cell_state, cell_output, scratch_buffer);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input_gates->info(), recurrent_gates->info(),
+                                                  (input_gate_bias != nullptr) ? input_gate_bias->info() : nullptr, forget_gate_bias->info(), cell_bias->info(), output_gate_bias->info(),
+                                                  (cell_to_input_weights != nullptr) ? cell_to_input_weights->info() : nullptr,
+                                                  (cell_to_forget_weights != nullptr) ? cell_to_forget_weights->info() : nullptr,
+                                                  (cell_to_output_weights != nullptr) ? cell_to_output_weights->info() : nullptr,
+                                                  cell_state->info(), cell_output->info(), (output != nullptr) ? output->info() : nullptr, scratch_buffer->info(),
+                                                  activation_info, cell_threshold));
+
+    _input_gates            = input_gates;
+    _recurrent_gates        = recurrent_gates;
+    _input_gate_bias        = input_gate_bias;
+    _forget_gate_bias       = forget_gate_bias;
+    _cell_bias              = cell_bias;
+    _output_gate_bias       = output_gate_bias;
+    _cell_to_input_weights  = cell_to_input_weights;
+    _cell_to_forget_weights = cell_to_forget_weights;
+    _cell_to_output_weights = cell_to_output_weights;
+    _cell_state             = cell_state;
+    _cell_output            = cell_output;
+    _output                 = output;
+    _scratch_buffer         = scratch_buffer;
+    _activation_info        = activation_info;
+    _cell_threshold         = cell_threshold;
+    _timestep               = 0;
+
+    switch(input_gates->info()->data_type())
+    {
+        case DataType::F32:
+            _func = &NELSTMCellKernel::run_lstm_cell<float>;
+            break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            _func = &NELSTMCellKernel::run_lstm_cell<float16_t>;
+            break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported");
+    }
+
+    // The window spans the units along X, one element per step, so that the scheduler can split it even for a single batch.
+    // Each thread then processes its own range with vector operations and a scalar tail.
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, cell_state->info()->dimension(0), 1));
+    win.set(Window::DimY, Window::Dimension(0, cell_state->info()->dimension(1), 1));
+
+    // The kernel writes every element of its outputs
+    cell_state->info()->set_valid_region(ValidRegion(Coordinates(), cell_state->info()->tensor_shape()));
+    cell_output->info()->set_valid_region(ValidRegion(Coordinates(), cell_output->info()->tensor_shape()));
+    scratch_buffer->info()->set_valid_region(ValidRegion(Coordinates(), scratch_buffer->info()->tensor_shape()));
+    if(output != nullptr)
+    {
+        output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+    }
+
+    INEKernel::configure(win);
+}
+
+Status NELSTMCellKernel::validate(const ITensorInfo *input_gates, const ITensorInfo *recurrent_gates,
+                                  const ITensorInfo *input_gate_bias, const ITensorInfo *forget_gate_bias, const ITensorInfo *cell_bias, const ITensorInfo *output_gate_bias,
+                                  const ITensorInfo *cell_to_input_weights, const ITensorInfo *cell_to_forget_weights, const ITensorInfo *cell_to_output_weights,
+                                  const ITensorInfo *cell_state, const ITensorInfo *cell_output, const ITensorInfo *output, const ITensorInfo *scratch_buffer,
+                                  const ActivationLayerInfo &activation_info, float cell_threshold)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input_gates, recurrent_gates, input_gate_bias, forget_gate_bias, cell_bias, output_gate_bias,
+                                                   cell_to_input_weights, cell_to_forget_weights, cell_to_output_weights,
+                                                   cell_state, cell_output, output, scratch_buffer, activation_info, cell_threshold));
+    return Status{};
+}
+
+void NELSTMCellKernel::set_timestep(unsigned int timestep)
+{
+    ARM_COMPUTE_ERROR_ON(timestep >= _input_gates->info()->dimension(2));
+    _timestep = timestep;
+}
+
+void NELSTMCellKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
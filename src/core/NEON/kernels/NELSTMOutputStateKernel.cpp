@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NELSTMOutputStateKernel.h"
+
+#include "arm_compute/core/CPP/Validate.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+
+using namespace arm_compute;
+
+namespace
+{
+Status validate_arguments(const ITensorInfo *projection_bias, const ITensorInfo *output_state, const ITensorInfo *output, float projection_threshold)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(output_state);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(output_state);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output_state, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(output_state->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(projection_threshold < 0.f);
+
+    if(projection_bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(output_state, projection_bias);
+        ARM_COMPUTE_RETURN_ERROR_ON(projection_bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(projection_bias->dimension(0) != output_state->dimension(0));
+    }
+
+    if(output != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(output_state, output);
+        ARM_COMPUTE_RETURN_ERROR_ON(output->num_dimensions() > 3);
+        ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(0) != output_state->dimension(0));
+        ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(1) != output_state->dimension(1));
+    }
+
+    return Status{};
+}
+} // namespace
+
+NELSTMOutputStateKernel::NELSTMOutputStateKernel()
+    : _func(nullptr), _projection_bias(nullptr), _output_state(nullptr), _output(nullptr), _projection_threshold(0.f), _timestep(0)
+{
+}
+
+template <typename T>
+void NELSTMOutputStateKernel::run_output_state(const Window &window)
+{
+    const bool has_clipping   = _projection_threshold != 0.f;
+    const T   *bias           = (_projection_bias != nullptr) ? reinterpret_cast<const T *>(_projection_bias->buffer() + _projection_bias->info()->offset_first_element_in_bytes()) : nullptr;
+    const int  window_start_x = window.x().start();
+    const int  window_end_x   = window.x().end();
+
+    for(int y = window.y().start(); y < window.y().end(); ++y)
+    {
+        T *output_state = reinterpret_cast<T *>(_output_state->ptr_to_element(Coordinates(0, y)));
+        T *output       = (_output != nullptr) ? reinterpret_cast<T *>(_output->ptr_to_element(Coordinates(0, y, _timestep))) : nullptr;
+
+        for(int x = window_start_x; x < window_end_x; ++x)
+        {
+            float value = static_cast<float>(output_state[x]);
+            if(bias != nullptr)
+            {
+                value += static_cast<float>(bias[x]);
+            }
+            if(has_clipping)
+            {
+                value = std::min(_projection_threshold, std::max(-_projection_threshold, value));
+            }
+
+            output_state[x] = static_cast<T>(value);
+            if(output != nullptr)
+            {
+                output[x] = static_cast<T>(value);
+            }
+        }
+    }
+}
+
+void NELSTMOutputStateKernel::configure(const ITensor *projection_bias, ITensor *output_state, ITensor *output, float projection_threshold)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(output_state);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments((projection_bias != nullptr) ? projection_bias->info() : nullptr, output_state->info(), (output != nullptr) ? output->info() : nullptr,
+                                                  projection_threshold));
+
+    _projection_bias      = projection_bias;
+    _output_state         = output_state;
+    _output               = output;
+    _projection_threshold = projection_threshold;
+    _timestep             = 0;
+
+    switch(output_state->info()->data_type())
+    {
+        case DataType::F32:
+            _func = &NELSTMOutputStateKernel::run_output_state<float>;
+            break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            _func = &NELSTMOutputStateKernel::run_output_state<float16_t>;
+            break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported");
+    }
+
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, output_state->info()->dimension(0), 1));
+    win.set(Window::DimY, Window::Dimension(0, output_state->info()->dimension(1), 1));
+
+    if(output != nullptr)
+    {
+        output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+    }
+
+    INEKernel::configure(win);
+}
+
+Status NELSTMOutputStateKernel::validate(const ITensorInfo *projection_bias, const ITensorInfo *output_state, const ITensorInfo *output, float projection_threshold)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(projection_bias, output_state, output, projection_threshold));
+    return Status{};
+}
+
+void NELSTMOutputStateKernel::set_timestep(unsigned int timestep)
+{
+    ARM_COMPUTE_ERROR_ON(_output != nullptr && timestep >= _output->info()->dimension(2));
+    _timestep = timestep;
+}
+
+void NELSTMOutputStateKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
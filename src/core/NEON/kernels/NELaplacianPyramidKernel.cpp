@@ -0,0 +1,478 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NELaplacianPyramidKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+using namespace arm_compute;
+
+namespace
+{
+constexpr int num_taps   = 5;
+constexpr int border     = num_taps / 2;
+constexpr int read_slack = 32;
+
+/** Horizontal pass of the Gaussian 5 filter
+ *
+ * @param[in]  row   Input row extended by two border pixels on each side. Must be readable up to 32 bytes past @p width.
+ * @param[out] out   Filtered row.
+ * @param[in]  width Width of the filtered row. Must be a multiple of 16.
+ */
+inline void gaussian5_hor(const uint8_t *row, uint16_t *out, int width)
+{
+    const uint16x8_t six  = vdupq_n_u16(6);
+    const uint16x8_t four = vdupq_n_u16(4);
+
+    for(int x = 0; x < width; x += 16)
+    {
+        const uint8x16_t data_l2 = vld1q_u8(row + x);
+        const uint8x16_t data_nx = vld1q_u8(row + x + 16);
+        const uint8x16_t data_l1 = vextq_u8(data_l2, data_nx, 1);
+        const uint8x16_t data_m  = vextq_u8(data_l2, data_nx, 2);
+        const uint8x16_t data_r1 = vextq_u8(data_l2, data_nx, 3);
+        const uint8x16_t data_r2 = vextq_u8(data_l2, data_nx, 4);
+
+        uint16x8_t out_low = vaddl_u8(vget_low_u8(data_l2), vget_low_u8(data_r2));
+        out_low            = vmlaq_u16(out_low, vaddl_u8(vget_low_u8(data_l1), vget_low_u8(data_r1)), four);
+        out_low            = vmlaq_u16(out_low, vmovl_u8(vget_low_u8(data_m)), six);
+
+        uint16x8_t out_high = vaddl_u8(vget_high_u8(data_l2), vget_high_u8(data_r2));
+        out_high            = vmlaq_u16(out_high, vaddl_u8(vget_high_u8(data_l1), vget_high_u8(data_r1)), four);
+        out_high            = vmlaq_u16(out_high, vmovl_u8(vget_high_u8(data_m)), six);
+
+        vst1q_u16(out + x, out_low);
+        vst1q_u16(out + x + 8, out_high);
+    }
+}
+
+/** Vertical pass of the Gaussian 5 filter
+ *
+ * @param[in]  rows  Horizontally filtered rows, from top to bottom.
+ * @param[out] out   Output row.
+ * @param[in]  width Width of the output row. Must be a multiple of 8.
+ */
+inline void gaussian5_vert(const uint16_t *const *rows, uint8_t *out, int width)
+{
+    const uint16x8_t six  = vdupq_n_u16(6);
+    const uint16x8_t four = vdupq_n_u16(4);
+
+    for(int x = 0; x < width; x += 8)
+    {
+        uint16x8_t out_val = vaddq_u16(vld1q_u16(rows[0] + x), vld1q_u16(rows[4] + x));
+        out_val            = vmlaq_u16(out_val, vaddq_u16(vld1q_u16(rows[1] + x), vld1q_u16(rows[3] + x)), four);
+        out_val            = vmlaq_u16(out_val, vld1q_u16(rows[2] + x), six);
+
+        vst1_u8(out + x, vqshrn_n_u16(out_val, 8));
+    }
+}
+
+/** Subtract the blurred row from the input row with wrap around
+ *
+ * @param[in]  in      Input row.
+ * @param[in]  blurred Blurred row.
+ * @param[out] out     Output row.
+ * @param[in]  width   Width of the rows.
+ */
+inline void subtract_row(const uint8_t *in, const uint8_t *blurred, int16_t *out, int width)
+{
+    int x = 0;
+
+    for(; x <= width - 8; x += 8)
+    {
+        vst1q_s16(out + x, vreinterpretq_s16_u16(vsubl_u8(vld1_u8(in + x), vld1_u8(blurred + x))));
+    }
+
+    // Left-overs loop
+    for(; x < width; ++x)
+    {
+        out[x] = static_cast<int16_t>(in[x] - blurred[x]);
+    }
+}
+
+/** Convert the blurred row to S16
+ *
+ * @param[in]  blurred Blurred row.
+ * @param[out] out     Output row.
+ * @param[in]  width   Width of the rows.
+ */
+inline void convert_row(const uint8_t *blurred, int16_t *out, int width)
+{
+    int x = 0;
+
+    for(; x <= width - 8; x += 8)
+    {
+        vst1q_s16(out + x, vreinterpretq_s16_u16(vmovl_u8(vld1_u8(blurred + x))));
+    }
+
+    // Left-overs loop
+    for(; x < width; ++x)
+    {
+        out[x] = blurred[x];
+    }
+}
+
+/** Decimate the blurred row by 2
+ *
+ * @param[in]  blurred Blurred row, starting at the first sampled column. Must be readable up to 32 bytes past 2 * @p width.
+ * @param[out] out     Output row.
+ * @param[in]  width   Width of the output row.
+ */
+inline void decimate_row(const uint8_t *blurred, uint8_t *out, int width)
+{
+    int x = 0;
+
+    for(; x <= width - 16; x += 16)
+    {
+        vst1q_u8(out + x, vld2q_u8(blurred + 2 * x).val[0]);
+    }
+
+    // Left-overs loop
+    for(; x < width; ++x)
+    {
+        out[x] = blurred[2 * x];
+    }
+}
+
+/** Add the upsampled row to the laplacian row with saturation and store the result
+ *
+ * @param[in]  upsampled Upsampled row.
+ * @param[in]  laplacian Laplacian row.
+ * @param[out] out       Output row.
+ * @param[in]  width     Width of the rows.
+ */
+inline void add_row(const int16_t *upsampled, const int16_t *laplacian, int16_t *out, int width)
+{
+    int x = 0;
+
+    for(; x <= width - 8; x += 8)
+    {
+        vst1q_s16(out + x, vqaddq_s16(vld1q_s16(upsampled + x), vld1q_s16(laplacian + x)));
+    }
+
+    // Left-overs loop
+    for(; x < width; ++x)
+    {
+        out[x] = utility::saturate_cast<int16_t>(static_cast<int32_t>(upsampled[x]) + laplacian[x]);
+    }
+}
+
+inline void add_row(const int16_t *upsampled, const int16_t *laplacian, uint8_t *out, int width)
+{
+    int x = 0;
+
+    for(; x <= width - 8; x += 8)
+    {
+        vst1_u8(out + x, vqmovun_s16(vqaddq_s16(vld1q_s16(upsampled + x), vld1q_s16(laplacian + x))));
+    }
+
+    // Left-overs loop
+    for(; x < width; ++x)
+    {
+        out[x] = utility::saturate_cast<uint8_t>(utility::saturate_cast<int16_t>(static_cast<int32_t>(upsampled[x]) + laplacian[x]));
+    }
+}
+
+inline uint8_t *row_ptr(const ITensor *tensor, int y)
+{
+    return tensor->buffer() + tensor->info()->offset_first_element_in_bytes() + y * tensor->info()->strides_in_bytes()[1];
+}
+} // namespace
+
+NELaplacianPyramidKernel::NELaplacianPyramidKernel()
+    : _input(nullptr), _laplacian(nullptr), _next_level(nullptr), _lowpass(nullptr), _border_mode(BorderMode::UNDEFINED), _constant_border_value(0), _offset_x(0), _offset_y(0)
+{
+}
+
+void NELaplacianPyramidKernel::configure(const ITensor *input, ITensor *laplacian, ITensor *next_level, ITensor *lowpass, BorderMode border_mode, uint8_t constant_border_value)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, laplacian);
+    ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(laplacian, 1, DataType::S16);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DIMENSIONS(input->info()->tensor_shape(), laplacian->info()->tensor_shape());
+
+    _input                 = input;
+    _laplacian             = laplacian;
+    _next_level            = next_level;
+    _lowpass               = lowpass;
+    _border_mode           = border_mode;
+    _constant_border_value = constant_border_value;
+
+    // The border is only undefined for the blurred outputs, the kernel itself replicates it
+    ValidRegion valid_region = input->info()->valid_region();
+
+    if(border_mode == BorderMode::UNDEFINED)
+    {
+        for(size_t d = 0; d < 2; ++d)
+        {
+            valid_region.set(d, valid_region.anchor[d] + border, std::max(0, static_cast<int>(valid_region.shape[d]) - 2 * border));
+        }
+    }
+
+    laplacian->info()->set_valid_region(valid_region);
+
+    if(next_level != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(next_level, 1, DataType::U8);
+        ARM_COMPUTE_ERROR_ON(next_level->info()->dimension(0) != (input->info()->dimension(0) + 1) / 2);
+        ARM_COMPUTE_ERROR_ON(next_level->info()->dimension(1) != (input->info()->dimension(1) + 1) / 2);
+
+        // Sub sampling selects odd pixels for even sizes and even pixels for odd sizes,
+        // see NEGaussianPyramidHorKernel for a detailed explanation.
+        const ValidRegion &input_valid_region = input->info()->valid_region();
+
+        _offset_x = (input_valid_region.end(0) % 2 == 0) ? 1 : 0;
+        _offset_y = (input_valid_region.end(1) % 2 == 0) ? 1 : 0;
+
+        next_level->info()->set_valid_region(ValidRegion(Coordinates(), next_level->info()->tensor_shape()));
+    }
+
+    if(lowpass != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(lowpass, 1, DataType::S16);
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DIMENSIONS(input->info()->tensor_shape(), lowpass->info()->tensor_shape());
+
+        lowpass->info()->set_valid_region(valid_region);
+    }
+
+    // Configure kernel window: one iteration per row of the input
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, input->info()->dimension(1), 1));
+
+    INEKernel::configure(win);
+}
+
+void NELaplacianPyramidKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int  width     = _input->info()->dimension(0);
+    const int  height    = _input->info()->dimension(1);
+    const int  hor_width = ceil_to_multiple(width, 16);
+    const bool constant  = (_border_mode == BorderMode::CONSTANT);
+
+    // Input row extended with its borders
+    std::vector<uint8_t> extended_row(hor_width + 2 * border + read_slack);
+
+    // Blurred row, only kept until the outputs of the row are written
+    std::vector<uint8_t> blurred_row(hor_width + read_slack);
+
+    // Line buffer of the horizontally filtered input rows, followed by the filtered constant border row
+    std::vector<uint16_t> line_buffer((num_taps + 1) * hor_width);
+    int                   line_rows[num_taps];
+    std::fill_n(line_rows, num_taps, INT_MIN);
+
+    uint16_t *constant_row = line_buffer.data() + num_taps * hor_width;
+    std::fill_n(constant_row, hor_width, static_cast<uint16_t>(_constant_border_value * 16));
+
+    auto hor_row = [&](int y) -> const uint16_t *
+    {
+        if(y < 0 || y >= height)
+        {
+            if(constant)
+            {
+                return constant_row;
+            }
+            // Replicate the border for BorderMode::UNDEFINED too
+            y = std::max(0, std::min(y, height - 1));
+        }
+
+        const int slot = y % num_taps;
+        uint16_t *out  = line_buffer.data() + slot * hor_width;
+
+        if(line_rows[slot] != y)
+        {
+            const uint8_t *in          = row_ptr(_input, y);
+            const uint8_t  left_value  = constant ? _constant_border_value : in[0];
+            const uint8_t  right_value = constant ? _constant_border_value : in[width - 1];
+
+            std::fill_n(extended_row.data(), border, left_value);
+            std::memcpy(extended_row.data() + border, in, width);
+            std::fill(extended_row.begin() + border + width, extended_row.end(), right_value);
+
+            gaussian5_hor(extended_row.data(), out, hor_width);
+
+            line_rows[slot] = y;
+        }
+
+        return out;
+    };
+
+    for(int y = window.y().start(); y < window.y().end(); ++y)
+    {
+        const uint16_t *rows[num_taps];
+
+        for(int i = 0; i < num_taps; ++i)
+        {
+            rows[i] = hor_row(y - border + i);
+        }
+
+        gaussian5_vert(rows, blurred_row.data(), hor_width);
+
+        subtract_row(row_ptr(_input, y), blurred_row.data(), reinterpret_cast<int16_t *>(row_ptr(_laplacian, y)), width);
+
+        if(_lowpass != nullptr)
+        {
+            convert_row(blurred_row.data(), reinterpret_cast<int16_t *>(row_ptr(_lowpass, y)), width);
+        }
+
+        if(_next_level != nullptr && y >= _offset_y && (y - _offset_y) % 2 == 0)
+        {
+            const int next_y = (y - _offset_y) / 2;
+
+            if(next_y < static_cast<int>(_next_level->info()->dimension(1)))
+            {
+                decimate_row(blurred_row.data() + _offset_x, row_ptr(_next_level, next_y), _next_level->info()->dimension(0));
+            }
+        }
+    }
+}
+
+NELaplacianReconstructKernel::NELaplacianReconstructKernel()
+    : _low(nullptr), _low_laplacian(nullptr), _laplacian(nullptr), _output(nullptr), _offsets_x(), _offsets_y()
+{
+}
+
+void NELaplacianReconstructKernel::configure(const ITensor *low, const ITensor *low_laplacian, const ITensor *laplacian, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(low, laplacian, output);
+    ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(laplacian);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(low, 1, DataType::S16);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(laplacian, 1, DataType::S16);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::S16);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DIMENSIONS(laplacian->info()->tensor_shape(), output->info()->tensor_shape());
+
+    if(low_laplacian != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(low_laplacian, 1, DataType::S16);
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DIMENSIONS(low->info()->tensor_shape(), low_laplacian->info()->tensor_shape());
+    }
+
+    _low           = low;
+    _low_laplacian = low_laplacian;
+    _laplacian     = laplacian;
+    _output        = output;
+
+    // Sampled rows and columns are computed as in the nearest neighbour path of NEScaleKernel
+    const size_t out_width  = output->info()->dimension(0);
+    const size_t out_height = output->info()->dimension(1);
+    const float  wr         = static_cast<float>(low->info()->dimension(0)) / static_cast<float>(out_width);
+    const float  hr         = static_cast<float>(low->info()->dimension(1)) / static_cast<float>(out_height);
+
+    _offsets_x.resize(out_width);
+    _offsets_y.resize(out_height);
+
+    for(size_t x = 0; x < out_width; ++x)
+    {
+        const size_t in_xi = (x + 0.5f) * wr;
+        _offsets_x[x]      = std::min(static_cast<int>(in_xi), static_cast<int>(low->info()->dimension(0)) - 1);
+    }
+
+    for(size_t y = 0; y < out_height; ++y)
+    {
+        const int in_yi = (y + 0.5f) * hr;
+        _offsets_y[y]   = std::min(in_yi, static_cast<int>(low->info()->dimension(1)) - 1);
+    }
+
+    output->info()->set_valid_region(laplacian->info()->valid_region());
+
+    // Configure kernel window: one iteration per row of the output
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, out_height, 1));
+
+    INEKernel::configure(win);
+}
+
+void NELaplacianReconstructKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int width = _output->info()->dimension(0);
+
+    // Upsampled row of the lower resolution tensor, shared by all the output rows sampling the same row
+    std::vector<int16_t> upsampled_row(width);
+    int                  upsampled_y = INT_MIN;
+
+    for(int y = window.y().start(); y < window.y().end(); ++y)
+    {
+        const int low_y = _offsets_y[y];
+
+        if(low_y != upsampled_y)
+        {
+            const auto low_row = reinterpret_cast<const int16_t *>(row_ptr(_low, low_y));
+
+            if(_low_laplacian != nullptr)
+            {
+                const auto low_laplacian_row = reinterpret_cast<const int16_t *>(row_ptr(_low_laplacian, low_y));
+
+                for(int x = 0; x < width; ++x)
+                {
+                    const int low_x  = _offsets_x[x];
+                    upsampled_row[x] = utility::saturate_cast<int16_t>(static_cast<int32_t>(low_row[low_x]) + low_laplacian_row[low_x]);
+                }
+            }
+            else
+            {
+                for(int x = 0; x < width; ++x)
+                {
+                    upsampled_row[x] = low_row[_offsets_x[x]];
+                }
+            }
+
+            upsampled_y = low_y;
+        }
+
+        const auto laplacian_row = reinterpret_cast<const int16_t *>(row_ptr(_laplacian, y));
+
+        if(_output->info()->data_type() == DataType::U8)
+        {
+            add_row(upsampled_row.data(), laplacian_row, row_ptr(_output, y), width);
+        }
+        else
+        {
+            add_row(upsampled_row.data(), laplacian_row, reinterpret_cast<int16_t *>(row_ptr(_output, y)), width);
+        }
+    }
+}
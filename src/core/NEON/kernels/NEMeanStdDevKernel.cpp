@@ -85,7 +85,7 @@ std::pair<uint64x1_t, uint64x1_t> accumulate(const Window &window, Iterator &ite
 } // namespace
 
 NEMeanStdDevKernel::NEMeanStdDevKernel()
-    : _input(nullptr), _mean(nullptr), _stddev(nullptr), _global_sum(nullptr), _global_sum_squared(nullptr), _mtx(), _border_size(0)
+    : _input(nullptr), _mean(nullptr), _stddev(nullptr), _local_sums(), _border_size(0)
 {
 }
 
@@ -94,19 +94,15 @@ BorderSize NEMeanStdDevKernel::border_size() const
     return _border_size;
 }
 
-void NEMeanStdDevKernel::configure(const IImage *input, float *mean, uint64_t *global_sum, float *stddev, uint64_t *global_sum_squared)
+void NEMeanStdDevKernel::configure(const IImage *input, float *mean, float *stddev)
 {
     ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input);
     ARM_COMPUTE_ERROR_ON(nullptr == mean);
-    ARM_COMPUTE_ERROR_ON(nullptr == global_sum);
-    ARM_COMPUTE_ERROR_ON(stddev && nullptr == global_sum_squared);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
 
-    _input              = input;
-    _mean               = mean;
-    _stddev             = stddev;
-    _global_sum         = global_sum;
-    _global_sum_squared = global_sum_squared;
+    _input  = input;
+    _mean   = mean;
+    _stddev = stddev;
 
     constexpr unsigned int num_elems_processed_per_iteration = 16;
 
@@ -120,9 +116,33 @@ void NEMeanStdDevKernel::configure(const IImage *input, float *mean, uint64_t *g
     INEKernel::configure(win);
 }
 
+void NEMeanStdDevKernel::reset(unsigned int num_threads)
+{
+    _local_sums.reset(num_threads, Sums{ 0, 0 });
+}
+
+void NEMeanStdDevKernel::merge()
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+
+    const Sums sums = _local_sums.merge(Sums{ 0, 0 }, [](Sums & result, const Sums & local_sums)
+    {
+        result.sum += local_sums.sum;
+        result.sum_squared += local_sums.sum_squared;
+    });
+
+    const float num_pixels = _input->info()->dimension(0) * _input->info()->dimension(1);
+    const float mean       = sums.sum / num_pixels;
+    *_mean                 = mean;
+
+    if(_stddev != nullptr)
+    {
+        *_stddev = std::sqrt((sums.sum_squared / num_pixels) - (mean * mean));
+    }
+}
+
 void NEMeanStdDevKernel::run(const Window &window, const ThreadInfo &info)
 {
-    ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
     Iterator input(_input, window);
@@ -139,22 +159,8 @@ void NEMeanStdDevKernel::run(const Window &window, const ThreadInfo &info)
         std::tie(local_sum, local_sum_squared) = accumulate<false>(window, input);
     }
 
-    const float num_pixels = _input->info()->dimension(0) * _input->info()->dimension(1);
-
-    // Merge sum and calculate mean and stddev
-    std::unique_lock<arm_compute::Mutex> lock(_mtx);
-
-    *_global_sum += vget_lane_u64(local_sum, 0);
-
-    const float mean = *_global_sum / num_pixels;
-    *_mean           = mean;
-
-    if(_stddev != nullptr)
-    {
-        const uint64_t tmp_sum_squared = vget_lane_u64(local_sum_squared, 0);
-        *_global_sum_squared += tmp_sum_squared;
-        *_stddev = std::sqrt((*_global_sum_squared / num_pixels) - (mean * mean));
-    }
-
-    lock.unlock();
+    // Accumulate the sums of the window into the ones of the thread
+    Sums &sums = _local_sums[info.thread_id];
+    sums.sum += vget_lane_u64(local_sum, 0);
+    sums.sum_squared += vget_lane_u64(local_sum_squared, 0);
 }
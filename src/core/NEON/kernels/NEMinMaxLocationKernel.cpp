@@ -38,11 +38,12 @@
 #include <arm_neon.h>
 #include <climits>
 #include <cstddef>
+#include <limits>
 
 namespace arm_compute
 {
 NEMinMaxKernel::NEMinMaxKernel()
-    : _func(), _input(nullptr), _min(), _max(), _mtx()
+    : _func(), _input(nullptr), _min(), _max(), _local_min_max()
 {
 }
 
@@ -83,30 +84,39 @@ void NEMinMaxKernel::configure(const IImage *input, void *min, void *max)
 
 void NEMinMaxKernel::run(const Window &window, const ThreadInfo &info)
 {
-    ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
     ARM_COMPUTE_ERROR_ON(_func == nullptr);
 
-    (this->*_func)(window);
+    (this->*_func)(window, info);
 }
 
-void NEMinMaxKernel::reset()
+void NEMinMaxKernel::reset(unsigned int num_threads)
 {
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+
+    _local_min_max.reset(num_threads, MinMax{ std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest() });
+}
+
+void NEMinMaxKernel::merge()
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+
+    const MinMax min_max = _local_min_max.merge(MinMax{ std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest() },
+                                                [](MinMax & result, const MinMax & local)
+    {
+        result.min = std::min(result.min, local.min);
+        result.max = std::max(result.max, local.max);
+    });
+
     switch(_input->info()->data_type())
     {
         case DataType::U8:
-            *static_cast<int32_t *>(_min) = UCHAR_MAX;
-            *static_cast<int32_t *>(_max) = 0;
-            break;
         case DataType::S16:
-            *static_cast<int32_t *>(_min) = SHRT_MAX;
-            *static_cast<int32_t *>(_max) = SHRT_MIN;
+            write_min_max<int32_t>(min_max.min, min_max.max);
             break;
         case DataType::F32:
-            *static_cast<float *>(_min) = std::numeric_limits<float>::max();
-            *static_cast<float *>(_max) = std::numeric_limits<float>::lowest();
+            write_min_max<float>(min_max.min, min_max.max);
             break;
         default:
             ARM_COMPUTE_ERROR("Unsupported data type");
@@ -115,27 +125,22 @@ void NEMinMaxKernel::reset()
 }
 
 template <typename T>
-void NEMinMaxKernel::update_min_max(const T min, const T max)
+void NEMinMaxKernel::update_min_max(const ThreadInfo &info, const T min, const T max)
 {
-    std::lock_guard<arm_compute::Mutex> lock(_mtx);
-
-    using type = typename std::conditional<std::is_same<T, float>::value, float, int32_t>::type;
+    MinMax &local = _local_min_max[info.thread_id];
 
-    auto min_ptr = static_cast<type *>(_min);
-    auto max_ptr = static_cast<type *>(_max);
-
-    if(min < *min_ptr)
-    {
-        *min_ptr = min;
-    }
+    local.min = std::min(local.min, static_cast<float>(min));
+    local.max = std::max(local.max, static_cast<float>(max));
+}
 
-    if(max > *max_ptr)
-    {
-        *max_ptr = max;
-    }
+template <typename T>
+void NEMinMaxKernel::write_min_max(float min, float max)
+{
+    *static_cast<T *>(_min) = static_cast<T>(min);
+    *static_cast<T *>(_max) = static_cast<T>(max);
 }
 
-void NEMinMaxKernel::minmax_U8(Window win)
+void NEMinMaxKernel::minmax_U8(Window win, const ThreadInfo &info)
 {
     uint8x8_t carry_min = vdup_n_u8(UCHAR_MAX);
     uint8x8_t carry_max = vdup_n_u8(0);
@@ -188,11 +193,11 @@ void NEMinMaxKernel::minmax_U8(Window win)
     const uint8_t min_i = std::min(vget_lane_u8(carry_min, 0), carry_min_scalar);
     const uint8_t max_i = std::max(vget_lane_u8(carry_max, 0), carry_max_scalar);
 
-    // Perform reduction of local min/max values
-    update_min_max(min_i, max_i);
+    // Accumulate the min/max values of the window in the slot of the thread
+    update_min_max(info, min_i, max_i);
 }
 
-void NEMinMaxKernel::minmax_S16(Window win)
+void NEMinMaxKernel::minmax_S16(Window win, const ThreadInfo &info)
 {
     int16x4_t carry_min = vdup_n_s16(SHRT_MAX);
     int16x4_t carry_max = vdup_n_s16(SHRT_MIN);
@@ -247,11 +252,11 @@ void NEMinMaxKernel::minmax_S16(Window win)
     const int16_t min_i = std::min(vget_lane_s16(carry_min, 0), carry_min_scalar);
     const int16_t max_i = std::max(vget_lane_s16(carry_max, 0), carry_max_scalar);
 
-    // Perform reduction of local min/max values
-    update_min_max(min_i, max_i);
+    // Accumulate the min/max values of the window in the slot of the thread
+    update_min_max(info, min_i, max_i);
 }
 
-void NEMinMaxKernel::minmax_F32(Window win)
+void NEMinMaxKernel::minmax_F32(Window win, const ThreadInfo &info)
 {
     float32x2_t carry_min = vdup_n_f32(std::numeric_limits<float>::max());
     float32x2_t carry_max = vdup_n_f32(std::numeric_limits<float>::lowest());
@@ -306,18 +311,14 @@ void NEMinMaxKernel::minmax_F32(Window win)
     const float min_i = std::min(vget_lane_f32(carry_min, 0), carry_min_scalar);
     const float max_i = std::max(vget_lane_f32(carry_max, 0), carry_max_scalar);
 
-    // Perform reduction of local min/max values
-    update_min_max(min_i, max_i);
+    // Accumulate the min/max values of the window in the slot of the thread
+    update_min_max(info, min_i, max_i);
 }
 
 NEMinMaxLocationKernel::NEMinMaxLocationKernel()
-    : _func(nullptr), _input(nullptr), _min(nullptr), _max(nullptr), _min_count(nullptr), _max_count(nullptr), _min_loc(nullptr), _max_loc(nullptr)
-{
-}
-
-bool NEMinMaxLocationKernel::is_parallelisable() const
+    : _func(nullptr), _input(nullptr), _min(nullptr), _max(nullptr), _min_count(nullptr), _max_count(nullptr), _min_loc(nullptr), _max_loc(nullptr), _local_count(), _local_min_loc(),
+      _local_max_loc()
 {
-    return false;
 }
 
 template <class T, std::size_t... N>
@@ -382,38 +383,91 @@ void NEMinMaxLocationKernel::configure(const IImage *input, void *min, void *max
     INEKernel::configure(win);
 }
 
+void NEMinMaxLocationKernel::reset(unsigned int num_threads)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+
+    _local_count.reset(num_threads, Counts{ 0, 0 });
+    _local_min_loc.reset(num_threads);
+    _local_max_loc.reset(num_threads);
+}
+
+void NEMinMaxLocationKernel::merge()
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+
+    if(nullptr != _min_loc)
+    {
+        _min_loc->clear();
+    }
+
+    if(nullptr != _max_loc)
+    {
+        _max_loc->clear();
+    }
+
+    const Counts counts = _local_count.merge(Counts{ 0, 0 }, [](Counts & result, const Counts & local)
+    {
+        result.min_count += local.min_count;
+        result.max_count += local.max_count;
+    });
+    const uint32_t min_count = counts.min_count;
+    const uint32_t max_count = counts.max_count;
+
+    // Merge the locations in the raster order of the windows so that the output does not depend on how the windows were distributed
+    if(nullptr != _min_loc)
+    {
+        _local_min_loc.merge([&](const Coordinates2D & p)
+        {
+            _min_loc->push_back(p);
+            return true;
+        });
+    }
+
+    if(nullptr != _max_loc)
+    {
+        _local_max_loc.merge([&](const Coordinates2D & p)
+        {
+            _max_loc->push_back(p);
+            return true;
+        });
+    }
+
+    if(nullptr != _min_count)
+    {
+        *_min_count = min_count;
+    }
+
+    if(nullptr != _max_count)
+    {
+        *_max_count = max_count;
+    }
+}
+
 void NEMinMaxLocationKernel::run(const Window &window, const ThreadInfo &info)
 {
-    ARM_COMPUTE_UNUSED(info);
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
     ARM_COMPUTE_ERROR_ON(_func == nullptr);
 
-    (this->*_func)(window);
+    (this->*_func)(window, info);
 }
 
 template <class T, bool count_min, bool count_max, bool loc_min, bool loc_max>
-void NEMinMaxLocationKernel::minmax_loc(const Window &win)
+void NEMinMaxLocationKernel::minmax_loc(const Window &win, const ThreadInfo &info)
 {
     if(count_min || count_max || loc_min || loc_max)
     {
         Iterator input(_input, win);
 
+        // Counts and locations are accumulated in the slots of the thread and merged into the outputs by merge()
+        Counts                     &local   = _local_count[info.thread_id];
+        std::vector<Coordinates2D> *min_loc = loc_min ? &_local_min_loc.begin_window(info.thread_id, win) : nullptr;
+        std::vector<Coordinates2D> *max_loc = loc_max ? &_local_max_loc.begin_window(info.thread_id, win) : nullptr;
+
         size_t min_count = 0;
         size_t max_count = 0;
 
-        // Clear min location array
-        if(loc_min)
-        {
-            _min_loc->clear();
-        }
-
-        // Clear max location array
-        if(loc_max)
-        {
-            _max_loc->clear();
-        }
-
         using type = typename std::conditional<std::is_same<T, float>::value, float, int32_t>::type;
 
         auto min_ptr = static_cast<type *>(_min);
@@ -439,7 +493,7 @@ void NEMinMaxLocationKernel::minmax_loc(const Window &win)
 
                     if(loc_min)
                     {
-                        _min_loc->push_back(p);
+                        min_loc->push_back(p);
                     }
                 }
             }
@@ -455,22 +509,15 @@ void NEMinMaxLocationKernel::minmax_loc(const Window &win)
 
                     if(loc_max)
                     {
-                        _max_loc->push_back(p);
+                        max_loc->push_back(p);
                     }
                 }
             }
         },
         input);
 
-        if(count_min)
-        {
-            *_min_count = min_count;
-        }
-
-        if(count_max)
-        {
-            *_max_count = max_count;
-        }
+        local.min_count += min_count;
+        local.max_count += max_count;
     }
 }
 } // namespace arm_compute
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NERNNCellKernel.h"
+
+#include "arm_compute/core/CPP/Validate.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEMath.h"
+#include "arm_compute/core/NEON/kernels/detail/NERecurrentCellDetail.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+#include <cmath>
+
+using namespace arm_compute;
+
+namespace
+{
+Status validate_arguments(const ITensorInfo *input_projection, const ITensorInfo *recurrent_projection, const ITensorInfo *bias, const ITensorInfo *hidden_state, const ITensorInfo *output,
+                          const ActivationLayerInfo &activation_info)
+{
+    ARM_COMPUTE_UNUSED(activation_info);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input_projection, recurrent_projection, bias, hidden_state);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input_projection);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input_projection, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input_projection, recurrent_projection, bias, hidden_state);
+
+    const unsigned int num_units   = hidden_state->dimension(0);
+    const unsigned int num_batches = hidden_state->dimension(1);
+
+    ARM_COMPUTE_RETURN_ERROR_ON(hidden_state->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(input_projection->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(input_projection->dimension(0) != num_units);
+    ARM_COMPUTE_RETURN_ERROR_ON(input_projection->dimension(1) != num_batches);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(recurrent_projection, hidden_state);
+    ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != num_units);
+
+    // Sequence output
+    if(output != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input_projection, output);
+        ARM_COMPUTE_RETURN_ERROR_ON(output->num_dimensions() > 3);
+        ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(0) != num_units);
+        ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(1) != num_batches);
+        ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(2) != input_projection->dimension(2));
+    }
+
+    return Status{};
+}
+} // namespace
+
+NERNNCellKernel::NERNNCellKernel()
+    : _func(nullptr), _input_projection(nullptr), _recurrent_projection(nullptr), _bias(nullptr), _hidden_state(nullptr), _output(nullptr), _activation_info(), _timestep(0)
+{
+}
+
+template <typename T>
+void NERNNCellKernel::run_rnn_cell(const Window &window)
+{
+    const T *bias = detail::row_ptr<T>(_bias, 0);
+
+    const int window_start_x = window.x().start();
+    const int window_end_x   = window.x().end();
+
+    for(int y = window.y().start(); y < window.y().end(); ++y)
+    {
+        const T *input_projection     = detail::row_ptr<T>(_input_projection, y, _timestep);
+        const T *recurrent_projection = detail::row_ptr<T>(_recurrent_projection, y);
+        T       *hidden_state         = detail::row_ptr<T>(_hidden_state, y);
+        T       *output               = detail::row_ptr<T>(_output, y, _timestep);
+
+        int x = window_start_x;
+        for(; x <= (window_end_x - 4); x += 4)
+        {
+            const float32x4_t sum    = vaddq_f32(vaddq_f32(detail::vload(input_projection + x), detail::vload(recurrent_projection + x)), detail::vload(bias + x));
+            const float32x4_t result = detail::vactivation(sum, _activation_info);
+
+            detail::vstore(hidden_state + x, result);
+            if(output != nullptr)
+            {
+                detail::vstore(output + x, result);
+            }
+        }
+
+        // Compute left-over elements
+        for(; x < window_end_x; ++x)
+        {
+            const float sum    = static_cast<float>(input_projection[x]) + static_cast<float>(recurrent_projection[x]) + static_cast<float>(bias[x]);
+            const float result = detail::activation(sum, _activation_info);
+
+            hidden_state[x] = static_cast<T>(result);
+            if(output != nullptr)
+            {
+                output[x] = static_cast<T>(result);
+            }
+        }
+    }
+}
+
+void NERNNCellKernel::configure(const ITensor *input_projection, const ITensor *recurrent_projection, const ITensor *bias, ITensor *hidden_state, ITensor *output,
+                                const ActivationLayerInfo &activation_info)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input_projection, recurrent_projection, bias, hidden_state);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input_projection->info(), recurrent_projection->info(), bias->info(), hidden_state->info(),
+                                                  (output != nullptr) ? output->info() : nullptr, activation_info));
+
+    _input_projection     = input_projection;
+    _recurrent_projection = recurrent_projection;
+    _bias                 = bias;
+    _hidden_state         = hidden_state;
+    _output               = output;
+    _activation_info      = activation_info;
+    _timestep             = 0;
+
+    switch(input_projection->info()->data_type())
+    {
+        case DataType::F32:
+            _func = &NERNNCellKernel::run_rnn_cell<float>;
+            break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            _func = &NERNNCellKernel::run_rnn_cell<float16_t>;
+            break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported");
+    }
+
+    // The window spans the units along X, one element per step, so that the scheduler can split it even for a single batch.
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, hidden_state->info()->dimension(0), 1));
+    win.set(Window::DimY, Window::Dimension(0, hidden_state->info()->dimension(1), 1));
+
+    // The kernel writes every element of its outputs
+    hidden_state->info()->set_valid_region(ValidRegion(Coordinates(), hidden_state->info()->tensor_shape()));
+    if(output != nullptr)
+    {
+        output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+    }
+
+    INEKernel::configure(win);
+}
+
+Status NERNNCellKernel::validate(const ITensorInfo *input_projection, const ITensorInfo *recurrent_projection, const ITensorInfo *bias, const ITensorInfo *hidden_state, const ITensorInfo *output,
+                                 const ActivationLayerInfo &activation_info)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input_projection, recurrent_projection, bias, hidden_state, output, activation_info));
+    return Status{};
+}
+
+void NERNNCellKernel::set_timestep(unsigned int timestep)
+{
+    ARM_COMPUTE_ERROR_ON(timestep >= _input_projection->info()->dimension(2));
+    _timestep = timestep;
+}
+
+void NERNNCellKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
@@ -24,6 +24,7 @@
 #include "arm_compute/core/NEON/kernels/NEScaleKernel.h"
 
 #include "arm_compute/core/AccessWindowStatic.h"
+#include "arm_compute/core/CPP/Validate.h"
 #include "arm_compute/core/Coordinates.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
@@ -34,6 +35,7 @@
 #include "arm_compute/core/Window.h"
 #include "arm_compute/core/utils/misc/Utility.h"
 
+#include <algorithm>
 #include <arm_neon.h>
 #include <cstddef>
 #include <cstdint>
@@ -46,20 +48,24 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *dx, const
                           const ITensorInfo *offsets, ITensorInfo *output, InterpolationPolicy policy,
                           BorderMode border_mode, SamplingPolicy sampling_policy)
 {
-    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::S16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::S16, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(output);
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
     ARM_COMPUTE_RETURN_ERROR_ON(output == input);
     ARM_COMPUTE_RETURN_ERROR_ON(sampling_policy != SamplingPolicy::CENTER);
     ARM_COMPUTE_UNUSED(border_mode);
 
-    const DataLayout data_layout = input->data_layout();
-    ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH)) == 0);
-    ARM_COMPUTE_RETURN_ERROR_ON(output->dimension(get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT)) == 0);
+    const DataLayout data_layout   = input->data_layout();
+    const size_t     output_width  = output->dimension(get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH));
+    const size_t     output_height = output->dimension(get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT));
+    ARM_COMPUTE_RETURN_ERROR_ON(output_width == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(output_height == 0);
 
     if(policy == InterpolationPolicy::NEAREST_NEIGHBOR)
     {
         ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(offsets, 1, DataType::S32);
+        ARM_COMPUTE_RETURN_ERROR_ON(offsets->num_dimensions() > 1 || offsets->dimension(0) != output_width);
     }
 
     if(policy == InterpolationPolicy::BILINEAR)
@@ -67,6 +73,9 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *dx, const
         ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(offsets, 1, DataType::S32);
         ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dx, 1, DataType::F32);
         ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dy, 1, DataType::F32);
+        ARM_COMPUTE_RETURN_ERROR_ON(offsets->num_dimensions() > 1 || offsets->dimension(0) != output_width);
+        ARM_COMPUTE_RETURN_ERROR_ON(dx->num_dimensions() > 1 || dx->dimension(0) != output_width);
+        ARM_COMPUTE_RETURN_ERROR_ON(dy->num_dimensions() > 1 || dy->dimension(0) != output_height);
     }
 
     if(policy == InterpolationPolicy::AREA)
@@ -90,16 +99,17 @@ std::pair<Status, Window> validate_and_configure_window_nchw(ITensorInfo *input,
 
     const ValidRegion &input_valid_region = input->valid_region();
 
+    // The column tables are read in blocks of num_elems_processed_per_iteration entries, the row table one entry at a time
+    const int table_end = ceil_to_multiple(output->dimension(0), num_elems_processed_per_iteration);
     if(offsets != nullptr)
     {
-        AccessWindowHorizontal offsets_access(offsets, 0, num_elems_processed_per_iteration);
+        AccessWindowStatic offsets_access(offsets, 0, 0, table_end, 1);
         window_changed = window_changed || update_window_and_padding(win, offsets_access);
     }
     if(dx != nullptr && dy != nullptr)
     {
-        AccessWindowHorizontal dx_access(dx, 0, num_elems_processed_per_iteration);
-        AccessWindowHorizontal dy_access(dy, 0, num_elems_processed_per_iteration);
-        window_changed = window_changed || update_window_and_padding(win, dx_access, dy_access);
+        AccessWindowStatic dx_access(dx, 0, 0, table_end, 1);
+        window_changed = window_changed || update_window_and_padding(win, dx_access);
     }
 
     // Reads can occur within the valid region of the input
@@ -123,7 +133,8 @@ std::pair<Status, Window> validate_and_configure_window_nhwc(ITensorInfo *input,
     bool   window_changed{ false };
     Window win{};
 
-    const unsigned int num_elems_processed_per_iteration = (policy == InterpolationPolicy::NEAREST_NEIGHBOR) ? 16 / input->element_size() : 1;
+    // Both interpolations process a full vector of channels per iteration
+    const unsigned int num_elems_processed_per_iteration = 16 / input->element_size();
 
     // Configure kernel window
     win = calculate_max_window(*output, Steps(num_elems_processed_per_iteration));
@@ -160,6 +171,176 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITen
     return win_config;
 }
 
+/** Load 16 bytes of elements and convert them to F32
+ *
+ * @param[in]  ptr Pointer to the elements to load.
+ * @param[out] out F32 vectors holding the loaded elements, four elements per vector.
+ */
+inline void load_as_f32(const uint8_t *ptr, float32x4_t *out)
+{
+    const uint8x16_t data    = vld1q_u8(ptr);
+    const uint16x8_t data_lo = vmovl_u8(vget_low_u8(data));
+    const uint16x8_t data_hi = vmovl_u8(vget_high_u8(data));
+
+    out[0] = vcvtq_f32_u32(vmovl_u16(vget_low_u16(data_lo)));
+    out[1] = vcvtq_f32_u32(vmovl_u16(vget_high_u16(data_lo)));
+    out[2] = vcvtq_f32_u32(vmovl_u16(vget_low_u16(data_hi)));
+    out[3] = vcvtq_f32_u32(vmovl_u16(vget_high_u16(data_hi)));
+}
+
+inline void load_as_f32(const int16_t *ptr, float32x4_t *out)
+{
+    const int16x8_t data = vld1q_s16(ptr);
+
+    out[0] = vcvtq_f32_s32(vmovl_s16(vget_low_s16(data)));
+    out[1] = vcvtq_f32_s32(vmovl_s16(vget_high_s16(data)));
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+inline void load_as_f32(const float16_t *ptr, float32x4_t *out)
+{
+    const float16x8_t data = vld1q_f16(ptr);
+
+    out[0] = vcvt_f32_f16(vget_low_f16(data));
+    out[1] = vcvt_f32_f16(vget_high_f16(data));
+}
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+inline void load_as_f32(const float *ptr, float32x4_t *out)
+{
+    out[0] = vld1q_f32(ptr);
+}
+
+/** Convert F32 values to the output data type and store 16 bytes of elements
+ *
+ * @note Conversions to integer types truncate towards zero as the scalar casts do.
+ *
+ * @param[in]  in  F32 vectors to store, four elements per vector.
+ * @param[out] ptr Pointer to the destination elements.
+ */
+inline void store_from_f32(const float32x4_t *in, uint8_t *ptr)
+{
+    const uint16x8_t data_lo = vcombine_u16(vmovn_u32(vcvtq_u32_f32(in[0])), vmovn_u32(vcvtq_u32_f32(in[1])));
+    const uint16x8_t data_hi = vcombine_u16(vmovn_u32(vcvtq_u32_f32(in[2])), vmovn_u32(vcvtq_u32_f32(in[3])));
+
+    vst1q_u8(ptr, vcombine_u8(vmovn_u16(data_lo), vmovn_u16(data_hi)));
+}
+
+inline void store_from_f32(const float32x4_t *in, int16_t *ptr)
+{
+    vst1q_s16(ptr, vcombine_s16(vmovn_s32(vcvtq_s32_f32(in[0])), vmovn_s32(vcvtq_s32_f32(in[1]))));
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+inline void store_from_f32(const float32x4_t *in, float16_t *ptr)
+{
+    vst1q_f16(ptr, vcombine_f16(vcvt_f16_f32(in[0]), vcvt_f16_f32(in[1])));
+}
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
+inline void store_from_f32(const float32x4_t *in, float *ptr)
+{
+    vst1q_f32(ptr, in[0]);
+}
+
+/** Bilinear interpolation of four neighbours, with the same weights and order of operations as @ref delta_bilinear_c1
+ *
+ * @param[in] a00 Top-left neighbours.
+ * @param[in] a01 Top-right neighbours.
+ * @param[in] a10 Bottom-left neighbours.
+ * @param[in] a11 Bottom-right neighbours.
+ * @param[in] dx  Distances between the X real coordinates and the smallest X following integers.
+ * @param[in] dy  Distances between the Y real coordinates and the smallest Y following integers.
+ *
+ * @return The interpolated values
+ */
+inline float32x4_t delta_bilinear(float32x4_t a00, float32x4_t a01, float32x4_t a10, float32x4_t a11, float32x4_t dx, float32x4_t dy)
+{
+    const float32x4_t dx1 = vsubq_f32(vdupq_n_f32(1.f), dx);
+    const float32x4_t dy1 = vsubq_f32(vdupq_n_f32(1.f), dy);
+
+    const float32x4_t w1 = vmulq_f32(dx1, dy1);
+    const float32x4_t w2 = vmulq_f32(dx, dy1);
+    const float32x4_t w3 = vmulq_f32(dx1, dy);
+    const float32x4_t w4 = vmulq_f32(dx, dy);
+
+    float32x4_t res = vmulq_f32(a00, w1);
+    res             = vmlaq_f32(res, a01, w2);
+    res             = vmlaq_f32(res, a10, w3);
+    res             = vmlaq_f32(res, a11, w4);
+    return res;
+}
+
+template <typename T>
+inline void scale_bilinear_nchw_core(const ITensor *input, const ITensor *offsets, const ITensor *dx, const ITensor *dy, ITensor *output,
+                                     float hr, const Window &window, const Window &win_in)
+{
+    // 16 output elements are computed per iteration, loaded and stored in vectors of 16 bytes
+    constexpr int num_elems_processed_per_iteration = 16;
+    constexpr int num_elems_per_vector              = 16 / sizeof(T);
+
+    Iterator in(input, win_in);
+    Iterator out(output, window);
+
+    const int    in_stride_in_bytes = input->info()->strides_in_bytes()[1];
+    const size_t in_stride          = in_stride_in_bytes / sizeof(T);
+
+    const auto offsets_base = reinterpret_cast<const int32_t *>(offsets->buffer() + offsets->info()->offset_first_element_in_bytes());
+    const auto dx_base      = reinterpret_cast<const float *>(dx->buffer() + dx->info()->offset_first_element_in_bytes());
+    const auto dy_base      = reinterpret_cast<const float *>(dy->buffer() + dy->info()->offset_first_element_in_bytes());
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int32_t *offsets_ptr = offsets_base + id.x();
+        const float   *dx_ptr      = dx_base + id.x();
+
+        const int      in_yi      = std::floor((id.y() + 0.5f) * hr - 0.5f);
+        const uint8_t *in_row_ptr = in.ptr() + in_yi * in_stride_in_bytes;
+
+        // Gather the four neighbours of each output element
+        T a00[num_elems_processed_per_iteration];
+        T a01[num_elems_processed_per_iteration];
+        T a10[num_elems_processed_per_iteration];
+        T a11[num_elems_processed_per_iteration];
+        for(int i = 0; i < num_elems_processed_per_iteration; ++i)
+        {
+            const T *pixel_ptr = reinterpret_cast<const T *>(in_row_ptr + offsets_ptr[i]);
+            a00[i]             = pixel_ptr[0];
+            a01[i]             = pixel_ptr[1];
+            a10[i]             = pixel_ptr[in_stride];
+            a11[i]             = pixel_ptr[in_stride + 1];
+        }
+
+        float32x4_t a00_f32[4];
+        float32x4_t a01_f32[4];
+        float32x4_t a10_f32[4];
+        float32x4_t a11_f32[4];
+        for(int i = 0; i < num_elems_processed_per_iteration; i += num_elems_per_vector)
+        {
+            const int v = i / 4;
+            load_as_f32(a00 + i, a00_f32 + v);
+            load_as_f32(a01 + i, a01_f32 + v);
+            load_as_f32(a10 + i, a10_f32 + v);
+            load_as_f32(a11 + i, a11_f32 + v);
+        }
+
+        // Interpolate with the per column horizontal weights and the per row vertical weight
+        const float32x4_t dy_f32 = vdupq_n_f32(dy_base[id.y()]);
+        float32x4_t       res[4];
+        for(int v = 0; v < 4; ++v)
+        {
+            res[v] = delta_bilinear(a00_f32[v], a01_f32[v], a10_f32[v], a11_f32[v], vld1q_f32(dx_ptr + 4 * v), dy_f32);
+        }
+
+        const auto out_ptr = reinterpret_cast<T *>(out.ptr());
+        for(int i = 0; i < num_elems_processed_per_iteration; i += num_elems_per_vector)
+        {
+            store_from_f32(res + i / 4, out_ptr + i);
+        }
+    },
+    in, out);
+}
+
 template <typename T>
 inline void scale_nearest_nhwc_core(const ITensor *input, const ITensor *offsets, ITensor *output,
                                     float hr, Window window, const Window &win_in, size_t stride_w, size_t stride_h, size_t stride_c)
@@ -168,10 +349,11 @@ inline void scale_nearest_nhwc_core(const ITensor *input, const ITensor *offsets
     Iterator out(output, window);
 
     const size_t offsets_stride = stride_w / sizeof(T);
+    const auto   offsets_base   = reinterpret_cast<const int32_t *>(offsets->buffer() + offsets->info()->offset_first_element_in_bytes());
 
     execute_window_loop(window, [&](const Coordinates & id)
     {
-        const auto offset     = *reinterpret_cast<const int32_t *>(offsets->ptr_to_element(Coordinates(id.y(), id.z())));
+        const auto offset     = offsets_base[id.y()];
         const int  in_yi      = (id.z() + 0.5f) * hr;
         const int  offset_row = in_yi * stride_h + id.x() * stride_c;
         wrapper::vstore(reinterpret_cast<T *>(out.ptr()),
@@ -184,17 +366,26 @@ template <typename T>
 inline void scale_bilinear_nhwc_core(const ITensor *input, const ITensor *offsets, const ITensor *dx, const ITensor *dy, ITensor *output,
                                      float hr, Window window, const Window &win_in, size_t stride_w, size_t stride_h, size_t stride_c, BorderMode border_mode)
 {
+    // A vector of channels is interpolated per iteration with the weights of its spatial position
+    constexpr int num_elems_processed_per_iteration = 16 / sizeof(T);
+    constexpr int num_f32_per_vector                = num_elems_processed_per_iteration / 4;
+
     Iterator in(input, win_in);
     Iterator out(output, window);
 
-    const size_t stride_w_elems = stride_w / sizeof(T);
-    const size_t stride_h_elems = stride_h / sizeof(T);
-
     const int input_width  = input->info()->dimension(1);
     const int input_height = input->info()->dimension(2);
 
+    const auto offsets_base = reinterpret_cast<const int32_t *>(offsets->buffer() + offsets->info()->offset_first_element_in_bytes());
+    const auto dx_base      = reinterpret_cast<const float *>(dx->buffer() + dx->info()->offset_first_element_in_bytes());
+    const auto dy_base      = reinterpret_cast<const float *>(dy->buffer() + dy->info()->offset_first_element_in_bytes());
+
     const T *border_area = reinterpret_cast<T *>(input->buffer() + input->info()->offset_first_element_in_bytes() - stride_w);
 
+    // Neighbours outside of the input are read from a vector of constant border values, or of zeros if the border is undefined
+    T outside_values[num_elems_processed_per_iteration];
+    std::fill_n(outside_values, num_elems_processed_per_iteration, (border_mode == BorderMode::CONSTANT) ? *border_area : static_cast<T>(0));
+
     auto is_valid = [](int x, int low_x, int high_x, int y, int low_y, int high_y)
     {
         return !(x < low_x || x > high_x || y < low_y || y > high_y);
@@ -204,67 +395,83 @@ inline void scale_bilinear_nhwc_core(const ITensor *input, const ITensor *offset
 
     execute_window_loop(window, [&](const Coordinates & id)
     {
-        const auto offset     = (*reinterpret_cast<const int32_t *>(offsets->ptr_to_element(Coordinates(id.y(), id.z())))) / static_cast<int>(sizeof(T));
-        const auto dx_scale   = *reinterpret_cast<const float *>(dx->ptr_to_element(Coordinates(id.y(), id.z())));
-        const auto dy_scale   = *reinterpret_cast<const float *>(dy->ptr_to_element(Coordinates(id.y(), id.z())));
-        const int  in_yi      = std::floor((id.z() + 0.5f) * hr - 0.5f);
-        const int  offset_row = in_yi * stride_h + id.x() * stride_c;
-        const T   *in_ptr     = reinterpret_cast<T *>(in.ptr() + offset * stride_w + offset_row);
+        const auto offset = offsets_base[id.y()] / static_cast<int>(sizeof(T));
+        const int  in_yi  = std::floor((id.z() + 0.5f) * hr - 0.5f);
 
         if(is_valid(offset, -border_size, input_width - 1 + border_size, in_yi, -border_size, input_height - 1 + border_size))
         {
-            T a00 = 0, a01 = 0, a10 = 0, a11 = 0;
+            const T *a00_ptr = outside_values;
+            const T *a01_ptr = outside_values;
+            const T *a10_ptr = outside_values;
+            const T *a11_ptr = outside_values;
 
-            if(border_mode == BorderMode::CONSTANT)
-            {
-                a00 = is_valid(offset, 0, input_width - 1, in_yi, 0, input_height - 1) ? *in_ptr : *border_area;
-                a01 = is_valid(offset + 1, 0, input_width - 1, in_yi, 0, input_height - 1) ? *(in_ptr + stride_w_elems) : *border_area;
-                a10 = is_valid(offset, 0, input_width - 1, in_yi + 1, 0, input_height - 1) ? *(in_ptr + stride_h_elems) : *border_area;
-                a11 = is_valid(offset + 1, 0, input_width - 1, in_yi + 1, 0, input_height - 1) ? *(in_ptr + stride_h_elems + stride_w_elems) : *border_area;
-            }
-            else if(border_mode == BorderMode::REPLICATE)
+            if(border_mode == BorderMode::REPLICATE)
             {
-                auto clamped_x  = utility::clamp<int>(offset, 0, input_width - 1);
-                auto clamped_x1 = utility::clamp<int>(offset + 1, 0, input_width - 1);
-                auto clamped_y  = utility::clamp<int>(in_yi, 0, input_height - 1);
-                auto clamped_y1 = utility::clamp<int>(in_yi + 1, 0, input_height - 1);
-
-                a00 = *reinterpret_cast<T *>(in.ptr() + clamped_x * stride_w + clamped_y * stride_h + id.x() * stride_c);
-                a01 = *reinterpret_cast<T *>(in.ptr() + clamped_x1 * stride_w + clamped_y * stride_h + id.x() * stride_c);
-                a10 = *reinterpret_cast<T *>(in.ptr() + clamped_x * stride_w + clamped_y1 * stride_h + id.x() * stride_c);
-                a11 = *reinterpret_cast<T *>(in.ptr() + clamped_x1 * stride_w + clamped_y1 * stride_h + id.x() * stride_c);
+                const int clamped_x  = utility::clamp<int>(offset, 0, input_width - 1);
+                const int clamped_x1 = utility::clamp<int>(offset + 1, 0, input_width - 1);
+                const int clamped_y  = utility::clamp<int>(in_yi, 0, input_height - 1);
+                const int clamped_y1 = utility::clamp<int>(in_yi + 1, 0, input_height - 1);
+
+                a00_ptr = reinterpret_cast<const T *>(in.ptr() + clamped_x * stride_w + clamped_y * stride_h + id.x() * stride_c);
+                a01_ptr = reinterpret_cast<const T *>(in.ptr() + clamped_x1 * stride_w + clamped_y * stride_h + id.x() * stride_c);
+                a10_ptr = reinterpret_cast<const T *>(in.ptr() + clamped_x * stride_w + clamped_y1 * stride_h + id.x() * stride_c);
+                a11_ptr = reinterpret_cast<const T *>(in.ptr() + clamped_x1 * stride_w + clamped_y1 * stride_h + id.x() * stride_c);
             }
             else
             {
-                a00 = is_valid(offset, 0, input_width - 1, in_yi, 0, input_height - 1) ? *in_ptr : 0;
-                a01 = is_valid(offset + 1, 0, input_width - 1, in_yi, 0, input_height - 1) ? *(in_ptr + stride_w_elems) : 0;
-                a10 = is_valid(offset, 0, input_width - 1, in_yi + 1, 0, input_height - 1) ? *(in_ptr + stride_h_elems) : 0;
-                a11 = is_valid(offset + 1, 0, input_width - 1, in_yi + 1, 0, input_height - 1) ? *(in_ptr + stride_h_elems + stride_w_elems) : 0;
+                const uint8_t *in_ptr = in.ptr() + offset * static_cast<int>(stride_w) + in_yi * static_cast<int>(stride_h) + id.x() * stride_c;
+
+                if(is_valid(offset, 0, input_width - 1, in_yi, 0, input_height - 1))
+                {
+                    a00_ptr = reinterpret_cast<const T *>(in_ptr);
+                }
+                if(is_valid(offset + 1, 0, input_width - 1, in_yi, 0, input_height - 1))
+                {
+                    a01_ptr = reinterpret_cast<const T *>(in_ptr + stride_w);
+                }
+                if(is_valid(offset, 0, input_width - 1, in_yi + 1, 0, input_height - 1))
+                {
+                    a10_ptr = reinterpret_cast<const T *>(in_ptr + stride_h);
+                }
+                if(is_valid(offset + 1, 0, input_width - 1, in_yi + 1, 0, input_height - 1))
+                {
+                    a11_ptr = reinterpret_cast<const T *>(in_ptr + stride_h + stride_w);
+                }
             }
 
-            // Perform interpolation
-            const float dx1 = 1.0f - dx_scale;
-            const float dy1 = 1.0f - dy_scale;
+            float32x4_t a00[num_f32_per_vector];
+            float32x4_t a01[num_f32_per_vector];
+            float32x4_t a10[num_f32_per_vector];
+            float32x4_t a11[num_f32_per_vector];
+            load_as_f32(a00_ptr, a00);
+            load_as_f32(a01_ptr, a01);
+            load_as_f32(a10_ptr, a10);
+            load_as_f32(a11_ptr, a11);
 
-            const float w1 = dx1 * dy1;
-            const float w2 = dx_scale * dy1;
-            const float w3 = dx1 * dy_scale;
-            const float w4 = dx_scale * dy_scale;
+            // Perform interpolation
+            const float32x4_t dx_f32 = vdupq_n_f32(dx_base[id.y()]);
+            const float32x4_t dy_f32 = vdupq_n_f32(dy_base[id.z()]);
+            float32x4_t       res[num_f32_per_vector];
+            for(int v = 0; v < num_f32_per_vector; ++v)
+            {
+                res[v] = delta_bilinear(a00[v], a01[v], a10[v], a11[v], dx_f32, dy_f32);
+            }
 
             // Store result
-            *reinterpret_cast<T *>(out.ptr()) = static_cast<T>(a00 * w1 + a01 * w2 + a10 * w3 + a11 * w4);
+            store_from_f32(res, reinterpret_cast<T *>(out.ptr()));
         }
         else
         {
             if(border_mode == BorderMode::CONSTANT)
             {
-                *reinterpret_cast<T *>(out.ptr()) = *border_area;
+                wrapper::vstore(reinterpret_cast<T *>(out.ptr()), wrapper::vloadq(outside_values));
             }
             else if(border_mode == BorderMode::REPLICATE)
             {
-                auto clamped_x                    = utility::clamp<int>(offset, 0, input_width - 1);
-                auto clamped_y                    = utility::clamp<int>(in_yi, 0, input_height - 1);
-                *reinterpret_cast<T *>(out.ptr()) = *reinterpret_cast<T *>(in.ptr() + clamped_x * stride_w + clamped_y * stride_h + id.x() * stride_c);
+                const int clamped_x = utility::clamp<int>(offset, 0, input_width - 1);
+                const int clamped_y = utility::clamp<int>(in_yi, 0, input_height - 1);
+                wrapper::vstore(reinterpret_cast<T *>(out.ptr()),
+                                wrapper::vloadq(reinterpret_cast<const T *>(in.ptr() + clamped_x * stride_w + clamped_y * stride_h + id.x() * stride_c)));
             }
         }
     },
@@ -371,14 +578,10 @@ void NEScaleKernel::scale_nearest_nchw(const Window &window)
     win_in.set(Window::DimX, Window::Dimension(0, 0, 0));
     win_in.set(Window::DimY, Window::Dimension(0, 0, 0));
 
-    // Set offsets window
+    // Set offsets window: the offsets only depend on the output column
     Window win_off;
     win_off.set(Window::DimX, window[Window::DimX]);
-    win_off.set(Window::DimY, window[Window::DimY]);
-    for(size_t d = Window::DimZ; d < _offsets->info()->num_dimensions(); ++d)
-    {
-        win_off.set(d, Window::Dimension(0, 0, 0));
-    }
+    win_off.set(Window::DimY, Window::Dimension(0, 0, 0));
 
     // Create iterators
     Iterator in(_input, win_in);
@@ -463,6 +666,48 @@ void NEScaleKernel::scale_nearest_nchw(const Window &window)
             in, offsets, out);
             break;
         }
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+        {
+            float16x8x2_t tmp =
+            {
+                {
+                    vdupq_n_f16(0),
+                    vdupq_n_f16(0)
+                }
+            };
+
+            execute_window_loop(window, [&](const Coordinates & id)
+            {
+                const auto offsets_ptr = reinterpret_cast<const int32_t *>(offsets.ptr());
+
+                const int in_yi      = (id.y() + 0.5f) * hr;
+                const int offset_row = in_yi * input_stride;
+
+                tmp.val[0] = vsetq_lane_f16(*reinterpret_cast<const float16_t *>(in.ptr() + offsets_ptr[0] + offset_row), tmp.val[0], 0);
+                tmp.val[0] = vsetq_lane_f16(*reinterpret_cast<const float16_t *>(in.ptr() + offsets_ptr[2] + offset_row), tmp.val[0], 1);
+                tmp.val[0] = vsetq_lane_f16(*reinterpret_cast<const float16_t *>(in.ptr() + offsets_ptr[4] + offset_row), tmp.val[0], 2);
+                tmp.val[0] = vsetq_lane_f16(*reinterpret_cast<const float16_t *>(in.ptr() + offsets_ptr[6] + offset_row), tmp.val[0], 3);
+                tmp.val[0] = vsetq_lane_f16(*reinterpret_cast<const float16_t *>(in.ptr() + offsets_ptr[8] + offset_row), tmp.val[0], 4);
+                tmp.val[0] = vsetq_lane_f16(*reinterpret_cast<const float16_t *>(in.ptr() + offsets_ptr[10] + offset_row), tmp.val[0], 5);
+                tmp.val[0] = vsetq_lane_f16(*reinterpret_cast<const float16_t *>(in.ptr() + offsets_ptr[12] + offset_row), tmp.val[0], 6);
+                tmp.val[0] = vsetq_lane_f16(*reinterpret_cast<const float16_t *>(in.ptr() + offsets_ptr[14] + offset_row), tmp.val[0], 7);
+
+                tmp.val[1] = vsetq_lane_f16(*reinterpret_cast<const float16_t *>(in.ptr() + offsets_ptr[1] + offset_row), tmp.val[1], 0);
+                tmp.val[1] = vsetq_lane_f16(*reinterpret_cast<const float16_t *>(in.ptr() + offsets_ptr[3] + offset_row), tmp.val[1], 1);
+                tmp.val[1] = vsetq_lane_f16(*reinterpret_cast<const float16_t *>(in.ptr() + offsets_ptr[5] + offset_row), tmp.val[1], 2);
+                tmp.val[1] = vsetq_lane_f16(*reinterpret_cast<const float16_t *>(in.ptr() + offsets_ptr[7] + offset_row), tmp.val[1], 3);
+                tmp.val[1] = vsetq_lane_f16(*reinterpret_cast<const float16_t *>(in.ptr() + offsets_ptr[9] + offset_row), tmp.val[1], 4);
+                tmp.val[1] = vsetq_lane_f16(*reinterpret_cast<const float16_t *>(in.ptr() + offsets_ptr[11] + offset_row), tmp.val[1], 5);
+                tmp.val[1] = vsetq_lane_f16(*reinterpret_cast<const float16_t *>(in.ptr() + offsets_ptr[13] + offset_row), tmp.val[1], 6);
+                tmp.val[1] = vsetq_lane_f16(*reinterpret_cast<const float16_t *>(in.ptr() + offsets_ptr[15] + offset_row), tmp.val[1], 7);
+
+                vst2q_f16(reinterpret_cast<float16_t *>(out.ptr()), tmp);
+            },
+            in, offsets, out);
+            break;
+        }
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
         case DataType::F32:
         {
             float32x4x4_t tmp =
@@ -515,7 +760,7 @@ void NEScaleKernel::scale_nearest_nchw(const Window &window)
 
 void NEScaleKernel::scale_bilinear_nchw(const Window &window)
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(_input, 1, DataType::U8, DataType::S16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(_input, 1, DataType::U8, DataType::S16, DataType::F16, DataType::F32);
 
     // Compute the ratio between source height and destination height
     const auto hr = static_cast<float>(_input->info()->dimension(1)) / static_cast<float>(_output->info()->dimension(1));
@@ -526,152 +771,22 @@ void NEScaleKernel::scale_bilinear_nchw(const Window &window)
     win_in.set(Window::DimX, Window::Dimension(0, 0, 0));
     win_in.set(Window::DimY, Window::Dimension(0, 0, 0));
 
-    Window win_off;
-    win_off.set(Window::DimX, window.x());
-    win_off.set(Window::DimY, window.y());
-
-    for(size_t d = Window::DimZ; d < _offsets->info()->num_dimensions(); ++d)
-    {
-        win_off.set(d, Window::Dimension(0, 0, 0));
-    }
-
-    Iterator in(_input, win_in);
-    Iterator out(_output, window);
-    Iterator offsets(_offsets, win_off);
-    Iterator dx(_dx, win_off);
-    Iterator dy(_dy, win_off);
-
-    /* Input image stride */
-    const size_t in_stide_in_bytes = _input->info()->strides_in_bytes()[1];
-    const size_t in_stride         = in_stide_in_bytes / _input->info()->element_size();
-
     switch(_input->info()->data_type())
     {
         case DataType::U8:
-        {
-            execute_window_loop(window, [&](const Coordinates & id)
-            {
-                const auto offsets_ptr = reinterpret_cast<const int32_t *>(offsets.ptr());
-                const auto dx_ptr      = reinterpret_cast<const float *>(dx.ptr());
-                const auto dy_ptr      = reinterpret_cast<const float *>(dy.ptr());
-                const auto in_ptr      = reinterpret_cast<const uint8_t *>(in.ptr());
-
-                const int in_yi      = std::floor((id.y() + 0.5f) * hr - 0.5f);
-                const int offset_row = in_yi * in_stide_in_bytes;
-
-                uint8x8_t tmp0 = vdup_n_u8(0);
-                tmp0           = vset_lane_u8(delta_bilinear_c1(&in_ptr[offsets_ptr[0] + offset_row], in_stride, dx_ptr[0], dy_ptr[0]), tmp0, 0);
-                tmp0           = vset_lane_u8(delta_bilinear_c1(&in_ptr[offsets_ptr[1] + offset_row], in_stride, dx_ptr[1], dy_ptr[1]), tmp0, 1);
-                tmp0           = vset_lane_u8(delta_bilinear_c1(&in_ptr[offsets_ptr[2] + offset_row], in_stride, dx_ptr[2], dy_ptr[2]), tmp0, 2);
-                tmp0           = vset_lane_u8(delta_bilinear_c1(&in_ptr[offsets_ptr[3] + offset_row], in_stride, dx_ptr[3], dy_ptr[3]), tmp0, 3);
-                tmp0           = vset_lane_u8(delta_bilinear_c1(&in_ptr[offsets_ptr[4] + offset_row], in_stride, dx_ptr[4], dy_ptr[4]), tmp0, 4);
-                tmp0           = vset_lane_u8(delta_bilinear_c1(&in_ptr[offsets_ptr[5] + offset_row], in_stride, dx_ptr[5], dy_ptr[5]), tmp0, 5);
-                tmp0           = vset_lane_u8(delta_bilinear_c1(&in_ptr[offsets_ptr[6] + offset_row], in_stride, dx_ptr[6], dy_ptr[6]), tmp0, 6);
-                tmp0           = vset_lane_u8(delta_bilinear_c1(&in_ptr[offsets_ptr[7] + offset_row], in_stride, dx_ptr[7], dy_ptr[7]), tmp0, 7);
-
-                uint8x8_t tmp1 = vdup_n_u8(0);
-                tmp1           = vset_lane_u8(delta_bilinear_c1(&in_ptr[offsets_ptr[8] + offset_row], in_stride, dx_ptr[8], dy_ptr[8]), tmp1, 0);
-                tmp1           = vset_lane_u8(delta_bilinear_c1(&in_ptr[offsets_ptr[9] + offset_row], in_stride, dx_ptr[9], dy_ptr[9]), tmp1, 1);
-                tmp1           = vset_lane_u8(delta_bilinear_c1(&in_ptr[offsets_ptr[10] + offset_row], in_stride, dx_ptr[10], dy_ptr[10]), tmp1, 2);
-                tmp1           = vset_lane_u8(delta_bilinear_c1(&in_ptr[offsets_ptr[11] + offset_row], in_stride, dx_ptr[11], dy_ptr[11]), tmp1, 3);
-                tmp1           = vset_lane_u8(delta_bilinear_c1(&in_ptr[offsets_ptr[12] + offset_row], in_stride, dx_ptr[12], dy_ptr[12]), tmp1, 4);
-                tmp1           = vset_lane_u8(delta_bilinear_c1(&in_ptr[offsets_ptr[13] + offset_row], in_stride, dx_ptr[13], dy_ptr[13]), tmp1, 5);
-                tmp1           = vset_lane_u8(delta_bilinear_c1(&in_ptr[offsets_ptr[14] + offset_row], in_stride, dx_ptr[14], dy_ptr[14]), tmp1, 6);
-                tmp1           = vset_lane_u8(delta_bilinear_c1(&in_ptr[offsets_ptr[15] + offset_row], in_stride, dx_ptr[15], dy_ptr[15]), tmp1, 7);
-
-                vst1q_u8(out.ptr(), vcombine_u8(tmp0, tmp1));
-            },
-            in, offsets, dx, dy, out);
+            scale_bilinear_nchw_core<uint8_t>(_input, _offsets, _dx, _dy, _output, hr, window, win_in);
             break;
-        }
         case DataType::S16:
-        {
-            execute_window_loop(window, [&](const Coordinates & id)
-            {
-                const auto offsets_ptr = reinterpret_cast<const int32_t *>(offsets.ptr());
-                const auto dx_ptr      = reinterpret_cast<const float *>(dx.ptr());
-                const auto dy_ptr      = reinterpret_cast<const float *>(dy.ptr());
-
-                const int in_yi      = std::floor((id.y() + 0.5f) * hr - 0.5f);
-                const int offset_row = in_yi * in_stide_in_bytes;
-
-                int16x8x2_t tmp =
-                {
-                    {
-                        vdupq_n_s16(0),
-                        vdupq_n_s16(0)
-                    }
-                };
-
-                tmp.val[0] = vsetq_lane_s16(delta_bilinear_c1(reinterpret_cast<const int16_t *>(in.ptr() + offsets_ptr[0] + offset_row), in_stride, dx_ptr[0], dy_ptr[0]), tmp.val[0], 0);
-                tmp.val[0] = vsetq_lane_s16(delta_bilinear_c1(reinterpret_cast<const int16_t *>(in.ptr() + offsets_ptr[2] + offset_row), in_stride, dx_ptr[2], dy_ptr[2]), tmp.val[0], 1);
-                tmp.val[0] = vsetq_lane_s16(delta_bilinear_c1(reinterpret_cast<const int16_t *>(in.ptr() + offsets_ptr[4] + offset_row), in_stride, dx_ptr[4], dy_ptr[4]), tmp.val[0], 2);
-                tmp.val[0] = vsetq_lane_s16(delta_bilinear_c1(reinterpret_cast<const int16_t *>(in.ptr() + offsets_ptr[6] + offset_row), in_stride, dx_ptr[6], dy_ptr[6]), tmp.val[0], 3);
-                tmp.val[0] = vsetq_lane_s16(delta_bilinear_c1(reinterpret_cast<const int16_t *>(in.ptr() + offsets_ptr[8] + offset_row), in_stride, dx_ptr[8], dy_ptr[8]), tmp.val[0], 4);
-                tmp.val[0] = vsetq_lane_s16(delta_bilinear_c1(reinterpret_cast<const int16_t *>(in.ptr() + offsets_ptr[10] + offset_row), in_stride, dx_ptr[10], dy_ptr[10]), tmp.val[0], 5);
-                tmp.val[0] = vsetq_lane_s16(delta_bilinear_c1(reinterpret_cast<const int16_t *>(in.ptr() + offsets_ptr[12] + offset_row), in_stride, dx_ptr[12], dy_ptr[12]), tmp.val[0], 6);
-                tmp.val[0] = vsetq_lane_s16(delta_bilinear_c1(reinterpret_cast<const int16_t *>(in.ptr() + offsets_ptr[14] + offset_row), in_stride, dx_ptr[14], dy_ptr[14]), tmp.val[0], 7);
-
-                tmp.val[1] = vsetq_lane_s16(delta_bilinear_c1(reinterpret_cast<const int16_t *>(in.ptr() + offsets_ptr[1] + offset_row), in_stride, dx_ptr[1], dy_ptr[1]), tmp.val[1], 0);
-                tmp.val[1] = vsetq_lane_s16(delta_bilinear_c1(reinterpret_cast<const int16_t *>(in.ptr() + offsets_ptr[3] + offset_row), in_stride, dx_ptr[3], dy_ptr[3]), tmp.val[1], 1);
-                tmp.val[1] = vsetq_lane_s16(delta_bilinear_c1(reinterpret_cast<const int16_t *>(in.ptr() + offsets_ptr[5] + offset_row), in_stride, dx_ptr[5], dy_ptr[5]), tmp.val[1], 2);
-                tmp.val[1] = vsetq_lane_s16(delta_bilinear_c1(reinterpret_cast<const int16_t *>(in.ptr() + offsets_ptr[7] + offset_row), in_stride, dx_ptr[7], dy_ptr[7]), tmp.val[1], 3);
-                tmp.val[1] = vsetq_lane_s16(delta_bilinear_c1(reinterpret_cast<const int16_t *>(in.ptr() + offsets_ptr[9] + offset_row), in_stride, dx_ptr[9], dy_ptr[9]), tmp.val[1], 4);
-                tmp.val[1] = vsetq_lane_s16(delta_bilinear_c1(reinterpret_cast<const int16_t *>(in.ptr() + offsets_ptr[11] + offset_row), in_stride, dx_ptr[11], dy_ptr[11]), tmp.val[1], 5);
-                tmp.val[1] = vsetq_lane_s16(delta_bilinear_c1(reinterpret_cast<const int16_t *>(in.ptr() + offsets_ptr[13] + offset_row), in_stride, dx_ptr[13], dy_ptr[13]), tmp.val[1], 6);
-                tmp.val[1] = vsetq_lane_s16(delta_bilinear_c1(reinterpret_cast<const int16_t *>(in.ptr() + offsets_ptr[15] + offset_row), in_stride, dx_ptr[15], dy_ptr[15]), tmp.val[1], 7);
-
-                vst2q_s16(reinterpret_cast<int16_t *>(out.ptr()), tmp);
-            },
-            in, offsets, dx, dy, out);
+            scale_bilinear_nchw_core<int16_t>(_input, _offsets, _dx, _dy, _output, hr, window, win_in);
             break;
-        }
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            scale_bilinear_nchw_core<float16_t>(_input, _offsets, _dx, _dy, _output, hr, window, win_in);
+            break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
         case DataType::F32:
-        {
-            execute_window_loop(window, [&](const Coordinates & id)
-            {
-                const auto offsets_ptr = reinterpret_cast<const int32_t *>(offsets.ptr());
-                const auto dx_ptr      = reinterpret_cast<const float *>(dx.ptr());
-                const auto dy_ptr      = reinterpret_cast<const float *>(dy.ptr());
-
-                const int in_yi      = std::floor((id.y() + 0.5f) * hr - 0.5f);
-                const int offset_row = in_yi * in_stide_in_bytes;
-
-                float32x4x4_t tmp =
-                {
-                    {
-                        vdupq_n_f32(0),
-                        vdupq_n_f32(0),
-                        vdupq_n_f32(0),
-                        vdupq_n_f32(0)
-                    }
-                };
-
-                tmp.val[0] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[0] + offset_row), in_stride, dx_ptr[0], dy_ptr[0]), tmp.val[0], 0);
-                tmp.val[0] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[4] + offset_row), in_stride, dx_ptr[4], dy_ptr[4]), tmp.val[0], 1);
-                tmp.val[0] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[8] + offset_row), in_stride, dx_ptr[8], dy_ptr[8]), tmp.val[0], 2);
-                tmp.val[0] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[12] + offset_row), in_stride, dx_ptr[12], dy_ptr[12]), tmp.val[0], 3);
-
-                tmp.val[1] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[1] + offset_row), in_stride, dx_ptr[1], dy_ptr[1]), tmp.val[1], 0);
-                tmp.val[1] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[5] + offset_row), in_stride, dx_ptr[5], dy_ptr[5]), tmp.val[1], 1);
-                tmp.val[1] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[9] + offset_row), in_stride, dx_ptr[9], dy_ptr[9]), tmp.val[1], 2);
-                tmp.val[1] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[13] + offset_row), in_stride, dx_ptr[13], dy_ptr[13]), tmp.val[1], 3);
-
-                tmp.val[2] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[2] + offset_row), in_stride, dx_ptr[2], dy_ptr[2]), tmp.val[2], 0);
-                tmp.val[2] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[6] + offset_row), in_stride, dx_ptr[6], dy_ptr[6]), tmp.val[2], 1);
-                tmp.val[2] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[10] + offset_row), in_stride, dx_ptr[10], dy_ptr[10]), tmp.val[2], 2);
-                tmp.val[2] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[14] + offset_row), in_stride, dx_ptr[14], dy_ptr[14]), tmp.val[2], 3);
-
-                tmp.val[3] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[3] + offset_row), in_stride, dx_ptr[3], dy_ptr[3]), tmp.val[3], 0);
-                tmp.val[3] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[7] + offset_row), in_stride, dx_ptr[7], dy_ptr[7]), tmp.val[3], 1);
-                tmp.val[3] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[11] + offset_row), in_stride, dx_ptr[11], dy_ptr[11]), tmp.val[3], 2);
-                tmp.val[3] = vsetq_lane_f32(delta_bilinear_c1(reinterpret_cast<const float *>(in.ptr() + offsets_ptr[15] + offset_row), in_stride, dx_ptr[15], dy_ptr[15]), tmp.val[3], 3);
-
-                vst4q_f32(reinterpret_cast<float *>(out.ptr()), tmp);
-            },
-            in, offsets, dx, dy, out);
+            scale_bilinear_nchw_core<float>(_input, _offsets, _dx, _dy, _output, hr, window, win_in);
             break;
-        }
         default:
             ARM_COMPUTE_ERROR("Not supported");
             break;
@@ -777,6 +892,21 @@ void NEScaleKernel::scale_nhwc(const Window &window)
             }
             break;
         }
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+        {
+            if(_policy == InterpolationPolicy::NEAREST_NEIGHBOR)
+            {
+                scale_nearest_nhwc_core<float16_t>(_input, _offsets, _output, hr, window, win_in, input_stride_w, input_stride_h, input_stride_c);
+            }
+            else
+            {
+                scale_bilinear_nhwc_core<float16_t>(_input, _offsets, _dx, _dy, _output, hr,
+                                                    window, win_in, input_stride_w, input_stride_h, input_stride_c, _border_mode);
+            }
+            break;
+        }
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
         case DataType::F32:
         {
             if(_policy == InterpolationPolicy::NEAREST_NEIGHBOR)
@@ -35,19 +35,20 @@ using namespace arm_compute;
 namespace
 {
 template <typename T, bool is_nhwc>
-void weights_reshape(const ITensor *input, const ITensor *bias, ITensor *output, const Window &window)
+void weights_reshape(const ITensor *input, const ITensor *bias, ITensor *output, unsigned int num_groups, const Window &window)
 {
-    DataLayout         data_layout     = input->info()->data_layout();
-    const int          idx_width       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
-    const int          idx_height      = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
-    const int          idx_channel     = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
-    const unsigned int kernel_size_x   = input->info()->dimension(idx_width);
-    const unsigned int kernel_size_y   = input->info()->dimension(idx_height);
-    const unsigned int kernel_depth    = input->info()->dimension(idx_channel);
-    const unsigned int input_stride_x  = input->info()->strides_in_bytes().x();
-    const unsigned int input_stride_y  = input->info()->strides_in_bytes().y();
-    const unsigned int input_stride_z  = input->info()->strides_in_bytes().z();
-    const unsigned int output_stride_y = output->info()->strides_in_bytes().y();
+    DataLayout         data_layout       = input->info()->data_layout();
+    const int          idx_width         = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const int          idx_height        = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const int          idx_channel       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+    const unsigned int kernel_size_x     = input->info()->dimension(idx_width);
+    const unsigned int kernel_size_y     = input->info()->dimension(idx_height);
+    const unsigned int kernel_depth      = input->info()->dimension(idx_channel);
+    const unsigned int input_stride_x    = input->info()->strides_in_bytes().x();
+    const unsigned int input_stride_y    = input->info()->strides_in_bytes().y();
+    const unsigned int input_stride_z    = input->info()->strides_in_bytes().z();
+    const unsigned int output_stride_y   = output->info()->strides_in_bytes().y();
+    const unsigned int kernels_per_group = input->info()->dimension(3) / num_groups;
 
     // Create iterators
     Iterator in(input, window);
@@ -57,9 +58,13 @@ void weights_reshape(const ITensor *input, const ITensor *bias, ITensor *output,
         const int kernel_idx = id[3];
         const int kernel_idz = id[4];
 
+        // With grouping each group of kernels is written to its own matrix
+        const int output_idx = kernel_idx % kernels_per_group;
+        const int output_idz = kernel_idz + kernel_idx / kernels_per_group;
+
         // Setup pointers
         const uint8_t *tmp_input_ptr        = in.ptr();
-        uint8_t       *tmp_output_ptr       = output->ptr_to_element(Coordinates(kernel_idx, 0, kernel_idz));
+        uint8_t       *tmp_output_ptr       = output->ptr_to_element(Coordinates(output_idx, 0, output_idz));
         const uint8_t *curr_input_row_ptr   = tmp_input_ptr;
         const uint8_t *curr_input_depth_ptr = tmp_input_ptr;
 
@@ -91,23 +96,31 @@ void weights_reshape(const ITensor *input, const ITensor *bias, ITensor *output,
     in);
 }
 
-TensorShape get_output_shape(const ITensorInfo *input, bool has_bias)
+TensorShape get_output_shape(const ITensorInfo *input, bool has_bias, unsigned int num_groups)
 {
     TensorShape output_shape{ input->tensor_shape() };
 
     output_shape.collapse(3);
     const size_t tmp_dim = output_shape[0];
-    output_shape.set(0, output_shape[1]);
+    output_shape.set(0, output_shape[1] / num_groups);
     output_shape.set(1, tmp_dim + (has_bias ? 1 : 0));
+    if(num_groups > 1)
+    {
+        output_shape.set(2, num_groups);
+    }
 
     return output_shape;
 }
 
-Status validate_arguments(const ITensorInfo *input, const ITensorInfo *biases, const ITensorInfo *output)
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *biases, const ITensorInfo *output, unsigned int num_groups)
 {
     //Note: ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input) is not needed here as this kernel doesn't use NEON FP16 instructions.
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(output);
+    ARM_COMPUTE_RETURN_ERROR_ON(num_groups == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups > 1) && (input->data_layout() != DataLayout::NCHW), "Grouping (num_groups != 1) is only supported with NCHW data layout");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups > 1) && (input->num_dimensions() > 4), "Grouping (num_groups != 1) is not supported with unshared weights");
+    ARM_COMPUTE_RETURN_ERROR_ON((input->dimension(3) % num_groups) != 0);
 
     if(biases != nullptr)
     {
@@ -122,7 +135,7 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *biases, c
     // Checks performed when output is configured
     if(output->total_size() != 0)
     {
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), get_output_shape(input, biases != nullptr));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), get_output_shape(input, biases != nullptr, num_groups));
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
     }
 
@@ -144,25 +157,27 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITen
 } // namespace
 
 NEWeightsReshapeKernel::NEWeightsReshapeKernel()
-    : _func(nullptr), _input(nullptr), _bias(nullptr), _output(nullptr)
+    : _func(nullptr), _input(nullptr), _bias(nullptr), _output(nullptr), _num_groups(1)
 {
 }
 
-void NEWeightsReshapeKernel::configure(const ITensor *input, const ITensor *bias, ITensor *output)
+void NEWeightsReshapeKernel::configure(const ITensor *input, const ITensor *bias, ITensor *output, unsigned int num_groups)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
 
     // Output tensor auto inizialitation if not yet initialized
-    auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(get_output_shape(input->info(), (bias != nullptr))));
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(get_output_shape(input->info(), (bias != nullptr), num_groups)));
 
     // Perform validation step
     ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(),
                                                   (bias != nullptr) ? bias->info() : nullptr,
-                                                  output->info()));
+                                                  output->info(),
+                                                  num_groups));
 
-    _input  = input;
-    _bias   = bias;
-    _output = output;
+    _input      = input;
+    _bias       = bias;
+    _output     = output;
+    _num_groups = num_groups;
 
     const DataLayout data_layout = input->info()->data_layout();
     const bool       is_nhwc     = data_layout == DataLayout::NHWC;
@@ -197,9 +212,9 @@ void NEWeightsReshapeKernel::configure(const ITensor *input, const ITensor *bias
     INEKernel::configure(win_config.second);
 }
 
-Status NEWeightsReshapeKernel::validate(const ITensorInfo *input, const ITensorInfo *biases, const ITensorInfo *output)
+Status NEWeightsReshapeKernel::validate(const ITensorInfo *input, const ITensorInfo *biases, const ITensorInfo *output, unsigned int num_groups)
 {
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, biases, output));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, biases, output, num_groups));
     ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), output->clone().get()).first);
 
     return Status{};
@@ -211,5 +226,5 @@ void NEWeightsReshapeKernel::run(const Window &window, const ThreadInfo &info)
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
 
-    (*_func)(_input, _bias, _output, window);
+    (*_func)(_input, _bias, _output, _num_groups, window);
 }
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "arm_gemm.hpp"
+#include "utils.hpp"
+
+namespace arm_gemm {
+
+// Gathers blocks of the (never materialised) im2col matrix of a
+// convolution straight from the input tensor.
+//
+// The output format is identical to the one produced by the standard
+// non-transposed "Transform" used by PrepareA, so the result can be fed to
+// the same kernels.  Out of range input points are read as zero.
+template<typename T>
+class convolver {
+private:
+    const ConvolutionParameters _params;
+
+    /* Number of real kernel points, i.e. columns of A excluding the bias column. */
+    const int _kernel_size;
+
+    /* Per column: kernel displacement (including dilation) and channel. */
+    std::vector<int> _col_dx;
+    std::vector<int> _col_dy;
+    std::vector<int> _col_c;
+
+    /* Per column element offset from the top left of the patch.  Depends on the strides so is refreshed by set_strides(). */
+    std::vector<ptrdiff_t> _col_offset;
+
+    ptrdiff_t _stride_x=0;
+    ptrdiff_t _stride_y=0;
+    ptrdiff_t _stride_batch=0;
+
+    template<typename TOut>
+    inline TOut get_element(const T *in, const int x0, const int y0, const ptrdiff_t row_offset, const int col) const {
+        if (col >= _kernel_size) {
+            return static_cast<TOut>(1);
+        }
+
+        const int x = x0 + _col_dx[col];
+        const int y = y0 + _col_dy[col];
+
+        if (x < 0 || x >= _params.input_width || y < 0 || y >= _params.input_height) {
+            return static_cast<TOut>(0);
+        }
+
+        return static_cast<TOut>(in[row_offset + _col_offset[col]]);
+    }
+
+public:
+    convolver(const ConvolutionParameters &params) :
+        _params(params), _kernel_size(params.input_channels * params.kernel_width * params.kernel_height),
+        _col_dx(_kernel_size), _col_dy(_kernel_size), _col_c(_kernel_size), _col_offset(_kernel_size, 0) {
+        int col = 0;
+
+        // Same ordering as the im2col kernel: channel outermost, then kernel rows, then kernel columns.
+        for (int c=0; c<params.input_channels; c++) {
+            for (int ky=0; ky<params.kernel_height; ky++) {
+                for (int kx=0; kx<params.kernel_width; kx++) {
+                    _col_dx[col] = kx * params.dilation_w;
+                    _col_dy[col] = ky * params.dilation_h;
+                    _col_c[col]  = c;
+                    col++;
+                }
+            }
+        }
+    }
+
+    /* Number of columns of the virtual A matrix (i.e. the GEMM "K"). */
+    unsigned int get_K() const {
+        return _kernel_size + (_params.append_bias ? 1 : 0);
+    }
+
+    /* Strides are in elements of T. */
+    void set_strides(const int stride_x, const int stride_y, const int stride_c, const int stride_batch) {
+        _stride_x     = stride_x;
+        _stride_y     = stride_y;
+        _stride_batch = stride_batch;
+
+        for (int col=0; col<_kernel_size; col++) {
+            _col_offset[col] = (_col_dy[col] * _stride_y) + (_col_dx[col] * _stride_x) + (static_cast<ptrdiff_t>(_col_c[col]) * stride_c);
+        }
+    }
+
+    /* Interleave rows [y0, ymax) and columns [k0, kmax) of A.  'point_offset' is the index of the output point
+     * corresponding to row 0 (i.e. batch * M), so that rows can be mapped back to (batch, y, x) positions. */
+    template<unsigned int IntBy, unsigned int BlockBy, typename TOut>
+    void interleave(TOut *out, const T *in, const int point_offset, const int y0, const int ymax, const int k0, const int kmax) const {
+        const int out_points = _params.output_width * _params.output_height;
+
+        // Top left input coordinates and element offset of the patch for each row in the current block.
+        int       row_x[IntBy];
+        int       row_y[IntBy];
+        ptrdiff_t row_offset[IntBy];
+
+        for (int y_base=y0; y_base<ymax; y_base+=IntBy) {
+            const int fill_rows = std::min<int>(IntBy, ymax - y_base);
+
+            for (int row=0; row<fill_rows; row++) {
+                const int point = point_offset + y_base + row;
+                const int batch = point / out_points;
+                const int oy    = (point % out_points) / _params.output_width;
+                const int ox    = (point % out_points) % _params.output_width;
+
+                row_x[row] = (ox * _params.output_stride_w) - _params.padding_left;
+                row_y[row] = (oy * _params.output_stride_h) - _params.padding_top;
+                row_offset[row] = (batch * _stride_batch) + (row_y[row] * _stride_y) + (row_x[row] * _stride_x);
+            }
+
+            for (int x_base=k0; x_base<kmax; x_base+=BlockBy) {
+                const int fill_cols = std::min<int>(BlockBy, kmax - x_base);
+
+                for (int row=0; row<fill_rows; row++) {
+                    for (int col=0; col<fill_cols; col++) {
+                        *out++ = get_element<TOut>(in, row_x[row], row_y[row], row_offset[row], x_base + col);
+                    }
+                    // "col" tail - row is in range but column is out of range.
+                    for (int col=fill_cols; col<static_cast<int>(BlockBy); col++) {
+                        *out++ = static_cast<TOut>(0);
+                    }
+                }
+                // "row" tail - row is out of range so fill with zeros always.
+                for (int row=fill_rows; row<static_cast<int>(IntBy); row++) {
+                    for (unsigned int col=0; col<BlockBy; col++) {
+                        *out++ = static_cast<TOut>(0);
+                    }
+                }
+            }
+        }
+    }
+};
+
+} // namespace arm_gemm
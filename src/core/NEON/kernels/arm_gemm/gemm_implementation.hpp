@@ -59,6 +59,11 @@ public:
     GemmImpl_gemv_batched() : GemmImplementation<Top, Tret>(GemmMethod::GEMV_BATCHED) { }
 };
 
+/* Only the interleaved GEMMs know how to gather A from a convolution input. */
+inline bool method_supports_convolution(GemmMethod method) {
+    return (method == GemmMethod::GEMM_INTERLEAVED || method == GemmMethod::GEMM_INTERLEAVED_FP16 || method == GemmMethod::GEMM_INTERLEAVED_DOT);
+}
+
 /* "Master" function implemented for each valid combination of types.
  * Returns a list of GEMM implementation descriptors for processing by the
  * other functions.  */
@@ -75,6 +80,11 @@ GemmImplementation<Top, Tret> *find_implementation(GemmArgs<Tret> &args, GemmCon
             continue;
         }
 
+        /* Skip if a convolution is requested and this implementation can't do it. */
+        if (args._conv_params != nullptr && !method_supports_convolution(i->method)) {
+            continue;
+        }
+
         /* Skip if a specific method is requested and this is a different one. */
         if (cfg && cfg->method != GemmMethod::DEFAULT && i->method != cfg->method) {
             continue;
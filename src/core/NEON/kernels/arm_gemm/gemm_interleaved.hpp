@@ -27,11 +27,13 @@
 #include <assert.h>
 
 #include <algorithm>
+#include <memory>
 
 #include "arm_gemm.hpp"
 #include "utils.hpp"
 
 #include "buffer_manager.hpp"
+#include "convolver.hpp"
 #include "mergeresults.hpp"
 #include "transform.hpp"
 
@@ -85,6 +87,9 @@ class GemmInterleaved : public GemmCommon<To, Tr> {
     BufferManager *_bm=nullptr;
     void *_working_space=nullptr;
 
+    /* If A is gathered from a convolution input, this describes how. */
+    std::unique_ptr<convolver<To>> _convolver=nullptr;
+
     /* We will need to walk through the blocks of B in a few contexts, so
      * factor that out.  */
     class blockwalker {
@@ -223,9 +228,15 @@ class GemmInterleaved : public GemmCommon<To, Tr> {
                     if (first_m >= last_m)
                         continue;
 
-                    strat.transforms.PrepareA(a_panel + ((batch * _Mround + first_m) * _k_block),
-                                              this->_Aptr + (batch * this->_A_batch_stride) + (current.multi() * this->_A_multi_stride),
-                                              this->_lda, first_m, last_m, current.k0(), current.kmax(), _trA);
+                    if (_convolver) {
+                        strat.transforms.PrepareA_convolution(a_panel + ((batch * _Mround + first_m) * _k_block),
+                                                              this->_Aptr + (current.multi() * this->_A_multi_stride), *_convolver,
+                                                              batch * _Msize, first_m, last_m, current.k0(), current.kmax());
+                    } else {
+                        strat.transforms.PrepareA(a_panel + ((batch * _Mround + first_m) * _k_block),
+                                                  this->_Aptr + (batch * this->_A_batch_stride) + (current.multi() * this->_A_multi_stride),
+                                                  this->_lda, first_m, last_m, current.k0(), current.kmax(), _trA);
+                    }
                 }
 
                 // Figure out how many "K" the kernel will actually process.
@@ -327,6 +338,12 @@ public:
 
         assert(_maxthreads > 0);
 
+        if (args._conv_params) {
+            _convolver.reset(new convolver<To>(*args._conv_params));
+            assert(_convolver->get_K() == _Ksize);
+            assert(!_trA);
+        }
+
         // Work out blocking parameters
 
         // k_block: Find out how much of the larger array can be loaded into half the cache.
@@ -501,6 +518,13 @@ public:
         _B_transposed = reinterpret_cast<Toi *>(in_buffer);
     }
 
+    // Interface implementation - convolution
+    void set_convolution_strides(const int stride_x, const int stride_y, const int stride_c, const int stride_batch) override {
+        if (_convolver) {
+            _convolver->set_strides(stride_x, stride_y, stride_c, stride_batch);
+        }
+    }
+
     ~GemmInterleaved() override {
         delete _bm;
     }
@@ -23,6 +23,8 @@
  */
 #pragma once
 
+#include "convolver.hpp"
+
 namespace arm_gemm {
 
 /*
@@ -50,6 +52,12 @@ public:
         }
     }
 
+    template<typename TIn>
+    void PrepareA_convolution(TOperand *out, const TIn *in, const convolver<TIn> &conv, const int point_offset,
+                              const int y0, const int ymax, const int k0, const int kmax) {
+        conv.template interleave<height, block>(out, in, point_offset, y0, ymax, k0, kmax);
+    }
+
     template<typename TIn>
     void PrepareB(TOperand *out, const TIn *in, const int stride, const int x0,
                   const int xmax, const int k0, const int kmax, bool transposed) {
@@ -72,16 +72,43 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     // Perform topological sort
     std::vector<NodeID> topological_sorted_nodes = dfs(graph);
 
+    // Pick the execution order with the smallest peak of live transition buffers
+    TransitionMemoryInfo transition_memory;
+    if(ctx.config().use_transition_memory_manager)
+    {
+        std::vector<NodeID> memory_aware_nodes = memory_aware_sort(graph);
+
+        transition_memory.dfs_peak          = peak_transition_memory(graph, topological_sorted_nodes);
+        transition_memory.memory_aware_peak = peak_transition_memory(graph, memory_aware_nodes);
+        transition_memory.use_memory_aware  = transition_memory.memory_aware_peak < transition_memory.dfs_peak;
+        if(transition_memory.use_memory_aware)
+        {
+            topological_sorted_nodes = std::move(memory_aware_nodes);
+        }
+        ARM_COMPUTE_LOG_GRAPH_INFO("Peak transition memory of graph " << graph.name() << " : "
+                                   << transition_memory.dfs_peak << " bytes with depth first ordering, "
+                                   << transition_memory.memory_aware_peak << " bytes with memory aware ordering" << std::endl);
+    }
+
     // Validate all nodes
     detail::validate_all_nodes(graph);
 
     // Configure all nodes
     auto workload = detail::configure_all_nodes(graph, ctx, topological_sorted_nodes);
     ARM_COMPUTE_ERROR_ON_MSG(workload.tasks.empty(), "Could not configure all nodes!");
+    workload.transition_memory = transition_memory;
 
     // Allocate const tensors and call accessors
+    if(ctx.config().share_weights)
+    {
+        detail::allocate_shared_const_tensors(graph);
+    }
     detail::allocate_const_tensors(graph);
     detail::call_all_const_node_accessors(graph);
+    if(ctx.config().share_weights)
+    {
+        detail::publish_shared_const_tensors(graph);
+    }
 
     // Prepare graph
     detail::prepare_all_tasks(workload);
@@ -136,5 +163,13 @@ void GraphManager::invalidate_graph(Graph &graph)
 
     _workloads.erase(it);
 }
+
+TransitionMemoryInfo GraphManager::transition_memory_info(const Graph &graph) const
+{
+    auto it = _workloads.find(graph.id());
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
+
+    return it->second.transition_memory;
+}
 } // namespace graph
 } // namespace arm_compute
@@ -79,6 +79,7 @@ PassManager create_default_pass_manager(Target target)
     PassManager pm;
 
     // Passes that mutate graph IR
+    pm.append(support::cpp14::make_unique<ChannelShuffleFusionMutator>());
     pm.append(support::cpp14::make_unique<GroupedConvolutionMutator>());
     if(target != Target::GC)
     {
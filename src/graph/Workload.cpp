@@ -26,6 +26,8 @@
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/ITensorHandle.h"
 
+#include "arm_compute/runtime/SchedulerTracer.h"
+
 namespace arm_compute
 {
 namespace graph
@@ -39,7 +41,19 @@ void execute_task(ExecutionTask &task)
 {
     if(task.task)
     {
+        // Tag the kernels scheduled by this task with the name of its node
+        const bool traced = SchedulerTracer::get().is_enabled() && task.node != nullptr;
+        if(traced)
+        {
+            SchedulerTracer::set_label(task.node->name());
+        }
+
         task.task->run();
+
+        if(traced)
+        {
+            SchedulerTracer::set_label("");
+        }
     }
 }
 
@@ -24,10 +24,15 @@
 #include "arm_compute/graph/algorithms/TopologicalSort.h"
 
 #include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/ITensorHandle.h"
 
+#include "arm_compute/core/Utils.h"
 #include "arm_compute/core/utils/misc/Iterable.h"
 
+#include <algorithm>
 #include <list>
+#include <map>
+#include <set>
 #include <stack>
 
 namespace arm_compute
@@ -67,6 +72,200 @@ inline bool all_inputs_are_visited(const INode *node, const std::vector<bool> &v
 
     return are_all_visited;
 }
+
+/** Transition buffer usage of the nodes of a graph */
+struct TransitionLiveness
+{
+    std::map<const void *, size_t>         buffer_size{}; /**< Size in bytes of each transition buffer */
+    std::map<const void *, unsigned int>   num_uses{};    /**< Number of node inputs reading each transition buffer */
+    std::vector<std::vector<const void *>> produced{};    /**< Transition buffers written by each node */
+    std::vector<std::vector<const void *>> consumed{};    /**< Transition buffers read by each node, one entry per input */
+};
+
+/** Returns the buffer backing a tensor
+ *
+ * Sub-tensors share the buffer of their parent tensor.
+ *
+ * @param[in] tensor Tensor to query
+ *
+ * @return Key identifying the buffer of the tensor
+ */
+inline const void *buffer_key(Tensor *tensor)
+{
+    ARM_COMPUTE_ERROR_ON(tensor == nullptr);
+    return (tensor->handle() != nullptr) ? static_cast<const void *>(tensor->handle()->parent_handle()) : static_cast<const void *>(tensor);
+}
+
+/** Collects the transition buffers produced and consumed by each node of a graph
+ *
+ * @param[in] g Graph to inspect
+ *
+ * @return Transition buffer usage of the graph
+ */
+TransitionLiveness get_transition_liveness(Graph &g)
+{
+    const auto        &nodes            = g.nodes();
+    std::set<NodeType> const_node_types = { NodeType::Input, NodeType::Output, NodeType::Const };
+
+    TransitionLiveness liveness;
+    liveness.produced.resize(nodes.size());
+    liveness.consumed.resize(nodes.size());
+
+    // Buffers bound to input, output and const nodes are not managed
+    std::set<const void *> const_buffers;
+    for(const auto &node : nodes)
+    {
+        if(node != nullptr && const_node_types.find(node->type()) != std::end(const_node_types))
+        {
+            for(unsigned int i = 0; i < node->num_inputs(); ++i)
+            {
+                if(node->input(i) != nullptr)
+                {
+                    const_buffers.insert(buffer_key(node->input(i)));
+                }
+            }
+            for(unsigned int i = 0; i < node->num_outputs(); ++i)
+            {
+                if(node->output(i) != nullptr)
+                {
+                    const_buffers.insert(buffer_key(node->output(i)));
+                }
+            }
+        }
+    }
+
+    for(const auto &node : nodes)
+    {
+        if(node == nullptr)
+        {
+            continue;
+        }
+
+        for(unsigned int i = 0; i < node->num_outputs(); ++i)
+        {
+            Tensor *tensor = node->output(i);
+            if(tensor != nullptr && const_buffers.find(buffer_key(tensor)) == std::end(const_buffers))
+            {
+                const void  *key   = buffer_key(tensor);
+                const size_t bytes = tensor->desc().shape.total_size() * data_size_from_type(tensor->desc().data_type);
+
+                liveness.produced[node->id()].push_back(key);
+                liveness.buffer_size[key] = std::max(liveness.buffer_size[key], bytes);
+            }
+        }
+
+        for(unsigned int i = 0; i < node->num_inputs(); ++i)
+        {
+            Tensor *tensor = node->input(i);
+            if(tensor != nullptr && const_buffers.find(buffer_key(tensor)) == std::end(const_buffers))
+            {
+                const void *key = buffer_key(tensor);
+
+                liveness.consumed[node->id()].push_back(key);
+                ++liveness.num_uses[key];
+            }
+        }
+    }
+
+    return liveness;
+}
+
+/** Tracks the live transition buffers while a graph is traversed */
+class LivenessTracker
+{
+public:
+    /** Constructor
+     *
+     * @param[in] liveness Transition buffer usage of the graph
+     */
+    explicit LivenessTracker(const TransitionLiveness &liveness)
+        : _liveness(liveness), _remaining_uses(liveness.num_uses), _live(), _live_bytes(0), _peak_bytes(0)
+    {
+    }
+    /** Computes the change of live memory caused by executing a node
+     *
+     * @param[in] nid Node to evaluate
+     *
+     * @return Number of bytes allocated by the node minus the number of bytes released by it
+     */
+    int64_t delta(NodeID nid) const
+    {
+        int64_t                              delta = 0;
+        std::set<const void *>               allocated;
+        std::map<const void *, unsigned int> uses;
+        for(const auto &key : _liveness.produced[nid])
+        {
+            if(_live.find(key) == std::end(_live) && allocated.insert(key).second)
+            {
+                delta += _liveness.buffer_size.at(key);
+            }
+        }
+        for(const auto &key : _liveness.consumed[nid])
+        {
+            ++uses[key];
+        }
+        for(const auto &use : uses)
+        {
+            if(remaining_uses(use.first) == use.second && _live.find(use.first) != std::end(_live))
+            {
+                delta -= _liveness.buffer_size.at(use.first);
+            }
+        }
+        return delta;
+    }
+    /** Executes a node, updating the live buffers
+     *
+     * @param[in] nid Node to execute
+     */
+    void execute(NodeID nid)
+    {
+        for(const auto &key : _liveness.produced[nid])
+        {
+            if(_live.insert(key).second)
+            {
+                _live_bytes += _liveness.buffer_size.at(key);
+            }
+        }
+        _peak_bytes = std::max(_peak_bytes, _live_bytes);
+
+        for(const auto &key : _liveness.consumed[nid])
+        {
+            --_remaining_uses[key];
+        }
+        // Release buffers without pending consumers, including outputs that are never read
+        for(const auto *keys : { &_liveness.consumed[nid], &_liveness.produced[nid] })
+        {
+            for(const auto &key : *keys)
+            {
+                if(remaining_uses(key) == 0 && _live.erase(key) != 0)
+                {
+                    _live_bytes -= _liveness.buffer_size.at(key);
+                }
+            }
+        }
+    }
+    /** Returns the peak of live memory
+     *
+     * @return Peak number of bytes of live transition memory
+     */
+    size_t peak_bytes() const
+    {
+        return _peak_bytes;
+    }
+
+private:
+    unsigned int remaining_uses(const void *key) const
+    {
+        auto it = _remaining_uses.find(key);
+        return (it != std::end(_remaining_uses)) ? it->second : 0;
+    }
+
+    const TransitionLiveness            &_liveness;
+    std::map<const void *, unsigned int> _remaining_uses;
+    std::set<const void *>               _live;
+    size_t                               _live_bytes;
+    size_t                               _peak_bytes;
+};
 } // namespace detail
 
 std::vector<NodeID> bfs(Graph &g)
@@ -184,5 +383,89 @@ std::vector<NodeID> dfs(Graph &g)
 
     return dfs_order_vector;
 }
+
+std::vector<NodeID> memory_aware_sort(Graph &g)
+{
+    std::vector<NodeID> order_vector;
+
+    const detail::TransitionLiveness liveness = detail::get_transition_liveness(g);
+    detail::LivenessTracker          tracker(liveness);
+
+    // Created visited and queued vectors
+    std::vector<bool> visited(g.nodes().size(), false);
+    std::vector<bool> queued(g.nodes().size(), false);
+
+    // Nodes whose inputs have all been visited, in the order they became ready
+    std::vector<NodeID> ready;
+
+    // Appends a node to the traversal and queues the consumers that became ready
+    auto visit = [&](NodeID n)
+    {
+        visited[n] = true;
+        order_vector.push_back(n);
+        tracker.execute(n);
+
+        const INode *node = g.node(n);
+        ARM_COMPUTE_ERROR_ON(node == nullptr);
+        for(const auto &eid : node->output_edges())
+        {
+            const Edge *e = g.edge(eid);
+            ARM_COMPUTE_ERROR_ON(e == nullptr);
+            if(!queued[e->consumer_id()] && detail::all_inputs_are_visited(e->consumer(), visited))
+            {
+                queued[e->consumer_id()] = true;
+                ready.push_back(e->consumer_id());
+            }
+        }
+    };
+
+    // Visit inputs and const nodes first
+    for(const auto type : { NodeType::Input, NodeType::Const })
+    {
+        for(auto &n : g.nodes(type))
+        {
+            if(n != EmptyNodeID)
+            {
+                queued[n] = true;
+                visit(n);
+            }
+        }
+    }
+
+    while(!ready.empty())
+    {
+        // Pick the ready node with the smallest memory growth, favouring the most recently readied one
+        size_t  best       = ready.size() - 1;
+        int64_t best_delta = tracker.delta(ready[best]);
+        for(size_t i = best; i-- > 0;)
+        {
+            const int64_t delta = tracker.delta(ready[i]);
+            if(delta < best_delta)
+            {
+                best       = i;
+                best_delta = delta;
+            }
+        }
+
+        const NodeID n = ready[best];
+        ready.erase(ready.begin() + best);
+        visit(n);
+    }
+
+    return order_vector;
+}
+
+size_t peak_transition_memory(Graph &g, const std::vector<NodeID> &order)
+{
+    const detail::TransitionLiveness liveness = detail::get_transition_liveness(g);
+    detail::LivenessTracker          tracker(liveness);
+
+    for(const auto &n : order)
+    {
+        tracker.execute(n);
+    }
+
+    return tracker.peak_bytes();
+}
 } // namespace graph
-} // namespace arm_compute
\ No newline at end of file
+} // namespace arm_compute
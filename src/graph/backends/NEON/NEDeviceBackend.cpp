@@ -42,9 +42,12 @@
 #include "arm_compute/runtime/OffsetLifetimeManager.h"
 #include "arm_compute/runtime/PoolManager.h"
 #include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/SchedulerTracer.h"
 
 #include "support/ToolchainSupport.h"
 
+#include <fstream>
+
 namespace arm_compute
 {
 namespace graph
@@ -55,7 +58,7 @@ namespace backends
 static detail::BackendRegistrar<NEDeviceBackend> NEDeviceBackend_registrar(Target::NEON);
 
 NEDeviceBackend::NEDeviceBackend()
-    : _allocator()
+    : _allocator(), _traced_contexts(), _mtx()
 {
 }
 
@@ -66,8 +69,52 @@ void NEDeviceBackend::initialize_backend()
 
 void NEDeviceBackend::release_backend_context(GraphContext &ctx)
 {
-    //Nothing to do
-    ARM_COMPUTE_UNUSED(ctx);
+    // Check if the context was recording the execution of the kernels
+    SchedulerTracer::Clock::time_point since;
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        auto                        it = _traced_contexts.find(&ctx);
+        if(it == _traced_contexts.end())
+        {
+            return;
+        }
+        since = it->second;
+        _traced_contexts.erase(it);
+    }
+
+    // Stop recording for this context only, other contexts may still be recording
+    const GraphConfig &config = ctx.config();
+    SchedulerTracer   &tracer = SchedulerTracer::get();
+    tracer.stop(!config.profile_file.empty());
+
+    // Write the execution trace and profile: this runs from the context's destructor so failures must not throw
+    if(!config.trace_file.empty())
+    {
+        try
+        {
+            tracer.save_chrome_trace(config.trace_file, since);
+            ARM_COMPUTE_LOG_GRAPH_INFO("Execution trace written to " << config.trace_file << std::endl);
+        }
+        catch(const std::exception &e)
+        {
+            ARM_COMPUTE_LOG_GRAPH_WARNING("Failed to write the execution trace to " << config.trace_file << ": " << e.what() << std::endl);
+        }
+    }
+    if(!config.profile_file.empty())
+    {
+        try
+        {
+            std::ofstream fs;
+            fs.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+            fs.open(config.profile_file, std::ios::out);
+            tracer.write_summary(fs, since);
+            ARM_COMPUTE_LOG_GRAPH_INFO("Execution profile written to " << config.profile_file << std::endl);
+        }
+        catch(const std::exception &e)
+        {
+            ARM_COMPUTE_LOG_GRAPH_WARNING("Failed to write the execution profile to " << config.profile_file << ": " << e.what() << std::endl);
+        }
+    }
 }
 
 void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
@@ -78,6 +125,16 @@ void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
         Scheduler::get().set_num_threads(ctx.config().num_threads);
     }
 
+    // Record the execution of the kernels, once per context as it can be set up by each graph finalized in it
+    if(!ctx.config().trace_file.empty() || !ctx.config().profile_file.empty())
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        if(_traced_contexts.find(&ctx) == _traced_contexts.end())
+        {
+            _traced_contexts.emplace(&ctx, SchedulerTracer::get().start(!ctx.config().profile_file.empty()));
+        }
+    }
+
     // Create function level memory manager
     if(ctx.memory_management_ctx(Target::NEON) == nullptr)
     {
@@ -60,6 +60,13 @@ struct NEConvolutionLayerFunctions
     using WinogradConvolutionLayer = NEWinogradConvolutionLayer;
 };
 
+/** Collection of NEON deconvolution functions */
+struct NEDeconvolutionLayerFunctions
+{
+    using GenericDeconvolutionLayer = NEDeconvolutionLayer;
+    using GEMMDeconvolutionLayer    = NEGEMMDeconvolutionLayer;
+};
+
 /** Collection of CL depthwise convolution functions */
 struct NEDepthwiseConvolutionLayerFunctions
 {
@@ -97,6 +104,7 @@ std::unique_ptr<IFunction> create_convolution_layer<NEConvolutionLayerFunctions,
 
     const PadStrideInfo     conv_info      = node.convolution_info();
     const ConvolutionMethod conv_algorithm = node.convolution_method();
+    const bool              implicit_gemm  = ctx.config().use_implicit_gemm;
 
     // Create and configure function (we assume that functions have been validated before creation)
     std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, Target::NEON);
@@ -110,7 +118,8 @@ std::unique_ptr<IFunction> create_convolution_layer<NEConvolutionLayerFunctions,
     else if(conv_algorithm == ConvolutionMethod::GEMM)
     {
         std::tie(func, func_name) = create_named_memory_managed_function<NEGEMMConvolutionLayer>(
-                                        std::string("GEMMConvolutionLayer"), mm, input, weights, biases, output, conv_info);
+                                        std::string("GEMMConvolutionLayer"), mm, input, weights, biases, output, conv_info,
+                                        WeightsInfo(), Size2D(1U, 1U), ActivationLayerInfo(), 1U, implicit_gemm);
     }
     else if(conv_algorithm == ConvolutionMethod::Winograd)
     {
@@ -120,7 +129,8 @@ std::unique_ptr<IFunction> create_convolution_layer<NEConvolutionLayerFunctions,
     else
     {
         std::tie(func, func_name) = create_named_memory_managed_function<NEConvolutionLayer>(
-                                        std::string("ConvolutionLayer"), mm, input, weights, biases, output, conv_info);
+                                        std::string("ConvolutionLayer"), mm, input, weights, biases, output, conv_info,
+                                        WeightsInfo(), Size2D(1U, 1U), ActivationLayerInfo(), false, 1U, implicit_gemm);
     }
 
     // Log info
@@ -136,6 +146,50 @@ std::unique_ptr<IFunction> create_convolution_layer<NEConvolutionLayerFunctions,
     return func;
 }
 
+template <>
+std::unique_ptr<IFunction> create_deconvolution_layer<NEDeconvolutionLayerFunctions, NETargetInfo>(DeconvolutionLayerNode &node, GraphContext &ctx)
+{
+    validate_node<NETargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    NETargetInfo::TensorType *input   = get_backing_tensor<NETargetInfo>(node.input(0));
+    NETargetInfo::TensorType *weights = get_backing_tensor<NETargetInfo>(node.input(1));
+    NETargetInfo::TensorType *biases  = get_backing_tensor<NETargetInfo>(node.input(2));
+    NETargetInfo::TensorType *output  = get_backing_tensor<NETargetInfo>(node.output(0));
+
+    const PadStrideInfo deconv_info  = node.deconvolution_info();
+    const Size2D        inner_border = node.inner_border();
+
+    // The GEMM based deconvolution avoids the zero-upsampling but doesn't support all the configurations
+    const bool use_gemm = bool(NEGEMMDeconvolutionLayer::validate(input->info(), weights->info(), (biases != nullptr) ? biases->info() : nullptr, output->info(),
+                                                                  deconv_info, inner_border.x(), inner_border.y()));
+
+    // Create and configure function (we assume that functions have been validated before creation)
+    std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, Target::NEON);
+    std::unique_ptr<IFunction>      func;
+    std::string                     func_name;
+    if(use_gemm)
+    {
+        std::tie(func, func_name) = create_named_memory_managed_function<NEGEMMDeconvolutionLayer>(
+                                        std::string("GEMMDeconvolutionLayer"), mm, input, weights, biases, output, deconv_info, inner_border.x(), inner_border.y());
+    }
+    else
+    {
+        std::tie(func, func_name) = create_named_memory_managed_function<NEDeconvolutionLayer>(
+                                        std::string("DeconvolutionLayer"), mm, input, weights, biases, output, deconv_info, inner_border.x(), inner_border.y());
+    }
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated " << func_name
+                               << " Target " << NETargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type()
+                               << " Input shape: " << input->info()->tensor_shape()
+                               << " Weights shape: " << weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << std::endl);
+    return func;
+}
+
 template <>
 std::unique_ptr<IFunction> create_normalization_layer<NENormalizationLayer, NETargetInfo>(NormalizationLayerNode &node, GraphContext &ctx)
 {
@@ -179,10 +233,12 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
             return detail::create_activation_layer<NEActivationLayer, NETargetInfo>(*polymorphic_downcast<ActivationLayerNode *>(node));
         case NodeType::BatchNormalizationLayer:
             return detail::create_batch_normalization_layer<NEBatchNormalizationLayer, NETargetInfo>(*polymorphic_downcast<BatchNormalizationLayerNode *>(node));
+        case NodeType::ChannelShuffleLayer:
+            return detail::create_channel_shuffle_layer<NEChannelShuffleLayer, NETargetInfo>(*polymorphic_downcast<ChannelShuffleLayerNode *>(node));
         case NodeType::ConvolutionLayer:
             return detail::create_convolution_layer<NEConvolutionLayerFunctions, NETargetInfo>(*polymorphic_downcast<ConvolutionLayerNode *>(node), ctx);
         case NodeType::DeconvolutionLayer:
-            return detail::create_deconvolution_layer<NEDeconvolutionLayer, NETargetInfo>(*polymorphic_downcast<DeconvolutionLayerNode *>(node), ctx);
+            return detail::create_deconvolution_layer<NEDeconvolutionLayerFunctions, NETargetInfo>(*polymorphic_downcast<DeconvolutionLayerNode *>(node), ctx);
         case NodeType::ConcatenateLayer:
             return detail::create_concatenate_layer<NEConcatenateLayer, NETargetInfo>(*polymorphic_downcast<ConcatenateLayerNode *>(node));
         case NodeType::DepthwiseConvolutionLayer:
@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/utils/misc/Cast.h"
 #include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/WeightsCache.h"
 
 namespace arm_compute
 {
@@ -48,6 +49,16 @@ void NETensorHandle::free()
     _tensor.allocator()->free();
 }
 
+bool NETensorHandle::allocate_shared(const std::string &key)
+{
+    return WeightsCache::get().acquire(key, _tensor);
+}
+
+void NETensorHandle::publish_shared(const std::string &key)
+{
+    WeightsCache::get().publish(key, _tensor);
+}
+
 void NETensorHandle::manage(IMemoryGroup *mg)
 {
     if(mg != nullptr)
@@ -27,7 +27,12 @@
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/GraphManager.h"
 #include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/TypePrinter.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/runtime/WeightsCache.h"
+#include "support/ToolchainSupport.h"
+
+#include <sstream>
 
 namespace arm_compute
 {
@@ -35,6 +40,93 @@ namespace graph
 {
 namespace detail
 {
+namespace
+{
+/** Accessor of a const tensor which imported the data of another graph */
+class SharedTensorAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] source Identifier of the data held by the tensor
+     */
+    explicit SharedTensorAccessor(std::string source)
+        : _source(std::move(source))
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        ARM_COMPUTE_UNUSED(tensor);
+        return true;
+    }
+
+    std::string source() const override
+    {
+        return _source;
+    }
+
+private:
+    std::string _source;
+};
+
+/** Key identifying the data of a const tensor across graphs
+ *
+ * @param[in] tensor Tensor to get the key of
+ *
+ * @return The key of the tensor, or an empty string if its data can't be shared
+ */
+std::string const_tensor_key(Tensor &tensor)
+{
+    if(tensor.accessor() == nullptr || tensor.accessor()->source().empty())
+    {
+        return "";
+    }
+
+    const TensorDescriptor &desc = tensor.desc();
+
+    std::stringstream ss;
+    ss << tensor.accessor()->source() << "@" << desc.shape << "," << desc.data_type << "," << desc.layout << "," << desc.quant_info << "," << desc.target;
+    return ss.str();
+}
+
+/** Key identifying the weights prepared by a node across graphs
+ *
+ * All the inputs of the node but the first one must be provided by const nodes with shareable data.
+ *
+ * @param[in] node Node to get the key of
+ *
+ * @return The key of the node, or an empty string if its prepared weights can't be shared
+ */
+std::string prepared_weights_key(INode &node)
+{
+    if(node.num_inputs() < 2 || node.input(0) == nullptr || node.output(0) == nullptr)
+    {
+        return "";
+    }
+
+    std::stringstream ss;
+    ss << node.type() << "(" << node.input(0)->desc().shape << "->" << node.output(0)->desc().shape << ")";
+    for(unsigned int i = 1; i < node.num_inputs(); ++i)
+    {
+        Tensor *tensor = node.input(i);
+        if(tensor == nullptr)
+        {
+            continue;
+        }
+
+        const Edge       *edge = node.input_edge(i);
+        const std::string key  = const_tensor_key(*tensor);
+        if(edge == nullptr || edge->producer() == nullptr || edge->producer()->type() != NodeType::Const || key.empty())
+        {
+            return "";
+        }
+        ss << ";" << key;
+    }
+    return ss.str();
+}
+} // namespace
+
 void validate_all_nodes(Graph &g)
 {
     auto &nodes = g.nodes();
@@ -90,7 +182,44 @@ void allocate_all_output_tensors(INode &node)
         if(tensor != nullptr && !tensor->bound_edges().empty())
         {
             ARM_COMPUTE_ERROR_ON_MSG(!tensor->handle(), "Tensor handle is not configured!");
-            tensor->handle()->allocate();
+            // Skip the tensors already holding memory (e.g. shared const tensors)
+            if(tensor->handle()->tensor().info()->is_resizable())
+            {
+                tensor->handle()->allocate();
+            }
+        }
+    }
+}
+
+void allocate_shared_const_tensors(Graph &g)
+{
+    for(auto &node : g.nodes())
+    {
+        if(node != nullptr && node->type() == NodeType::Const)
+        {
+            Tensor           *tensor = node->output(0);
+            const std::string key    = (tensor != nullptr && tensor->handle() != nullptr && !tensor->bound_edges().empty()) ? const_tensor_key(*tensor) : "";
+            if(!key.empty() && tensor->handle()->allocate_shared(key))
+            {
+                // The data was loaded by another graph
+                tensor->set_accessor(support::cpp14::make_unique<SharedTensorAccessor>(tensor->accessor()->source()));
+            }
+        }
+    }
+}
+
+void publish_shared_const_tensors(Graph &g)
+{
+    for(auto &node : g.nodes())
+    {
+        if(node != nullptr && node->type() == NodeType::Const)
+        {
+            Tensor           *tensor = node->output(0);
+            const std::string key    = (tensor != nullptr && tensor->handle() != nullptr) ? const_tensor_key(*tensor) : "";
+            if(!key.empty())
+            {
+                tensor->handle()->publish_shared(key);
+            }
         }
     }
 }
@@ -213,8 +342,11 @@ bool call_all_input_node_accessors(ExecutionWorkload &workload)
 void prepare_all_tasks(ExecutionWorkload &workload)
 {
     ARM_COMPUTE_ERROR_ON(workload.graph == nullptr);
+    const bool share_weights = (workload.ctx != nullptr) && workload.ctx->config().share_weights;
     for(auto &task : workload.tasks)
     {
+        // Identify the weights prepared by the task to share them with the other graphs
+        WeightsCache::Scope scope((share_weights && task.node != nullptr) ? prepared_weights_key(*task.node) : "");
         task.prepare();
         release_unused_tensors(*workload.graph);
     }
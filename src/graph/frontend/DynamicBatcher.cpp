@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/frontend/DynamicBatcher.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Window.h"
+#include "support/ToolchainSupport.h"
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace frontend
+{
+namespace
+{
+/** Calls a function on each row of a sample of a batched tensor
+ *
+ * @param[in] tensor     Batched tensor
+ * @param[in] batch_size Number of samples in the tensor
+ * @param[in] sample     Sample to iterate over
+ * @param[in] func       Function to call with the row pointer and the row size in bytes
+ */
+template <typename F>
+void for_each_sample_row(ITensor &tensor, unsigned int batch_size, unsigned int sample, F &&func)
+{
+    const ITensorInfo &info      = *tensor.info();
+    const size_t       batch_idx = info.num_dimensions() - 1;
+
+    Window win;
+    win.use_tensor_dimensions(info.tensor_shape());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    if(batch_size > 1)
+    {
+        win.set(batch_idx, Window::Dimension(sample, sample + 1, 1));
+    }
+
+    const size_t row_size = ((batch_size > 1 && batch_idx == Window::DimX) ? 1 : info.dimension(0)) * info.element_size();
+
+    Iterator it(&tensor, win);
+    execute_window_loop(win, [&](const Coordinates &)
+    {
+        func(it.ptr(), row_size);
+    },
+    it);
+}
+
+/** Accessor scattering the queued input samples into the batched input tensor */
+class BatchInputAccessor final : public ITensorAccessor
+{
+public:
+    BatchInputAccessor(unsigned int batch_size, const std::vector<const void *> &samples)
+        : _batch_size(batch_size), _samples(samples)
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        ARM_COMPUTE_ERROR_ON(_samples.size() > _batch_size);
+        for(unsigned int i = 0; i < _samples.size(); ++i)
+        {
+            auto src = reinterpret_cast<const uint8_t *>(_samples[i]);
+            for_each_sample_row(tensor, _batch_size, i, [&](uint8_t *row, size_t row_size)
+            {
+                std::memcpy(row, src, row_size);
+                src += row_size;
+            });
+        }
+        return true;
+    }
+
+private:
+    const unsigned int               _batch_size;
+    const std::vector<const void *> &_samples;
+};
+
+/** Accessor gathering the batched output tensor into the queued output samples */
+class BatchOutputAccessor final : public ITensorAccessor
+{
+public:
+    BatchOutputAccessor(unsigned int batch_size, const std::vector<void *> &samples)
+        : _batch_size(batch_size), _samples(samples)
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        ARM_COMPUTE_ERROR_ON(_samples.size() > _batch_size);
+        for(unsigned int i = 0; i < _samples.size(); ++i)
+        {
+            auto dst = reinterpret_cast<uint8_t *>(_samples[i]);
+            for_each_sample_row(tensor, _batch_size, i, [&](uint8_t *row, size_t row_size)
+            {
+                std::memcpy(dst, row, row_size);
+                dst += row_size;
+            });
+        }
+        // Stop the execution after a single iteration
+        return false;
+    }
+
+private:
+    const unsigned int         _batch_size;
+    const std::vector<void *> &_samples;
+};
+} // namespace
+
+DynamicBatcher::DynamicBatcher(Target target, const GraphConfig &config, StreamBuilder builder)
+    : _batch_sizes(), _streams(), _batch_inputs(), _batch_outputs(), _queue(), _mtx(), _cv(), _timeout(config.batching_timeout_us), _stop(false), _dispatcher()
+{
+    ARM_COMPUTE_ERROR_ON(config.max_batch_size == 0);
+    ARM_COMPUTE_ERROR_ON(!builder);
+
+    for(unsigned int batch_size = 1; batch_size < config.max_batch_size; batch_size *= 2)
+    {
+        _batch_sizes.push_back(batch_size);
+    }
+    _batch_sizes.push_back(config.max_batch_size);
+
+    // All the streams run the same network so they can share a single copy of the weights
+    GraphConfig stream_config   = config;
+    stream_config.share_weights = true;
+
+    for(unsigned int batch_size : _batch_sizes)
+    {
+        auto stream = support::cpp14::make_unique<Stream>(_streams.size(), "DynamicBatch" + support::cpp11::to_string(batch_size));
+        builder(*stream, batch_size,
+                support::cpp14::make_unique<BatchInputAccessor>(batch_size, _batch_inputs),
+                support::cpp14::make_unique<BatchOutputAccessor>(batch_size, _batch_outputs));
+        stream->finalize(target, stream_config);
+        _streams.push_back(std::move(stream));
+    }
+
+    _dispatcher = std::thread(&DynamicBatcher::dispatch, this);
+}
+
+DynamicBatcher::~DynamicBatcher()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _stop = true;
+    }
+    _cv.notify_one();
+    _dispatcher.join();
+}
+
+std::future<void> DynamicBatcher::enqueue(const void *input, void *output)
+{
+    ARM_COMPUTE_ERROR_ON(input == nullptr || output == nullptr);
+
+    Request           request{ input, output, std::promise<void>(), std::chrono::steady_clock::now() };
+    std::future<void> future = request.promise.get_future();
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        if(_stop)
+        {
+            // The dispatching thread might have already exited: the request would never be executed
+            request.promise.set_exception(std::make_exception_ptr(std::runtime_error("Dynamic batcher is shutting down!")));
+            return future;
+        }
+        _queue.push_back(std::move(request));
+    }
+    _cv.notify_one();
+
+    return future;
+}
+
+const std::vector<unsigned int> &DynamicBatcher::batch_sizes() const
+{
+    return _batch_sizes;
+}
+
+void DynamicBatcher::dispatch()
+{
+    const size_t         max_batch_size = _batch_sizes.back();
+    std::vector<Request> batch;
+    batch.reserve(max_batch_size);
+
+    while(true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_mtx);
+            _cv.wait(lock, [this]
+            {
+                return _stop || !_queue.empty();
+            });
+
+            // Pending requests are executed before stopping
+            if(_queue.empty())
+            {
+                return;
+            }
+
+            // Wait for the batch to fill up, unless the oldest request has already waited long enough
+            const auto deadline = _queue.front().arrival + _timeout;
+            _cv.wait_until(lock, deadline, [&]
+            {
+                return _stop || _queue.size() >= max_batch_size;
+            });
+
+            const size_t num_requests = std::min(_queue.size(), max_batch_size);
+            for(size_t i = 0; i < num_requests; ++i)
+            {
+                batch.push_back(std::move(_queue.front()));
+                _queue.pop_front();
+            }
+        }
+
+        run_batch(batch);
+        batch.clear();
+    }
+}
+
+void DynamicBatcher::run_batch(std::vector<Request> &batch)
+{
+    // Select the smallest stream able to hold the batch
+    const auto   it  = std::lower_bound(_batch_sizes.begin(), _batch_sizes.end(), static_cast<unsigned int>(batch.size()));
+    const size_t idx = std::distance(_batch_sizes.begin(), it);
+    ARM_COMPUTE_ERROR_ON(idx >= _streams.size());
+
+    _batch_inputs.clear();
+    _batch_outputs.clear();
+    for(auto &request : batch)
+    {
+        _batch_inputs.push_back(request.input);
+        _batch_outputs.push_back(request.output);
+    }
+
+    try
+    {
+        _streams[idx]->run();
+    }
+    catch(...)
+    {
+        for(auto &request : batch)
+        {
+            request.promise.set_exception(std::current_exception());
+        }
+        return;
+    }
+
+    for(auto &request : batch)
+    {
+        request.promise.set_value();
+    }
+}
+} // namespace frontend
+} // namespace graph
+} // namespace arm_compute
@@ -49,6 +49,11 @@ void Stream::run()
     _manager.execute_graph(_g);
 }
 
+TransitionMemoryInfo Stream::transition_memory_info() const
+{
+    return _manager.transition_memory_info(_g);
+}
+
 void Stream::add_layer(ILayer &layer)
 {
     auto nid   = layer.create_layer(*this);
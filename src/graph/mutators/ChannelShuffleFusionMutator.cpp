@@ -0,0 +1,467 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/ChannelShuffleFusionMutator.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/core/utils/misc/Cast.h"
+
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Accessor that permutes a constant tensor along a dimension once the wrapped accessor has filled it */
+class ChannelPermutationAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] accessor     Accessor filling the tensor. Can be nullptr
+     * @param[in] axis         Dimension to permute
+     * @param[in] src_channels Source channel of each destination channel, indexed by the channel of the whole group set
+     * @param[in] group_axis   (Optional) Dimension selecting the group of an element if the permuted dimension only holds one group
+     * @param[in] num_groups   (Optional) Number of groups along @p group_axis. Defaults to 1
+     */
+    ChannelPermutationAccessor(std::unique_ptr<ITensorAccessor> accessor, size_t axis, std::vector<unsigned int> src_channels, size_t group_axis = 0, unsigned int num_groups = 1)
+        : _accessor(std::move(accessor)), _axis(axis), _src_channels(std::move(src_channels)), _group_axis(group_axis), _num_groups(num_groups)
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        const bool ret = (_accessor == nullptr) || _accessor->access_tensor(tensor);
+
+        const size_t element_size       = tensor.info()->element_size();
+        const size_t channels_per_group = tensor.info()->dimension(_axis);
+        const size_t elements_per_group = (_num_groups > 1) ? tensor.info()->dimension(_group_axis) / _num_groups : 1;
+
+        Window window;
+        window.use_tensor_dimensions(tensor.info()->tensor_shape());
+
+        // Gather the permuted tensor: the channels of a group are only permuted within the group
+        std::vector<uint8_t> permuted(tensor.info()->tensor_shape().total_size() * element_size);
+        uint8_t             *permuted_ptr = permuted.data();
+        execute_window_loop(window, [&](const Coordinates & id)
+        {
+            const size_t offset = (_num_groups > 1) ? (id[_group_axis] / elements_per_group) * channels_per_group : 0;
+            Coordinates  src_id(id);
+            src_id.set(_axis, _src_channels[offset + id[_axis]] - offset);
+            std::memcpy(permuted_ptr, tensor.ptr_to_element(src_id), element_size);
+            permuted_ptr += element_size;
+        });
+
+        // Write it back in place
+        permuted_ptr = permuted.data();
+        execute_window_loop(window, [&](const Coordinates & id)
+        {
+            std::memcpy(tensor.ptr_to_element(id), permuted_ptr, element_size);
+            permuted_ptr += element_size;
+        });
+
+        return ret;
+    }
+
+    std::string source() const override
+    {
+        const std::string src = (_accessor != nullptr) ? _accessor->source() : "";
+        if(src.empty())
+        {
+            return src;
+        }
+
+        // The permutation itself is part of the key: graphs folding different shuffles, or folding them on different sides, permute the same data differently
+        std::stringstream ss;
+        ss << src << "|channel_permutation(" << _axis << "," << _group_axis << "," << _num_groups << "," << _src_channels.size() << "," << std::hex << permutation_hash() << ")";
+        return ss.str();
+    }
+
+private:
+    /** FNV-1a hash of the source channels
+     *
+     * @return The hash of the permutation
+     */
+    uint64_t permutation_hash() const
+    {
+        uint64_t hash = 14695981039346656037ULL;
+        for(const auto &c : _src_channels)
+        {
+            hash = (hash ^ c) * 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    std::unique_ptr<ITensorAccessor> _accessor;
+    size_t                           _axis;
+    std::vector<unsigned int>        _src_channels;
+    size_t                           _group_axis;
+    unsigned int                     _num_groups;
+};
+
+/** Source channel of each destination channel of a channel shuffle
+ *
+ * @note The inverse of a shuffle of @p num_groups groups is a shuffle of @p channels / @p num_groups groups.
+ *
+ * @param[in] channels   Number of channels
+ * @param[in] num_groups Number of groups of the shuffle
+ *
+ * @return The source channels: channel k * num_groups + g is taken from channel g * channels / num_groups + k
+ */
+std::vector<unsigned int> shuffle_permutation(unsigned int channels, unsigned int num_groups)
+{
+    const unsigned int        channels_in_group = channels / num_groups;
+    std::vector<unsigned int> src_channels(channels);
+    for(unsigned int c = 0; c < channels; ++c)
+    {
+        src_channels[c] = (c % num_groups) * channels_in_group + c / num_groups;
+    }
+    return src_channels;
+}
+
+/** Checks if a permutation keeps every channel in its group
+ *
+ * @param[in] src_channels Source channel of each destination channel
+ * @param[in] num_groups   Number of groups
+ *
+ * @return True if every channel is taken from a channel of the same group
+ */
+bool preserves_groups(const std::vector<unsigned int> &src_channels, unsigned int num_groups)
+{
+    const size_t channels_in_group = src_channels.size() / num_groups;
+    for(size_t c = 0; c < src_channels.size(); ++c)
+    {
+        if(c / channels_in_group != src_channels[c] / channels_in_group)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Returns the tensor produced by a constant node used only by the given input of a node
+ *
+ * @param[in] node Node to check
+ * @param[in] idx  Input index
+ *
+ * @return The constant tensor if not shared, else nullptr
+ */
+Tensor *get_exclusive_const_input(const INode &node, size_t idx)
+{
+    const Edge *edge = node.input_edge(idx);
+    if(edge == nullptr || edge->producer() == nullptr || edge->producer()->type() != NodeType::Const || edge->producer()->output_edges().size() != 1)
+    {
+        return nullptr;
+    }
+    return edge->tensor();
+}
+
+/** Checks if the optional inputs of a node are exclusive constants
+ *
+ * @param[in] node  Node to check
+ * @param[in] first First input to check
+ * @param[in] last  Last input to check
+ *
+ * @return True if every connected input in [first, last] is an exclusive constant
+ */
+bool has_exclusive_const_inputs(const INode &node, size_t first, size_t last)
+{
+    for(size_t idx = first; idx <= last; ++idx)
+    {
+        if(node.input_edge(idx) != nullptr && get_exclusive_const_input(node, idx) == nullptr)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Checks if a node only reads its output from a single consumer, so that the channels of the output can be permuted
+ *
+ * @param[in] node Node to check
+ *
+ * @return True if the output of the node has a single consumer and no accessor
+ */
+bool has_single_consumer(const INode &node)
+{
+    return node.output_edges().size() == 1 && node.output(0) != nullptr && node.output(0)->accessor() == nullptr;
+}
+
+/** Checks if a node processes each channel independently with exclusive constant parameters, so that a channel permutation commutes with it
+ *
+ * @param[in] node Node to check
+ *
+ * @return True if the node is a batch normalization, an activation or a depthwise convolution that a permutation can be moved across
+ */
+bool is_per_channel_node(const INode *node)
+{
+    if(node == nullptr)
+    {
+        return false;
+    }
+
+    switch(node->type())
+    {
+        case NodeType::ActivationLayer:
+            return true;
+        case NodeType::BatchNormalizationLayer:
+            return has_exclusive_const_inputs(*node, 1, 4);
+        case NodeType::DepthwiseConvolutionLayer:
+            return (get_exclusive_const_input(*node, 1) != nullptr) && has_exclusive_const_inputs(*node, 2, 2);
+        default:
+            return false;
+    }
+}
+
+/** Checks if the channels of a convolution can be permuted by permuting its constant weights and biases
+ *
+ * @param[in] node         Node to check
+ * @param[in] src_channels Permutation of the channels
+ *
+ * @return True if the node is a convolution with exclusive constant weights and biases whose groups are preserved by the permutation
+ */
+bool is_permutable_convolution(const INode *node, const std::vector<unsigned int> &src_channels)
+{
+    if(node == nullptr || node->type() != NodeType::ConvolutionLayer)
+    {
+        return false;
+    }
+
+    // Permuting the channels of a grouped convolution must not move a channel to another group
+    const auto *conv_node = arm_compute::utils::cast::polymorphic_downcast<const ConvolutionLayerNode *>(node);
+    if(conv_node->num_groups() != 1 && !preserves_groups(src_channels, conv_node->num_groups()))
+    {
+        return false;
+    }
+
+    return (get_exclusive_const_input(*node, 1) != nullptr) && has_exclusive_const_inputs(*node, 2, 2);
+}
+
+/** Permutes a constant tensor once it has been loaded
+ *
+ * @param[in] tensor       Constant tensor to permute
+ * @param[in] axis         Dimension to permute
+ * @param[in] src_channels Source channel of each destination channel
+ * @param[in] group_axis   (Optional) Dimension selecting the group of an element if @p axis only holds one group
+ * @param[in] num_groups   (Optional) Number of groups along @p group_axis. Defaults to 1
+ */
+void permute_const_tensor(Tensor *tensor, size_t axis, const std::vector<unsigned int> &src_channels, size_t group_axis = 0, unsigned int num_groups = 1)
+{
+    tensor->set_accessor(support::cpp14::make_unique<ChannelPermutationAccessor>(tensor->extract_accessor(), axis, src_channels, group_axis, num_groups));
+}
+
+/** Permutes the per channel parameters of a node so that it can process permuted channels
+ *
+ * @param[in] node         Node checked by @ref is_per_channel_node
+ * @param[in] src_channels Source channel of each destination channel
+ */
+void permute_per_channel_node(INode *node, const std::vector<unsigned int> &src_channels)
+{
+    switch(node->type())
+    {
+        case NodeType::BatchNormalizationLayer:
+            for(size_t idx = 1; idx <= 4; ++idx)
+            {
+                if(node->input_edge(idx) != nullptr)
+                {
+                    permute_const_tensor(node->input(idx), 0, src_channels);
+                }
+            }
+            break;
+        case NodeType::DepthwiseConvolutionLayer:
+            permute_const_tensor(node->input(1), get_dimension_idx(node->input(1)->desc(), DataLayoutDimension::CHANNEL), src_channels);
+            if(node->input_edge(2) != nullptr)
+            {
+                permute_const_tensor(node->input(2), 0, src_channels);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+bool fold_into_consumers(Graph &g, ChannelShuffleLayerNode *shuffle_node)
+{
+    const Edge *input_edge = shuffle_node->input_edge(0);
+    if(shuffle_node->output_edges().empty() || input_edge == nullptr || shuffle_node->output(0)->accessor() != nullptr)
+    {
+        return false;
+    }
+
+    // Once the shuffle is removed the consumers read channel i from channel dst(i): this is the inverse shuffle, a shuffle with channels / num_groups groups
+    const unsigned int              channels     = get_dimension_size(shuffle_node->output(0)->desc(), DataLayoutDimension::CHANNEL);
+    const std::vector<unsigned int> src_channels = shuffle_permutation(channels, channels / shuffle_node->num_groups());
+
+    // Every consumer must reach a convolution able to absorb the permutation, possibly through per channel nodes
+    std::vector<std::vector<INode *>> paths;
+    for(const auto &edge_id : shuffle_node->output_edges())
+    {
+        const Edge *edge = g.edge(edge_id);
+        if(edge == nullptr || edge->consumer_idx() != 0)
+        {
+            return false;
+        }
+
+        std::vector<INode *> path;
+        INode               *node = edge->consumer();
+        while(is_per_channel_node(node) && has_single_consumer(*node))
+        {
+            path.push_back(node);
+
+            const Edge *next_edge = g.edge(*node->output_edges().begin());
+            if(next_edge == nullptr || next_edge->consumer_idx() != 0)
+            {
+                return false;
+            }
+            node = next_edge->consumer();
+        }
+
+        if(!is_permutable_convolution(node, src_channels))
+        {
+            return false;
+        }
+        path.push_back(node);
+        paths.push_back(std::move(path));
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Folding Channel Shuffle node with ID : " << shuffle_node->id() << " into its consumers" << std::endl);
+
+    for(const auto &path : paths)
+    {
+        for(size_t i = 0; i + 1 < path.size(); ++i)
+        {
+            permute_per_channel_node(path[i], src_channels);
+        }
+
+        // Permute the input channels of the convolution, within each group for a grouped convolution
+        auto         *conv_node  = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(path.back());
+        Tensor       *weights    = conv_node->input(1);
+        const size_t  axis       = get_dimension_idx(weights->desc(), DataLayoutDimension::CHANNEL);
+        const size_t  group_axis = get_dimension_idx(weights->desc(), DataLayoutDimension::BATCHES);
+        permute_const_tensor(weights, axis, src_channels, group_axis, conv_node->num_groups());
+    }
+
+    // Bypass the shuffle
+    const NodeID                   producer_id  = input_edge->producer_id();
+    const unsigned int             producer_idx = input_edge->producer_idx();
+    const std::vector<NodeIdxPair> consumers    = get_driving_nodes(*shuffle_node);
+
+    g.remove_node(shuffle_node->id());
+    for(const auto &consumer : consumers)
+    {
+        g.add_connection(producer_id, producer_idx, consumer.node_id, consumer.index);
+    }
+
+    return true;
+}
+
+bool fold_into_producer(Graph &g, ChannelShuffleLayerNode *shuffle_node)
+{
+    // Output channel o of the producer must now compute the original channel src(o)
+    const unsigned int              channels     = get_dimension_size(shuffle_node->output(0)->desc(), DataLayoutDimension::CHANNEL);
+    const std::vector<unsigned int> src_channels = shuffle_permutation(channels, shuffle_node->num_groups());
+
+    // Walk up to a convolution able to absorb the permutation, possibly through per channel nodes only read by the next node
+    std::vector<INode *> path;
+    const Edge          *edge = shuffle_node->input_edge(0);
+    while(edge != nullptr && edge->producer_idx() == 0 && is_per_channel_node(edge->producer()) && has_single_consumer(*edge->producer()))
+    {
+        path.push_back(edge->producer());
+        edge = edge->producer()->input_edge(0);
+    }
+
+    if(edge == nullptr || edge->producer_idx() != 0 || !is_permutable_convolution(edge->producer(), src_channels) || !has_single_consumer(*edge->producer()))
+    {
+        return false;
+    }
+
+    INode *conv_node = edge->producer();
+    INode *last_node = path.empty() ? conv_node : path.front();
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Folding Channel Shuffle node with ID : " << shuffle_node->id() << " into Convolution node with ID : " << conv_node->id() << std::endl);
+
+    permute_const_tensor(conv_node->input(1), get_dimension_idx(conv_node->input(1)->desc(), DataLayoutDimension::BATCHES), src_channels);
+    if(conv_node->input_edge(2) != nullptr)
+    {
+        permute_const_tensor(conv_node->input(2), 0, src_channels);
+    }
+    for(auto *node : path)
+    {
+        permute_per_channel_node(node, src_channels);
+    }
+
+    // Move the shuffle consumers and accessor to the last node before the shuffle
+    std::vector<NodeIdxPair> consumers        = get_driving_nodes(*shuffle_node);
+    auto                     shuffle_accessor = shuffle_node->output(0)->extract_accessor();
+
+    g.remove_node(shuffle_node->id());
+    for(const auto &consumer : consumers)
+    {
+        g.add_connection(last_node->id(), 0, consumer.node_id, consumer.index);
+    }
+    last_node->output(0)->set_accessor(std::move(shuffle_accessor));
+
+    return true;
+}
+} // namespace
+
+namespace detail
+{
+void fold_channel_shuffle_into_convolution(Graph &g)
+{
+    // Not interested in the order of nodes
+    for(auto &node : g.nodes())
+    {
+        if(node && node->type() == NodeType::ChannelShuffleLayer)
+        {
+            auto *shuffle_node = arm_compute::utils::cast::polymorphic_downcast<ChannelShuffleLayerNode *>(node.get());
+            if(!fold_into_consumers(g, shuffle_node) && !fold_into_producer(g, shuffle_node))
+            {
+                ARM_COMPUTE_LOG_GRAPH_VERBOSE("Channel Shuffle node with ID : " << shuffle_node->id() << " could not be folded" << std::endl);
+            }
+        }
+    }
+}
+} // namespace detail
+
+const char *ChannelShuffleFusionMutator::name()
+{
+    return "ChannelShuffleFusionMutator";
+}
+
+void ChannelShuffleFusionMutator::mutate(Graph &g)
+{
+    detail::fold_channel_shuffle_into_convolution(g);
+}
+} // namespace graph
+} // namespace arm_compute
@@ -179,7 +179,9 @@ void CLHarrisCorners::run()
 
     // Run corner candidate kernel
     _nonmax.map(true);
+    _candidates.reset(Scheduler::get().num_threads());
     Scheduler::get().schedule(&_candidates, Window::DimY);
+    _candidates.merge();
     _nonmax.unmap();
 
     _corners->map(CLScheduler::get().queue(), true);
@@ -28,6 +28,7 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/runtime/CPUUtils.h"
+#include "arm_compute/runtime/SchedulerTracer.h"
 
 #include <atomic>
 #include <condition_variable>
@@ -277,11 +278,22 @@ void CPPScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
         return;
     }
 
+    SchedulerTracer   &tracer = SchedulerTracer::get();
+    const bool         traced = tracer.is_enabled();
+    const std::string &label  = SchedulerTracer::label();
+
     if(!kernel->is_parallelisable() || num_threads == 1)
     {
         ThreadInfo info;
         info.cpu_info = &_cpu_info;
-        kernel->run(max_window, info);
+        if(traced)
+        {
+            tracer.run(kernel, max_window, info, label, 0, 1);
+        }
+        else
+        {
+            kernel->run(max_window, info);
+        }
     }
     else
     {
@@ -304,12 +316,19 @@ void CPPScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
         std::vector<IScheduler::Workload> workloads(num_windows);
         for(unsigned int t = 0; t < num_windows; t++)
         {
-            //Capture 't' by copy, all the other variables by reference:
-            workloads[t] = [t, &hints, &max_window, &num_windows, &kernel](const ThreadInfo & info)
+            //Capture 't' and 'traced' by copy, all the other variables by reference:
+            workloads[t] = [t, traced, &hints, &max_window, &num_windows, &kernel, &tracer, &label](const ThreadInfo & info)
             {
                 Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
                 win.validate();
-                kernel->run(win, info);
+                if(traced)
+                {
+                    tracer.run(kernel, win, info, label, t, num_windows);
+                }
+                else
+                {
+                    kernel->run(win, info);
+                }
             };
         }
         run_workloads(workloads);
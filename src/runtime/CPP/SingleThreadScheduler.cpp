@@ -26,6 +26,7 @@
 #include "arm_compute/core/CPP/ICPPKernel.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Utils.h"
+#include "arm_compute/runtime/SchedulerTracer.h"
 
 namespace arm_compute
 {
@@ -46,7 +47,15 @@ void SingleThreadScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
     ARM_COMPUTE_UNUSED(hints);
     ThreadInfo info;
     info.cpu_info = &_cpu_info;
-    kernel->run(kernel->window(), info);
+    SchedulerTracer &tracer = SchedulerTracer::get();
+    if(tracer.is_enabled())
+    {
+        tracer.run(kernel, kernel->window(), info, SchedulerTracer::label(), 0, 1);
+    }
+    else
+    {
+        kernel->run(kernel->window(), info);
+    }
 }
 
 void SingleThreadScheduler::run_workloads(std::vector<Workload> &workloads)
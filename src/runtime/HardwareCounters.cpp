@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/HardwareCounters.h"
+
+#include "arm_compute/core/Error.h"
+
+#if defined(__linux__)
+#include <asm/unistd.h>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* defined(__linux__) */
+
+namespace arm_compute
+{
+namespace
+{
+#if defined(__linux__)
+/** Group of perf_event counters measuring the thread which opened it */
+class ThreadCounters
+{
+public:
+    ThreadCounters()
+        : _fds(), _index(), _num_opened(0), _available(false)
+    {
+        _fds.fill(-1);
+        _index.fill(-1);
+
+        const std::array<std::pair<uint32_t, uint64_t>, HardwareCounters::num_counters> configs =
+        {
+            {
+                { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+                { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+                { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+                { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+                { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+            }
+        };
+
+        for(size_t i = 0; i < configs.size(); ++i)
+        {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.type           = configs[i].first;
+            attr.size           = sizeof(perf_event_attr);
+            attr.config         = configs[i].second;
+            attr.read_format    = PERF_FORMAT_GROUP;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+            // The leader starts disabled and enables the whole group once all the counters are opened
+            attr.disabled = (_fds[0] == -1) ? 1 : 0;
+
+            // Measure the calling thread on any CPU
+            const int fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, _fds[0], 0));
+            if(fd < 0)
+            {
+                if(i == 0)
+                {
+                    // Without cycle counter there is no group leader
+                    return;
+                }
+                continue;
+            }
+            _fds[i]   = fd;
+            _index[i] = _num_opened++;
+        }
+
+        _available = ioctl(_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) != -1;
+    }
+
+    ~ThreadCounters()
+    {
+        for(auto fd : _fds)
+        {
+            if(fd != -1)
+            {
+                ::close(fd);
+            }
+        }
+    }
+
+    bool read(HardwareCounters::Values &values) const
+    {
+        if(!_available)
+        {
+            return false;
+        }
+
+        // Layout of a group read: number of counters followed by the values in the order they were opened
+        std::array<uint64_t, HardwareCounters::num_counters + 1> buffer{ {} };
+        if(::read(_fds[0], buffer.data(), sizeof(buffer)) < static_cast<ssize_t>((_num_opened + 1) * sizeof(uint64_t)))
+        {
+            return false;
+        }
+
+        for(size_t i = 0; i < values.size(); ++i)
+        {
+            values[i] = (_index[i] >= 0) ? buffer[_index[i] + 1] : 0;
+        }
+        return true;
+    }
+
+private:
+    std::array<int, HardwareCounters::num_counters> _fds;
+    std::array<int, HardwareCounters::num_counters> _index;
+    int                                             _num_opened;
+    bool                                            _available;
+};
+#endif /* defined(__linux__) */
+} // namespace
+
+bool HardwareCounters::read(Values &values)
+{
+#if defined(__linux__)
+    static thread_local ThreadCounters counters;
+    return counters.read(values);
+#else  /* defined(__linux__) */
+    values.fill(0);
+    return false;
+#endif /* defined(__linux__) */
+}
+
+const char *HardwareCounters::name(Counter counter)
+{
+    switch(counter)
+    {
+        case Counter::CYCLES:
+            return "cycles";
+        case Counter::INSTRUCTIONS:
+            return "instructions";
+        case Counter::L1D_MISSES:
+            return "l1d_misses";
+        case Counter::LLC_MISSES:
+            return "llc_misses";
+        case Counter::BRANCH_MISSES:
+            return "branch_misses";
+        default:
+            ARM_COMPUTE_ERROR("Unknown counter");
+    }
+}
+} // namespace arm_compute
@@ -26,7 +26,6 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/NEON/kernels/NECannyEdgeKernel.h"
-#include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
@@ -36,7 +35,6 @@
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "support/ToolchainSupport.h"
 
-#include <cstring>
 #include <utility>
 
 using namespace arm_compute;
@@ -44,17 +42,13 @@ using namespace arm_compute;
 NECannyEdge::NECannyEdge(std::shared_ptr<IMemoryManager> memory_manager) // NOLINT
     : _memory_group(std::move(memory_manager)),
       _sobel(),
-      _gradient(),
-      _non_max_suppr(),
-      _edge_trace(),
-      _border_mag_gradient(),
-      _border_edge_trace(),
+      _gradient_non_max_suppr(),
+      _edge_label(),
+      _edge_hysteresis(),
       _gx(),
       _gy(),
-      _magnitude(),
-      _phase(),
       _nonmax(),
-      _output(nullptr)
+      _labels()
 {
 }
 
@@ -68,31 +62,23 @@ void NECannyEdge::configure(ITensor *input, ITensor *output, int32_t upper_thr,
     ARM_COMPUTE_ERROR_ON((gradient_size != 3) && (gradient_size != 5) && (gradient_size != 7));
     ARM_COMPUTE_ERROR_ON((lower_thr < 0) || (lower_thr >= upper_thr));
 
-    _output = output;
-
     const TensorShape &shape = input->info()->tensor_shape();
     TensorInfo         gradient_info;
-    TensorInfo         magnitude_info;
 
     // Initialize images
     if(gradient_size < 7)
     {
         gradient_info.init(shape, Format::S16);
-        magnitude_info.init(shape, Format::U16);
     }
     else
     {
         gradient_info.init(shape, Format::S32);
-        magnitude_info.init(shape, Format::U32);
     }
 
     _gx.allocator()->init(gradient_info);
     _gy.allocator()->init(gradient_info);
-    _magnitude.allocator()->init(magnitude_info);
-
-    TensorInfo info(shape, Format::U8);
-    _phase.allocator()->init(info);
-    _nonmax.allocator()->init(info);
+    _nonmax.allocator()->init(TensorInfo(shape, Format::U8));
+    _labels.allocator()->init(TensorInfo(shape, Format::S32));
 
     // Manage intermediate buffers
     _memory_group.manage(&_gx);
@@ -123,49 +109,25 @@ void NECannyEdge::configure(ITensor *input, ITensor *output, int32_t upper_thr,
     }
 
     // Manage intermediate buffers
-    _memory_group.manage(&_magnitude);
-    _memory_group.manage(&_phase);
+    _memory_group.manage(&_nonmax);
 
-    // Configure gradient
-    if(use_fp16)
-    {
-        auto k = arm_compute::support::cpp14::make_unique<NEGradientFP16Kernel>();
-        k->configure(&_gx, &_gy, &_magnitude, &_phase, norm_type);
-        _gradient = std::move(k);
-    }
-    else
-    {
-        auto k = arm_compute::support::cpp14::make_unique<NEGradientKernel>();
-        k->configure(&_gx, &_gy, &_magnitude, &_phase, norm_type);
-        _gradient = std::move(k);
-    }
+    // Configure gradient and non-maxima suppression. The magnitude border is handled by the kernel.
+    _gradient_non_max_suppr.configure(&_gx, &_gy, &_nonmax, upper_thr, lower_thr, norm_type, border_mode, constant_border_value, use_fp16);
 
     // Allocate intermediate tensors
     _gx.allocator()->allocate();
     _gy.allocator()->allocate();
 
     // Manage intermediate buffers
-    _memory_group.manage(&_nonmax);
+    _memory_group.manage(&_labels);
 
-    // Configure non-maxima suppression
-    _non_max_suppr.configure(&_magnitude, &_phase, &_nonmax, upper_thr, lower_thr, border_mode == BorderMode::UNDEFINED);
-
-    // Fill border around magnitude image as non-maxima suppression will access
-    // it. If border mode is undefined filling the border is a nop.
-    _border_mag_gradient.configure(&_magnitude, _non_max_suppr.border_size(), border_mode, constant_border_value);
-
-    // Allocate intermediate tensors
-    _phase.allocator()->allocate();
-    _magnitude.allocator()->allocate();
-
-    // Configure edge tracing
-    _edge_trace.configure(&_nonmax, output);
-
-    // Fill border with "No edge" to stop recursion in edge trace
-    _border_edge_trace.configure(&_nonmax, _edge_trace.border_size(), BorderMode::CONSTANT, static_cast<float>(0.f));
+    // Configure hysteresis
+    _edge_label.configure(&_nonmax, &_labels);
+    _edge_hysteresis.configure(&_nonmax, &_labels, output);
 
     // Allocate intermediate tensors
     _nonmax.allocator()->allocate();
+    _labels.allocator()->allocate();
 }
 
 void NECannyEdge::run()
@@ -177,23 +139,16 @@ void NECannyEdge::run()
     // Run sobelNxN
     _sobel->run();
 
-    // Run gradient
-    NEScheduler::get().schedule(_gradient.get(), Window::DimY);
-
-    // Fill border before non-maxima suppression. Nop for border mode undefined.
-    NEScheduler::get().schedule(&_border_mag_gradient, Window::DimZ);
-
-    // Run non-maxima suppression
-    NEScheduler::get().schedule(&_non_max_suppr, Window::DimY);
-
-    ARM_COMPUTE_ERROR_ON(_output->buffer() == nullptr);
-    std::fill_n(_output->buffer(), _output->info()->total_size(), 0);
+    // Run gradient and non-maxima suppression
+    NEScheduler::get().schedule(&_gradient_non_max_suppr, Window::DimY);
 
-    // Fill border before edge trace
-    NEScheduler::get().schedule(&_border_edge_trace, Window::DimZ);
+    // Label the candidate edges of each thread, then join the labels across threads
+    _edge_label.reset(NEScheduler::get().num_threads());
+    NEScheduler::get().schedule(&_edge_label, Window::DimY);
+    _edge_label.merge();
 
-    // Run edge tracing
-    NEScheduler::get().schedule(&_edge_trace, Window::DimY);
+    // Run hysteresis
+    NEScheduler::get().schedule(&_edge_hysteresis, Window::DimY);
 
     _memory_group.release();
 }
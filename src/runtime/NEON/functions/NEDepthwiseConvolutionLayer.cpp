@@ -29,6 +29,7 @@
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Utils.h"
 #include "support/ToolchainSupport.h"
 
 using namespace arm_compute;
@@ -37,7 +38,7 @@ using namespace arm_compute::misc::shape_calculator;
 
 NEDepthwiseConvolutionLayer3x3::NEDepthwiseConvolutionLayer3x3()
     : _dwc_kernel(), _output_stage_kernel(), _border_handler(), _permute_input(), _permute_weights(), _permute_output(), _accumulator(), _permuted_input(), _permuted_weights(), _permuted_output(),
-      _has_bias(false), _is_quantized(false), _is_optimized(false), _are_weights_reshaped(false), _is_nchw(true), _is_first_run(true), _permute(false)
+      _cost(), _has_bias(false), _is_quantized(false), _is_optimized(false), _are_weights_reshaped(false), _is_nchw(true), _is_first_run(true), _permute(false)
 {
 }
 
@@ -157,6 +158,9 @@ void NEDepthwiseConvolutionLayer3x3::configure(ITensor *input, const ITensor *we
         _permute_output.configure(&_permuted_output, output, PermutationVector(2U, 0U, 1U));
         _permuted_output.allocator()->allocate();
     }
+
+    // Each output element accumulates a 3x3 window of a single input channel, plus the bias
+    _cost = compute_workload_cost(2 * 9 + (_has_bias ? 1 : 0), output->info(), { input->info(), weights->info(), _has_bias ? biases->info() : nullptr });
 }
 
 Status NEDepthwiseConvolutionLayer3x3::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
@@ -224,14 +228,20 @@ void NEDepthwiseConvolutionLayer3x3::run()
     }
 }
 
+WorkloadCost NEDepthwiseConvolutionLayer3x3::cost() const
+{
+    return _cost;
+}
+
 NEDepthwiseConvolutionLayer::NEDepthwiseConvolutionLayer()
-    : _im2col_kernel(), _weights_reshape_kernel(), _v2mm_kernel(), _vector_to_tensor_kernel(), _output_stage_kernel(), _v2mm_input_fill_border(), _v2mm_weights_fill_border(), _permute_input(),
-      _permute_weights(), _permute_output(), _input_reshaped(), _weights_reshaped(), _v2mm_output(), _output_reshaped(), _permuted_input(), _permuted_weights(), _permuted_output(), _is_prepared(false),
-      _is_quantized(false), _is_nhwc(false), _original_weights(nullptr)
+    : _im2col_kernel(), _weights_reshape_kernel(), _v2mm_kernel(), _vector_to_tensor_kernel(), _output_stage_kernel(), _native_kernel(), _v2mm_input_fill_border(), _v2mm_weights_fill_border(),
+      _permute_input(), _permute_weights(), _permute_output(), _input_reshaped(), _weights_reshaped(), _v2mm_output(), _output_reshaped(), _permuted_input(), _permuted_weights(), _permuted_output(),
+      _cost(), _is_prepared(false), _is_quantized(false), _is_nhwc(false), _use_native(false), _original_weights(nullptr)
 {
 }
 
-void NEDepthwiseConvolutionLayer::configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, unsigned int depth_multiplier)
+void NEDepthwiseConvolutionLayer::configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, unsigned int depth_multiplier,
+                                            const Size2D &dilation)
 {
     const unsigned int channel_idx = get_data_layout_dimension_index(input->info()->data_layout(), DataLayoutDimension::CHANNEL);
     ARM_COMPUTE_UNUSED(channel_idx);
@@ -240,80 +250,103 @@ void NEDepthwiseConvolutionLayer::configure(ITensor *input, const ITensor *weigh
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
     ARM_COMPUTE_ERROR_ON((input->info()->dimension(channel_idx) * depth_multiplier) != weights->info()->dimension(channel_idx));
 
-    _is_nhwc = input->info()->data_layout() == DataLayout::NHWC;
-
-    ITensor       *input_to_use   = input;
-    const ITensor *weights_to_use = weights;
-    ITensor       *output_to_use  = output;
-
-    if(_is_nhwc)
-    {
-        _permute_input.configure(input, &_permuted_input, PermutationVector(1U, 2U, 0U));
-        _permuted_input.info()->set_data_layout(DataLayout::NCHW);
-        input_to_use = &_permuted_input;
-
-        _permute_weights.configure(weights, &_permuted_weights, PermutationVector(1U, 2U, 0U));
-        _permuted_weights.info()->set_data_layout(DataLayout::NCHW);
-        weights_to_use = &_permuted_weights;
-    }
-
-    const size_t weights_w = weights_to_use->info()->dimension(0);
-    const size_t weights_h = weights_to_use->info()->dimension(1);
-    const size_t weights_z = weights_to_use->info()->dimension(2);
-
+    _is_nhwc          = input->info()->data_layout() == DataLayout::NHWC;
+    _use_native       = is_native_execution_possible(input->info()->data_layout(), dilation);
     _is_quantized     = is_data_type_quantized_asymmetric(input->info()->data_type());
     _is_prepared      = false;
-    _original_weights = weights_to_use;
-
-    // Should bias be appended ?
-    bool append_bias = (biases != nullptr) && !_is_quantized;
+    _original_weights = weights;
 
     // Calculate output shape
-    TensorShape output_shape = shape_calculator::compute_depthwise_convolution_shape(*input->info(), *weights->info(), conv_info, depth_multiplier);
+    TensorShape output_shape = shape_calculator::compute_depthwise_convolution_shape(*input->info(), *weights->info(), conv_info, depth_multiplier, dilation);
 
     // Output auto inizialitation if not yet initialized
     auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(output_shape));
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DIMENSIONS(output->info()->tensor_shape(), output_shape);
 
+    if(_use_native)
+    {
+        configure_native(input, weights, biases, output, conv_info, depth_multiplier, dilation);
+    }
+    else
+    {
+        configure_generic(input, weights, biases, output, conv_info, depth_multiplier);
+    }
+
+    // Each output element accumulates a kernel_width x kernel_height window of a single input channel, plus the bias
+    const DataLayout data_layout     = input->info()->data_layout();
+    const uint64_t   macs_per_output = static_cast<uint64_t>(weights->info()->dimension(get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH)))
+                                       * weights->info()->dimension(get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT));
+    _cost = compute_workload_cost(2 * macs_per_output + (biases != nullptr ? 1 : 0), output->info(), { input->info(), weights->info(), biases != nullptr ? biases->info() : nullptr });
+}
+
+void NEDepthwiseConvolutionLayer::configure_native(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, unsigned int depth_multiplier,
+                                                   const Size2D &dilation)
+{
     if(_is_nhwc)
     {
-        permute(output_shape, PermutationVector(1U, 2U, 0U));
-        _permuted_output.allocator()->init(output->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(output_shape));
-        _permuted_output.info()->set_data_layout(DataLayout::NCHW);
-        output_to_use = &_permuted_output;
+        _native_kernel.configure(input, weights, biases, output, conv_info, depth_multiplier, dilation);
+        return;
     }
 
+    // The native kernel works on NHWC: permute the NCHW tensors around it
+    _permute_input.configure(input, &_permuted_input, PermutationVector(2U, 0U, 1U));
+    _permuted_input.info()->set_data_layout(DataLayout::NHWC);
+
+    _permute_weights.configure(weights, &_permuted_weights, PermutationVector(2U, 0U, 1U));
+    _permuted_weights.info()->set_data_layout(DataLayout::NHWC);
+
+    TensorShape output_shape = output->info()->tensor_shape();
+    permute(output_shape, PermutationVector(2U, 0U, 1U));
+    _permuted_output.allocator()->init(output->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(output_shape).set_data_layout(DataLayout::NHWC));
+
+    _native_kernel.configure(&_permuted_input, &_permuted_weights, biases, &_permuted_output, conv_info, depth_multiplier, dilation);
+
+    _permute_output.configure(&_permuted_output, output, PermutationVector(1U, 2U, 0U));
+
+    _permuted_input.allocator()->allocate();
+    _permuted_output.allocator()->allocate();
+}
+
+void NEDepthwiseConvolutionLayer::configure_generic(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, unsigned int depth_multiplier)
+{
+    const size_t weights_w = weights->info()->dimension(0);
+    const size_t weights_h = weights->info()->dimension(1);
+    const size_t weights_z = weights->info()->dimension(2);
+
+    // Should bias be appended ?
+    bool append_bias = (biases != nullptr) && !_is_quantized;
+
     // Output width and height
-    const unsigned int conv_w = output_shape.x();
-    const unsigned int conv_h = output_shape.y();
+    const unsigned int conv_w = output->info()->tensor_shape().x();
+    const unsigned int conv_h = output->info()->tensor_shape().y();
 
     // Set up intermediate tensors
     const size_t patch_size = weights_w * weights_h + (append_bias ? 1 : 0);
     const size_t conv_size  = conv_w * conv_h;
 
     // Im2Col configuration
-    TensorShape shape_im2col = input_to_use->info()->tensor_shape();
+    TensorShape shape_im2col = input->info()->tensor_shape();
     shape_im2col.set(0, patch_size);
     shape_im2col.set(1, conv_size);
     shape_im2col.set(2, weights_z);
     _input_reshaped.allocator()->init(input->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(shape_im2col).set_data_layout(DataLayout::NCHW));
-    _im2col_kernel.configure(input_to_use, &_input_reshaped, Size2D(weights_w, weights_h), conv_info, append_bias, depth_multiplier);
+    _im2col_kernel.configure(input, &_input_reshaped, Size2D(weights_w, weights_h), conv_info, append_bias, depth_multiplier);
 
     // Weights reshape configuration
     const TensorShape shape_weights_reshape(patch_size, weights_z);
     _weights_reshaped.allocator()->init(weights->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(shape_weights_reshape).set_data_layout(DataLayout::NCHW));
-    _weights_reshape_kernel.configure(weights_to_use, &_weights_reshaped, append_bias ? biases : nullptr);
+    _weights_reshape_kernel.configure(weights, &_weights_reshaped, append_bias ? biases : nullptr);
 
     // GEMV configuration
     DataType    v2mm_dt        = (input->info()->data_type() == DataType::QASYMM8) ? DataType::S32 : input->info()->data_type();
-    TensorShape shape_v2mm_out = input_to_use->info()->tensor_shape();
+    TensorShape shape_v2mm_out = input->info()->tensor_shape();
     shape_v2mm_out.set(0, conv_size * weights_z);
     shape_v2mm_out.set(1, 1);
     shape_v2mm_out.set(2, 1);
     _v2mm_output.allocator()->init(input->info()->clone()->set_is_resizable(true).reset_padding().set_data_type(v2mm_dt).set_tensor_shape(shape_v2mm_out).set_data_layout(DataLayout::NCHW));
     _v2mm_kernel.configure(&_input_reshaped, &_weights_reshaped, &_v2mm_output);
-    _output_reshaped.allocator()->init(_v2mm_output.info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(output_shape));
-    _vector_to_tensor_kernel.configure(&_v2mm_output, (_is_quantized) ? &_output_reshaped : output_to_use, conv_w, conv_h);
+    _output_reshaped.allocator()->init(_v2mm_output.info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(output->info()->tensor_shape()));
+    _vector_to_tensor_kernel.configure(&_v2mm_output, (_is_quantized) ? &_output_reshaped : output, conv_w, conv_h);
 
     // Output staged configuration
     if(_is_quantized)
@@ -323,19 +356,10 @@ void NEDepthwiseConvolutionLayer::configure(ITensor *input, const ITensor *weigh
         float multiplier = input->info()->quantization_info().scale * weights->info()->quantization_info().scale / output_quant_info.scale;
         int   output_multiplier, output_shift;
         quantization::calculate_quantized_multiplier_less_than_one(multiplier, &output_multiplier, &output_shift);
-        _output_stage_kernel.configure(&_output_reshaped, biases, output_to_use, output_multiplier, output_shift, output_quant_info.offset);
+        _output_stage_kernel.configure(&_output_reshaped, biases, output, output_multiplier, output_shift, output_quant_info.offset);
         _output_reshaped.allocator()->allocate();
     }
 
-    if(_is_nhwc)
-    {
-        _permute_output.configure(&_permuted_output, output, PermutationVector(2U, 0U, 1U));
-
-        _permuted_input.allocator()->allocate();
-        _permuted_weights.allocator()->allocate();
-        _permuted_output.allocator()->allocate();
-    }
-
     // Fill borders on inputs
     PixelValue zero_in(static_cast<int32_t>(0));
     PixelValue zero_w(static_cast<int32_t>(0));
@@ -356,7 +380,7 @@ void NEDepthwiseConvolutionLayer::configure(ITensor *input, const ITensor *weigh
 }
 
 Status NEDepthwiseConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
-                                             unsigned int depth_multiplier)
+                                             unsigned int depth_multiplier, const Size2D &dilation)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
     ARM_COMPUTE_RETURN_ERROR_ON(input->data_layout() != DataLayout::NCHW && input->data_layout() != DataLayout::NHWC);
@@ -364,90 +388,99 @@ Status NEDepthwiseConvolutionLayer::validate(const ITensorInfo *input, const ITe
     // Clone output to use auto init
     auto output_clone = output->clone();
 
-    const ITensorInfo *input_to_use   = input;
-    const ITensorInfo *weights_to_use = weights;
-    const ITensorInfo *output_to_use  = output_clone.get();
+    TensorShape output_shape = shape_calculator::compute_depthwise_convolution_shape(*input, *weights, conv_info, depth_multiplier, dilation);
 
-    TensorShape permuted_input_shape   = input->tensor_shape();
-    TensorShape permuted_weights_shape = weights->tensor_shape();
-    TensorInfo  permuted_input;
-    TensorInfo  permuted_weights;
+    // Output auto inizialitation if not yet initialized
+    auto_init_if_empty(*output_clone, input->clone()->set_tensor_shape(output_shape));
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), output_shape);
 
-    if(input->data_layout() == DataLayout::NHWC)
+    if(is_native_execution_possible(input->data_layout(), dilation))
     {
-        permute(permuted_input_shape, PermutationVector(1U, 2U, 0U));
-        permute(permuted_weights_shape, PermutationVector(1U, 2U, 0U));
+        if(input->data_layout() == DataLayout::NHWC)
+        {
+            return NEDepthwiseConvolutionLayerNativeKernel::validate(input, weights, biases, output_clone.get(), conv_info, depth_multiplier, dilation);
+        }
+
+        TensorShape permuted_input_shape   = input->tensor_shape();
+        TensorShape permuted_weights_shape = weights->tensor_shape();
+        permute(permuted_input_shape, PermutationVector(2U, 0U, 1U));
+        permute(permuted_weights_shape, PermutationVector(2U, 0U, 1U));
+        permute(output_shape, PermutationVector(2U, 0U, 1U));
 
-        permuted_input   = TensorInfo(input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(permuted_input_shape).set_data_layout(DataLayout::NCHW));
-        permuted_weights = TensorInfo(weights->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(permuted_weights_shape).set_data_layout(DataLayout::NCHW));
+        const TensorInfo permuted_input(input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(permuted_input_shape).set_data_layout(DataLayout::NHWC));
+        const TensorInfo permuted_weights(weights->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(permuted_weights_shape).set_data_layout(DataLayout::NHWC));
+        const TensorInfo permuted_output(output_clone->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(output_shape).set_data_layout(DataLayout::NHWC));
 
-        input_to_use   = &permuted_input;
-        weights_to_use = &permuted_weights;
+        return NEDepthwiseConvolutionLayerNativeKernel::validate(&permuted_input, &permuted_weights, biases, &permuted_output, conv_info, depth_multiplier, dilation);
     }
 
     const bool         is_quantized = is_data_type_quantized_asymmetric(input->data_type());
     const bool         append_bias  = (biases != nullptr) && !is_quantized;
-    TensorShape        output_shape = shape_calculator::compute_depthwise_convolution_shape(*input, *weights, conv_info, depth_multiplier);
-    const size_t       weights_w    = weights_to_use->dimension(0);
-    const size_t       weights_h    = weights_to_use->dimension(1);
-    const size_t       weights_z    = weights_to_use->dimension(2);
+    const size_t       weights_w    = weights->dimension(0);
+    const size_t       weights_h    = weights->dimension(1);
+    const size_t       weights_z    = weights->dimension(2);
     const unsigned int conv_w       = output_shape.x();
     const unsigned int conv_h       = output_shape.y();
     const size_t       patch_size   = weights_w * weights_h + (append_bias ? 1 : 0);
     const size_t       conv_size    = conv_w * conv_h;
 
-    // Output auto inizialitation if not yet initialized
-    auto_init_if_empty(*output_clone, input->clone()->set_tensor_shape(output_shape));
-    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), output_shape);
-
-    TensorInfo permuted_output;
-    if(input->data_layout() == DataLayout::NHWC)
-    {
-        permute(output_shape, PermutationVector(1U, 2U, 0U));
-        permuted_output = TensorInfo(output_clone->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(output_shape).set_data_layout(DataLayout::NCHW));
-        output_to_use   = &permuted_output;
-    }
-
     // Im2Col configuration
-    TensorShape shape_im2col = input_to_use->tensor_shape();
+    TensorShape shape_im2col = input->tensor_shape();
     shape_im2col.set(0, patch_size);
     shape_im2col.set(1, conv_size);
     shape_im2col.set(2, weights_z);
     TensorInfo input_reshaped(input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(shape_im2col).set_data_layout(DataLayout::NCHW));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEDepthwiseIm2ColKernel::validate(input_to_use, &input_reshaped, Size2D(weights_w, weights_h), conv_info, append_bias, depth_multiplier));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEDepthwiseIm2ColKernel::validate(input, &input_reshaped, Size2D(weights_w, weights_h), conv_info, append_bias, depth_multiplier));
 
     // Weights reshape configuration
     const TensorShape shape_weights_reshape(patch_size, weights_z);
     TensorInfo        weights_reshaped(weights->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(shape_weights_reshape).set_data_layout(DataLayout::NCHW));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEDepthwiseWeightsReshapeKernel::validate(weights_to_use, &weights_reshaped, append_bias ? biases : nullptr));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEDepthwiseWeightsReshapeKernel::validate(weights, &weights_reshaped, append_bias ? biases : nullptr));
 
     // GEMV configuration
     DataType    v2mm_dt        = (input->data_type() == DataType::QASYMM8) ? DataType::S32 : input->data_type();
-    TensorShape shape_v2mm_out = input_to_use->tensor_shape();
+    TensorShape shape_v2mm_out = input->tensor_shape();
     shape_v2mm_out.set(0, conv_size * weights_z);
     shape_v2mm_out.set(1, 1);
     shape_v2mm_out.set(2, 1);
     TensorInfo v2mm_output(input->clone()->set_is_resizable(true).reset_padding().set_data_type(v2mm_dt).set_tensor_shape(shape_v2mm_out).set_data_layout(DataLayout::NCHW));
     ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMMatrixVectorMultiplyKernel::validate(&input_reshaped, &weights_reshaped, &v2mm_output));
 
-    TensorInfo output_reshaped(v2mm_output.clone()->set_is_resizable(true).reset_padding().set_tensor_shape(output_to_use->tensor_shape()));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEDepthwiseVectorToTensorKernel::validate(&v2mm_output, (is_quantized) ? &output_reshaped : output_to_use, conv_w, conv_h));
+    TensorInfo output_reshaped(v2mm_output.clone()->set_is_resizable(true).reset_padding().set_tensor_shape(output_clone->tensor_shape()));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEDepthwiseVectorToTensorKernel::validate(&v2mm_output, (is_quantized) ? &output_reshaped : output_clone.get(), conv_w, conv_h));
 
     if(is_quantized)
     {
-        ARM_COMPUTE_RETURN_ON_ERROR(NEDirectConvolutionLayerOutputStageKernel::validate(&output_reshaped, biases, output_to_use));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEDirectConvolutionLayerOutputStageKernel::validate(&output_reshaped, biases, output_clone.get()));
     }
 
     return Status{};
 }
 
+bool NEDepthwiseConvolutionLayer::is_native_execution_possible(DataLayout data_layout, const Size2D &dilation)
+{
+    // NHWC always runs natively, NCHW only when dilated as the im2col path has no dilation support
+    return (data_layout == DataLayout::NHWC) || (dilation != Size2D(1U, 1U));
+}
+
 void NEDepthwiseConvolutionLayer::run()
 {
     prepare();
 
-    if(_is_nhwc)
+    if(_use_native)
     {
-        _permute_input.run();
+        if(!_is_nhwc)
+        {
+            _permute_input.run();
+        }
+
+        NEScheduler::get().schedule(&_native_kernel, Window::DimY);
+
+        if(!_is_nhwc)
+        {
+            _permute_output.run();
+        }
+        return;
     }
 
     NEScheduler::get().schedule(&_im2col_kernel, Window::DimX);
@@ -458,11 +491,6 @@ void NEDepthwiseConvolutionLayer::run()
     {
         NEScheduler::get().schedule(&_output_stage_kernel, Window::DimX);
     }
-
-    if(_is_nhwc)
-    {
-        _permute_output.run();
-    }
 }
 
 void NEDepthwiseConvolutionLayer::prepare()
@@ -471,17 +499,30 @@ void NEDepthwiseConvolutionLayer::prepare()
     {
         ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
 
-        if(_is_nhwc)
+        if(_use_native)
         {
-            _permute_weights.run();
+            // Permute weights and mark original weights as unused
+            if(!_is_nhwc)
+            {
+                _permuted_weights.allocator()->allocate();
+                _permute_weights.run();
+                _original_weights->mark_as_unused();
+            }
+        }
+        else
+        {
+            // Run reshape and mark original weights as unused
+            _weights_reshaped.allocator()->allocate();
+            NEScheduler::get().schedule(&_weights_reshape_kernel, Window::DimX);
+            NEScheduler::get().schedule(&_v2mm_weights_fill_border, Window::DimX);
+            _original_weights->mark_as_unused();
         }
-
-        // Run reshape and mark original weights as unused
-        _weights_reshaped.allocator()->allocate();
-        NEScheduler::get().schedule(&_weights_reshape_kernel, Window::DimX);
-        NEScheduler::get().schedule(&_v2mm_weights_fill_border, Window::DimX);
-        _original_weights->mark_as_unused();
 
         _is_prepared = true;
     }
 }
+
+WorkloadCost NEDepthwiseConvolutionLayer::cost() const
+{
+    return _cost;
+}
@@ -23,36 +23,81 @@
  */
 #include "arm_compute/runtime/NEON/functions/NEDepthwiseSeparableConvolutionLayer.h"
 
+#include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/PixelValue.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "support/ToolchainSupport.h"
 
 using namespace arm_compute;
 
-NEDepthwiseSeparableConvolutionLayer::NEDepthwiseSeparableConvolutionLayer()
-    : _depthwise_conv(), _pointwise_conv()
+NEDepthwiseSeparableConvolutionLayer::NEDepthwiseSeparableConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager)
+    : _depthwise_conv(), _depthwise_act(), _pointwise_conv(std::move(memory_manager)), _fused_kernel(), _is_fused(false), _run_depthwise_act(false)
 {
 }
 
 void NEDepthwiseSeparableConvolutionLayer::configure(ITensor *input, const ITensor *depthwise_weights, const ITensor *depthwise_biases, ITensor *depthwise_out,
                                                      const ITensor *pointwise_weights, const ITensor *pointwise_biases, ITensor *output,
-                                                     const PadStrideInfo &depthwise_conv_info, const PadStrideInfo &pointwise_conv_info)
+                                                     const PadStrideInfo &depthwise_conv_info, const PadStrideInfo &pointwise_conv_info,
+                                                     const ActivationLayerInfo &depthwise_act_info, const ActivationLayerInfo &pointwise_act_info)
 {
-    _depthwise_conv.configure(input, depthwise_weights, depthwise_biases, depthwise_out, depthwise_conv_info);
-    _pointwise_conv.configure(depthwise_out, pointwise_weights, pointwise_biases, output, pointwise_conv_info);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, depthwise_weights, depthwise_out, pointwise_weights, output);
+
+    // Depthwise output auto inizialitation if not yet initialized
+    const TensorShape depthwise_out_shape = misc::shape_calculator::compute_depthwise_convolution_shape(*input->info(), *depthwise_weights->info(), depthwise_conv_info, 1);
+    auto_init_if_empty(*depthwise_out->info(), input->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(depthwise_out_shape));
+
+    const bool is_pointwise_fusable = (pointwise_conv_info.stride() == std::make_pair(1U, 1U)) && !pointwise_conv_info.has_padding();
+
+    _is_fused = is_pointwise_fusable && bool(NEDepthwiseSeparableConvolutionLayerKernel::validate(input->info(), depthwise_weights->info(),
+                                                                                                  (depthwise_biases != nullptr) ? depthwise_biases->info() : nullptr,
+                                                                                                  pointwise_weights->info(), (pointwise_biases != nullptr) ? pointwise_biases->info() : nullptr,
+                                                                                                  output->info(), depthwise_conv_info,
+                                                                                                  depthwise_act_info, pointwise_act_info));
+
+    if(_is_fused)
+    {
+        _fused_kernel.configure(input, depthwise_weights, depthwise_biases, pointwise_weights, pointwise_biases, output, depthwise_conv_info,
+                                depthwise_act_info, pointwise_act_info);
+    }
+    else
+    {
+        _depthwise_conv.configure(input, depthwise_weights, depthwise_biases, depthwise_out, depthwise_conv_info);
+
+        _run_depthwise_act = depthwise_act_info.enabled();
+        if(_run_depthwise_act)
+        {
+            _depthwise_act.configure(depthwise_out, nullptr, depthwise_act_info);
+        }
+
+        _pointwise_conv.configure(depthwise_out, pointwise_weights, pointwise_biases, output, pointwise_conv_info, pointwise_act_info);
+    }
 }
 
 void NEDepthwiseSeparableConvolutionLayer::run()
 {
     prepare();
 
+    if(_is_fused)
+    {
+        NEScheduler::get().schedule(&_fused_kernel, Window::DimZ);
+        return;
+    }
+
     _depthwise_conv.run();
+    if(_run_depthwise_act)
+    {
+        _depthwise_act.run();
+    }
     _pointwise_conv.run();
 }
 
 void NEDepthwiseSeparableConvolutionLayer::prepare()
 {
-    _depthwise_conv.prepare();
-    _pointwise_conv.prepare();
-}
\ No newline at end of file
+    if(!_is_fused)
+    {
+        _depthwise_conv.prepare();
+        _pointwise_conv.prepare();
+    }
+}
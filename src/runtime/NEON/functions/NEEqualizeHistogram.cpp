@@ -52,7 +52,9 @@ void NEEqualizeHistogram::configure(const IImage *input, IImage *output)
 void NEEqualizeHistogram::run()
 {
     // Calculate histogram of input.
+    _histogram_kernel.reset(NEScheduler::get().num_threads());
     NEScheduler::get().schedule(&_histogram_kernel, Window::DimY);
+    _histogram_kernel.merge();
 
     // Calculate cumulative distribution of histogram and create LUT.
     NEScheduler::get().schedule(&_cd_histogram_kernel, Window::DimY);
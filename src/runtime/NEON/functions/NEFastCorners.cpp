@@ -102,7 +102,9 @@ void NEFastCorners::run()
         NEScheduler::get().schedule(&_nonmax_kernel, Window::DimY);
     }
 
+    _fill_kernel.reset(NEScheduler::get().num_threads());
     NEScheduler::get().schedule(&_fill_kernel, Window::DimY);
+    _fill_kernel.merge();
 
     _memory_group.release();
 }
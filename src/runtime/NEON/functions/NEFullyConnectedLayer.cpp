@@ -29,6 +29,8 @@
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Utils.h"
+#include "arm_compute/runtime/WeightsCache.h"
 
 #include <algorithm>
 #include <cmath>
@@ -75,7 +77,7 @@ Status NEFullyConnectedLayerReshapeWeights::validate(const ITensorInfo *input, c
 
 NEFullyConnectedLayer::NEFullyConnectedLayer(std::shared_ptr<IMemoryManager> memory_manager)
     : _memory_group(std::move(memory_manager)), _im2col_kernel(), _convert_weights(), _reshape_weights_function(), _mm_gemm(), _mm_gemmlowp(), _gemmlowp_output_stage(), _accumulate_biases_kernel(),
-      _im2col_output(), _gemmlowp_output(), _converted_weights_output(), _reshape_weights_output(), _original_weights(nullptr), _are_weights_converted(true), _are_weights_reshaped(false),
+      _im2col_output(), _gemmlowp_output(), _converted_weights_output(), _reshape_weights_output(), _original_weights(nullptr), _cost(), _are_weights_converted(true), _are_weights_reshaped(false),
       _is_fc_after_conv(false), _accumulate_biases(false), _is_quantized(false), _is_prepared(false)
 {
 }
@@ -234,6 +236,10 @@ void NEFullyConnectedLayer::configure(const ITensor *input, const ITensor *weigh
     }
 
     _are_weights_reshaped = _are_weights_reshaped || fc_info.retain_internal_weights;
+
+    // Each output element is the dot product of an input with a row of weights, plus the bias
+    const uint64_t num_inputs = weights->info()->tensor_shape().total_size() / output->info()->dimension(0);
+    _cost                     = compute_workload_cost(2 * num_inputs + (biases != nullptr ? 1 : 0), output->info(), { input->info(), weights->info(), biases != nullptr ? biases->info() : nullptr });
 }
 
 Status NEFullyConnectedLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output,
@@ -386,9 +392,13 @@ void NEFullyConnectedLayer::prepare()
         // Reshape of the weights (happens only once)
         if(!_are_weights_reshaped)
         {
-            // Run reshape weights kernel and mark weights as unused
-            _reshape_weights_output.allocator()->allocate();
-            _reshape_weights_function.run();
+            // Run reshape weights kernel (unless shared by another instance) and mark weights as unused
+            const std::string reshaped_key = WeightsCache::scoped_key("reshaped_weights");
+            if(!WeightsCache::get().acquire(reshaped_key, _reshape_weights_output))
+            {
+                _reshape_weights_function.run();
+                WeightsCache::get().publish(reshaped_key, _reshape_weights_output);
+            }
 
             cur_weights->mark_as_unused();
             cur_weights           = &_reshape_weights_output;
@@ -398,8 +408,12 @@ void NEFullyConnectedLayer::prepare()
         // Convert weights if needed (happens only once)
         if(!_are_weights_converted)
         {
-            _converted_weights_output.allocator()->allocate();
-            _convert_weights.run();
+            const std::string converted_key = WeightsCache::scoped_key("converted_weights");
+            if(!WeightsCache::get().acquire(converted_key, _converted_weights_output))
+            {
+                _convert_weights.run();
+                WeightsCache::get().publish(converted_key, _converted_weights_output);
+            }
 
             cur_weights->mark_as_unused();
             _are_weights_converted = true;
@@ -420,4 +434,9 @@ void NEFullyConnectedLayer::prepare()
 
         _is_prepared = true;
     }
-}
\ No newline at end of file
+}
+
+WorkloadCost NEFullyConnectedLayer::cost() const
+{
+    return _cost;
+}
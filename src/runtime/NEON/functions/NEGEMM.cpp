@@ -34,6 +34,8 @@
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
 #include "arm_compute/runtime/TensorAllocator.h"
+#include "arm_compute/runtime/Utils.h"
+#include "arm_compute/runtime/WeightsCache.h"
 #include "support/ToolchainSupport.h"
 
 #include <cmath>
@@ -44,7 +46,7 @@ namespace arm_compute
 {
 NEGEMM::NEGEMM(std::shared_ptr<IMemoryManager> memory_manager)
     : _memory_group(memory_manager), _interleave_kernel(), _transpose_kernel(), _mm_kernel(), _asm_glue(memory_manager), _ma_kernel(), _tmp_a(), _tmp_b(), _original_b(nullptr),
-      _run_vector_matrix_multiplication(false), _run_addition(false), _reshape_b_only_on_first_run(false), _is_prepared(false)
+      _run_vector_matrix_multiplication(false), _run_addition(false), _reshape_b_only_on_first_run(false), _is_prepared(false), _cost()
 {
 }
 
@@ -58,6 +60,10 @@ void NEGEMM::configure(const ITensor *a, const ITensor *b, const ITensor *c, ITe
     _run_vector_matrix_multiplication = a->info()->dimension(1) < 2;
     _original_b                       = b;
 
+    // Each output element is the dot product of a row of A and a column of B, plus an optional scaled addition of C
+    const bool add_c = beta != 0 && c != nullptr;
+    _cost            = compute_workload_cost(2 * a->info()->dimension(0) + (add_c ? 2 : 0), d->info(), { a->info(), b->info(), add_c ? c->info() : nullptr });
+
     bool run_optimised = c == nullptr && bool(NEGEMMAssemblyDispatch::validate(a->info(), b->info(), d->info(), alpha, beta, _reshape_b_only_on_first_run));
 
     if(run_optimised)
@@ -273,12 +279,21 @@ void NEGEMM::prepare()
         {
             ARM_COMPUTE_ERROR_ON(!_original_b->is_used());
 
-            _tmp_b.allocator()->allocate();
-            NEScheduler::get().schedule(&_transpose_kernel, Window::DimY);
+            const std::string transposed_key = WeightsCache::scoped_key("transposed_b");
+            if(!WeightsCache::get().acquire(transposed_key, _tmp_b))
+            {
+                NEScheduler::get().schedule(&_transpose_kernel, Window::DimY);
+                WeightsCache::get().publish(transposed_key, _tmp_b);
+            }
             _original_b->mark_as_unused();
         }
 
         _is_prepared = true;
     }
 }
+
+WorkloadCost NEGEMM::cost() const
+{
+    return _cost;
+}
 } // namespace arm_compute
@@ -24,6 +24,7 @@
 #include "arm_compute/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
 
 #include "arm_compute/core/CPP/Validate.h"
+#include "arm_compute/core/Utils.h"
 #include "arm_compute/core/NEON/kernels/assembly/NEGEMMInterleavedMatrixMultiplyWrapper.h"
 #include "arm_compute/core/NEON/kernels/assembly/NEGEMMInterleavedPrepareBWrapperKernel.h"
 #include "arm_compute/core/NEON/kernels/assembly/NEGEMMInterleavedTransformAWrapper.h"
@@ -31,8 +32,10 @@
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NESimpleAssemblyFunction.h"
 #include "arm_compute/runtime/NEON/functions/assembly/NEGEMMInterleavedWrapper.h"
+#include "arm_compute/runtime/WeightsCache.h"
 
 #include <arm_neon.h>
+#include <tuple>
 
 namespace arm_compute
 {
@@ -183,6 +186,8 @@ private:
     Tensor _pretranspose{};
     /** Prepared flag */
     bool _is_prepared{ false };
+    /** True if A is gathered from the convolution input @p _a instead of being a matrix */
+    bool _is_convolution{ false };
 };
 
 template <typename TypeInput, typename TypeOutput>
@@ -221,6 +226,7 @@ void Fallback<TypeInput, TypeOutput>::configure(const ITensor *a, const ITensor
     _a                = a;
     _b                = b;
     _d                = d;
+    _is_convolution   = args._conv_params != nullptr;
     // Check for pre-transposed support
     if(_gemm_kernel_asm->B_pretranspose_required())
     {
@@ -228,8 +234,6 @@ void Fallback<TypeInput, TypeOutput>::configure(const ITensor *a, const ITensor
         const unsigned int alignment           = 128;
         const size_t       B_pretranspose_size = _gemm_kernel_asm->get_B_pretransposed_array_size();
         _pretranspose.allocator()->init(TensorInfo(TensorShape{ (B_pretranspose_size + alignment) }, 1, DataType::S8), alignment);
-        _pretranspose.allocator()->allocate();
-        ARM_COMPUTE_ERROR_ON_NULLPTR(_pretranspose.buffer());
     }
 }
 
@@ -241,12 +245,22 @@ void Fallback<TypeInput, TypeOutput>::prepare()
         // Pretranspose B if required
         if(_gemm_kernel_asm->B_pretranspose_required())
         {
-            ARM_COMPUTE_ERROR_ON(_pretranspose.buffer() == nullptr);
-            const int  ldb            = _b->info()->strides_in_bytes().y() / sizeof(TypeInput);
-            const auto in1_ptr        = reinterpret_cast<const TypeInput *>(_b->buffer() + _b->info()->offset_first_element_in_bytes());
-            const int  multi_stride_b = _b->info()->strides_in_bytes().z() / sizeof(TypeInput);
+            // Reuse the pretransposed B of another instance if shared
+            const std::string pretranspose_key = WeightsCache::scoped_key("pretransposed_b");
+            if(WeightsCache::get().acquire(pretranspose_key, _pretranspose))
+            {
+                _gemm_kernel_asm->set_pretransposed_B_data(_pretranspose.buffer());
+            }
+            else
+            {
+                ARM_COMPUTE_ERROR_ON(_pretranspose.buffer() == nullptr);
+                const int  ldb            = _b->info()->strides_in_bytes().y() / sizeof(TypeInput);
+                const auto in1_ptr        = reinterpret_cast<const TypeInput *>(_b->buffer() + _b->info()->offset_first_element_in_bytes());
+                const int  multi_stride_b = _b->info()->strides_in_bytes().z() / sizeof(TypeInput);
 
-            _gemm_kernel_asm->pretranspose_B_array(_pretranspose.buffer(), in1_ptr, ldb, multi_stride_b);
+                _gemm_kernel_asm->pretranspose_B_array(_pretranspose.buffer(), in1_ptr, ldb, multi_stride_b);
+                WeightsCache::get().publish(pretranspose_key, _pretranspose);
+            }
             _b->mark_as_unused();
         }
 
@@ -300,6 +314,19 @@ void Fallback<TypeInput, TypeOutput>::run()
         in1_ptr        = reinterpret_cast<const TypeInput *>(_b->buffer() + _b->info()->offset_first_element_in_bytes());
     }
 
+    // For implicit GEMM convolutions A is the input tensor itself: pass on its strides and don't treat it as a matrix
+    if(_is_convolution)
+    {
+        const DataLayout data_layout = _a->info()->data_layout();
+        const Strides   &strides     = _a->info()->strides_in_bytes();
+        const int        stride_x    = strides[get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH)] / sizeof(TypeInput);
+        const int        stride_y    = strides[get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT)] / sizeof(TypeInput);
+        const int        stride_c    = strides[get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL)] / sizeof(TypeInput);
+        const int        stride_n    = strides[get_data_layout_dimension_index(data_layout, DataLayoutDimension::BATCHES)] / sizeof(TypeInput);
+
+        _gemm_kernel_asm->set_convolution_strides(stride_x, stride_y, stride_c, stride_n);
+    }
+
     // Set workspace if needed and reset number of threads as buffer manager gets re-created with max_threads
     if(_workspace.buffer() != nullptr)
     {
@@ -317,7 +344,14 @@ void Fallback<TypeInput, TypeOutput>::run()
     prepare();
 
     // Set gemm parameters
-    _gemm_kernel_asm->set_arrays(in0_ptr, lda, batch_stride_a, multi_stride_a, in1_ptr, ldb, multi_stride_b, out_ptr, ldd, batch_stride_d, multi_stride_d);
+    if(_is_convolution)
+    {
+        _gemm_kernel_asm->set_arrays(in0_ptr, 0, 0, 0, in1_ptr, ldb, multi_stride_b, out_ptr, ldd, batch_stride_d, multi_stride_d);
+    }
+    else
+    {
+        _gemm_kernel_asm->set_arrays(in0_ptr, lda, batch_stride_a, multi_stride_a, in1_ptr, ldb, multi_stride_b, out_ptr, ldd, batch_stride_d, multi_stride_d);
+    }
 
     // Schedule assembly kernel
     NEScheduler::get().schedule(_optimised_kernel.get(), Window::DimX);
@@ -350,6 +384,73 @@ void create_function_or_arm_gemm(std::unique_ptr<IFunction> &acl_function, std::
     }
 }
 
+template <typename TypeOutput>
+arm_gemm::GemmArgs<TypeOutput> make_convolution_gemm_args(const ITensorInfo *b, const ITensorInfo *d, const arm_gemm::ConvolutionParameters &conv_params)
+{
+    const CPUInfo     &ci          = NEScheduler::get().cpu_info();
+    const unsigned int num_threads = NEScheduler::get().num_threads();
+
+    // Rows of A are the output points: d is interpreted as [N, M, batches]
+    const unsigned int M       = d->dimension(1);
+    const unsigned int N       = d->dimension(0);
+    const unsigned int K       = b->dimension(1);
+    const unsigned int batches = d->tensor_shape().total_size_upper(2);
+
+    arm_gemm::GemmArgs<TypeOutput> args(&ci, M, N, K, batches, 1, false, false, 1.f, 0.f, num_threads, true);
+    args._conv_params = &conv_params;
+
+    return args;
+}
+
+template <typename TypeInput, typename TypeOutput>
+bool has_arm_gemm_convolution(const ITensorInfo *b, const ITensorInfo *d, const arm_gemm::ConvolutionParameters &conv_params)
+{
+    arm_gemm::GemmArgs<TypeOutput> args = make_convolution_gemm_args<TypeOutput>(b, d, conv_params);
+
+    // DEFAULT is returned if none of the kernels of this CPU can gather A from the convolution input
+    return arm_gemm::get_gemm_method<TypeInput, TypeOutput>(args) != arm_gemm::GemmMethod::DEFAULT;
+}
+
+template <typename TypeInput, typename TypeOutput>
+void create_arm_gemm_convolution(std::unique_ptr<NEGEMMAssemblyDispatch::IFallback> &arm_gemm, MemoryGroup &memory_group, const ITensor *input, const ITensor *b, ITensor *d,
+                                 const arm_gemm::ConvolutionParameters &conv_params)
+{
+    arm_gemm::GemmArgs<TypeOutput> args = make_convolution_gemm_args<TypeOutput>(b->info(), d->info(), conv_params);
+
+    // ACL's own GEMM functions expect a real A matrix, so always go through arm_gemm
+    auto fallback = support::cpp14::make_unique<Fallback<TypeInput, TypeOutput>>();
+    fallback->configure(input, b, d, args, memory_group);
+    arm_gemm = std::move(fallback);
+}
+
+arm_gemm::ConvolutionParameters make_convolution_parameters(const ITensorInfo *input, const Size2D &kernel_dims, const PadStrideInfo &conv_info, const Size2D &dilation, bool append_bias)
+{
+    const DataLayout data_layout = input->data_layout();
+
+    unsigned int conv_w = 0;
+    unsigned int conv_h = 0;
+    std::tie(conv_w, conv_h) = scaled_dimensions(input->dimension(get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH)),
+                                                 input->dimension(get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT)),
+                                                 kernel_dims.width, kernel_dims.height, conv_info, dilation);
+
+    arm_gemm::ConvolutionParameters params;
+    params.input_width     = input->dimension(get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH));
+    params.input_height    = input->dimension(get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT));
+    params.input_channels  = input->dimension(get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL));
+    params.kernel_width    = kernel_dims.width;
+    params.kernel_height   = kernel_dims.height;
+    params.output_width    = conv_w;
+    params.output_height   = conv_h;
+    params.output_stride_w = conv_info.stride().first;
+    params.output_stride_h = conv_info.stride().second;
+    params.dilation_w      = dilation.x();
+    params.dilation_h      = dilation.y();
+    params.padding_top     = conv_info.pad_top();
+    params.padding_left    = conv_info.pad_left();
+    params.append_bias     = append_bias;
+
+    return params;
+}
 } //namespace
 
 NEGEMMAssemblyDispatch::NEGEMMAssemblyDispatch(std::shared_ptr<IMemoryManager> memory_manager)
@@ -413,6 +514,69 @@ void NEGEMMAssemblyDispatch::configure(const ITensor *a, const ITensor *b, ITens
     }
 }
 
+Status NEGEMMAssemblyDispatch::validate_convolution(const ITensorInfo *input, const ITensorInfo *b, const ITensorInfo *d, const Size2D &kernel_dims, const PadStrideInfo &conv_info,
+                                                    const Size2D &dilation, bool append_bias)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, b, d);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+#else  /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, b, d);
+
+    const arm_gemm::ConvolutionParameters params = make_convolution_parameters(input, kernel_dims, conv_info, dilation, append_bias);
+
+    const unsigned int expected_k = params.input_channels * params.kernel_width * params.kernel_height + (append_bias ? 1 : 0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(b->dimension(1) != expected_k, "Matrix B does not match the convolution kernel");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(b->dimension(0) != d->dimension(0), "Matrix B and the output have a different number of columns");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(d->dimension(1) * d->tensor_shape().total_size_upper(2) != static_cast<size_t>(params.output_width * params.output_height) * input->tensor_shape()[3],
+                                    "Output does not hold one row per output point");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((params.output_width * params.output_height) % d->dimension(1) != 0, "Output rows can't straddle two batches");
+
+    bool has_kernel = false;
+    switch(input->data_type())
+    {
+        case DataType::F32:
+            has_kernel = has_arm_gemm_convolution<float, float>(b, d, params);
+            break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            has_kernel = has_arm_gemm_convolution<float16_t, float16_t>(b, d, params);
+            break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        default:
+            break;
+    }
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(!has_kernel, "No arm_gemm kernel can gather the GEMM input from this convolution");
+
+    return Status{};
+}
+
+void NEGEMMAssemblyDispatch::configure_convolution(const ITensor *input, const ITensor *b, ITensor *d, const Size2D &kernel_dims, const PadStrideInfo &conv_info, const Size2D &dilation,
+                                                   bool append_bias)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, b, d);
+    ARM_COMPUTE_ERROR_THROW_ON(NEGEMMAssemblyDispatch::validate_convolution(input->info(), b->info(), d->info(), kernel_dims, conv_info, dilation, append_bias));
+
+    const arm_gemm::ConvolutionParameters params = make_convolution_parameters(input->info(), kernel_dims, conv_info, dilation, append_bias);
+
+    switch(input->info()->data_type())
+    {
+        case DataType::F32:
+            create_arm_gemm_convolution<float, float>(_arm_gemm, _memory_group, input, b, d, params);
+            break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            create_arm_gemm_convolution<float16_t, float16_t>(_arm_gemm, _memory_group, input, b, d, params);
+            break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+        default:
+            break;
+    }
+}
+
 void NEGEMMAssemblyDispatch::prepare()
 {
     if(_function != nullptr)
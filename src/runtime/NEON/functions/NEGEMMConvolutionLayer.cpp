@@ -29,6 +29,8 @@
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Utils.h"
+#include "arm_compute/runtime/WeightsCache.h"
 #include "support/ToolchainSupport.h"
 
 #include <cmath>
@@ -42,23 +44,24 @@ NEConvolutionLayerReshapeWeights::NEConvolutionLayerReshapeWeights()
 {
 }
 
-void NEConvolutionLayerReshapeWeights::configure(const ITensor *weights, const ITensor *biases, ITensor *output)
+void NEConvolutionLayerReshapeWeights::configure(const ITensor *weights, const ITensor *biases, ITensor *output, unsigned int num_groups)
 {
     // Perform validation step
     ARM_COMPUTE_ERROR_ON_NULLPTR(weights, output);
     ARM_COMPUTE_ERROR_THROW_ON(NEConvolutionLayerReshapeWeights::validate(weights->info(),
                                                                           (biases != nullptr) ? biases->info() : nullptr,
-                                                                          output->info()));
+                                                                          output->info(),
+                                                                          num_groups));
 
     const bool     append_biases = (biases != nullptr) && !is_data_type_quantized_asymmetric(weights->info()->data_type());
     const ITensor *biases_to_use = (append_biases) ? biases : nullptr;
 
-    _weights_reshape_kernel.configure(weights, biases_to_use, output);
+    _weights_reshape_kernel.configure(weights, biases_to_use, output, num_groups);
 
     output->info()->set_quantization_info(weights->info()->quantization_info());
 }
 
-Status NEConvolutionLayerReshapeWeights::validate(const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output)
+Status NEConvolutionLayerReshapeWeights::validate(const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, unsigned int num_groups)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(weights);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
@@ -77,7 +80,7 @@ Status NEConvolutionLayerReshapeWeights::validate(const ITensorInfo *weights, co
     {
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(weights, output);
 
-        NEWeightsReshapeKernel::validate(weights, biases, output);
+        NEWeightsReshapeKernel::validate(weights, biases, output, num_groups);
     }
 
     return Status{};
@@ -89,9 +92,9 @@ void NEConvolutionLayerReshapeWeights::run()
 }
 
 NEGEMMConvolutionLayer::NEGEMMConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager)
-    : _memory_group(memory_manager), _reshape_weights(), _im2col_kernel(), _mm_gemm(), _mm_gemmlowp(memory_manager), _gemmlowp_output_stage(), _col2im_kernel(), _activationlayer_function(),
-      _add_bias_kernel(), _reshape_layer(), _original_weights(nullptr), _im2col_output(), _weights_reshaped(), _gemm_output(), _tmp_output(), _data_layout(DataLayout::NCHW), _append_bias(false),
-      _skip_im2col(false), _skip_col2im(false), _is_quantized(false), _is_activationlayer_enabled(false), _is_prepared(false)
+    : _memory_group(memory_manager), _reshape_weights(), _im2col_kernel(), _mm_gemm(), _mm_implicit_gemm(memory_manager), _mm_grouped_gemm(memory_manager), _mm_gemmlowp(memory_manager), _gemmlowp_output_stage(), _col2im_kernel(),
+      _activationlayer_function(), _add_bias_kernel(), _reshape_layer(), _original_weights(nullptr), _im2col_output(), _weights_reshaped(), _gemm_output(), _tmp_output(), _data_layout(DataLayout::NCHW),
+      _num_groups(1), _cost(), _append_bias(false), _skip_im2col(false), _skip_col2im(false), _use_implicit_gemm(false), _is_quantized(false), _is_activationlayer_enabled(false), _is_prepared(false)
 {
 }
 
@@ -166,11 +169,44 @@ Status NEGEMMConvolutionLayer::validate_gemm3d(DataType data_type, int gemm_3d_d
     return validate_mm(&dummy_input_info, &dummy_weights_info, &dummy_output_info, gemm_3d_depth, skip_im2col);
 }
 
+Status NEGEMMConvolutionLayer::validate_implicit_gemm(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, const PadStrideInfo &conv_info, const Size2D &dilation,
+                                                      bool append_bias)
+{
+    const DataLayout data_layout = input->data_layout();
+    const int        idx_width   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const int        idx_height  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const int        idx_kernels = get_data_layout_dimension_index(data_layout, DataLayoutDimension::BATCHES);
+
+    const unsigned int kernel_width  = weights->dimension(idx_width);
+    const unsigned int kernel_height = weights->dimension(idx_height);
+
+    unsigned int conv_w = 0;
+    unsigned int conv_h = 0;
+    std::tie(conv_w, conv_h) = scaled_dimensions(input->dimension(idx_width), input->dimension(idx_height), kernel_width, kernel_height, conv_info, dilation);
+
+    const TensorInfo weights_reshaped_info(compute_weights_reshaped_shape(*weights, append_bias), 1, input->data_type());
+
+    // With NHWC the GEMM writes straight into the output, otherwise col2im is still needed
+    TensorInfo         info_gemm;
+    const ITensorInfo *gemm_output_to_use = output;
+    if(data_layout == DataLayout::NCHW)
+    {
+        TensorShape shape_gemm = input->tensor_shape();
+        shape_gemm.set(0, weights->dimension(idx_kernels));
+        shape_gemm.set(1, conv_w * conv_h);
+        shape_gemm.set(2, 1);
+
+        info_gemm          = TensorInfo(shape_gemm, 1, input->data_type());
+        gemm_output_to_use = &info_gemm;
+    }
+
+    return NEGEMMAssemblyDispatch::validate_convolution(input, &weights_reshaped_info, gemm_output_to_use, Size2D(kernel_width, kernel_height), conv_info, dilation, append_bias);
+}
+
 void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info,
-                                       const Size2D &dilation, const ActivationLayerInfo &act_info, unsigned int num_groups)
+                                       const Size2D &dilation, const ActivationLayerInfo &act_info, unsigned int num_groups, bool implicit_gemm)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
-    ARM_COMPUTE_UNUSED(num_groups);
     ARM_COMPUTE_ERROR_THROW_ON(NEGEMMConvolutionLayer::validate(input->info(),
                                                                 weights->info(),
                                                                 biases != nullptr ? biases->info() : nullptr,
@@ -179,7 +215,8 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
                                                                 weights_info,
                                                                 dilation,
                                                                 act_info,
-                                                                num_groups));
+                                                                num_groups,
+                                                                implicit_gemm));
 
     const DataType   data_type   = input->info()->data_type();
     const DataLayout data_layout = input->info()->data_layout();
@@ -195,6 +232,7 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
     _original_weights = weights;
     _is_quantized     = is_data_type_quantized_asymmetric(input->info()->data_type());
     _data_layout      = data_layout;
+    _num_groups       = num_groups;
     _skip_im2col      = (data_layout == DataLayout::NHWC && kernel_width == 1 && kernel_height == 1 && conv_info.stride().first == 1 && conv_info.stride().second == 1);
     _skip_col2im      = data_layout == DataLayout::NHWC;
     _append_bias      = (biases != nullptr) && (!_is_quantized);
@@ -224,6 +262,13 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
         }
     }
 
+    // Check if the GEMM can gather its input straight from the convolution input rather than from an im2col buffer
+    _use_implicit_gemm = implicit_gemm && !_skip_im2col && (num_groups == 1) && bool(validate_implicit_gemm(input->info(), weights->info(), output->info(), conv_info, dilation, _append_bias));
+    if(_use_implicit_gemm)
+    {
+        _skip_col2im = (data_layout == DataLayout::NHWC);
+    }
+
     const unsigned bias_element  = (_append_bias && !_skip_im2col) ? 1 : 0;
     const ITensor *biases_to_use = (_append_bias && !_skip_im2col) ? biases : nullptr;
 
@@ -232,15 +277,15 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
     unsigned int stride_y = 0;
     std::tie(stride_x, stride_y) = conv_info.stride();
 
-    unsigned int mat_weights_cols = weights->info()->dimension(idx_kernels);
+    unsigned int mat_weights_cols = weights->info()->dimension(idx_kernels) / num_groups;
     unsigned int mat_weights_rows = weights->info()->dimension(idx_width) * weights->info()->dimension(idx_height) * weights->info()->dimension(idx_channel) + bias_element;
 
     // _weights_reshaped will be auto configured in the kernel.
     // Just append biases and do not transpose 1xW as it will be reshaped in NEGEMM
-    _reshape_weights.configure(weights, biases_to_use, &_weights_reshaped);
+    _reshape_weights.configure(weights, biases_to_use, &_weights_reshaped, num_groups);
 
     // Create tensor to store im2col reshaped inputs
-    if(!_skip_im2col)
+    if(!_skip_im2col && !_use_implicit_gemm)
     {
         // Calculate im2col shape
         // For NEON the batch size is on the fourth dimension
@@ -248,17 +293,23 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
         shape_im2col.set(0, mat_weights_rows);
         shape_im2col.set(1, conv_w * conv_h);
         shape_im2col.set(2, 1);
+        if(num_groups > 1)
+        {
+            // Each group is a separate multi of the GEMM, which are expected on the fourth dimension
+            shape_im2col.set(2, input->info()->dimension(3));
+            shape_im2col.set(3, num_groups);
+        }
 
         _im2col_output.allocator()->init(input->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(shape_im2col));
         _memory_group.manage(&_im2col_output);
 
         // Configure
-        _im2col_kernel.configure(input, &_im2col_output, Size2D(kernel_width, kernel_height), conv_info, _append_bias, dilation);
+        _im2col_kernel.configure(input, &_im2col_output, Size2D(kernel_width, kernel_height), conv_info, _append_bias, dilation, num_groups);
 
         // Update GEMM input
         gemm_input_to_use = &_im2col_output;
     }
-    else if(_append_bias)
+    else if(_skip_im2col && _append_bias)
     {
         // Configure add bias kernel
         _add_bias_kernel.configure(output, biases, output, ConvertPolicy::SATURATE);
@@ -268,9 +319,15 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
     if(!_skip_col2im)
     {
         // Calculate GEMM output shape
-        TensorShape shape_gemm = _im2col_output.info()->tensor_shape();
+        TensorShape shape_gemm = input->info()->tensor_shape();
         shape_gemm.set(0, mat_weights_cols);
         shape_gemm.set(1, conv_w * conv_h);
+        shape_gemm.set(2, 1);
+        if(num_groups > 1)
+        {
+            shape_gemm.set(2, input->info()->dimension(3));
+            shape_gemm.set(3, num_groups);
+        }
 
         // GEMM output should be S32 for acquiring raw integer accumulator without quantized postprocessing for quantized asymmetric input.
         const DataType gemm_data_type = _is_quantized ? DataType::S32 : data_type;
@@ -284,9 +341,23 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
     }
 
     // Configure GEMM
-    configure_mm(gemm_input_to_use, &_weights_reshaped, gemm_output_to_use, _skip_col2im ? conv_h : 1);
+    if(_use_implicit_gemm)
+    {
+        _mm_implicit_gemm.configure_convolution(input, &_weights_reshaped, gemm_output_to_use, Size2D(kernel_width, kernel_height), conv_info, dilation, _append_bias);
+    }
+    else if(num_groups > 1)
+    {
+        // All the groups are computed by a single GEMM call, one multi per group
+        // There is no per-group fallback: fail in release builds too rather than leaving the GEMM unconfigured
+        _mm_grouped_gemm.configure(gemm_input_to_use, &_weights_reshaped, gemm_output_to_use, 1.f, 0.f, true);
+        ARM_COMPUTE_EXIT_ON_MSG(!_mm_grouped_gemm.is_configured(), "Grouped GEMM could not be configured");
+    }
+    else
+    {
+        configure_mm(gemm_input_to_use, &_weights_reshaped, gemm_output_to_use, _skip_col2im ? conv_h : 1);
+    }
 
-    if(!_skip_im2col)
+    if(!_skip_im2col && !_use_implicit_gemm)
     {
         _im2col_output.allocator()->allocate();
     }
@@ -311,7 +382,7 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
         if(_data_layout == DataLayout::NCHW)
         {
             // Configure col2im
-            _col2im_kernel.configure(_is_quantized ? gemm_output_staged_to_use : gemm_output_to_use, output, Size2D(conv_w, conv_h));
+            _col2im_kernel.configure(_is_quantized ? gemm_output_staged_to_use : gemm_output_to_use, output, Size2D(conv_w, conv_h), num_groups);
         }
         else
         {
@@ -341,18 +412,24 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
         _activationlayer_function.configure(output, nullptr, act_info);
     }
 
+    // Each output element accumulates a kernel_width x kernel_height x (input_channels / num_groups) window, plus the bias
+    const uint64_t macs_per_output = static_cast<uint64_t>(kernel_width) * kernel_height * weights->info()->dimension(idx_channel);
+    _cost                          = compute_workload_cost(2 * macs_per_output + (biases != nullptr ? 1 : 0), output->info(), { input->info(), weights->info(), biases != nullptr ? biases->info() : nullptr });
+
     ARM_COMPUTE_UNUSED(weights_info);
 }
 
 Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
-                                        const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, unsigned int num_groups)
+                                        const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, unsigned int num_groups, bool implicit_gemm)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights_info.are_reshaped(), "Weights already reshaped are not supported!");
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, weights);
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_groups > 1, "Grouping (num_groups != 1) is not supported on NEON");
+    ARM_COMPUTE_RETURN_ERROR_ON(num_groups == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups != 1) && (input->data_layout() != DataLayout::NCHW), "Grouping (num_groups != 1) with NHWC data layout is not supported");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups != 1) && (input->data_type() == DataType::QASYMM8), "Grouping (num_groups != 1) is not supported with QASYMM8");
 
     const DataLayout data_layout = input->data_layout();
     const DataType   data_type   = input->data_type();
@@ -397,10 +474,18 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
         }
     }
 
+    // Check if the GEMM can gather its input straight from the convolution input
+    const bool use_implicit_gemm = implicit_gemm && !skip_im2col && (num_groups == 1) && bool(validate_implicit_gemm(input, weights, output, conv_info, dilation, append_bias));
+    if(use_implicit_gemm)
+    {
+        skip_col2im = (data_layout == DataLayout::NHWC);
+    }
+
     const unsigned     bias_element  = (append_bias && !skip_im2col) ? 1 : 0;
     const ITensorInfo *biases_to_use = (append_bias && !skip_im2col) ? biases : nullptr;
 
-    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(idx_channel) != input->dimension(idx_channel));
+    ARM_COMPUTE_RETURN_ERROR_ON((weights->dimension(idx_channel) * num_groups) != input->dimension(idx_channel));
+    ARM_COMPUTE_RETURN_ERROR_ON((weights->dimension(idx_kernels) % num_groups) != 0);
     ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
 
     // Validate biases
@@ -423,15 +508,15 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
         ARM_COMPUTE_ERROR_ON(act_info.b() > act_info.a());
     }
 
-    unsigned int mat_weights_cols = weights->dimension(idx_kernels);
+    unsigned int mat_weights_cols = weights->dimension(idx_kernels) / num_groups;
     unsigned int mat_weights_rows = weights->dimension(idx_width) * weights->dimension(idx_height) * weights->dimension(idx_channel) + bias_element;
 
     // Output tensor auto inizialization if not yet initialized
-    ARM_COMPUTE_RETURN_ON_ERROR(NEConvolutionLayerReshapeWeights::validate(weights, biases_to_use, nullptr));
-    weights_reshaped_info = TensorInfo(compute_weights_reshaped_shape(*weights, (append_bias && !skip_im2col)), 1, data_type);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEConvolutionLayerReshapeWeights::validate(weights, biases_to_use, nullptr, num_groups));
+    weights_reshaped_info = TensorInfo(compute_weights_reshaped_shape(*weights, (append_bias && !skip_im2col), num_groups), 1, data_type);
     weights_to_use        = &weights_reshaped_info;
 
-    if(!skip_im2col)
+    if(!skip_im2col && !use_implicit_gemm)
     {
         // Create tensor info for im2col reshaped inputs
         // For NEON the batch size is on the fourth dimension
@@ -439,14 +524,19 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
         shape_im2col.set(0, mat_weights_rows);
         shape_im2col.set(1, conv_w * conv_h);
         shape_im2col.set(2, 1);
+        if(num_groups > 1)
+        {
+            shape_im2col.set(2, input->dimension(3));
+            shape_im2col.set(3, num_groups);
+        }
 
         im2col_reshaped_info = TensorInfo(shape_im2col, 1, data_type);
         im2col_reshaped_info.set_quantization_info(input->quantization_info());
 
-        ARM_COMPUTE_RETURN_ON_ERROR(NEIm2ColKernel::validate(input, &im2col_reshaped_info, Size2D(kernel_width, kernel_height), conv_info, append_bias, dilation));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEIm2ColKernel::validate(input, &im2col_reshaped_info, Size2D(kernel_width, kernel_height), conv_info, append_bias, dilation, num_groups));
         gemm_input_to_use = &im2col_reshaped_info;
     }
-    else if(append_bias)
+    else if(skip_im2col && append_bias)
     {
         // Validate add bias kernel
         ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAdditionKernel::validate(output, biases, output, ConvertPolicy::SATURATE));
@@ -455,9 +545,15 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
     // Create temporary GEMM output tensor in case we cannot skip col2im
     if(!skip_col2im)
     {
-        TensorShape shape_gemm = gemm_input_to_use->tensor_shape();
+        TensorShape shape_gemm = input->tensor_shape();
         shape_gemm.set(0, mat_weights_cols);
         shape_gemm.set(1, conv_w * conv_h);
+        shape_gemm.set(2, 1);
+        if(num_groups > 1)
+        {
+            shape_gemm.set(2, input->dimension(3));
+            shape_gemm.set(3, num_groups);
+        }
         const DataType gemm_data_type = is_quantized ? DataType::S32 : data_type;
         // GEMM output should be S32 for acquiring raw integer accumulator without quantized postprocessing for quantized asymmetric input.
         info_gemm = TensorInfo(shape_gemm, 1, gemm_data_type);
@@ -466,7 +562,14 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
         gemm_output_to_use = &info_gemm;
     }
 
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_mm(gemm_input_to_use, weights_to_use, gemm_output_to_use, skip_col2im ? conv_h : 1, skip_im2col));
+    if(num_groups > 1)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMAssemblyDispatch::validate(gemm_input_to_use, weights_to_use, gemm_output_to_use, 1.f, 0.f, true));
+    }
+    else if(!use_implicit_gemm)
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_mm(gemm_input_to_use, weights_to_use, gemm_output_to_use, skip_col2im ? conv_h : 1, skip_im2col));
+    }
 
     if(is_quantized)
     {
@@ -487,7 +590,8 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
     {
         ARM_COMPUTE_RETURN_ON_ERROR(NECol2ImKernel::validate(is_quantized ? gemm_output_staged_to_use : gemm_output_to_use,
                                                              output,
-                                                             Size2D(conv_w, conv_h)));
+                                                             Size2D(conv_w, conv_h),
+                                                             num_groups));
     }
 
     //Validate Activation Layer
@@ -505,7 +609,7 @@ void NEGEMMConvolutionLayer::run()
 
     _memory_group.acquire();
 
-    if(!_skip_im2col)
+    if(!_skip_im2col && !_use_implicit_gemm)
     {
         // Run input reshaping
         unsigned int y_dim = get_data_layout_dimension_index(_data_layout, DataLayoutDimension::HEIGHT);
@@ -521,6 +625,16 @@ void NEGEMMConvolutionLayer::run()
         // Run output stage
         _gemmlowp_output_stage.run();
     }
+    else if(_use_implicit_gemm)
+    {
+        // Run gemm reading straight from the input
+        _mm_implicit_gemm.run();
+    }
+    else if(_num_groups > 1)
+    {
+        // Run all the groups in a single gemm
+        _mm_grouped_gemm.run();
+    }
     else
     {
         // Run gemm
@@ -559,13 +673,32 @@ void NEGEMMConvolutionLayer::prepare()
     {
         ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
 
-        // Run weights reshaping and mark original weights tensor as unused
-        _weights_reshaped.allocator()->allocate();
-        _reshape_weights.run();
+        // Run weights reshaping (unless shared by another instance) and mark original weights tensor as unused
+        const std::string reshaped_key = WeightsCache::scoped_key("reshaped_weights");
+        if(!WeightsCache::get().acquire(reshaped_key, _weights_reshaped))
+        {
+            _reshape_weights.run();
+            WeightsCache::get().publish(reshaped_key, _weights_reshaped);
+        }
         _original_weights->mark_as_unused();
 
         // Prepare GEMM
-        _is_quantized ? _mm_gemmlowp.prepare() : _mm_gemm.prepare();
+        if(_is_quantized)
+        {
+            _mm_gemmlowp.prepare();
+        }
+        else if(_use_implicit_gemm)
+        {
+            _mm_implicit_gemm.prepare();
+        }
+        else if(_num_groups > 1)
+        {
+            _mm_grouped_gemm.prepare();
+        }
+        else
+        {
+            _mm_gemm.prepare();
+        }
         if(!_weights_reshaped.is_used())
         {
             _weights_reshaped.allocator()->free();
@@ -574,3 +707,13 @@ void NEGEMMConvolutionLayer::prepare()
         _is_prepared = true;
     }
 }
+
+WorkloadCost NEGEMMConvolutionLayer::cost() const
+{
+    return _cost;
+}
+
+bool NEGEMMConvolutionLayer::is_implicit_gemm() const
+{
+    return _use_implicit_gemm;
+}
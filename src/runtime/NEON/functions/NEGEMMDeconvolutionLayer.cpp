@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEGEMMDeconvolutionLayer.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+using namespace arm_compute;
+using namespace arm_compute::misc::shape_calculator;
+
+namespace
+{
+/** Im2col with a 1x1 kernel: lays the input out as the [IFM, width * height, 1, batches] left hand side matrix */
+const Size2D        im2col_kernel_dims(1U, 1U);
+const PadStrideInfo im2col_conv_info(1, 1, 0, 0);
+} // namespace
+
+NEGEMMDeconvolutionLayer::NEGEMMDeconvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager) // NOLINT
+    : _memory_group(memory_manager),
+      _im2col_kernel(),
+      _reshape_weights_kernel(),
+      _mm_gemm(memory_manager),
+      _col2im_kernel(),
+      _original_weights(nullptr),
+      _im2col_output(),
+      _weights_reshaped(),
+      _gemm_output(),
+      _is_prepared(false)
+{
+}
+
+Status NEGEMMDeconvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *bias, const ITensorInfo *output, const PadStrideInfo &info,
+                                          unsigned int inner_border_right, unsigned int inner_border_top)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->data_layout() != DataLayout::NCHW);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(2) != input->dimension(2));
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(0) < 1 || weights->dimension(1) < 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(!info.padding_is_symmetric());
+    ARM_COMPUTE_RETURN_ERROR_ON(info.pad().first >= weights->dimension(0) || info.pad().second >= weights->dimension(1));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(inner_border_right > info.stride().first - 1, "inner_border_right must be smaller than stride_x");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(inner_border_top > info.stride().second - 1, "inner_border_top must be smaller than stride_y");
+
+    if(bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, bias);
+    }
+
+    const auto out_dims = deconvolution_output_dimensions(input->dimension(0), input->dimension(1), weights->dimension(0), weights->dimension(1),
+                                                          info.pad().first, info.pad().second, inner_border_right, inner_border_top,
+                                                          info.stride().first, info.stride().second);
+
+    auto output_info = output->clone();
+    auto_init_if_empty(*output_info, input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(deconvolution_output_shape(out_dims, input->tensor_shape(), weights->tensor_shape())));
+
+    const TensorInfo im2col_info(input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_im2col_conv_shape(input, im2col_kernel_dims, im2col_conv_info, false, Size2D(1U, 1U),
+                                                                                                                                    false)));
+    const TensorInfo weights_reshaped_info(weights->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_deconvolution_reshaped_weights_shape(*weights)));
+    const TensorInfo gemm_output_info(input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_deconvolution_col_shape(*input, *weights)));
+
+    ARM_COMPUTE_RETURN_ON_ERROR(NEIm2ColKernel::validate(input, &im2col_info, im2col_kernel_dims, im2col_conv_info, false));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEDeconvolutionWeightsReshapeKernel::validate(weights, &weights_reshaped_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMM::validate(&im2col_info, &weights_reshaped_info, nullptr, &gemm_output_info, 1.f, 0.f, GEMMInfo(false, false, true /* Reshape weights only for the first run */)));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEDeconvolutionCol2ImKernel::validate(&gemm_output_info, bias, output_info.get(), Size2D(input->dimension(0), input->dimension(1)),
+                                                                      Size2D(weights->dimension(0), weights->dimension(1)), info, inner_border_right, inner_border_top));
+
+    return Status{};
+}
+
+void NEGEMMDeconvolutionLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *bias, ITensor *output, const PadStrideInfo &info,
+                                         unsigned int inner_border_right, unsigned int inner_border_top)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+
+    const auto out_dims = deconvolution_output_dimensions(input->info()->dimension(0), input->info()->dimension(1), weights->info()->dimension(0), weights->info()->dimension(1),
+                                                          info.pad().first, info.pad().second, inner_border_right, inner_border_top,
+                                                          info.stride().first, info.stride().second);
+
+    // Output auto inizialitation if not yet initialized
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(deconvolution_output_shape(out_dims, input->info()->tensor_shape(), weights->info()->tensor_shape())));
+
+    // Perform validation step
+    ARM_COMPUTE_ERROR_THROW_ON(NEGEMMDeconvolutionLayer::validate(input->info(), weights->info(), bias == nullptr ? nullptr : bias->info(), output->info(), info, inner_border_right, inner_border_top));
+
+    _original_weights = weights;
+    _is_prepared      = false;
+
+    // Initialize the intermediate tensors: the GEMM operands and output are kept unpadded
+    _im2col_output.allocator()->init(input->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_im2col_conv_shape(input->info(), im2col_kernel_dims,
+                                                                                                                                                im2col_conv_info, false, Size2D(1U, 1U), false)));
+    _weights_reshaped.allocator()->init(weights->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_deconvolution_reshaped_weights_shape(*weights->info())));
+    _gemm_output.allocator()->init(input->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_deconvolution_col_shape(*input->info(), *weights->info())));
+
+    _memory_group.manage(&_im2col_output);
+    _memory_group.manage(&_gemm_output);
+
+    // Lay the input out as a matrix with one row per pixel
+    _im2col_kernel.configure(input, &_im2col_output, im2col_kernel_dims, im2col_conv_info, false);
+
+    // Reshape the weights so that a single GEMM computes all the contributions of every pixel
+    _reshape_weights_kernel.configure(weights, &_weights_reshaped);
+
+    _mm_gemm.configure(&_im2col_output, &_weights_reshaped, nullptr, &_gemm_output, 1.f, 0.f, GEMMInfo(false, false, true /* Reshape weights only for the first run */));
+    _im2col_output.allocator()->allocate();
+
+    // Accumulate the contributions in the output
+    _col2im_kernel.configure(&_gemm_output, bias, output, Size2D(input->info()->dimension(0), input->info()->dimension(1)),
+                             Size2D(weights->info()->dimension(0), weights->info()->dimension(1)), info, inner_border_right, inner_border_top);
+    _gemm_output.allocator()->allocate();
+}
+
+void NEGEMMDeconvolutionLayer::run()
+{
+    prepare();
+
+    _memory_group.acquire();
+
+    NEScheduler::get().schedule(&_im2col_kernel, Window::DimY);
+    _mm_gemm.run();
+    NEScheduler::get().schedule(&_col2im_kernel, Window::DimY);
+
+    _memory_group.release();
+}
+
+void NEGEMMDeconvolutionLayer::prepare()
+{
+    if(!_is_prepared)
+    {
+        ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
+
+        // Run weights reshaping and mark original weights tensor as unused
+        _weights_reshaped.allocator()->allocate();
+        NEScheduler::get().schedule(&_reshape_weights_kernel, Window::DimZ);
+        _original_weights->mark_as_unused();
+
+        // Prepare GEMM
+        _mm_gemm.prepare();
+        if(!_weights_reshaped.is_used())
+        {
+            _weights_reshaped.allocator()->free();
+        }
+
+        _is_prepared = true;
+    }
+}
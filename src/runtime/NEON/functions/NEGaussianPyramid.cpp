@@ -37,6 +37,7 @@
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "support/ToolchainSupport.h"
 
+#include <algorithm>
 #include <cstddef>
 
 using namespace arm_compute;
@@ -46,11 +47,11 @@ NEGaussianPyramid::NEGaussianPyramid()
 {
 }
 
+constexpr size_t NEGaussianPyramidHalf::max_levels_per_pass;
+
 NEGaussianPyramidHalf::NEGaussianPyramidHalf() // NOLINT
-    : _horizontal_border_handler(),
-      _vertical_border_handler(),
-      _horizontal_reduction(),
-      _vertical_reduction()
+    : _pyramid_kernels(),
+      _num_passes(0)
 {
 }
 
@@ -63,45 +64,24 @@ void NEGaussianPyramidHalf::configure(const ITensor *input, IPyramid *pyramid, B
     ARM_COMPUTE_ERROR_ON(input->info()->dimension(1) != pyramid->info()->height());
     ARM_COMPUTE_ERROR_ON(SCALE_PYRAMID_HALF != pyramid->info()->scale());
 
-    // Constant value to use for vertical fill border when the border mode is CONSTANT
-    const uint16_t pixel_value_u16 = static_cast<uint16_t>(constant_border_value) * 2 + static_cast<uint16_t>(constant_border_value) * 8 + static_cast<uint16_t>(constant_border_value) * 6;
-
     /* Get number of pyramid levels */
     const size_t num_levels = pyramid->info()->num_levels();
 
-    _input   = input;
-    _pyramid = pyramid;
+    _input      = input;
+    _pyramid    = pyramid;
+    _num_passes = DIV_CEIL(num_levels - 1, max_levels_per_pass);
 
-    if(num_levels > 1)
+    if(_num_passes > 0)
     {
-        _horizontal_border_handler = arm_compute::support::cpp14::make_unique<NEFillBorderKernel[]>(num_levels - 1);
-        _vertical_border_handler   = arm_compute::support::cpp14::make_unique<NEFillBorderKernel[]>(num_levels - 1);
-        _horizontal_reduction      = arm_compute::support::cpp14::make_unique<NEGaussianPyramidHorKernel[]>(num_levels - 1);
-        _vertical_reduction        = arm_compute::support::cpp14::make_unique<NEGaussianPyramidVertKernel[]>(num_levels - 1);
+        _pyramid_kernels = arm_compute::support::cpp14::make_unique<NEGaussianPyramidHalfKernel[]>(_num_passes);
 
-        // Apply half scale to the X dimension of the tensor shape
-        TensorShape tensor_shape = pyramid->info()->tensor_shape();
-        tensor_shape.set(0, (pyramid->info()->width() + 1) * SCALE_PYRAMID_HALF);
-
-        PyramidInfo pyramid_info(num_levels - 1, SCALE_PYRAMID_HALF, tensor_shape, Format::S16);
-        _tmp.init(pyramid_info);
-
-        for(unsigned int i = 0; i < num_levels - 1; ++i)
+        for(size_t i = 0; i < _num_passes; ++i)
         {
-            /* Configure horizontal kernel */
-            _horizontal_reduction[i].configure(_pyramid->get_pyramid_level(i), _tmp.get_pyramid_level(i));
+            const size_t first_level = i * max_levels_per_pass;
 
-            /* Configure vertical kernel */
-            _vertical_reduction[i].configure(_tmp.get_pyramid_level(i), _pyramid->get_pyramid_level(i + 1));
-
-            /* Configure border */
-            _horizontal_border_handler[i].configure(_pyramid->get_pyramid_level(i), _horizontal_reduction[i].border_size(), border_mode, PixelValue(constant_border_value));
-
-            /* Configure border */
-            _vertical_border_handler[i].configure(_tmp.get_pyramid_level(i), _vertical_reduction[i].border_size(), border_mode, PixelValue(pixel_value_u16));
+            /* Configure the kernel computing the levels following first_level */
+            _pyramid_kernels[i].configure(_pyramid, first_level, std::min(max_levels_per_pass, num_levels - 1 - first_level), border_mode, constant_border_value);
         }
-
-        _tmp.allocate();
     }
 }
 
@@ -109,18 +89,12 @@ void NEGaussianPyramidHalf::run()
 {
     ARM_COMPUTE_ERROR_ON_MSG(_pyramid == nullptr, "Unconfigured function");
 
-    /* Get number of pyramid levels */
-    const size_t num_levels = _pyramid->info()->num_levels();
-
     /* The first level of the pyramid has the input image */
     _pyramid->get_pyramid_level(0)->copy_from(*_input);
 
-    for(unsigned int i = 0; i < num_levels - 1; ++i)
+    for(size_t i = 0; i < _num_passes; ++i)
     {
-        NEScheduler::get().schedule(_horizontal_border_handler.get() + i, Window::DimZ);
-        NEScheduler::get().schedule(_horizontal_reduction.get() + i, Window::DimY);
-        NEScheduler::get().schedule(_vertical_border_handler.get() + i, Window::DimZ);
-        NEScheduler::get().schedule(_vertical_reduction.get() + i, Window::DimY);
+        NEScheduler::get().schedule(_pyramid_kernels.get() + i, Window::DimY);
     }
 }
 
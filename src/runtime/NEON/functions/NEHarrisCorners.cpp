@@ -234,7 +234,9 @@ void NEHarrisCorners::run()
     _non_max_suppr.run();
 
     // Run corner candidate kernel
+    _candidates.reset(NEScheduler::get().num_threads());
     NEScheduler::get().schedule(&_candidates, Window::DimY);
+    _candidates.merge();
 
     // Run sort & euclidean distance
     NEScheduler::get().schedule(&_sort_euclidean, Window::DimY);
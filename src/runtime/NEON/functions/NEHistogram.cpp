@@ -34,7 +34,7 @@
 using namespace arm_compute;
 
 NEHistogram::NEHistogram()
-    : _histogram_kernel(), _local_hist(), _window_lut(arm_compute::support::cpp14::make_unique<uint32_t[]>(window_lut_default_size)), _local_hist_size(0)
+    : _histogram_kernel(), _window_lut(arm_compute::support::cpp14::make_unique<uint32_t[]>(window_lut_default_size))
 {
 }
 
@@ -43,16 +43,14 @@ void NEHistogram::configure(const IImage *input, IDistribution1D *output)
     ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input);
     ARM_COMPUTE_ERROR_ON(nullptr == output);
 
-    // Allocate space for threads local histograms
-    _local_hist_size = output->num_bins() * NEScheduler::get().num_threads();
-    _local_hist      = arm_compute::support::cpp14::make_unique<uint32_t[]>(_local_hist_size);
-
     // Configure kernel
-    _histogram_kernel.configure(input, output, _local_hist.get(), _window_lut.get());
+    _histogram_kernel.configure(input, output, _window_lut.get());
 }
 
 void NEHistogram::run()
 {
-    // Calculate histogram of input.
+    // Calculate the partial histograms of the threads and add them up
+    _histogram_kernel.reset(NEScheduler::get().num_threads());
     NEScheduler::get().schedule(&_histogram_kernel, Window::DimY);
+    _histogram_kernel.merge();
 }
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEImageToTensor.h"
+
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+using namespace arm_compute;
+
+NEImageToTensor::NEImageToTensor()
+    : _kernel()
+{
+}
+
+void NEImageToTensor::configure(const IImage *input, ITensor *output, const ImageToTensorInfo &info)
+{
+    _kernel.configure(input, output, info);
+}
+
+void NEImageToTensor::configure(const IMultiImage *input, ITensor *output, const ImageToTensorInfo &info)
+{
+    _kernel.configure(input, output, info);
+}
+
+Status NEImageToTensor::validate(const ITensorInfo *input, const ITensorInfo *output, const ImageToTensorInfo &info)
+{
+    return NEImageToTensorKernel::validate(input, output, info);
+}
+
+void NEImageToTensor::run()
+{
+    NEScheduler::get().schedule(&_kernel, Window::DimY);
+}
@@ -23,18 +23,24 @@
  */
 #include "arm_compute/runtime/NEON/functions/NEIntegralImage.h"
 
-#include "arm_compute/core/NEON/kernels/NEIntegralImageKernel.h"
 #include "arm_compute/core/Types.h"
-#include "support/ToolchainSupport.h"
-
-#include <utility>
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 
 using namespace arm_compute;
 
-void NEIntegralImage::configure(const ITensor *input, ITensor *output)
+NEIntegralImage::NEIntegralImage()
+    : _integral_hor(), _integral_vert()
+{
+}
+
+void NEIntegralImage::configure(const ITensor *input, ITensor *output, ITensor *output_squared)
+{
+    _integral_hor.configure(input, output, output_squared);
+    _integral_vert.configure(output, output_squared);
+}
+
+void NEIntegralImage::run()
 {
-    auto k = arm_compute::support::cpp14::make_unique<NEIntegralImageKernel>();
-    k->configure(input, output);
-    _kernel = std::move(k);
-    _border_handler.configure(output, _kernel->border_size(), BorderMode::CONSTANT, static_cast<float>(0.f));
+    NEScheduler::get().schedule(&_integral_hor, Window::DimY);
+    NEScheduler::get().schedule(&_integral_vert, Window::DimX);
 }
@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NELSTMLayer.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include <cstring>
+
+namespace arm_compute
+{
+namespace
+{
+/** Write the transpose of @p src into the rows of @p dst, starting from column @p dst_offset_x.
+ *
+ * The gate weights [K, num_units] are stored one after the other along the X axis of the packed matrix [num_gates * num_units, K].
+ */
+void transpose_into(const ITensor *src, ITensor *dst, unsigned int dst_offset_x)
+{
+    const size_t element_size = src->info()->element_size();
+
+    Window window;
+    window.use_tensor_dimensions(src->info()->tensor_shape());
+
+    Iterator in(src, window);
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        std::memcpy(dst->ptr_to_element(Coordinates(dst_offset_x + id.y(), id.x())), in.ptr(), element_size);
+    },
+    in);
+}
+} // namespace
+
+NELSTMLayer::NELSTMLayer(std::shared_ptr<IMemoryManager> memory_manager)
+    : _memory_group(std::move(memory_manager)), _input_gemm(), _recurrent_gemm(), _projection_gemm(), _cell_kernel(), _output_state_kernel(), _copy_output_state(), _copy_cell_state(),
+      _input_weights(), _recurrent_weights(), _projection_weights(), _input_gates(), _recurrent_gates(), _cell_output(), _original_input_weights(), _original_recurrent_weights(),
+      _original_projection_weights(nullptr), _num_timesteps(1), _has_projection(false), _run_copy_output_state(false), _run_copy_cell_state(false), _is_prepared(false)
+{
+}
+
+void NELSTMLayer::configure(const ITensor *input,
+                            const ITensor *input_to_forget_weights, const ITensor *input_to_cell_weights, const ITensor *input_to_output_weights,
+                            const ITensor *recurrent_to_forget_weights, const ITensor *recurrent_to_cell_weights, const ITensor *recurrent_to_output_weights,
+                            const ITensor *forget_gate_bias, const ITensor *cell_bias, const ITensor *output_gate_bias,
+                            const ITensor *output_state_in, const ITensor *cell_state_in,
+                            ITensor *scratch_buffer, ITensor *output_state_out, ITensor *cell_state_out, ITensor *output,
+                            const LSTMParams<ITensor> &lstm_params, const ActivationLayerInfo &activation_info, float cell_threshold, float projection_threshold)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input,
+                                 input_to_forget_weights, input_to_cell_weights, input_to_output_weights,
+                                 recurrent_to_forget_weights, recurrent_to_cell_weights, recurrent_to_output_weights,
+                                 forget_gate_bias, cell_bias, output_gate_bias,
+                                 output_state_in, cell_state_in,
+                                 scratch_buffer, output_state_out, cell_state_out, output);
+
+    // Set lstm parameters
+    LSTMParams<ITensorInfo> lstm_params_info;
+    if(lstm_params.has_peephole_opt())
+    {
+        lstm_params_info.set_peephole_params(lstm_params.cell_to_forget_weights()->info(), lstm_params.cell_to_output_weights()->info());
+    }
+    if(lstm_params.has_projection())
+    {
+        lstm_params_info.set_projection_params(lstm_params.projection_weights()->info(),
+                                               lstm_params.projection_bias() != nullptr ? lstm_params.projection_bias()->info() : nullptr);
+    }
+    if(!lstm_params.has_cifg_opt())
+    {
+        const ITensorInfo *cell_to_input_weights_info = (lstm_params.has_peephole_opt()) ? lstm_params.cell_to_input_weights()->info() : nullptr;
+        lstm_params_info.set_cifg_params(lstm_params.input_to_input_weights()->info(), lstm_params.recurrent_to_input_weights()->info(),
+                                         cell_to_input_weights_info, lstm_params.input_gate_bias()->info());
+    }
+
+    // Validate
+    ARM_COMPUTE_ERROR_THROW_ON(NELSTMLayer::validate(input->info(), input_to_forget_weights->info(),
+                                                     input_to_cell_weights->info(), input_to_output_weights->info(),
+                                                     recurrent_to_forget_weights->info(), recurrent_to_cell_weights->info(), recurrent_to_output_weights->info(),
+                                                     forget_gate_bias->info(), cell_bias->info(), output_gate_bias->info(),
+                                                     output_state_in->info(), cell_state_in->info(),
+                                                     scratch_buffer->info(), output_state_out->info(), cell_state_out->info(), output->info(),
+                                                     lstm_params_info, activation_info, cell_threshold, projection_threshold));
+
+    const DataType     data_type   = input->info()->data_type();
+    const unsigned int input_size  = input->info()->dimension(0);
+    const unsigned int num_batches = input->info()->dimension(1);
+    const unsigned int num_units   = input_to_output_weights->info()->dimension(1);
+    const unsigned int output_size = recurrent_to_output_weights->info()->dimension(0);
+
+    _is_prepared    = false;
+    _num_timesteps  = input->info()->dimension(2);
+    _has_projection = lstm_params.has_projection();
+
+    // Gates are packed in the order [input (without CIFG), forget, cell, output]
+    _original_input_weights.clear();
+    _original_recurrent_weights.clear();
+    if(!lstm_params.has_cifg_opt())
+    {
+        _original_input_weights.push_back(lstm_params.input_to_input_weights());
+        _original_recurrent_weights.push_back(lstm_params.recurrent_to_input_weights());
+    }
+    _original_input_weights.insert(_original_input_weights.end(), { input_to_forget_weights, input_to_cell_weights, input_to_output_weights });
+    _original_recurrent_weights.insert(_original_recurrent_weights.end(), { recurrent_to_forget_weights, recurrent_to_cell_weights, recurrent_to_output_weights });
+
+    const unsigned int num_gates = _original_input_weights.size();
+
+    // The packed weights are filled in prepare() and handed to the GEMMs as constant right-hand sides, so that they get pre-transposed once
+    const GEMMInfo gemm_info(false, false, true);
+
+    _input_weights.allocator()->init(TensorInfo(TensorShape(num_gates * num_units, input_size), 1, data_type));
+    _recurrent_weights.allocator()->init(TensorInfo(TensorShape(num_gates * num_units, output_size), 1, data_type));
+    _input_gates.allocator()->init(TensorInfo(TensorShape(num_gates * num_units, num_batches, _num_timesteps), 1, data_type));
+    _recurrent_gates.allocator()->init(TensorInfo(TensorShape(num_gates * num_units, num_batches), 1, data_type));
+
+    // Input contribution of the gates for all the time steps
+    _memory_group.manage(&_input_gates);
+    _input_gemm.configure(input, &_input_weights, nullptr, &_input_gates, 1.f, 0.f, gemm_info);
+
+    // Recurrent contribution of the gates. The output state is updated in-place at each time step.
+    _memory_group.manage(&_recurrent_gates);
+    _recurrent_gemm.configure(output_state_out, &_recurrent_weights, nullptr, &_recurrent_gates, 1.f, 0.f, gemm_info);
+
+    // Gate activations, cell update and cell output
+    ITensor *cell_output     = output_state_out;
+    ITensor *sequence_output = output;
+    if(_has_projection)
+    {
+        _cell_output.allocator()->init(TensorInfo(TensorShape(num_units, num_batches), 1, data_type));
+        _memory_group.manage(&_cell_output);
+        cell_output     = &_cell_output;
+        sequence_output = nullptr;
+    }
+    _cell_kernel.configure(&_input_gates, &_recurrent_gates,
+                           lstm_params.has_cifg_opt() ? nullptr : lstm_params.input_gate_bias(), forget_gate_bias, cell_bias, output_gate_bias,
+                           lstm_params.has_peephole_opt() && !lstm_params.has_cifg_opt() ? lstm_params.cell_to_input_weights() : nullptr,
+                           lstm_params.has_peephole_opt() ? lstm_params.cell_to_forget_weights() : nullptr,
+                           lstm_params.has_peephole_opt() ? lstm_params.cell_to_output_weights() : nullptr,
+                           cell_state_out, cell_output, sequence_output, scratch_buffer, activation_info, cell_threshold);
+    _input_gates.allocator()->allocate();
+    _recurrent_gates.allocator()->allocate();
+
+    // Projection of the cell output
+    if(_has_projection)
+    {
+        _original_projection_weights = lstm_params.projection_weights();
+        _projection_weights.allocator()->init(TensorInfo(TensorShape(output_size, num_units), 1, data_type));
+        _projection_gemm.configure(&_cell_output, &_projection_weights, nullptr, output_state_out, 1.f, 0.f, gemm_info);
+        _output_state_kernel.configure(lstm_params.projection_bias(), output_state_out, output, projection_threshold);
+        _cell_output.allocator()->allocate();
+    }
+
+    // The states are updated in-place in the output tensors
+    _run_copy_output_state = output_state_in != output_state_out;
+    _run_copy_cell_state   = cell_state_in != cell_state_out;
+    if(_run_copy_output_state)
+    {
+        _copy_output_state.configure(output_state_in, output_state_out);
+    }
+    if(_run_copy_cell_state)
+    {
+        _copy_cell_state.configure(cell_state_in, cell_state_out);
+    }
+}
+
+Status NELSTMLayer::validate(const ITensorInfo *input,
+                             const ITensorInfo *input_to_forget_weights, const ITensorInfo *input_to_cell_weights, const ITensorInfo *input_to_output_weights,
+                             const ITensorInfo *recurrent_to_forget_weights, const ITensorInfo *recurrent_to_cell_weights, const ITensorInfo *recurrent_to_output_weights,
+                             const ITensorInfo *forget_gate_bias, const ITensorInfo *cell_bias, const ITensorInfo *output_gate_bias,
+                             const ITensorInfo *output_state_in, const ITensorInfo *cell_state_in,
+                             const ITensorInfo *scratch_buffer, const ITensorInfo *output_state_out, const ITensorInfo *cell_state_out, const ITensorInfo *output,
+                             const LSTMParams<ITensorInfo> &lstm_params, const ActivationLayerInfo &activation_info, float cell_threshold, float projection_threshold)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input,
+                                        input_to_forget_weights, input_to_cell_weights, input_to_output_weights,
+                                        recurrent_to_forget_weights, recurrent_to_cell_weights, recurrent_to_output_weights,
+                                        forget_gate_bias, cell_bias, output_gate_bias,
+                                        output_state_in, cell_state_in,
+                                        scratch_buffer, output_state_out, cell_state_out, output);
+
+    // Check data types
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input,
+                                                       input_to_forget_weights, input_to_cell_weights, input_to_output_weights,
+                                                       recurrent_to_forget_weights, recurrent_to_cell_weights, recurrent_to_output_weights,
+                                                       forget_gate_bias, cell_bias, output_gate_bias,
+                                                       output_state_in, cell_state_in,
+                                                       scratch_buffer, output_state_out, cell_state_out, output);
+
+    // Check dimensions
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(input_to_forget_weights->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(input_to_cell_weights->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(input_to_output_weights->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(recurrent_to_forget_weights->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(recurrent_to_cell_weights->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(recurrent_to_output_weights->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(output_state_in->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(cell_state_in->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(output->num_dimensions() > 3);
+
+    const unsigned int input_size    = input->dimension(0);
+    const unsigned int num_batches   = input->dimension(1);
+    const unsigned int num_timesteps = input->dimension(2);
+    const unsigned int num_units     = input_to_output_weights->dimension(1);
+    const unsigned int output_size   = recurrent_to_output_weights->dimension(0);
+    const unsigned int num_gates     = lstm_params.has_cifg_opt() ? 3 : 4;
+    const DataType     data_type     = input->data_type();
+
+    const TensorShape input_weights_shape(input_size, num_units);
+    const TensorShape recurrent_weights_shape(output_size, num_units);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(input_to_forget_weights->tensor_shape(), input_weights_shape);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(input_to_cell_weights->tensor_shape(), input_weights_shape);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(input_to_output_weights->tensor_shape(), input_weights_shape);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(recurrent_to_forget_weights->tensor_shape(), recurrent_weights_shape);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(recurrent_to_cell_weights->tensor_shape(), recurrent_weights_shape);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(recurrent_to_output_weights->tensor_shape(), recurrent_weights_shape);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output_state_in->tensor_shape(), TensorShape(output_size, num_batches));
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(cell_state_in->tensor_shape(), TensorShape(num_units, num_batches));
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), TensorShape(output_size, num_batches, num_timesteps));
+    ARM_COMPUTE_RETURN_ON_ERROR(NECopyKernel::validate(output_state_in, output_state_out));
+    ARM_COMPUTE_RETURN_ON_ERROR(NECopyKernel::validate(cell_state_in, cell_state_out));
+
+    if(!lstm_params.has_cifg_opt())
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lstm_params.input_to_input_weights(),
+                                            lstm_params.recurrent_to_input_weights(),
+                                            lstm_params.input_gate_bias());
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, lstm_params.input_to_input_weights(), lstm_params.recurrent_to_input_weights());
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(lstm_params.input_to_input_weights()->tensor_shape(), input_weights_shape);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(lstm_params.recurrent_to_input_weights()->tensor_shape(), recurrent_weights_shape);
+        ARM_COMPUTE_RETURN_ERROR_ON(lstm_params.has_peephole_opt() && lstm_params.cell_to_input_weights() == nullptr);
+    }
+    if(lstm_params.has_peephole_opt())
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lstm_params.cell_to_output_weights(), lstm_params.cell_to_forget_weights());
+    }
+
+    // Validate the GEMMs on the packed weights
+    const TensorInfo input_weights(TensorShape(num_gates * num_units, input_size), 1, data_type);
+    const TensorInfo recurrent_weights(TensorShape(num_gates * num_units, output_size), 1, data_type);
+    const TensorInfo input_gates(TensorShape(num_gates * num_units, num_batches, num_timesteps), 1, data_type);
+    const TensorInfo recurrent_gates(TensorShape(num_gates * num_units, num_batches), 1, data_type);
+    const GEMMInfo   gemm_info(false, false, true);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMM::validate(input, &input_weights, nullptr, &input_gates, 1.f, 0.f, gemm_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMM::validate(output_state_out, &recurrent_weights, nullptr, &recurrent_gates, 1.f, 0.f, gemm_info));
+
+    // Validate the cell and the projection
+    const TensorInfo   cell_output(TensorShape(num_units, num_batches), 1, data_type);
+    const ITensorInfo *cell_to_input_weights = lstm_params.has_peephole_opt() && !lstm_params.has_cifg_opt() ? lstm_params.cell_to_input_weights() : nullptr;
+    if(lstm_params.has_projection())
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(lstm_params.projection_weights());
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, lstm_params.projection_weights());
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(lstm_params.projection_weights()->tensor_shape(), TensorShape(num_units, output_size));
+
+        const TensorInfo projection_weights(TensorShape(output_size, num_units), 1, data_type);
+        ARM_COMPUTE_RETURN_ON_ERROR(NELSTMCellKernel::validate(&input_gates, &recurrent_gates,
+                                                               lstm_params.has_cifg_opt() ? nullptr : lstm_params.input_gate_bias(), forget_gate_bias, cell_bias, output_gate_bias,
+                                                               cell_to_input_weights, lstm_params.cell_to_forget_weights(), lstm_params.cell_to_output_weights(),
+                                                               cell_state_out, &cell_output, nullptr, scratch_buffer, activation_info, cell_threshold));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEGEMM::validate(&cell_output, &projection_weights, nullptr, output_state_out, 1.f, 0.f, gemm_info));
+        ARM_COMPUTE_RETURN_ON_ERROR(NELSTMOutputStateKernel::validate(lstm_params.projection_bias(), output_state_out, output, projection_threshold));
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(output_size != num_units, "Without projection the output size must match the number of units");
+        ARM_COMPUTE_RETURN_ON_ERROR(NELSTMCellKernel::validate(&input_gates, &recurrent_gates,
+                                                               lstm_params.has_cifg_opt() ? nullptr : lstm_params.input_gate_bias(), forget_gate_bias, cell_bias, output_gate_bias,
+                                                               cell_to_input_weights, lstm_params.cell_to_forget_weights(), lstm_params.cell_to_output_weights(),
+                                                               cell_state_out, output_state_out, output, scratch_buffer, activation_info, cell_threshold));
+    }
+
+    return Status{};
+}
+
+void NELSTMLayer::run()
+{
+    prepare();
+
+    _memory_group.acquire();
+
+    if(_run_copy_output_state)
+    {
+        NEScheduler::get().schedule(&_copy_output_state, Window::DimY);
+    }
+    if(_run_copy_cell_state)
+    {
+        NEScheduler::get().schedule(&_copy_cell_state, Window::DimY);
+    }
+
+    _input_gemm.run();
+
+    for(unsigned int t = 0; t < _num_timesteps; ++t)
+    {
+        _recurrent_gemm.run();
+
+        _cell_kernel.set_timestep(t);
+        NEScheduler::get().schedule(&_cell_kernel, Window::DimX);
+
+        if(_has_projection)
+        {
+            _projection_gemm.run();
+
+            _output_state_kernel.set_timestep(t);
+            NEScheduler::get().schedule(&_output_state_kernel, Window::DimX);
+        }
+    }
+
+    _memory_group.release();
+}
+
+void NELSTMLayer::prepare()
+{
+    if(!_is_prepared)
+    {
+        auto release_unused = [](Tensor * w)
+        {
+            if(!w->is_used())
+            {
+                w->allocator()->free();
+            }
+        };
+
+        const unsigned int num_units = _original_input_weights[0]->info()->dimension(1);
+
+        // Pack the gate weights
+        _input_weights.allocator()->allocate();
+        _recurrent_weights.allocator()->allocate();
+        for(unsigned int gate = 0; gate < _original_input_weights.size(); ++gate)
+        {
+            transpose_into(_original_input_weights[gate], &_input_weights, gate * num_units);
+            transpose_into(_original_recurrent_weights[gate], &_recurrent_weights, gate * num_units);
+            _original_input_weights[gate]->mark_as_unused();
+            _original_recurrent_weights[gate]->mark_as_unused();
+        }
+
+        _input_gemm.prepare();
+        _recurrent_gemm.prepare();
+        release_unused(&_input_weights);
+        release_unused(&_recurrent_weights);
+
+        if(_has_projection)
+        {
+            _projection_weights.allocator()->allocate();
+            transpose_into(_original_projection_weights, &_projection_weights, 0);
+            _original_projection_weights->mark_as_unused();
+
+            _projection_gemm.prepare();
+            release_unused(&_projection_weights);
+        }
+
+        _is_prepared = true;
+    }
+}
+} // namespace arm_compute
@@ -27,10 +27,7 @@
 #include "arm_compute/core/IPyramid.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Validate.h"
-#include "arm_compute/runtime/NEON/functions/NEArithmeticSubtraction.h"
-#include "arm_compute/runtime/NEON/functions/NEDepthConvertLayer.h"
-#include "arm_compute/runtime/NEON/functions/NEGaussian5x5.h"
-#include "arm_compute/runtime/NEON/functions/NEGaussianPyramid.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "support/ToolchainSupport.h"
 
@@ -38,12 +35,8 @@ using namespace arm_compute;
 
 NELaplacianPyramid::NELaplacianPyramid() // NOLINT
     : _num_levels(0),
-      _gaussian_pyr_function(),
-      _convf(),
-      _subf(),
-      _gauss_pyr(),
-      _conv_pyr(),
-      _depth_function()
+      _laplacian_kernels(),
+      _gauss_pyr()
 {
 }
 
@@ -51,22 +44,11 @@ void NELaplacianPyramid::run()
 {
     ARM_COMPUTE_ERROR_ON_MSG(0 == _num_levels, "Unconfigured function");
 
-    // Compute Gaussian Pyramid
-    _gaussian_pyr_function.run();
-
+    // Each level computes its laplacian and the next level of the gaussian pyramid
     for(unsigned int i = 0; i < _num_levels; ++i)
     {
-        // Apply Gaussian filter to gaussian pyramid image
-        _convf[i].run();
+        NEScheduler::get().schedule(_laplacian_kernels.get() + i, Window::DimY);
     }
-
-    for(unsigned int i = 0; i < _num_levels; ++i)
-    {
-        // Compute laplacian image
-        _subf[i].run();
-    }
-
-    _depth_function.run();
 }
 
 void NELaplacianPyramid::configure(const ITensor *input, IPyramid *pyramid, ITensor *output, BorderMode border_mode, uint8_t constant_border_value)
@@ -82,27 +64,30 @@ void NELaplacianPyramid::configure(const ITensor *input, IPyramid *pyramid, ITen
 
     _num_levels = pyramid->info()->num_levels();
 
-    // Create and initialize the gaussian pyramid and the convoluted pyramid
-    PyramidInfo pyramid_info;
-    pyramid_info.init(_num_levels, 0.5f, pyramid->info()->tensor_shape(), arm_compute::Format::U8);
+    // Create and initialize the levels 1 to n-1 of the gaussian pyramid, level 0 is the input
+    if(_num_levels > 1)
+    {
+        PyramidInfo pyramid_info;
+        pyramid_info.init(_num_levels - 1, SCALE_PYRAMID_HALF, pyramid->get_pyramid_level(1)->info()->tensor_shape(), arm_compute::Format::U8);
 
-    _gauss_pyr.init(pyramid_info);
-    _conv_pyr.init(pyramid_info);
+        _gauss_pyr.init(pyramid_info);
+    }
 
-    // Create Gaussian Pyramid function
-    _gaussian_pyr_function.configure(input, &_gauss_pyr, border_mode, constant_border_value);
+    _laplacian_kernels = arm_compute::support::cpp14::make_unique<NELaplacianPyramidKernel[]>(_num_levels);
 
-    _convf = arm_compute::support::cpp14::make_unique<NEGaussian5x5[]>(_num_levels);
-    _subf  = arm_compute::support::cpp14::make_unique<NEArithmeticSubtraction[]>(_num_levels);
+    const size_t last_level = _num_levels - 1;
 
-    for(unsigned int i = 0; i < _num_levels; ++i)
+    for(size_t i = 0; i < _num_levels; ++i)
     {
-        _convf[i].configure(_gauss_pyr.get_pyramid_level(i), _conv_pyr.get_pyramid_level(i), border_mode, constant_border_value);
-        _subf[i].configure(_gauss_pyr.get_pyramid_level(i), _conv_pyr.get_pyramid_level(i), pyramid->get_pyramid_level(i), ConvertPolicy::WRAP);
-    }
+        const ITensor *level_input = (i == 0) ? input : _gauss_pyr.get_pyramid_level(i - 1);
+        ITensor       *next_level  = (i < last_level) ? _gauss_pyr.get_pyramid_level(i) : nullptr;
+        ITensor       *lowpass     = (i == last_level) ? output : nullptr;
 
-    _depth_function.configure(_conv_pyr.get_pyramid_level(_num_levels - 1), output, ConvertPolicy::WRAP, 0);
+        _laplacian_kernels[i].configure(level_input, pyramid->get_pyramid_level(i), next_level, lowpass, border_mode, constant_border_value);
+    }
 
-    _gauss_pyr.allocate();
-    _conv_pyr.allocate();
+    if(_num_levels > 1)
+    {
+        _gauss_pyr.allocate();
+    }
 }
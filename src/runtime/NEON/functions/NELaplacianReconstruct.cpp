@@ -28,22 +28,25 @@
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "support/ToolchainSupport.h"
 
+#include <algorithm>
 #include <cstddef>
 
 using namespace arm_compute;
 
 NELaplacianReconstruct::NELaplacianReconstruct() // NOLINT
-    : _tmp_pyr(),
-      _addf(),
-      _scalef(),
-      _depthf()
+    : _num_kernels(0),
+      _reconstruct_kernels(),
+      _tmp_pyr()
 {
 }
 
 void NELaplacianReconstruct::configure(const IPyramid *pyramid, ITensor *input, ITensor *output, BorderMode border_mode, uint8_t constant_border_value)
 {
+    ARM_COMPUTE_UNUSED(border_mode);
+    ARM_COMPUTE_UNUSED(constant_border_value);
     ARM_COMPUTE_ERROR_ON(nullptr == pyramid);
     ARM_COMPUTE_ERROR_ON(input == output);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::S16);
@@ -56,48 +59,53 @@ void NELaplacianReconstruct::configure(const IPyramid *pyramid, ITensor *input,
     ARM_COMPUTE_ERROR_ON(input->info()->dimension(1) != pyramid->get_pyramid_level(pyramid->info()->num_levels() - 1)->info()->dimension(1));
 
     const size_t num_levels = pyramid->info()->num_levels();
+    const size_t last_level = num_levels - 1;
 
-    // Create and initialize the tmp pyramid: I(n-2) = upsample( input + Laplace(n-1) )
-    PyramidInfo pyramid_info;
-    pyramid_info.init(num_levels, 0.5f, output->info()->tensor_shape(), arm_compute::Format::S16);
+    _reconstruct_kernels = arm_compute::support::cpp14::make_unique<NELaplacianReconstructKernel[]>(std::max<size_t>(last_level, 1));
 
-    _tmp_pyr.init(pyramid_info);
+    if(num_levels == 1)
+    {
+        // output = input + L(0)
+        _num_kernels = 1;
+        _reconstruct_kernels[0].configure(input, nullptr, pyramid->get_pyramid_level(0), output);
+        return;
+    }
 
-    // Allocate add and scale functions. Level 0 does not need to be scaled.
-    _addf   = arm_compute::support::cpp14::make_unique<NEArithmeticAddition[]>(num_levels);
-    _scalef = arm_compute::support::cpp14::make_unique<NEScale[]>(num_levels - 1);
+    _num_kernels = last_level;
 
-    const size_t last_level = num_levels - 1;
+    // Create and initialize the tmp pyramid holding I(1) to I(n-2)
+    if(num_levels > 2)
+    {
+        PyramidInfo pyramid_info;
+        pyramid_info.init(num_levels - 2, SCALE_PYRAMID_HALF, pyramid->get_pyramid_level(1)->info()->tensor_shape(), arm_compute::Format::S16);
 
-    _addf[last_level].configure(input, pyramid->get_pyramid_level(last_level), _tmp_pyr.get_pyramid_level(last_level), ConvertPolicy::SATURATE);
+        _tmp_pyr.init(pyramid_info);
+    }
 
-    // Scale levels n-1 to 1, and add levels n-2 to 0
+    // I(l) = upsample(I(l+1)) + L(l) for l = [n-2, 0], with I(n-1) = input + L(n-1) computed while upsampling
     for(size_t l = 0; l < last_level; ++l)
     {
-        _scalef[l].configure(_tmp_pyr.get_pyramid_level(l + 1), _tmp_pyr.get_pyramid_level(l), arm_compute::InterpolationPolicy::NEAREST_NEIGHBOR, border_mode, constant_border_value);
-        _addf[l].configure(_tmp_pyr.get_pyramid_level(l), pyramid->get_pyramid_level(l), _tmp_pyr.get_pyramid_level(l), ConvertPolicy::SATURATE);
-    }
+        const bool     first_pass    = (l + 1 == last_level);
+        const ITensor *low           = first_pass ? input : _tmp_pyr.get_pyramid_level(l);
+        const ITensor *low_laplacian = first_pass ? pyramid->get_pyramid_level(last_level) : nullptr;
+        ITensor       *level_output  = (l == 0) ? output : _tmp_pyr.get_pyramid_level(l - 1);
 
-    // Convert level 0 from S16 to U8
-    _depthf.configure(_tmp_pyr.get_pyramid_level(0), output, ConvertPolicy::SATURATE, 0);
+        _reconstruct_kernels[l].configure(low, low_laplacian, pyramid->get_pyramid_level(l), level_output);
+    }
 
-    _tmp_pyr.allocate();
+    if(num_levels > 2)
+    {
+        _tmp_pyr.allocate();
+    }
 }
 
 void NELaplacianReconstruct::run()
 {
-    ARM_COMPUTE_ERROR_ON_MSG(_addf == nullptr, "Unconfigured function");
+    ARM_COMPUTE_ERROR_ON_MSG(0 == _num_kernels, "Unconfigured function");
 
-    const size_t last_level = _tmp_pyr.info()->num_levels() - 1;
-
-    _addf[last_level].run();
-
-    // Run l = [last_level - 1, 0]
-    for(size_t l = last_level; l-- > 0;)
+    // Run l = [_num_kernels - 1, 0]
+    for(size_t l = _num_kernels; l-- > 0;)
     {
-        _scalef[l].run();
-        _addf[l].run();
+        NEScheduler::get().schedule(_reconstruct_kernels.get() + l, Window::DimY);
     }
-
-    _depthf.run();
 }
@@ -28,21 +28,22 @@
 using namespace arm_compute;
 
 NEMeanStdDev::NEMeanStdDev()
-    : _mean_stddev_kernel(), _fill_border_kernel(), _global_sum(0), _global_sum_squared(0)
+    : _mean_stddev_kernel(), _fill_border_kernel()
 {
 }
 
 void NEMeanStdDev::configure(IImage *input, float *mean, float *stddev)
 {
-    _mean_stddev_kernel.configure(input, mean, &_global_sum, stddev, &_global_sum_squared);
+    _mean_stddev_kernel.configure(input, mean, stddev);
     _fill_border_kernel.configure(input, _mean_stddev_kernel.border_size(), BorderMode::CONSTANT, PixelValue(static_cast<uint8_t>(0)));
 }
 
 void NEMeanStdDev::run()
 {
-    _global_sum         = 0;
-    _global_sum_squared = 0;
-
     NEScheduler::get().schedule(&_fill_border_kernel, Window::DimZ);
+
+    // Accumulate the partial sums of the threads and compute the results from their total
+    _mean_stddev_kernel.reset(NEScheduler::get().num_threads());
     NEScheduler::get().schedule(&_mean_stddev_kernel, Window::DimY);
+    _mean_stddev_kernel.merge();
 }
@@ -40,11 +40,15 @@ void NEMinMaxLocation::configure(const IImage *input, void *min, void *max, ICoo
 
 void NEMinMaxLocation::run()
 {
-    _min_max.reset();
+    const unsigned int num_threads = NEScheduler::get().num_threads();
 
     /* Run min max kernel */
+    _min_max.reset(num_threads);
     NEScheduler::get().schedule(&_min_max, Window::DimY);
+    _min_max.merge();
 
     /* Run min max location */
+    _min_max_loc.reset(num_threads);
     NEScheduler::get().schedule(&_min_max_loc, Window::DimY);
+    _min_max_loc.merge();
 }
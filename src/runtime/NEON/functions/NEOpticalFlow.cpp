@@ -25,21 +25,59 @@
 
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
 #include "arm_compute/core/NEON/kernels/NELKTrackerKernel.h"
+#include "arm_compute/core/NEON/kernels/NEScharr3x3Kernel.h"
+#include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Window.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
-#include "arm_compute/runtime/NEON/functions/NEScharr3x3.h"
 #include "arm_compute/runtime/Pyramid.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "support/ToolchainSupport.h"
 
+#include <algorithm>
+#include <vector>
+
 using namespace arm_compute;
 
+namespace
+{
+/** Append the workloads running @p kernel to a batch of workloads
+ *
+ * @param[in, out] workloads       Batch of workloads.
+ * @param[in]      kernel          Kernel to run.
+ * @param[in]      split_dimension Dimension along which to split the kernel's execution window.
+ * @param[in]      num_windows     Number of workloads to split the kernel's execution window into.
+ */
+void append_workloads(std::vector<IScheduler::Workload> &workloads, INEKernel *kernel, unsigned int split_dimension, unsigned int num_windows)
+{
+    const unsigned int num_iterations = kernel->window().num_iterations(split_dimension);
+
+    if(!kernel->is_parallelisable())
+    {
+        num_windows = 1;
+    }
+
+    num_windows = std::max(1u, std::min(num_windows, num_iterations));
+
+    for(unsigned int t = 0; t < num_windows; ++t)
+    {
+        workloads.emplace_back([kernel, split_dimension, t, num_windows](const ThreadInfo & info)
+        {
+            Window win = kernel->window().split_window(split_dimension, t, num_windows);
+            win.validate();
+            kernel->run(win, info);
+        });
+    }
+}
+} // namespace
+
 NEOpticalFlow::NEOpticalFlow(std::shared_ptr<IMemoryManager> memory_manager) // NOLINT
     : _memory_group(std::move(memory_manager)),
-      _func_scharr(),
+      _kernel_border(),
+      _kernel_scharr(),
       _kernel_tracker(),
       _scharr_gx(),
       _scharr_gy(),
@@ -74,7 +112,8 @@ void NEOpticalFlow::configure(const Pyramid *old_pyramid, const Pyramid *new_pyr
 
     const float pyr_scale = old_pyramid->info()->scale();
 
-    _func_scharr    = arm_compute::support::cpp14::make_unique<NEScharr3x3[]>(_num_levels);
+    _kernel_border  = arm_compute::support::cpp14::make_unique<NEFillBorderKernel[]>(_num_levels);
+    _kernel_scharr  = arm_compute::support::cpp14::make_unique<NEScharr3x3Kernel[]>(_num_levels);
     _kernel_tracker = arm_compute::support::cpp14::make_unique<NELKTrackerKernel[]>(_num_levels);
     _scharr_gx      = arm_compute::support::cpp14::make_unique<Tensor[]>(_num_levels);
     _scharr_gy      = arm_compute::support::cpp14::make_unique<Tensor[]>(_num_levels);
@@ -103,7 +142,8 @@ void NEOpticalFlow::configure(const Pyramid *old_pyramid, const Pyramid *new_pyr
         _memory_group.manage(_scharr_gy.get() + i);
 
         // Init Scharr kernel
-        _func_scharr[i].configure(old_ith_input, _scharr_gx.get() + i, _scharr_gy.get() + i, border_mode, constant_border_value);
+        _kernel_scharr[i].configure(old_ith_input, _scharr_gx.get() + i, _scharr_gy.get() + i, border_mode == BorderMode::UNDEFINED);
+        _kernel_border[i].configure(old_ith_input, _kernel_scharr[i].border_size(), border_mode, PixelValue(constant_border_value));
 
         // Init Lucas-Kanade kernel
         _kernel_tracker[i].configure(old_ith_input, new_ith_input, _scharr_gx.get() + i, _scharr_gy.get() + i,
@@ -111,7 +151,12 @@ void NEOpticalFlow::configure(const Pyramid *old_pyramid, const Pyramid *new_pyr
                                      &_old_points_internal, &_new_points_internal,
                                      termination, use_initial_estimate, epsilon, num_iterations, window_dimension,
                                      i, _num_levels, pyr_scale);
+    }
 
+    // The gradients of all the levels are computed before any tracker runs: allocate them once all the levels are configured
+    // so that their lifetimes overlap and the memory manager does not alias them
+    for(unsigned int i = 0; i < _num_levels; ++i)
+    {
         _scharr_gx[i].allocator()->allocate();
         _scharr_gy[i].allocator()->allocate();
     }
@@ -123,13 +168,41 @@ void NEOpticalFlow::run()
 
     _memory_group.acquire();
 
-    for(unsigned int level = _num_levels; level > 0; --level)
+    // The Scharr gradients of all the levels only depend on the old pyramid: compute them in a single batch,
+    // giving each level a number of workloads proportional to its size so that the small levels do not serialise the threads
+    const unsigned int num_workloads = 3 * NEScheduler::get().num_threads();
+
+    size_t total_pixels = 0;
+    for(unsigned int i = 0; i < _num_levels; ++i)
     {
-        // Run Scharr kernel
-        _func_scharr[level - 1].run();
+        total_pixels += _scharr_gx[i].info()->tensor_shape().total_size();
+    }
+
+    std::vector<IScheduler::Workload> workloads;
+
+    for(unsigned int i = 0; i < _num_levels; ++i)
+    {
+        append_workloads(workloads, _kernel_border.get() + i, Window::DimZ, 1);
+    }
+
+    NEScheduler::get().run_workloads(workloads);
+    workloads.clear();
 
+    for(unsigned int i = 0; i < _num_levels; ++i)
+    {
+        const size_t level_pixels = _scharr_gx[i].info()->tensor_shape().total_size();
+        append_workloads(workloads, _kernel_scharr.get() + i, Window::DimY, DIV_CEIL(num_workloads * level_pixels, total_pixels));
+    }
+
+    NEScheduler::get().run_workloads(workloads);
+
+    // The number of iterations per keypoint varies, split the keypoints dynamically
+    const IScheduler::Hints tracker_hints(Window::DimX, IScheduler::StrategyHint::DYNAMIC);
+
+    for(unsigned int level = _num_levels; level > 0; --level)
+    {
         // Run Lucas-Kanade kernel
-        NEScheduler::get().schedule(_kernel_tracker.get() + level - 1, Window::DimX);
+        NEScheduler::get().schedule(_kernel_tracker.get() + level - 1, tracker_hints);
     }
 
     _memory_group.release();
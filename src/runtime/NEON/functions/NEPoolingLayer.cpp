@@ -23,15 +23,17 @@
  */
 #include "arm_compute/runtime/NEON/functions/NEPoolingLayer.h"
 
+#include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Utils.h"
 
 #include "support/ToolchainSupport.h"
 
 using namespace arm_compute;
 
 NEPoolingLayer::NEPoolingLayer()
-    : _pooling_layer_kernel(), _border_handler(), _is_global_pooling_layer(false), _data_layout(DataLayout::NCHW)
+    : _pooling_layer_kernel(), _border_handler(), _is_global_pooling_layer(false), _data_layout(DataLayout::NCHW), _cost()
 {
 }
 
@@ -65,6 +67,12 @@ void NEPoolingLayer::configure(ITensor *input, ITensor *output, const PoolingLay
         default:
             ARM_COMPUTE_ERROR("Data layout not supported");
     }
+
+    // Each output element reduces a pool_width x pool_height window, L2 pooling squares the elements before accumulating them
+    const unsigned int pool_width   = pool_info.is_global_pooling() ? input->info()->dimension(get_data_layout_dimension_index(_data_layout, DataLayoutDimension::WIDTH)) : pool_info.pool_size().width;
+    const unsigned int pool_height  = pool_info.is_global_pooling() ? input->info()->dimension(get_data_layout_dimension_index(_data_layout, DataLayoutDimension::HEIGHT)) : pool_info.pool_size().height;
+    const uint64_t     ops_per_elem = (pool_info.pool_type() == PoolingType::L2) ? 2 : 1;
+    _cost                           = compute_workload_cost(ops_per_elem * pool_width * pool_height, output->info(), { input->info() });
 }
 
 Status NEPoolingLayer::validate(const ITensorInfo *input, const ITensorInfo *output, const PoolingLayerInfo &pool_info)
@@ -90,4 +98,9 @@ void NEPoolingLayer::run()
         default:
             ARM_COMPUTE_ERROR("Data layout not supported");
     }
-}
\ No newline at end of file
+}
+
+WorkloadCost NEPoolingLayer::cost() const
+{
+    return _cost;
+}
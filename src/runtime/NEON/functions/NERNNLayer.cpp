@@ -34,8 +34,8 @@
 namespace arm_compute
 {
 NERNNLayer::NERNNLayer(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _gemm_state_f(), _add_kernel(), _activation_kernel(), _fully_connected_kernel(), _copy_kernel(), _fully_connected_out(), _gemm_output(), _add_output(),
-      _is_prepared(false)
+    : _memory_group(std::move(memory_manager)), _transpose_weights(), _gemm_input(), _gemm_state_f(), _cell_kernel(), _weights_transposed(), _input_projection(), _gemm_output(),
+      _original_weights(nullptr), _num_timesteps(1), _is_prepared(false)
 {
 }
 
@@ -43,23 +43,38 @@ Status NERNNLayer::validate(const ITensorInfo *input, const ITensorInfo *weights
                             const ITensorInfo *output, const ActivationLayerInfo &info)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, recurrent_weights, bias, hidden_state, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights, recurrent_weights, bias, hidden_state, output);
 
     const int idx_width  = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::WIDTH);
     const int idx_height = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::HEIGHT);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 3);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(recurrent_weights->num_dimensions() > 2);
     ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(idx_width) != weights->dimension(idx_width));
     ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(idx_height) != recurrent_weights->dimension(idx_width));
     ARM_COMPUTE_RETURN_ERROR_ON(recurrent_weights->dimension(idx_width) != recurrent_weights->dimension(idx_height));
     ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() != 1);
     ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(idx_width) != weights->dimension(idx_height));
+    ARM_COMPUTE_RETURN_ERROR_ON(hidden_state->num_dimensions() > 2);
     ARM_COMPUTE_RETURN_ERROR_ON(hidden_state->dimension(idx_width) != weights->dimension(idx_height));
     ARM_COMPUTE_RETURN_ERROR_ON(hidden_state->dimension(idx_height) != input->dimension(idx_height));
-    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), hidden_state->tensor_shape());
 
-    auto shape_info = TensorInfo(misc::shape_calculator::compute_rnn_shape(recurrent_weights, hidden_state->dimension(idx_height)), 1, input->data_type());
+    const unsigned int num_timesteps = input->dimension(2);
 
-    ARM_COMPUTE_RETURN_ON_ERROR(NEFullyConnectedLayer::validate(input, weights, bias, &shape_info));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEArithmeticAdditionKernel::validate(&shape_info, &shape_info, &shape_info, ConvertPolicy::SATURATE));
-    ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayerKernel::validate(&shape_info, &shape_info, info));
+    TensorShape sequence_shape = misc::shape_calculator::compute_rnn_shape(recurrent_weights, hidden_state->dimension(idx_height));
+    sequence_shape.set(2, num_timesteps);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), sequence_shape);
+
+    const GEMMInfo   gemm_info(false, false, true);
+    const TensorInfo weights_transposed(misc::shape_calculator::compute_transposed_shape(*weights), 1, input->data_type());
+    const TensorInfo input_projection(sequence_shape, 1, input->data_type());
+    const TensorInfo gemm_output(hidden_state->tensor_shape(), 1, input->data_type());
+
+    ARM_COMPUTE_RETURN_ON_ERROR(NETransposeKernel::validate(weights, &weights_transposed));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMM::validate(input, &weights_transposed, nullptr, &input_projection, 1.f, 0.f, gemm_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMM::validate(hidden_state, recurrent_weights, nullptr, &gemm_output, 1.f, 0.f, gemm_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(NERNNCellKernel::validate(&input_projection, &gemm_output, bias, hidden_state, output, info));
 
     return Status{};
 }
@@ -70,34 +85,32 @@ void NERNNLayer::configure(const ITensor *input, const ITensor *weights, const I
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, recurrent_weights, bias, hidden_state, output);
     ARM_COMPUTE_ERROR_THROW_ON(NERNNLayer::validate(input->info(), weights->info(), recurrent_weights->info(), bias->info(), hidden_state->info(), output->info(), info));
 
-    const int   idx_height = get_data_layout_dimension_index(input->info()->data_layout(), DataLayoutDimension::HEIGHT);
-    TensorShape shape      = misc::shape_calculator::compute_rnn_shape(recurrent_weights->info(), hidden_state->info()->dimension(idx_height));
+    const DataType data_type = input->info()->data_type();
+    const GEMMInfo gemm_info(false, false, true);
 
-    _is_prepared = false;
+    _is_prepared      = false;
+    _original_weights = weights;
+    _num_timesteps    = input->info()->dimension(2);
 
-    // Manage intermediate buffers and configure
-    _fully_connected_out.allocator()->init(TensorInfo(shape, 1, input->info()->data_type()));
-    _gemm_output.allocator()->init(TensorInfo(shape, 1, input->info()->data_type()));
+    // The transposed weights are filled in prepare() and handed to the GEMM as a constant right-hand side
+    _weights_transposed.allocator()->init(TensorInfo(misc::shape_calculator::compute_transposed_shape(*weights->info()), 1, data_type));
+    _transpose_weights.configure(weights, &_weights_transposed);
 
-    // Manage intermediate buffers and configure
-    _memory_group.manage(&_fully_connected_out);
-    _fully_connected_kernel.configure(input, weights, bias, &_fully_connected_out);
+    // Input contribution of all the time steps, computed by a single GEMM
+    _input_projection.allocator()->init(TensorInfo(output->info()->tensor_shape(), 1, data_type));
+    _memory_group.manage(&_input_projection);
+    _gemm_input.configure(input, &_weights_transposed, nullptr, &_input_projection, 1.f, 0.f, gemm_info);
 
+    // Recurrent contribution of the current time step
+    _gemm_output.allocator()->init(TensorInfo(hidden_state->info()->tensor_shape(), 1, data_type));
     _memory_group.manage(&_gemm_output);
-    _gemm_state_f.configure(hidden_state, recurrent_weights, nullptr, &_gemm_output, 1.f, 0.f);
-
-    _add_output.allocator()->init(TensorInfo(shape, 1, input->info()->data_type()));
-    _memory_group.manage(&_add_output);
+    _gemm_state_f.configure(hidden_state, recurrent_weights, nullptr, &_gemm_output, 1.f, 0.f, gemm_info);
 
-    _add_kernel.configure(&_fully_connected_out, &_gemm_output, &_add_output, ConvertPolicy::SATURATE);
+    // Bias addition and activation. The hidden state is updated in-place and copied to the current time step of the output.
+    _cell_kernel.configure(&_input_projection, &_gemm_output, bias, hidden_state, output, info);
 
-    _fully_connected_out.allocator()->allocate();
+    _input_projection.allocator()->allocate();
     _gemm_output.allocator()->allocate();
-
-    _activation_kernel.configure(&_add_output, hidden_state, info);
-    _add_output.allocator()->allocate();
-
-    _copy_kernel.configure(hidden_state, output);
 }
 
 void NERNNLayer::run()
@@ -106,15 +119,15 @@ void NERNNLayer::run()
 
     _memory_group.acquire();
 
-    _fully_connected_kernel.run();
-
-    _gemm_state_f.run();
+    _gemm_input.run();
 
-    NEScheduler::get().schedule(&_add_kernel, Window::DimY);
-    NEScheduler::get().schedule(&_activation_kernel, Window::DimY);
+    for(unsigned int t = 0; t < _num_timesteps; ++t)
+    {
+        _gemm_state_f.run();
 
-    // copy hidden out to output
-    NEScheduler::get().schedule(&_copy_kernel, Window::DimY);
+        _cell_kernel.set_timestep(t);
+        NEScheduler::get().schedule(&_cell_kernel, Window::DimX);
+    }
 
     _memory_group.release();
 }
@@ -123,7 +136,18 @@ void NERNNLayer::prepare()
 {
     if(!_is_prepared)
     {
-        _fully_connected_kernel.prepare();
+        ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
+
+        _weights_transposed.allocator()->allocate();
+        NEScheduler::get().schedule(&_transpose_weights, Window::DimY);
+        _original_weights->mark_as_unused();
+
+        _gemm_input.prepare();
+        if(!_weights_transposed.is_used())
+        {
+            _weights_transposed.allocator()->free();
+        }
+
         _gemm_state_f.prepare();
 
         _is_prepared = true;
@@ -34,6 +34,7 @@
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "support/ToolchainSupport.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <utility>
@@ -47,42 +48,44 @@ void precompute_dx_dy_offsets(ITensor *dx, ITensor *dy, ITensor *offsets, float
     ARM_COMPUTE_ERROR_ON(nullptr == offsets);
     ARM_COMPUTE_UNUSED(sampling_policy);
 
-    Window win;
-    win.set(Window::DimX, Window::Dimension(0, offsets->info()->dimension(0), 1));
-    win.set(Window::DimY, Window::Dimension(0, offsets->info()->dimension(1), 1));
+    // The sampling coordinates are separable: the offsets and the X distances only depend on the output column and the Y distances only depend on the output row.
+    // The entries in the padding of the column tables replicate the last column so that the kernel can read them in whole vectors.
+    const int width        = offsets->info()->dimension(0);
+    const int padded_width = width + offsets->info()->padding().right;
+    auto      offsets_ptr  = reinterpret_cast<int32_t *>(offsets->buffer() + offsets->info()->offset_first_element_in_bytes());
 
     if(dx != nullptr && dy != nullptr)
     {
         // Pre-compute the offset and pixel's distance for BILINEAR interpolation
-        Iterator offsets_it(offsets, win);
-        Iterator dx_it(dx, win);
-        Iterator dy_it(dy, win);
+        auto dx_ptr = reinterpret_cast<float *>(dx->buffer() + dx->info()->offset_first_element_in_bytes());
+        auto dy_ptr = reinterpret_cast<float *>(dy->buffer() + dy->info()->offset_first_element_in_bytes());
 
-        execute_window_loop(win, [&](const Coordinates & id)
+        for(int x = 0; x < padded_width; ++x)
         {
-            const float in_x  = (id.x() + 0.5f) * wr - 0.5f;
-            const float in_y  = (id.y() + 0.5f) * hr - 0.5f;
+            const float in_x  = (std::min(x, width - 1) + 0.5f) * wr - 0.5f;
             const int   in_xi = std::floor(in_x);
+
+            offsets_ptr[x] = in_xi * static_cast<int>(input_element_size);
+            dx_ptr[x]      = in_x - in_xi;
+        }
+
+        for(int y = 0; y < static_cast<int>(dy->info()->dimension(0)); ++y)
+        {
+            const float in_y  = (y + 0.5f) * hr - 0.5f;
             const int   in_yi = std::floor(in_y);
 
-            *reinterpret_cast<int32_t *>(offsets_it.ptr()) = in_xi * static_cast<int>(input_element_size);
-            *reinterpret_cast<float *>(dx_it.ptr())        = in_x - in_xi;
-            *reinterpret_cast<float *>(dy_it.ptr())        = in_y - in_yi;
-        },
-        offsets_it, dx_it, dy_it);
+            dy_ptr[y] = in_y - in_yi;
+        }
     }
     else
     {
         // Pre-compute the offset for NEAREST interpolation
-        Iterator offsets_it(offsets, win);
-
-        execute_window_loop(win, [&](const Coordinates & id)
+        for(int x = 0; x < padded_width; ++x)
         {
-            const size_t in_xi = (id.x() + 0.5f) * wr;
+            const size_t in_xi = (std::min(x, width - 1) + 0.5f) * wr;
 
-            *reinterpret_cast<int32_t *>(offsets_it.ptr()) = in_xi * input_element_size;
-        },
-        offsets_it);
+            offsets_ptr[x] = in_xi * input_element_size;
+        }
     }
 }
 } // namespace
@@ -106,8 +109,9 @@ void NEScale::configure(ITensor *input, ITensor *output, InterpolationPolicy pol
     const int        idx_width   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
     const int        idx_height  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
 
-    // Get the tensor shape
-    const TensorShape shape(output->info()->dimension(idx_width), output->info()->dimension(idx_height));
+    // Get the shapes of the per column and per row tables
+    const TensorShape shape_x(output->info()->dimension(idx_width));
+    const TensorShape shape_y(output->info()->dimension(idx_height));
 
     // Compute the ratio between source width/height and destination width/height
     const auto wr = static_cast<float>(input->info()->dimension(idx_width)) / static_cast<float>(output->info()->dimension(idx_width));
@@ -126,7 +130,7 @@ void NEScale::configure(ITensor *input, ITensor *output, InterpolationPolicy pol
     {
         case InterpolationPolicy::NEAREST_NEIGHBOR:
         {
-            TensorInfo tensor_info_offsets(shape, Format::S32);
+            TensorInfo tensor_info_offsets(shape_x, Format::S32);
             _offsets.allocator()->init(tensor_info_offsets);
 
             _scale_kernel.configure(input, nullptr, nullptr, &_offsets, output, policy, border_mode, sampling_policy);
@@ -140,12 +144,13 @@ void NEScale::configure(ITensor *input, ITensor *output, InterpolationPolicy pol
         }
         case InterpolationPolicy::BILINEAR:
         {
-            TensorInfo tensor_info_offsets(shape, Format::S32);
-            TensorInfo tensor_info_dxdy(shape, Format::F32);
+            TensorInfo tensor_info_offsets(shape_x, Format::S32);
+            TensorInfo tensor_info_dx(shape_x, Format::F32);
+            TensorInfo tensor_info_dy(shape_y, Format::F32);
 
             _offsets.allocator()->init(tensor_info_offsets);
-            _dx.allocator()->init(tensor_info_dxdy);
-            _dy.allocator()->init(tensor_info_dxdy);
+            _dx.allocator()->init(tensor_info_dx);
+            _dy.allocator()->init(tensor_info_dy);
 
             _scale_kernel.configure(input, &_dx, &_dy, &_offsets, output, policy, border_mode, sampling_policy);
 
@@ -186,12 +191,13 @@ Status NEScale::validate(const ITensorInfo *input, const ITensorInfo *output, In
     const int        idx_width   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
     const int        idx_height  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
 
-    // Get the tensor shape of auxilary buffers
-    const TensorShape shape(output->dimension(idx_width), output->dimension(idx_height));
+    // Get the tensor shapes of the per column and per row auxilary buffers
+    const TensorShape shape_x(output->dimension(idx_width));
+    const TensorShape shape_y(output->dimension(idx_height));
 
-    TensorInfo tensor_info_offsets(shape, Format::S32);
-    TensorInfo tensor_info_dx(shape, Format::F32);
-    TensorInfo tensor_info_dy(shape, Format::F32);
+    TensorInfo tensor_info_offsets(shape_x, Format::S32);
+    TensorInfo tensor_info_dx(shape_x, Format::F32);
+    TensorInfo tensor_info_dy(shape_y, Format::F32);
 
     switch(policy)
     {
@@ -31,6 +31,8 @@
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
+#include "arm_compute/runtime/Utils.h"
+#include "arm_compute/runtime/WeightsCache.h"
 #include "support/ToolchainSupport.h"
 
 #include "arm_compute/core/NEON/kernels/convolution/winograd/winograd_gemm.hpp"
@@ -111,7 +113,7 @@ bool check_support_fast_math(const Size2D &output_tile, const Size2D &kernel_siz
 NEWinogradConvolutionLayer::NEWinogradConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager)
     : _memory_group(memory_manager), _asm_glue(memory_manager), _transform_input_kernel(nullptr), _transform_output_kernel(nullptr), _transform_weights_kernel(nullptr), _activationlayer_function(),
       _permute_input(), _permute_weights(), _permute_output(), _input_workspace(), _output_workspace(), _kernel_storage(), _input_nhwc(), _output_nhwc(), _weights_hwio(), _input(), _weights(), _output(),
-      _is_prepared(false), _is_activationlayer_enabled(false)
+      _cost(), _is_prepared(false), _is_activationlayer_enabled(false)
 {
 } /* arm_compute */
 
@@ -340,6 +342,10 @@ void NEWinogradConvolutionLayer::configure(const ITensor *input, const ITensor *
     {
         _activationlayer_function.configure(_output, nullptr, act_info);
     }
+
+    // Report the operations of the equivalent direct convolution so that the efficiency is comparable with the other convolution methods
+    const uint64_t macs_per_output = static_cast<uint64_t>(kernel_size.area()) * weights->info()->dimension(channel_idx);
+    _cost                          = compute_workload_cost(2 * macs_per_output + (biases != nullptr ? 1 : 0), output->info(), { input->info(), weights->info(), biases != nullptr ? biases->info() : nullptr });
 }
 
 void NEWinogradConvolutionLayer::run()
@@ -507,16 +513,30 @@ void NEWinogradConvolutionLayer::prepare()
 {
     if(!_is_prepared)
     {
-        // Permute weights
-        _permute_weights.run();
+        // Permute and transform weights (unless shared by another instance)
+        const std::string transformed_key = WeightsCache::scoped_key("transformed_weights");
+        if(!WeightsCache::get().acquire(transformed_key, _kernel_storage))
+        {
+            _permute_weights.run();
+            NEScheduler::get().schedule(_transform_weights_kernel.get(), Window::DimX);
+            WeightsCache::get().publish(transformed_key, _kernel_storage);
+        }
         _weights->mark_as_unused();
-
-        // Transform weights
-        NEScheduler::get().schedule(_transform_weights_kernel.get(), Window::DimX);
         _weights_hwio.allocator()->free();
 
+        // Prepare GEMM and release the transformed weights if pretransposed
+        _asm_glue.prepare();
+        if(!_kernel_storage.is_used())
+        {
+            _kernel_storage.allocator()->free();
+        }
+
         _is_prepared = true;
     }
 }
 
+WorkloadCost NEWinogradConvolutionLayer::cost() const
+{
+    return _cost;
+}
 } // namespace arm_compute
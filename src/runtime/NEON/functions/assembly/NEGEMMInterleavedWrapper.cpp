@@ -30,6 +30,7 @@
 #include "arm_compute/core/NEON/kernels/assembly/NEGEMMInterleavedTransformAWrapper.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/WeightsCache.h"
 
 namespace arm_compute
 {
@@ -52,7 +53,12 @@ void NEGEMMInterleavedWrapper::prepare()
     {
         if(_pretranspose_b)
         {
-            NEScheduler::get().schedule(_prepare_b.get(), Window::DimX);
+            const std::string transformed_key = WeightsCache::scoped_key("transformed_b");
+            if(!WeightsCache::get().acquire(transformed_key, _transformed_b))
+            {
+                NEScheduler::get().schedule(_prepare_b.get(), Window::DimX);
+                WeightsCache::get().publish(transformed_key, _transformed_b);
+            }
             _b->mark_as_unused();
         }
         else
@@ -28,6 +28,7 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/runtime/CPUUtils.h"
+#include "arm_compute/runtime/SchedulerTracer.h"
 
 #include <omp.h>
 
@@ -59,31 +60,62 @@ void OMPScheduler::set_num_threads(unsigned int num_threads)
 void OMPScheduler::schedule(ICPPKernel *kernel, const Hints &hints)
 {
     ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
-    ARM_COMPUTE_ERROR_ON_MSG(hints.strategy() == StrategyHint::DYNAMIC,
-                             "Dynamic scheduling is not supported in OMPScheduler");
 
     const Window      &max_window     = kernel->window();
     const unsigned int num_iterations = max_window.num_iterations(hints.split_dimension());
     const unsigned int num_threads    = std::min(num_iterations, _num_threads);
 
+    SchedulerTracer   &tracer = SchedulerTracer::get();
+    const bool         traced = tracer.is_enabled();
+    const std::string &label  = SchedulerTracer::label();
+
     if(!kernel->is_parallelisable() || num_threads == 1)
     {
         ThreadInfo info;
         info.cpu_info = &_cpu_info;
-        kernel->run(max_window, info);
+        if(traced)
+        {
+            tracer.run(kernel, max_window, info, label, 0, 1);
+        }
+        else
+        {
+            kernel->run(max_window, info);
+        }
     }
     else
     {
-        const unsigned int                num_windows = num_threads;
+        unsigned int num_windows = 0;
+        switch(hints.strategy())
+        {
+            case StrategyHint::STATIC:
+                num_windows = num_threads;
+                break;
+            case StrategyHint::DYNAMIC:
+            {
+                // Make sure we don't use some windows which are too small as this might create some contention when distributing them
+                const unsigned int max_iterations = static_cast<unsigned int>(_num_threads) * 3;
+                num_windows                       = num_iterations > max_iterations ? max_iterations : num_iterations;
+                break;
+            }
+            default:
+                ARM_COMPUTE_ERROR("Unknown strategy");
+        }
         std::vector<IScheduler::Workload> workloads(num_windows);
         for(unsigned int t = 0; t < num_windows; t++)
         {
-            //Capture 't' by copy, all the other variables by reference:
-            workloads[t] = [t, &hints, &max_window, &num_windows, &kernel](const ThreadInfo & info)
+            //Capture 't' and 'traced' by copy, all the other variables by reference:
+            workloads[t] = [t, traced, &hints, &max_window, &num_windows, &kernel, &tracer, &label](const ThreadInfo & info)
             {
                 Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
                 win.validate();
-                kernel->run(win, info);
+                if(traced)
+                {
+                    tracer.run(kernel, win, info, label, t, num_windows);
+                }
+                else
+                {
+                    kernel->run(win, info);
+                }
             };
         }
         run_workloads(workloads);
@@ -101,10 +133,18 @@ void OMPScheduler::run_workloads(std::vector<arm_compute::IScheduler::Workload>
     ThreadInfo info;
     info.cpu_info    = &_cpu_info;
     info.num_threads = num_threads;
+
+    const int num_workloads = static_cast<int>(workloads.size());
+
     #pragma omp parallel firstprivate(info) num_threads(num_threads)
     {
-        const int tid  = omp_get_thread_num();
-        info.thread_id = tid;
-        workloads[tid](info);
+        info.thread_id = omp_get_thread_num();
+
+        // There can be more workloads than threads: distribute them dynamically
+        #pragma omp for schedule(dynamic, 1)
+        for(int wid = 0; wid < num_workloads; ++wid)
+        {
+            workloads[wid](info);
+        }
     }
 }
@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/SchedulerTracer.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <map>
+#include <set>
+#include <utility>
+
+namespace arm_compute
+{
+namespace
+{
+std::string &thread_label()
+{
+    static thread_local std::string label;
+    return label;
+}
+
+/** Escape a string to be used in a JSON document */
+std::string escape_json(const std::string &str)
+{
+    std::string escaped;
+    escaped.reserve(str.size());
+    for(const char c : str)
+    {
+        switch(c)
+        {
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            case '\t':
+                escaped += "\\t";
+                break;
+            default:
+                if(static_cast<unsigned char>(c) >= 0x20)
+                {
+                    escaped += c;
+                }
+                break;
+        }
+    }
+    return escaped;
+}
+
+/** Microseconds elapsed between @p origin and @p t */
+double to_us(SchedulerTracer::Clock::time_point origin, SchedulerTracer::Clock::time_point t)
+{
+    return std::chrono::duration<double, std::micro>(t - origin).count();
+}
+
+/** Write the hardware counters as the members of a JSON object */
+void write_counters(std::ostream &os, const HardwareCounters::Values &counters)
+{
+    for(size_t i = 0; i < counters.size(); ++i)
+    {
+        os << (i == 0 ? "" : ",") << "\"" << HardwareCounters::name(static_cast<HardwareCounters::Counter>(i)) << "\":" << counters[i];
+    }
+}
+} // namespace
+
+SchedulerTracer &SchedulerTracer::get()
+{
+    static SchedulerTracer tracer;
+    return tracer;
+}
+
+SchedulerTracer::SchedulerTracer()
+    : _enabled(false), _num_users(0), _num_counters_users(0), _hardware_counters(false), _origin(Clock::now()), _events(), _mtx()
+{
+}
+
+SchedulerTracer::Clock::time_point SchedulerTracer::start(bool hardware_counters)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    if(hardware_counters && _num_counters_users++ == 0)
+    {
+        _hardware_counters.store(true, std::memory_order_release);
+    }
+    // Only the first user discards the events, the others could still be interested in them
+    if(_num_users++ == 0)
+    {
+        _events.clear();
+        _origin = Clock::now();
+        _enabled.store(true, std::memory_order_release);
+    }
+    return Clock::now();
+}
+
+void SchedulerTracer::stop(bool hardware_counters)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    ARM_COMPUTE_ERROR_ON_MSG(_num_users == 0, "Tracer stopped more times than started");
+    ARM_COMPUTE_ERROR_ON_MSG(hardware_counters && _num_counters_users == 0, "Hardware counters stopped more times than started");
+    if(hardware_counters && _num_counters_users > 0 && --_num_counters_users == 0)
+    {
+        _hardware_counters.store(false, std::memory_order_release);
+    }
+    if(_num_users > 0 && --_num_users == 0)
+    {
+        _enabled.store(false, std::memory_order_release);
+    }
+}
+
+bool SchedulerTracer::is_enabled() const
+{
+    return _enabled.load(std::memory_order_acquire);
+}
+
+bool SchedulerTracer::hardware_counters() const
+{
+    return _hardware_counters.load(std::memory_order_acquire);
+}
+
+void SchedulerTracer::set_label(std::string label)
+{
+    thread_label() = std::move(label);
+}
+
+const std::string &SchedulerTracer::label()
+{
+    return thread_label();
+}
+
+void SchedulerTracer::run(ICPPKernel *kernel, const Window &window, const ThreadInfo &info, const std::string &label, unsigned int window_id, unsigned int num_windows)
+{
+    ARM_COMPUTE_ERROR_ON(kernel == nullptr);
+
+    Event                    event;
+    HardwareCounters::Values counters_start{ {} };
+    const bool               sample_counters = hardware_counters() && HardwareCounters::read(counters_start);
+
+    event.start = Clock::now();
+    kernel->run(window, info);
+    event.end = Clock::now();
+
+    if(sample_counters && HardwareCounters::read(event.counters))
+    {
+        for(size_t i = 0; i < event.counters.size(); ++i)
+        {
+            event.counters[i] -= counters_start[i];
+        }
+        event.has_counters = true;
+    }
+
+    event.kernel      = kernel->name();
+    event.label       = label;
+    event.thread_id   = info.thread_id;
+    event.window_id   = window_id;
+    event.num_windows = num_windows;
+
+    // The end timestamp is taken before locking so that contention doesn't show up in the trace
+    std::lock_guard<std::mutex> lock(_mtx);
+    _events.emplace_back(std::move(event));
+}
+
+std::vector<SchedulerTracer::Event> SchedulerTracer::events(Clock::time_point since) const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    std::vector<Event> events;
+    std::copy_if(_events.begin(), _events.end(), std::back_inserter(events), [&](const Event & event)
+    {
+        return event.start >= since;
+    });
+    return events;
+}
+
+std::vector<SchedulerTracer::KernelStats> SchedulerTracer::summary(Clock::time_point since) const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    std::vector<KernelStats>                              stats;
+    std::map<std::pair<std::string, std::string>, size_t> index;
+    for(const auto &event : _events)
+    {
+        if(event.start < since)
+        {
+            continue;
+        }
+        const auto key = std::make_pair(event.label, event.kernel);
+        auto       it  = index.find(key);
+        if(it == index.end())
+        {
+            KernelStats kernel_stats;
+            kernel_stats.kernel       = event.kernel;
+            kernel_stats.label        = event.label;
+            kernel_stats.has_counters = true;
+            it                        = index.emplace(key, stats.size()).first;
+            stats.emplace_back(std::move(kernel_stats));
+        }
+
+        KernelStats &kernel_stats = stats[it->second];
+        // Windows of a same run are recorded in any order but there is exactly one window 0 per run
+        kernel_stats.num_runs += (event.window_id == 0) ? 1 : 0;
+        kernel_stats.num_windows++;
+        kernel_stats.busy_time_us += to_us(event.start, event.end);
+        kernel_stats.has_counters = kernel_stats.has_counters && event.has_counters;
+        for(size_t i = 0; i < event.counters.size(); ++i)
+        {
+            kernel_stats.counters[i] += event.counters[i];
+        }
+    }
+    return stats;
+}
+
+void SchedulerTracer::write_summary(std::ostream &os, Clock::time_point since) const
+{
+    const std::vector<KernelStats> stats = summary(since);
+
+    const auto flags     = os.flags();
+    const auto precision = os.precision();
+    os << std::fixed << std::setprecision(3);
+
+    os << "[";
+    for(size_t i = 0; i < stats.size(); ++i)
+    {
+        const KernelStats &kernel_stats = stats[i];
+        os << (i == 0 ? "" : ",") << "\n{\"label\":\"" << escape_json(kernel_stats.label) << "\",\"kernel\":\"" << escape_json(kernel_stats.kernel)
+           << "\",\"runs\":" << kernel_stats.num_runs << ",\"windows\":" << kernel_stats.num_windows << ",\"busy_time_us\":" << kernel_stats.busy_time_us;
+        if(kernel_stats.has_counters)
+        {
+            os << ",\"counters\":{";
+            write_counters(os, kernel_stats.counters);
+            os << "}";
+        }
+        os << "}";
+    }
+    os << "\n]\n";
+
+    os.flags(flags);
+    os.precision(precision);
+}
+
+void SchedulerTracer::write_chrome_trace(std::ostream &os, Clock::time_point since) const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    // Timestamps are relative to the start of the recording for this user
+    const Clock::time_point origin = std::max(since, _origin);
+
+    std::set<unsigned int> thread_ids;
+    for(const auto &event : _events)
+    {
+        if(event.start >= since)
+        {
+            thread_ids.insert(event.thread_id);
+        }
+    }
+
+    const auto flags     = os.flags();
+    const auto precision = os.precision();
+    os << std::fixed << std::setprecision(3);
+
+    os << "{\"traceEvents\":[";
+    bool first = true;
+    for(const auto &thread_id : thread_ids)
+    {
+        os << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << thread_id
+           << ",\"args\":{\"name\":\"Thread " << thread_id << "\"}}";
+        first = false;
+    }
+    for(const auto &event : _events)
+    {
+        if(event.start < since)
+        {
+            continue;
+        }
+        os << (first ? "" : ",") << "\n{\"name\":\"" << escape_json(event.kernel) << "\",\"cat\":\"kernel\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.thread_id
+           << ",\"ts\":" << to_us(origin, event.start) << ",\"dur\":" << to_us(event.start, event.end)
+           << ",\"args\":{\"label\":\"" << escape_json(event.label) << "\",\"window\":\"" << event.window_id << "/" << event.num_windows << "\"";
+        if(event.has_counters)
+        {
+            os << ",";
+            write_counters(os, event.counters);
+        }
+        os << "}}";
+        first = false;
+    }
+    os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+
+    os.flags(flags);
+    os.precision(precision);
+}
+
+void SchedulerTracer::save_chrome_trace(const std::string &filename, Clock::time_point since) const
+{
+    std::ofstream fs;
+    fs.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    fs.open(filename, std::ios::out);
+    write_chrome_trace(fs, since);
+}
+} // namespace arm_compute
@@ -23,6 +23,8 @@
  */
 #include "arm_compute/runtime/Utils.h"
 
+#include "arm_compute/core/ITensorInfo.h"
+
 #include <map>
 #include <string>
 
@@ -44,3 +46,20 @@ const std::string &arm_compute::string_from_scheduler_type(Scheduler::Type t)
 
     return scheduler_type_map[t];
 }
+
+uint64_t arm_compute::tensor_size_in_bytes(const ITensorInfo *info)
+{
+    return (info != nullptr) ? static_cast<uint64_t>(info->tensor_shape().total_size()) * info->element_size() : 0;
+}
+
+WorkloadCost arm_compute::compute_workload_cost(uint64_t flops_per_output, const ITensorInfo *output, std::initializer_list<const ITensorInfo *> inputs)
+{
+    WorkloadCost cost;
+    cost.flops = flops_per_output * output->tensor_shape().total_size();
+    cost.bytes = tensor_size_in_bytes(output);
+    for(const auto *input : inputs)
+    {
+        cost.bytes += tensor_size_in_bytes(input);
+    }
+    return cost;
+}
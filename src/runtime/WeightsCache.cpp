@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/WeightsCache.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/Memory.h"
+#include "arm_compute/runtime/MemoryRegion.h"
+#include "arm_compute/runtime/Tensor.h"
+
+namespace arm_compute
+{
+namespace
+{
+/** Key of the weights prepared by the calling thread */
+std::string &current_key()
+{
+    static thread_local std::string key;
+    return key;
+}
+
+/** Key of an entry: entries are only shared between tensors of the same size */
+std::string entry_key(const std::string &key, const Tensor &tensor)
+{
+    return key + "#" + std::to_string(tensor.info()->total_size());
+}
+
+/** Import the memory of an entry into a tensor */
+void import_region(Tensor &tensor, const std::shared_ptr<IMemoryRegion> &region)
+{
+    const Status status = tensor.allocator()->import_memory(Memory(region));
+    ARM_COMPUTE_UNUSED(status);
+    ARM_COMPUTE_ERROR_THROW_ON(status);
+}
+} // namespace
+
+WeightsCache::Scope::Scope(std::string key)
+    : _previous_key(std::move(current_key()))
+{
+    current_key() = std::move(key);
+}
+
+WeightsCache::Scope::~Scope()
+{
+    current_key() = std::move(_previous_key);
+}
+
+WeightsCache &WeightsCache::get()
+{
+    static WeightsCache cache;
+    return cache;
+}
+
+WeightsCache::WeightsCache()
+    : _mtx(), _entries()
+{
+}
+
+std::string WeightsCache::scoped_key(const std::string &tag)
+{
+    const std::string &key = current_key();
+    return key.empty() ? std::string() : key + "/" + tag;
+}
+
+bool WeightsCache::acquire(const std::string &key, Tensor &tensor)
+{
+    if(!key.empty())
+    {
+        const size_t size = tensor.info()->total_size();
+
+        std::lock_guard<std::mutex> lock(_mtx);
+        Entry &entry  = _entries[entry_key(key, tensor)];
+        auto   region = entry.region.lock();
+        if(region != nullptr && entry.is_published)
+        {
+            import_region(tensor, region);
+            return true;
+        }
+        if(region == nullptr)
+        {
+            // First instance preparing the data: the others will import its memory once published
+            region             = std::make_shared<MemoryRegion>(size, tensor.allocator()->alignment());
+            entry.region       = region;
+            entry.is_published = false;
+            import_region(tensor, region);
+            return false;
+        }
+        // Another instance is preparing the data: fall back to a private copy
+    }
+
+    if(tensor.buffer() == nullptr)
+    {
+        tensor.allocator()->allocate();
+    }
+    return false;
+}
+
+void WeightsCache::publish(const std::string &key, const Tensor &tensor)
+{
+    if(key.empty())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    auto it = _entries.find(entry_key(key, tensor));
+    if(it != _entries.end())
+    {
+        auto region = it->second.region.lock();
+        if(region != nullptr && region->buffer() == tensor.buffer())
+        {
+            it->second.is_published = true;
+        }
+    }
+}
+
+size_t WeightsCache::size_in_bytes()
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    size_t size = 0;
+    for(auto it = _entries.begin(); it != _entries.end();)
+    {
+        auto region = it->second.region.lock();
+        if(region == nullptr)
+        {
+            // Drop the entries released by all their tensors
+            it = _entries.erase(it);
+        }
+        else
+        {
+            size += region->size();
+            ++it;
+        }
+    }
+    return size;
+}
+
+void WeightsCache::clear()
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    _entries.clear();
+}
+} // namespace arm_compute
@@ -26,6 +26,7 @@
 #include "arm_compute/runtime/Tensor.h"
 #include "tests/NEON/Accessor.h"
 #include "tests/benchmark/fixtures/CannyEdgeFixture.h"
+#include "tests/benchmark/fixtures/ThreadScalingFixture.h"
 #include "tests/datasets/BorderModeDataset.h"
 #include "tests/datasets/ImageFileDatasets.h"
 #include "tests/framework/Macros.h"
@@ -46,9 +47,11 @@ const auto use_fp16           = framework::dataset::make("UseFP16", { false });
 const auto canny_edge_dataset = combine(framework::dataset::make("GradientSize", { 3, 5, 7 }),
                                 combine(framework::dataset::make("Normalization", { MagnitudeType::L1NORM, MagnitudeType::L2NORM }),
                                 combine(datasets::BorderModes(), use_fp16)));
+const auto num_threads        = framework::dataset::make("Threads", { 1, 2, 4, 8 });
 } // namespace
 
-using NECannyEdgeFixture = CannyEdgeFixture<Tensor, NECannyEdge, Accessor>;
+using NECannyEdgeFixture              = CannyEdgeFixture<Tensor, NECannyEdge, Accessor>;
+using NECannyEdgeThreadScalingFixture = ThreadScalingFixture<NECannyEdgeFixture>;
 
 TEST_SUITE(NEON)
 TEST_SUITE(CannyEdge)
@@ -64,6 +67,13 @@ REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NECannyEdgeFixture, framework::Dataset
                                 datasets::LargeImageFiles(),
                                 canny_edge_dataset),
                                 framework::dataset::make("Format", Format::U8)));
+
+REGISTER_FIXTURE_DATA_TEST_CASE(RunThreadScaling, NECannyEdgeThreadScalingFixture, framework::DatasetMode::NIGHTLY,
+                                combine(combine(combine(
+                                num_threads,
+                                datasets::LargeImageFiles()),
+                                canny_edge_dataset),
+                                framework::dataset::make("Format", Format::U8)));
 // clang-format on
 // *INDENT-ON*
 
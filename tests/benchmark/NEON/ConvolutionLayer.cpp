@@ -125,6 +125,39 @@ REGISTER_FIXTURE_DATA_TEST_CASE(MobileNetConvolutionLayer, NEGEMMConvolutionLaye
                                                                                         data_types),
                                                             framework::dataset::make("Batches", 1)));
 
+// Compare the implicit GEMM path against the im2col path on the networks' layers
+using NEGEMMConvolutionLayerImplicitGEMMFixture = ConvolutionLayerImplicitGEMMFixture<Tensor, NEGEMMConvolutionLayer, Accessor>;
+
+TEST_SUITE(ImplicitGEMM)
+REGISTER_FIXTURE_DATA_TEST_CASE(AlexNetConvolutionLayer, NEGEMMConvolutionLayerImplicitGEMMFixture, framework::DatasetMode::ALL,
+                                framework::dataset::combine(framework::dataset::combine(framework::dataset::combine(framework::dataset::combine(datasets::AlexNetConvolutionLayerDataset(),
+                                                                                                                    framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))),
+                                                                                                                    framework::dataset::make("DataType", DataType::F32)),
+                                                                                        framework::dataset::make("Batches", 1)),
+                                                            framework::dataset::make("ImplicitGEMM", { false, true })));
+
+REGISTER_FIXTURE_DATA_TEST_CASE(GoogLeNetInceptionV1ConvolutionLayer, NEGEMMConvolutionLayerImplicitGEMMFixture, framework::DatasetMode::ALL,
+                                framework::dataset::combine(framework::dataset::combine(framework::dataset::combine(framework::dataset::combine(datasets::GoogLeNetInceptionV1ConvolutionLayerDataset(),
+                                                                                                                    framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))),
+                                                                                                                    framework::dataset::make("DataType", DataType::F32)),
+                                                                                        framework::dataset::make("Batches", 1)),
+                                                            framework::dataset::make("ImplicitGEMM", { false, true })));
+
+REGISTER_FIXTURE_DATA_TEST_CASE(SqueezeNetConvolutionLayer, NEGEMMConvolutionLayerImplicitGEMMFixture, framework::DatasetMode::ALL,
+                                framework::dataset::combine(framework::dataset::combine(framework::dataset::combine(framework::dataset::combine(datasets::SqueezeNetConvolutionLayerDataset(),
+                                                                                                                    framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))),
+                                                                                                                    framework::dataset::make("DataType", DataType::F32)),
+                                                                                        framework::dataset::make("Batches", 1)),
+                                                            framework::dataset::make("ImplicitGEMM", { false, true })));
+
+REGISTER_FIXTURE_DATA_TEST_CASE(VGG16ConvolutionLayer, NEGEMMConvolutionLayerImplicitGEMMFixture, framework::DatasetMode::ALL,
+                                framework::dataset::combine(framework::dataset::combine(framework::dataset::combine(framework::dataset::combine(datasets::VGG16ConvolutionLayerDataset(),
+                                                                                                                    framework::dataset::make("ActivationInfo", ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU))),
+                                                                                                                    framework::dataset::make("DataType", DataType::F32)),
+                                                                                        framework::dataset::make("Batches", 1)),
+                                                            framework::dataset::make("ImplicitGEMM", { false, true })));
+TEST_SUITE_END()
+
 TEST_SUITE(NIGHTLY)
 REGISTER_FIXTURE_DATA_TEST_CASE(AlexNetConvolutionLayer, NEGEMMConvolutionLayerFixture, framework::DatasetMode::NIGHTLY,
                                 framework::dataset::combine(framework::dataset::combine(framework::dataset::combine(datasets::AlexNetConvolutionLayerDataset(),
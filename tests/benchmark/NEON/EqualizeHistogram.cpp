@@ -53,6 +53,11 @@ REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEEqualizeHistogramFixture, framework:
                                 combine(
                                 datasets::LargeImageShapes(),
                                 framework::dataset::make("Format", Format::U8)));
+
+REGISTER_FIXTURE_DATA_TEST_CASE(RunUHD, NEEqualizeHistogramFixture, framework::DatasetMode::NIGHTLY,
+                                combine(
+                                datasets::UHD2DShapes(),
+                                framework::dataset::make("Format", Format::U8)));
 // clang-format on
 // *INDENT-ON*
 
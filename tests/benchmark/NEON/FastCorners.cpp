@@ -27,6 +27,7 @@
 #include "arm_compute/runtime/Tensor.h"
 #include "tests/NEON/Accessor.h"
 #include "tests/benchmark/fixtures/FastCornersFixture.h"
+#include "tests/benchmark/fixtures/ThreadScalingFixture.h"
 #include "tests/datasets/ImageFileDatasets.h"
 #include "tests/framework/Macros.h"
 #include "tests/framework/datasets/Datasets.h"
@@ -43,9 +44,11 @@ namespace
 const auto threshold       = framework::dataset::make("Threshold", { 64.f });                   // valid range (0.0 ≤ threshold < 256.0)
 const auto border_mode     = framework::dataset::make("BorderMode", { BorderMode::UNDEFINED }); // NOTE: only BorderMode::UNDEFINED is implemented
 const auto suppress_nonmax = framework::dataset::make("SuppressNonMax", { false, true });
+const auto num_threads     = framework::dataset::make("Threads", { 1, 2, 4, 8 });
 } // namespace
 
-using NEFastCornersFixture = FastCornersFixture<Tensor, NEFastCorners, Accessor, KeyPointArray>;
+using NEFastCornersFixture              = FastCornersFixture<Tensor, NEFastCorners, Accessor, KeyPointArray>;
+using NEFastCornersThreadScalingFixture = ThreadScalingFixture<NEFastCornersFixture>;
 
 TEST_SUITE(NEON)
 TEST_SUITE(FastCorners)
@@ -67,6 +70,15 @@ REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEFastCornersFixture, framework::Datas
                                 threshold),
                                 suppress_nonmax),
                                 border_mode));
+
+REGISTER_FIXTURE_DATA_TEST_CASE(RunThreadScaling, NEFastCornersThreadScalingFixture, framework::DatasetMode::NIGHTLY,
+                                combine(combine(combine(combine(combine(
+                                num_threads,
+                                datasets::LargeImageFiles()),
+                                framework::dataset::make("Format", { Format::U8 })),
+                                threshold),
+                                suppress_nonmax),
+                                border_mode));
 // clang-format on
 // *INDENT-ON*
 
@@ -55,6 +55,12 @@ REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEGaussianPyramidFixture, framework::D
                                 combine(
                                 datasets::Large2DShapes(),
                                 datasets::BorderModes()) * framework::dataset::make("numlevels", 2, 5));
+
+REGISTER_FIXTURE_DATA_TEST_CASE(RunUHD, NEGaussianPyramidFixture, framework::DatasetMode::NIGHTLY,
+                                combine(combine(
+                                datasets::UHD2DShapes(),
+                                datasets::BorderModes()),
+                                framework::dataset::make("numlevels", { 4, 6 })));
 // clang-format on
 // *INDENT-ON*
 
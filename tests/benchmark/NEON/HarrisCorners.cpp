@@ -27,6 +27,7 @@
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "tests/NEON/Accessor.h"
 #include "tests/benchmark/fixtures/HarrisCornersFixture.h"
+#include "tests/benchmark/fixtures/ThreadScalingFixture.h"
 #include "tests/datasets/ImageFileDatasets.h"
 #include "tests/framework/Macros.h"
 #include "tests/framework/datasets/Datasets.h"
@@ -46,9 +47,11 @@ const auto sensitivity   = framework::dataset::make("Sensitivity", { 0.04f });
 const auto gradient_size = framework::dataset::make("GradientSize", { 3, 5, 7 });
 const auto block_size    = framework::dataset::make("BlockSize", { 3, 5, 7 });
 const auto border_mode   = framework::dataset::make("BorderMode", { BorderMode::UNDEFINED, BorderMode::CONSTANT, BorderMode::REPLICATE });
+const auto num_threads   = framework::dataset::make("Threads", { 1, 2, 4, 8 });
 } // namespace
 
-using NEHarrisCornersFixture = HarrisCornersFixture<Tensor, NEHarrisCorners, Accessor, KeyPointArray>;
+using NEHarrisCornersFixture              = HarrisCornersFixture<Tensor, NEHarrisCorners, Accessor, KeyPointArray>;
+using NEHarrisCornersThreadScalingFixture = ThreadScalingFixture<NEHarrisCornersFixture>;
 
 TEST_SUITE(NEON)
 TEST_SUITE(HarrisCorners)
@@ -96,6 +99,17 @@ REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEHarrisCornersFixture, framework::Dat
                                                                                                                    block_size),
                                                                                                                    border_mode),
                                                                                                            framework::dataset::make("UseFP16", { false })));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunThreadScaling, NEHarrisCornersThreadScalingFixture, framework::DatasetMode::NIGHTLY,
+                                combine(combine(combine(combine(combine(combine(combine(combine(combine(num_threads,
+                                                                                                        datasets::LargeImageFiles()),
+                                                                                                framework::dataset::make("Format", { Format::U8 })),
+                                                                                        threshold),
+                                                                                min_dist),
+                                                                        sensitivity),
+                                                                framework::dataset::make("GradientSize", { 3 })),
+                                                        framework::dataset::make("BlockSize", { 3 })),
+                                                framework::dataset::make("BorderMode", { BorderMode::UNDEFINED })),
+                                        framework::dataset::make("UseFP16", { false })));
 TEST_SUITE_END() // S16
 TEST_SUITE_END() // HarrisCorners
 TEST_SUITE_END() // NEON
@@ -26,6 +26,7 @@
 #include "arm_compute/runtime/Tensor.h"
 #include "tests/NEON/Accessor.h"
 #include "tests/benchmark/fixtures/IntegralImageFixture.h"
+#include "tests/benchmark/fixtures/ThreadScalingFixture.h"
 #include "tests/datasets/ShapeDatasets.h"
 #include "tests/framework/Macros.h"
 #include "tests/framework/datasets/Datasets.h"
@@ -37,13 +38,20 @@ namespace test
 {
 namespace benchmark
 {
-using NEIntegralImageFixture = IntegralImageFixture<Tensor, NEIntegralImage, Accessor>;
+namespace
+{
+const auto num_threads = framework::dataset::make("Threads", { 1, 2, 4, 8 });
+} // namespace
+
+using NEIntegralImageFixture              = IntegralImageFixture<Tensor, NEIntegralImage, Accessor>;
+using NEIntegralImageThreadScalingFixture = ThreadScalingFixture<NEIntegralImageFixture>;
 
 TEST_SUITE(NEON)
 TEST_SUITE(IntegralImage)
 
 REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, NEIntegralImageFixture, framework::DatasetMode::PRECOMMIT, datasets::SmallImageShapes());
 REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEIntegralImageFixture, framework::DatasetMode::NIGHTLY, datasets::LargeImageShapes());
+REGISTER_FIXTURE_DATA_TEST_CASE(RunThreadScaling, NEIntegralImageThreadScalingFixture, framework::DatasetMode::NIGHTLY, combine(num_threads, datasets::UHD2DShapes()));
 
 TEST_SUITE_END() // IntegralImage
 TEST_SUITE_END() // NEON
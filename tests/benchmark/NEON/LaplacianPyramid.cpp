@@ -66,6 +66,13 @@ REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NELaplacianPyramidFixture, framework::
                                 datasets::BorderModes()),
                                 large_laplacian_pyramid_levels),
                                 formats));
+
+REGISTER_FIXTURE_DATA_TEST_CASE(RunUHD, NELaplacianPyramidFixture, framework::DatasetMode::NIGHTLY,
+                                combine(combine(combine(
+                                datasets::UHD2DShapes(),
+                                datasets::BorderModes()),
+                                framework::dataset::make("NumLevels", { 4, 6 })),
+                                formats));
 // clang-format on
 // *INDENT-ON*
 
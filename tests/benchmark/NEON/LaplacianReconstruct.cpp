@@ -72,6 +72,13 @@ REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NELaplacianReconstructFixture, framewo
                                 large_laplacian_reconstruct_levels),
                                 formats));
 
+REGISTER_FIXTURE_DATA_TEST_CASE(RunUHD, NELaplacianReconstructFixture, framework::DatasetMode::NIGHTLY,
+                                combine(combine(combine(
+                                datasets::UHD2DShapes(),
+                                datasets::BorderModes()),
+                                framework::dataset::make("NumLevels", { 4, 6 })),
+                                formats));
+
 // clang-format on
 // *INDENT-ON*
 
@@ -55,6 +55,11 @@ REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEMeanStdDevFixture, framework::Datase
                                 combine(
                                 datasets::Large2DShapes(),
                                 framework::dataset::make("Format", Format::U8)));
+
+REGISTER_FIXTURE_DATA_TEST_CASE(RunUHD, NEMeanStdDevFixture, framework::DatasetMode::NIGHTLY,
+                                combine(
+                                datasets::UHD2DShapes(),
+                                framework::dataset::make("Format", Format::U8)));
 // clang-format on
 // *INDENT-ON*
 
@@ -54,6 +54,9 @@ REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, NEMinMaxLocationFixture, framework::Da
 
 REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEMinMaxLocationFixture, framework::DatasetMode::NIGHTLY,
                                 combine(datasets::Large2DShapes(), data_types));
+
+REGISTER_FIXTURE_DATA_TEST_CASE(RunUHD, NEMinMaxLocationFixture, framework::DatasetMode::NIGHTLY,
+                                combine(datasets::UHD2DShapes(), data_types));
 // clang-format on
 // *INDENT-ON*
 TEST_SUITE_END() // MinMaxLocation
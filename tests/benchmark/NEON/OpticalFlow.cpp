@@ -29,6 +29,7 @@
 #include "tests/NEON/Accessor.h"
 #include "tests/NEON/ArrayAccessor.h"
 #include "tests/benchmark/fixtures/OpticalFlowFixture.h"
+#include "tests/benchmark/fixtures/ThreadScalingFixture.h"
 #include "tests/datasets/BorderModeDataset.h"
 #include "tests/datasets/ImageFileDatasets.h"
 #include "tests/datasets/OpticalFlowDataset.h"
@@ -42,7 +43,13 @@ namespace test
 {
 namespace benchmark
 {
-using NEOpticalFlowFixture = OpticalFlowFixture<Tensor, NEOpticalFlow, Accessor, KeyPointArray, ArrayAccessor<KeyPoint>, Pyramid, NEGaussianPyramidHalf>;
+namespace
+{
+const auto num_threads = framework::dataset::make("Threads", { 1, 2, 4, 8 });
+} // namespace
+
+using NEOpticalFlowFixture              = OpticalFlowFixture<Tensor, NEOpticalFlow, Accessor, KeyPointArray, ArrayAccessor<KeyPoint>, Pyramid, NEGaussianPyramidHalf>;
+using NEOpticalFlowThreadScalingFixture = ThreadScalingFixture<NEOpticalFlowFixture>;
 
 TEST_SUITE(NEON)
 TEST_SUITE(OpticalFlow)
@@ -60,6 +67,13 @@ REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEOpticalFlowFixture, framework::Datas
                                 datasets::LargeOpticalFlowDataset(),
                                 framework::dataset::make("Format", Format::U8)),
                                 datasets::BorderModes()));
+
+REGISTER_FIXTURE_DATA_TEST_CASE(RunThreadScaling, NEOpticalFlowThreadScalingFixture, framework::DatasetMode::NIGHTLY,
+                                combine(combine(combine(
+                                num_threads,
+                                datasets::LargeOpticalFlowDataset()),
+                                framework::dataset::make("Format", Format::U8)),
+                                datasets::BorderModes()));
 // clang-format on
 // *INDENT-ON*
 
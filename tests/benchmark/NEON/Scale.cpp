@@ -43,22 +43,41 @@ namespace benchmark
 namespace
 {
 const auto interpolation_types = framework::dataset::make("InterpolationPolicy", { InterpolationPolicy::NEAREST_NEIGHBOR, InterpolationPolicy::BILINEAR });
+const auto data_types          = framework::dataset::make("DataType", { DataType::U8, DataType::S16, DataType::F32 });
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+const auto data_types_fp16 = framework::dataset::make("DataType", { DataType::F16 });
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+const auto data_layouts = framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC });
 } // namespace
 
 using NEScaleFixture = ScaleFixture<Tensor, NEScale, Accessor>;
 
 TEST_SUITE(NEON)
 TEST_SUITE(Scale)
-REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, NEScaleFixture, framework::DatasetMode::PRECOMMIT, combine(combine(combine(combine(combine(datasets::SmallImageShapes(), framework::dataset::make("DataType", { DataType::U8, DataType::S16, DataType::F32 })),
-                                                                                                                     framework::dataset::make("DataLayout", { DataLayout::NCHW })),
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, NEScaleFixture, framework::DatasetMode::PRECOMMIT, combine(combine(combine(combine(combine(datasets::SmallImageShapes(), data_types),
+                                                                                                                     data_layouts),
                                                                                                                      interpolation_types),
                                                                                                              datasets::BorderModes()),
                                                                                                      framework::dataset::make("SamplingPolicy", { SamplingPolicy::CENTER })));
-REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEScaleFixture, framework::DatasetMode::NIGHTLY, combine(combine(combine(combine(combine(datasets::LargeImageShapes(), framework::dataset::make("DataType", { DataType::U8, DataType::S16, DataType::F32 })),
-                                                                                                                   framework::dataset::make("DataLayout", { DataLayout::NCHW })),
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEScaleFixture, framework::DatasetMode::NIGHTLY, combine(combine(combine(combine(combine(datasets::LargeImageShapes(), data_types),
+                                                                                                                   data_layouts),
                                                                                                                    interpolation_types),
                                                                                                            datasets::BorderModes()),
                                                                                                    framework::dataset::make("SamplingPolicy", { SamplingPolicy::CENTER })));
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+TEST_SUITE(FP16)
+REGISTER_FIXTURE_DATA_TEST_CASE(RunSmall, NEScaleFixture, framework::DatasetMode::PRECOMMIT, combine(combine(combine(combine(combine(datasets::SmallImageShapes(), data_types_fp16),
+                                                                                                                     data_layouts),
+                                                                                                                     interpolation_types),
+                                                                                                             datasets::BorderModes()),
+                                                                                                     framework::dataset::make("SamplingPolicy", { SamplingPolicy::CENTER })));
+REGISTER_FIXTURE_DATA_TEST_CASE(RunLarge, NEScaleFixture, framework::DatasetMode::NIGHTLY, combine(combine(combine(combine(combine(datasets::LargeImageShapes(), data_types_fp16),
+                                                                                                                   data_layouts),
+                                                                                                                   interpolation_types),
+                                                                                                           datasets::BorderModes()),
+                                                                                                   framework::dataset::make("SamplingPolicy", { SamplingPolicy::CENTER })));
+TEST_SUITE_END() // FP16
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
 TEST_SUITE_END() // Scale
 TEST_SUITE_END() // NEON
 } // namespace benchmark
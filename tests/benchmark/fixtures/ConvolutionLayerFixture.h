@@ -26,9 +26,11 @@
 
 #include "arm_compute/core/TensorShape.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Types.h"
 #include "tests/Globals.h"
 #include "tests/Utils.h"
 #include "tests/framework/Fixture.h"
+#include "tests/framework/Framework.h"
 
 namespace arm_compute
 {
@@ -60,6 +62,70 @@ public:
         // Create and configure function
         conv_layer.configure(&src, &weights, &biases, &dst, info, WeightsInfo(), dilation, act_info);
 
+        // Report the workload to derive the throughput and the bandwidth from the wall clock time
+        const WorkloadCost cost = conv_layer.cost();
+        framework::Framework::get().set_workload(cost.flops, cost.bytes);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        biases.allocator()->allocate();
+        dst.allocator()->allocate();
+    }
+
+    void run()
+    {
+        conv_layer.run();
+    }
+
+    void sync()
+    {
+        sync_if_necessary<TensorType>();
+        sync_tensor_if_necessary<TensorType>(dst);
+    }
+
+    void teardown()
+    {
+        src.allocator()->free();
+        weights.allocator()->free();
+        biases.allocator()->free();
+        dst.allocator()->free();
+    }
+
+private:
+    TensorType src{};
+    TensorType weights{};
+    TensorType biases{};
+    TensorType dst{};
+    Function   conv_layer{};
+};
+
+/** Fixture to compare the implicit GEMM and the im2col paths of a GEMM based convolution */
+template <typename TensorType, typename Function, typename Accessor>
+class ConvolutionLayerImplicitGEMMFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape src_shape, TensorShape weights_shape, TensorShape biases_shape, TensorShape dst_shape, PadStrideInfo info, Size2D dilation, ActivationLayerInfo act_info, DataType data_type,
+               int batches, bool implicit_gemm)
+    {
+        // Set batched in source and destination shapes
+        src_shape.set(3 /* batch */, batches);
+        dst_shape.set(3 /* batch */, batches);
+
+        // Create tensors
+        src     = create_tensor<TensorType>(src_shape, data_type, 1);
+        weights = create_tensor<TensorType>(weights_shape, data_type, 1);
+        biases  = create_tensor<TensorType>(biases_shape, data_type, 1);
+        dst     = create_tensor<TensorType>(dst_shape, data_type, 1);
+
+        // Create and configure function
+        conv_layer.configure(&src, &weights, &biases, &dst, info, WeightsInfo(), dilation, act_info, 1, implicit_gemm);
+
+        // Report the workload to derive the throughput and the bandwidth from the wall clock time
+        const WorkloadCost cost = conv_layer.cost();
+        framework::Framework::get().set_workload(cost.flops, cost.bytes);
+
         // Allocate tensors
         src.allocator()->allocate();
         weights.allocator()->allocate();
@@ -64,6 +64,7 @@ public:
 
     void run()
     {
+        corners.clear();
         fast_corners_func.run();
     }
 
@@ -26,9 +26,11 @@
 
 #include "arm_compute/core/TensorShape.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Types.h"
 #include "tests/Globals.h"
 #include "tests/Utils.h"
 #include "tests/framework/Fixture.h"
+#include "tests/framework/Framework.h"
 
 namespace arm_compute
 {
@@ -58,6 +60,10 @@ public:
         // Create and configure function
         fc_layer.configure(&src, &weights, &biases, &dst);
 
+        // Report the workload to derive the throughput and the bandwidth from the wall clock time
+        const WorkloadCost cost = fc_layer.cost();
+        framework::Framework::get().set_workload(cost.flops, cost.bytes);
+
         // Allocate tensors
         src.allocator()->allocate();
         weights.allocator()->allocate();
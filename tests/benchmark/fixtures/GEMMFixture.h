@@ -26,9 +26,11 @@
 
 #include "arm_compute/core/TensorShape.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Types.h"
 #include "tests/Globals.h"
 #include "tests/Utils.h"
 #include "tests/framework/Fixture.h"
+#include "tests/framework/Framework.h"
 
 namespace arm_compute
 {
@@ -53,6 +55,10 @@ public:
         // Create and configure function
         gemm.configure(&a, &b, &c, &dst, alpha, beta, GEMMInfo(false, false, reshape_b_only_on_first_run));
 
+        // Report the workload to derive the throughput and the bandwidth from the wall clock time
+        const WorkloadCost cost = gemm.cost();
+        framework::Framework::get().set_workload(cost.flops, cost.bytes);
+
         // Allocate tensors
         a.allocator()->allocate();
         b.allocator()->allocate();
@@ -63,6 +63,7 @@ public:
 
     void run()
     {
+        out.clear();
         harris_corners_func.run();
     }
 
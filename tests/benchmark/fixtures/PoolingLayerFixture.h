@@ -26,10 +26,12 @@
 
 #include "arm_compute/core/TensorShape.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Types.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "tests/Globals.h"
 #include "tests/Utils.h"
 #include "tests/framework/Fixture.h"
+#include "tests/framework/Framework.h"
 
 namespace arm_compute
 {
@@ -70,6 +72,10 @@ public:
         // Create and configure function
         pool_layer.configure(&src, &dst, info);
 
+        // Report the workload to derive the throughput and the bandwidth from the wall clock time
+        const WorkloadCost cost = pool_layer.cost();
+        framework::Framework::get().set_workload(cost.flops, cost.bytes);
+
         // Allocate tensors
         src.allocator()->allocate();
         dst.allocator()->allocate();
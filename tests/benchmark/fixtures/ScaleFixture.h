@@ -71,8 +71,8 @@ public:
         shape_scaled.set(idx_height, shape[idx_height] * scale_y);
 
         // Create tensors
-        src = create_tensor<TensorType>(shape, data_type);
-        dst = create_tensor<TensorType>(shape_scaled, data_type);
+        src = create_tensor<TensorType>(shape, data_type, 1, QuantizationInfo(), data_layout);
+        dst = create_tensor<TensorType>(shape_scaled, data_type, 1, QuantizationInfo(), data_layout);
 
         // Create and configure function
         scale_func.configure(&src, &dst, policy, border_mode, constant_border_value, sampling_policy);
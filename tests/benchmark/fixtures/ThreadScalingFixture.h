@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_THREAD_SCALING_FIXTURE
+#define ARM_COMPUTE_TEST_THREAD_SCALING_FIXTURE
+
+#include "arm_compute/runtime/Scheduler.h"
+#include "tests/framework/Fixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Fixture running another benchmark fixture with a given number of threads.
+ *
+ * The number of threads is the first element of the dataset, the other elements are forwarded to @p Fixture.
+ * The number of threads of the scheduler is restored once the test case is done.
+ */
+template <typename Fixture>
+class ThreadScalingFixture : public Fixture
+{
+public:
+    template <typename T, typename... As>
+    void setup(T num_threads, As... args)
+    {
+        _default_num_threads = Scheduler::get().num_threads();
+        Scheduler::get().set_num_threads(num_threads);
+
+        Fixture::setup(args...);
+    }
+
+    void teardown()
+    {
+        Fixture::teardown();
+
+        Scheduler::get().set_num_threads(_default_num_threads);
+    }
+
+private:
+    unsigned int _default_num_threads{ 0 };
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_THREAD_SCALING_FIXTURE */
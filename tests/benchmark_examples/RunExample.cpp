@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "utils/Utils.h"
+
+#include "arm_compute/graph/TypeLoader.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "support/ToolchainSupport.h"
+#include "tests/framework/DatasetModes.h"
+#include "tests/framework/Framework.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/command_line/CommonOptions.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/framework/instruments/Instruments.h"
+#include "tests/framework/printers/Printers.h"
+#include "utils/TypePrinter.h"
+#include "utils/command_line/CommandLineOptions.h"
+#include "utils/command_line/CommandLineParser.h"
+
+#ifdef ARM_COMPUTE_CL
+#include "arm_compute/runtime/CL/CLScheduler.h"
+#endif /* ARM_COMPUTE_CL */
+
+#include <memory>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace arm_compute;
+using namespace arm_compute::test;
+
+namespace arm_compute
+{
+namespace utils
+{
+namespace
+{
+std::string command_line(int argc, char **argv)
+{
+    std::stringstream ss;
+    for(int i = 0; i < argc; i++)
+    {
+        ss << argv[i] << " ";
+    }
+    return ss.str();
+}
+
+ExampleFactory           g_example_factory{};
+std::vector<std::string> g_example_args{};
+
+/** Test case running an example network for a given number of threads and data layout.
+ *
+ * The example is created and set up (graph construction, configuration and
+ * weights loading) outside of the measured region. Only @ref Example::do_run
+ * is measured by the instruments.
+ */
+template <typename T>
+class ExampleTest : public framework::DataTestCase<T>
+{
+public:
+    /** Construct the test case
+     *
+     * @param[in] data Tuple of number of threads and data layout.
+     */
+    explicit ExampleTest(T data)
+        : framework::DataTestCase<T>(std::move(data)), _example(nullptr)
+    {
+    }
+
+    void do_setup() override
+    {
+        const int        num_threads = std::get<0>(this->_data);
+        const DataLayout data_layout = std::get<1>(this->_data);
+
+        std::vector<std::string> args = g_example_args;
+        args.emplace_back("--threads=" + support::cpp11::to_string(num_threads));
+        args.emplace_back("--layout=" + string_from_data_layout(data_layout));
+
+        std::vector<char *> argv;
+        for(auto &arg : args)
+        {
+            argv.emplace_back(const_cast<char *>(arg.c_str())); // NOLINT
+        }
+
+        _example = g_example_factory();
+        const bool is_setup = _example->do_setup(static_cast<int>(argv.size()), argv.data());
+        ARM_COMPUTE_EXIT_ON_MSG(!is_setup, "Failed to set up the example");
+    }
+
+    void do_run() override
+    {
+        _example->do_run();
+    }
+
+    void do_sync() override
+    {
+#ifdef ARM_COMPUTE_CL
+        if(opencl_is_available())
+        {
+            CLScheduler::get().sync();
+        }
+#endif /* ARM_COMPUTE_CL */
+    }
+
+    void do_teardown() override
+    {
+        _example->do_teardown();
+        _example = nullptr;
+    }
+
+private:
+    std::unique_ptr<Example> _example;
+};
+} // namespace
+
+int run_example(int argc, char **argv, const ExampleFactory &factory)
+{
+    framework::Framework &framework = framework::Framework::get();
+
+    CommandLineParser       parser;
+    framework::CommonOptions options(parser);
+
+    const std::set<DataLayout> supported_data_layouts
+    {
+        DataLayout::NHWC,
+        DataLayout::NCHW,
+    };
+
+    auto example_args = parser.add_option<ListOption<std::string>>("example_args");
+    example_args->set_help("Arguments to pass to the example separated by commas (e.g: --target=NEON,--type=F32)");
+    auto threads = parser.add_option<ListOption<int>>("threads", std::initializer_list<int> { 1 });
+    threads->set_help("List of number of threads to benchmark the example with (e.g: 1,2,4)");
+    auto layouts = parser.add_option<EnumListOption<DataLayout>>("layouts", supported_data_layouts, std::initializer_list<DataLayout> { DataLayout::NCHW });
+    layouts->set_help("List of data layouts to benchmark the example with");
+    auto filter = parser.add_option<SimpleOption<std::string>>("filter", ".*");
+    filter->set_help("Regular expression to select test cases");
+
+    try
+    {
+        parser.parse(argc, argv);
+
+        if(options.help->is_set() && options.help->value())
+        {
+            parser.print_help(argv[0]);
+            return 0;
+        }
+
+        if(!parser.validate())
+        {
+            return 1;
+        }
+
+        std::vector<std::unique_ptr<framework::Printer>> printers = options.create_printers();
+
+        // The test case is named after the program, the first argument passed to the example
+        std::string            example_name = argv[0];
+        const std::string::size_type slash  = example_name.find_last_of('/');
+        if(slash != std::string::npos)
+        {
+            example_name = example_name.substr(slash + 1);
+        }
+
+        g_example_factory = factory;
+        g_example_args.clear();
+        g_example_args.emplace_back(argv[0]);
+        for(auto &arg : example_args->value())
+        {
+            g_example_args.emplace_back(arg);
+        }
+
+        if(options.log_level->value() > framework::LogLevel::NONE)
+        {
+            for(auto &p : printers)
+            {
+                p->print_global_header();
+            }
+        }
+
+        if(options.log_level->value() >= framework::LogLevel::CONFIG)
+        {
+            for(auto &p : printers)
+            {
+                p->print_entry("Version", build_information());
+                p->print_entry("CommandLine", command_line(argc, argv));
+#ifdef ARM_COMPUTE_CL
+                if(opencl_is_available())
+                {
+                    p->print_entry("CL_DEVICE_VERSION", CLKernelLibrary::get().get_device_version());
+                }
+                else
+                {
+                    p->print_entry("CL_DEVICE_VERSION", "Unavailable");
+                }
+#endif /* ARM_COMPUTE_CL */
+                p->print_entry("Iterations", support::cpp11::to_string(options.iterations->value()));
+            }
+        }
+
+        framework.init(options.instruments->value(), options.iterations->value(), framework::DatasetMode::ALL, filter->value(), "", options.log_level->value());
+        for(auto &p : printers)
+        {
+            framework.add_printer(p.get());
+        }
+        framework.set_throw_errors(options.throw_errors->value());
+
+        // Register one test case per number of threads and data layout
+        std::vector<int>        threads_values(threads->value());
+        std::vector<DataLayout> layouts_values(layouts->value());
+
+        auto dataset = framework::dataset::combine(framework::dataset::make("Threads", std::move(threads_values)),
+                                                   framework::dataset::make("DataLayout", std::move(layouts_values)));
+
+        framework::detail::TestSuiteRegistrar suite{ "Examples" };
+        auto                                  it = dataset.begin();
+        for(int i = 0; i < dataset.size(); ++i, ++it)
+        {
+            framework.add_data_test_case<ExampleTest<decltype(dataset)::type>>(example_name, framework::DatasetMode::ALL, framework::TestCaseFactory::Status::ACTIVE, it.description(), it);
+        }
+        framework::detail::TestSuiteRegistrar suite_end{};
+
+        const bool success = framework.run();
+
+        if(options.log_level->value() > framework::LogLevel::NONE)
+        {
+            for(auto &p : printers)
+            {
+                p->print_global_footer();
+            }
+        }
+
+        return success ? 0 : 1;
+    }
+    catch(std::exception &error)
+    {
+        std::cerr << "Found exception: " << error.what() << "\n";
+    }
+
+    return 1;
+}
+} // namespace utils
+} // namespace arm_compute
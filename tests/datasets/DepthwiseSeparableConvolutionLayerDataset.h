@@ -153,6 +153,21 @@ private:
     std::vector<PadStrideInfo> _depthwise_infos{};
     std::vector<PadStrideInfo> _pointwise_infos{};
 };
+
+/** Dataset containing small depthwise separable convolution shapes. */
+class SmallDepthwiseSeparableConvolutionLayerDataset final : public DepthwiseSeparableConvolutionLayerDataset
+{
+public:
+    SmallDepthwiseSeparableConvolutionLayerDataset()
+    {
+        add_config(TensorShape(7U, 9U, 5U), TensorShape(3U, 3U, 5U), TensorShape(5U), TensorShape(7U, 9U, 5U), TensorShape(1U, 1U, 5U, 13U), TensorShape(13U), TensorShape(7U, 9U, 13U),
+                   PadStrideInfo(1, 1, 1, 1), PadStrideInfo(1, 1, 0, 0));
+        add_config(TensorShape(11U, 10U, 16U), TensorShape(3U, 3U, 16U), TensorShape(16U), TensorShape(6U, 5U, 16U), TensorShape(1U, 1U, 16U, 8U), TensorShape(8U), TensorShape(6U, 5U, 8U),
+                   PadStrideInfo(2, 2, 1, 1), PadStrideInfo(1, 1, 0, 0));
+        add_config(TensorShape(9U, 7U, 3U, 2U), TensorShape(5U, 3U, 3U), TensorShape(3U), TensorShape(9U, 7U, 3U, 2U), TensorShape(1U, 1U, 3U, 4U), TensorShape(4U), TensorShape(9U, 7U, 4U, 2U),
+                   PadStrideInfo(1, 1, 2, 1), PadStrideInfo(1, 1, 0, 0));
+    }
+};
 } // namespace datasets
 } // namespace test
 } // namespace arm_compute
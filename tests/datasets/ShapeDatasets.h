@@ -342,6 +342,19 @@ public:
     }
 };
 
+/** Data set containing a 4K UHD 2D tensor shape. */
+class UHD2DShapes final : public ShapeDataset
+{
+public:
+    UHD2DShapes()
+        : ShapeDataset("Shape",
+    {
+        TensorShape{ 3840U, 2160U }
+    })
+    {
+    }
+};
+
 /** Data set containing large 3D tensor shapes. */
 class Large3DShapes final : public ShapeDataset
 {
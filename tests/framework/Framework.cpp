@@ -39,6 +39,76 @@ namespace test
 {
 namespace framework
 {
+namespace
+{
+/** Convert a wall clock measurement to seconds.
+ *
+ * @param[in] measurement Measurement to convert.
+ *
+ * @return The measurement in seconds or 0 if the unit is not a time unit.
+ */
+double to_seconds(const Measurement &measurement)
+{
+    const Measurement::Value &value = measurement.value();
+    const double              v     = value.is_floating_point ? value.v.floating_point : static_cast<double>(value.v.integer);
+
+    if(measurement.unit() == "us")
+    {
+        return v * 1e-6;
+    }
+    else if(measurement.unit() == "ms")
+    {
+        return v * 1e-3;
+    }
+    else if(measurement.unit() == "s")
+    {
+        return v;
+    }
+    return 0.0;
+}
+
+/** Derive the throughput, the bandwidth and the arithmetic intensity of a test case from its wall clock measurements.
+ *
+ * @param[in, out] measurements Measurements of the test case.
+ * @param[in]      flops        Number of operations done by an iteration.
+ * @param[in]      bytes        Number of bytes read and written by an iteration.
+ */
+void add_workload_measurements(Profiler::MeasurementsMap &measurements, uint64_t flops, uint64_t bytes)
+{
+    const auto wall_clock = measurements.find("Wall clock/Wall clock time");
+    if(wall_clock == measurements.end())
+    {
+        return;
+    }
+
+    std::vector<Measurement> throughput;
+    std::vector<Measurement> bandwidth;
+
+    for(const auto &measurement : wall_clock->second)
+    {
+        const double seconds = to_seconds(measurement);
+        if(seconds > 0.0)
+        {
+            throughput.emplace_back(static_cast<double>(flops) / seconds * 1e-9, "GFLOP/s");
+            bandwidth.emplace_back(static_cast<double>(bytes) / seconds * 1e-9, "GB/s");
+        }
+    }
+
+    if(flops != 0 && !throughput.empty())
+    {
+        measurements["Wall clock/Throughput"] = std::move(throughput);
+    }
+    if(bytes != 0 && !bandwidth.empty())
+    {
+        measurements["Wall clock/Bandwidth"] = std::move(bandwidth);
+    }
+    if(flops != 0 && bytes != 0)
+    {
+        measurements["Workload/Arithmetic intensity"] = { Measurement(static_cast<double>(flops) / static_cast<double>(bytes), "FLOP/byte") };
+    }
+}
+} // namespace
+
 Framework::Framework()
 {
     _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::WALL_CLOCK_TIMER, ScaleFactor::NONE), Instrument::make_instrument<WallClockTimer, ScaleFactor::NONE>);
@@ -51,6 +121,9 @@ Framework::Framework()
     _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU, ScaleFactor::NONE), Instrument::make_instrument<PMUCounter, ScaleFactor::NONE>);
     _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU, ScaleFactor::SCALE_1K), Instrument::make_instrument<PMUCounter, ScaleFactor::SCALE_1K>);
     _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU, ScaleFactor::SCALE_1M), Instrument::make_instrument<PMUCounter, ScaleFactor::SCALE_1M>);
+    _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::SCHEDULER_PMU, ScaleFactor::NONE), Instrument::make_instrument<SchedulerPMU, ScaleFactor::NONE>);
+    _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::SCHEDULER_PMU, ScaleFactor::SCALE_1K), Instrument::make_instrument<SchedulerPMU, ScaleFactor::SCALE_1K>);
+    _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::SCHEDULER_PMU, ScaleFactor::SCALE_1M), Instrument::make_instrument<SchedulerPMU, ScaleFactor::SCALE_1M>);
 #endif /* PMU_ENABLED */
 #ifdef MALI_ENABLED
     _available_instruments.emplace(std::pair<InstrumentType, ScaleFactor>(InstrumentType::MALI, ScaleFactor::NONE), Instrument::make_instrument<MaliCounter, ScaleFactor::NONE>);
@@ -125,6 +198,12 @@ void Framework::pop_suite()
     _test_suite_name.pop_back();
 }
 
+void Framework::set_workload(uint64_t flops, uint64_t bytes)
+{
+    _workload_flops = flops;
+    _workload_bytes = bytes;
+}
+
 void Framework::add_test_info(std::string info)
 {
     _test_info.emplace_back(std::move(info));
@@ -279,6 +358,8 @@ void Framework::run_test(const TestInfo &info, TestCaseFactory &test_factory)
 
     _current_test_info   = &info;
     _current_test_result = &result;
+    _workload_flops      = 0;
+    _workload_bytes      = 0;
 
     if(_log_level >= LogLevel::ERRORS)
     {
@@ -501,6 +582,11 @@ void Framework::run_test(const TestInfo &info, TestCaseFactory &test_factory)
 
     result.measurements = profiler.measurements();
 
+    if(_workload_flops != 0 || _workload_bytes != 0)
+    {
+        add_workload_measurements(result.measurements, _workload_flops, _workload_bytes);
+    }
+
     set_test_result(info, result);
     log_test_end(info);
 }
@@ -167,6 +167,16 @@ public:
      */
     void print_test_info(std::ostream &os) const;
 
+    /** Set the amount of work done by an iteration of the currently running test case.
+     *
+     * Used to derive the throughput (GFLOP/s), the bandwidth (GB/s) and the arithmetic intensity (FLOP/byte)
+     * of the test case from its wall clock measurements.
+     *
+     * @param[in] flops Number of operations done by an iteration.
+     * @param[in] bytes Number of bytes read and written by an iteration.
+     */
+    void set_workload(uint64_t flops, uint64_t bytes);
+
     /** Tell the framework that execution of a test starts.
      *
      * @param[in] info Test info.
@@ -335,6 +345,8 @@ private:
     LogLevel                                    _log_level{ LogLevel::ALL };
     const TestInfo                             *_current_test_info{ nullptr };
     TestResult                                 *_current_test_result{ nullptr };
+    uint64_t                                    _workload_flops{ 0 };
+    uint64_t                                    _workload_bytes{ 0 };
     std::vector<std::string>                    _test_info{};
 };
 
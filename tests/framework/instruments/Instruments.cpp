@@ -50,6 +50,9 @@ InstrumentsDescription instrument_type_from_name(const std::string &name)
         { "pmu", std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU, ScaleFactor::NONE) },
         { "pmu_k", std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU, ScaleFactor::SCALE_1K) },
         { "pmu_m", std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU, ScaleFactor::SCALE_1M) },
+        { "scheduler_pmu", std::pair<InstrumentType, ScaleFactor>(InstrumentType::SCHEDULER_PMU, ScaleFactor::NONE) },
+        { "scheduler_pmu_k", std::pair<InstrumentType, ScaleFactor>(InstrumentType::SCHEDULER_PMU, ScaleFactor::SCALE_1K) },
+        { "scheduler_pmu_m", std::pair<InstrumentType, ScaleFactor>(InstrumentType::SCHEDULER_PMU, ScaleFactor::SCALE_1M) },
         { "pmu_cycles", std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_CYCLE_COUNTER, ScaleFactor::NONE) },
         { "pmu_instructions", std::pair<InstrumentType, ScaleFactor>(InstrumentType::PMU_INSTRUCTION_COUNTER, ScaleFactor::NONE) },
         { "mali", std::pair<InstrumentType, ScaleFactor>(InstrumentType::MALI, ScaleFactor::NONE) },
@@ -28,6 +28,7 @@
 #include "OpenCLMemoryUsage.h"
 #include "OpenCLTimer.h"
 #include "PMUCounter.h"
+#include "SchedulerPMU.h"
 #include "SchedulerTimer.h"
 #include "WallClockTimer.h"
 
@@ -52,6 +53,7 @@ enum class InstrumentType : unsigned int
     OPENCL_TIMER            = 0x0400,
     SCHEDULER_TIMER         = 0x0500,
     OPENCL_MEMORY_USAGE     = 0x0600,
+    SCHEDULER_PMU           = 0x0700,
 };
 
 using InstrumentsDescription = std::pair<InstrumentType, ScaleFactor>;
@@ -118,6 +120,22 @@ inline ::std::stringstream &operator<<(::std::stringstream &stream, InstrumentsD
                     throw std::invalid_argument("Unsupported instrument scale");
             }
             break;
+        case InstrumentType::SCHEDULER_PMU:
+            switch(instrument.second)
+            {
+                case ScaleFactor::NONE:
+                    stream << "SCHEDULER_PMU";
+                    break;
+                case ScaleFactor::SCALE_1K:
+                    stream << "SCHEDULER_PMU_K";
+                    break;
+                case ScaleFactor::SCALE_1M:
+                    stream << "SCHEDULER_PMU_M";
+                    break;
+                default:
+                    throw std::invalid_argument("Unsupported instrument scale");
+            }
+            break;
         case InstrumentType::PMU_CYCLE_COUNTER:
             stream << "PMU_CYCLE_COUNTER";
             break;
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "SchedulerPMU.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/HardwareCounters.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+SchedulerPMU::SchedulerPMU(ScaleFactor scale_factor)
+    : _kernels(), _since(), _scale_factor(1), _unit()
+{
+    switch(scale_factor)
+    {
+        case ScaleFactor::NONE:
+            _scale_factor = 1;
+            _unit         = "";
+            break;
+        case ScaleFactor::SCALE_1K:
+            _scale_factor = 1000;
+            _unit         = "K ";
+            break;
+        case ScaleFactor::SCALE_1M:
+            _scale_factor = 1000000;
+            _unit         = "M ";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Invalid scale");
+    }
+}
+
+std::string SchedulerPMU::id() const
+{
+    return "SchedulerPMU";
+}
+
+void SchedulerPMU::start()
+{
+    // Other users (e.g. a graph writing a profile) might be recording too: only keep the events of this iteration
+    _kernels.clear();
+    _since = SchedulerTracer::get().start(true);
+}
+
+void SchedulerPMU::stop()
+{
+    SchedulerTracer::get().stop(true);
+    _kernels = SchedulerTracer::get().summary(_since);
+}
+
+Instrument::MeasurementsMap SchedulerPMU::measurements() const
+{
+    MeasurementsMap measurements;
+    for(const auto &kernel : _kernels)
+    {
+        if(!kernel.has_counters)
+        {
+            continue;
+        }
+
+        const std::string prefix = (kernel.label.empty() ? "" : kernel.label + "/") + kernel.kernel + " ";
+        for(size_t i = 0; i < kernel.counters.size(); ++i)
+        {
+            const std::string name = HardwareCounters::name(static_cast<HardwareCounters::Counter>(i));
+            measurements.emplace(prefix + name, Measurement(kernel.counters[i] / _scale_factor, _unit + name));
+        }
+    }
+
+    return measurements;
+}
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_SCHEDULER_PMU
+#define ARM_COMPUTE_TEST_SCHEDULER_PMU
+
+#include "Instrument.h"
+#include "arm_compute/runtime/SchedulerTracer.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace framework
+{
+/** Instrument collecting the CPU hardware counters of each scheduled kernel
+ *
+ * The counters are sampled by the @ref SchedulerTracer around every window and aggregated per kernel (and graph node).
+ */
+class SchedulerPMU : public Instrument
+{
+public:
+    /** Construct a scheduler PMU instrument.
+     *
+     * @param[in] scale_factor Measurement scale factor.
+     */
+    SchedulerPMU(ScaleFactor scale_factor);
+
+    /** Prevent instances of this class from being copy constructed */
+    SchedulerPMU(const SchedulerPMU &) = delete;
+    /** Prevent instances of this class from being copied */
+    SchedulerPMU &operator=(const SchedulerPMU &) = delete;
+
+    std::string                 id() const override;
+    void                        start() override;
+    void                        stop() override;
+    Instrument::MeasurementsMap measurements() const override;
+
+private:
+    std::vector<SchedulerTracer::KernelStats> _kernels;
+    SchedulerTracer::Clock::time_point        _since;
+    int                                       _scale_factor;
+    std::string                               _unit;
+};
+} // namespace framework
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_SCHEDULER_PMU */
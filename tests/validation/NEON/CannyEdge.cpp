@@ -95,7 +95,7 @@ DATA_TEST_CASE(Configuration, framework::DatasetMode::ALL, combine(combine(conca
     calculator.set_accessed_elements(16);
 
     validate(src.info()->padding(), calculator.required_padding());
-    validate(dst.info()->padding(), PaddingSize{ 1 });
+    validate(dst.info()->padding(), PaddingSize());
 }
 
 template <typename T>
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Array.h"
+#include "arm_compute/runtime/NEON/functions/NECropResize.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/NEON/ArrayAccessor.h"
+#include "tests/datasets/ROIPoolingLayerDataset.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/CropResizeFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr AbsoluteTolerance<float> tolerance_f32(0.0001f); /**< Tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(CropResize)
+
+DATA_TEST_CASE(Configuration, framework::DatasetMode::ALL, datasets::SmallROIPoolingLayerDataset(),
+               shape, crop_info, num_rois)
+{
+    // Create tensors
+    Tensor src = create_tensor<Tensor>(shape, DataType::F32);
+    Tensor dst;
+
+    std::vector<ROI> rois = generate_random_rois(shape, crop_info, num_rois, 0U);
+    Array<ROI>       rois_array(num_rois);
+    fill_array(ArrayAccessor<ROI>(rois_array), rois);
+
+    // Create and configure function
+    NECropResize crop_resize;
+    crop_resize.configure(&src, &rois_array, &dst, crop_info);
+
+    // Validate output shape and valid region
+    const TensorShape dst_shape(crop_info.pooled_width(), crop_info.pooled_height(), shape.z(), num_rois);
+    ARM_COMPUTE_EXPECT(dst.info()->tensor_shape() == dst_shape, framework::LogLevel::ERRORS);
+    validate(dst.info()->valid_region(), shape_to_valid_region(dst_shape));
+}
+
+template <typename T>
+using NECropResizeFixture = CropResizeValidationFixture<Tensor, Accessor, Array<ROI>, ArrayAccessor<ROI>, NECropResize, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NECropResizeFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(datasets::SmallROIPoolingLayerDataset(),
+                                               framework::dataset::make("DataType", DataType::F32)),
+                                       framework::dataset::make("Batches", { 1, 3 })),
+                               framework::dataset::make("ExtrapolationValue", { 0.f, -1.5f })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+TEST_SUITE_END()
+TEST_SUITE_END()
+
+TEST_SUITE_END()
+TEST_SUITE_END()
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -23,6 +23,7 @@
  */
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/NEON/functions/NEDeconvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMDeconvolutionLayer.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "tests/NEON/Accessor.h"
@@ -53,6 +54,9 @@ const auto data3x3 = datasets::SmallDeconvolutionShapes() * framework::dataset::
 const auto data1x1 = datasets::SmallDeconvolutionShapes() * framework::dataset::make("StrideX", 1, 4) * framework::dataset::make("StrideY", 1, 4) * framework::dataset::make("PadX", 0, 1)
                      * framework::dataset::make("PadY", 0, 1) * framework::dataset::make("ax", 0) * framework::dataset::make("ay", 0) * framework::dataset::make("NumKernels", { 1, 3 });
 
+const auto data3x3_inner_border = datasets::SmallDeconvolutionShapes() * framework::dataset::make("StrideX", 2, 4) * framework::dataset::make("StrideY", 2, 4) * framework::dataset::make("PadX", 0, 2)
+                                  * framework::dataset::make("PadY", 0, 2) * framework::dataset::make("ax", 0, 2) * framework::dataset::make("ay", 0, 2) * framework::dataset::make("NumKernels", { 3 });
+
 } // namespace
 
 TEST_SUITE(NEON)
@@ -198,9 +202,103 @@ TEST_SUITE_END()
 
 TEST_SUITE_END()
 TEST_SUITE_END()
+TEST_SUITE_END() // DeconvolutionLayer
+
+TEST_SUITE(GEMMDeconvolutionLayer)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(zip(
+    framework::dataset::make("InputInfo", { TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),   // Mismatching data type
+                                            TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F16),   // Non supported data type
+                                            TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),   // Padding larger than the kernel
+                                            TensorInfo(TensorShape(27U, 13U, 2U), 1, DataType::F32),   // Invalid output shape
+                                            TensorInfo(TensorShape(13U, 11U, 4U, 3U), 1, DataType::F32),
+                                            TensorInfo(TensorShape(32U, 16U, 2U), 1, DataType::F32),
+                                          }),
+    framework::dataset::make("WeightsInfo", { TensorInfo(TensorShape(3U, 3U, 2U, 2U), 1, DataType::F16),
+                                              TensorInfo(TensorShape(3U, 3U, 2U, 2U), 1, DataType::F16),
+                                              TensorInfo(TensorShape(3U, 3U, 2U, 2U), 1, DataType::F32),
+                                              TensorInfo(TensorShape(3U, 3U, 2U, 2U), 1, DataType::F32),
+                                              TensorInfo(TensorShape(3U, 3U, 4U, 5U), 1, DataType::F32),
+                                              TensorInfo(TensorShape(4U, 4U, 2U, 4U), 1, DataType::F32),
+                                            })),
+    framework::dataset::make("BiasInfo",  { TensorInfo(TensorShape(2U), 1, DataType::F16),
+                                            TensorInfo(TensorShape(2U), 1, DataType::F16),
+                                            TensorInfo(TensorShape(2U), 1, DataType::F32),
+                                            TensorInfo(TensorShape(2U), 1, DataType::F32),
+                                            TensorInfo(TensorShape(5U), 1, DataType::F32),
+                                            TensorInfo(TensorShape(4U), 1, DataType::F32),
+                                          })),
+    framework::dataset::make("OutputInfo",{ TensorInfo(TensorShape(25U, 11U, 2U), 1, DataType::F32),
+                                            TensorInfo(TensorShape(25U, 11U, 2U), 1, DataType::F16),
+                                            TensorInfo(TensorShape(25U, 11U, 2U), 1, DataType::F32),
+                                            TensorInfo(TensorShape(25U, 10U, 2U), 1, DataType::F32),
+                                            TensorInfo(TensorShape(25U, 21U, 5U, 3U), 1, DataType::F32),
+                                            TensorInfo(TensorShape(64U, 32U, 4U), 1, DataType::F32),
+                                          })),
+    framework::dataset::make("PadStrideInfo", { PadStrideInfo(1, 1, 0, 0),
+                                                PadStrideInfo(1, 1, 0, 0),
+                                                PadStrideInfo(1, 1, 3, 3),
+                                                PadStrideInfo(1, 1, 0, 0),
+                                                PadStrideInfo(2, 2, 1, 1),
+                                                PadStrideInfo(2, 2, 2, 2),
+                                              })),
+    framework::dataset::make("Expected", { false, false, false, false, true, true })),
+    input_info, weights_info, bias_info, output_info, pad_info, expected)
+{
+    bool is_valid = bool(NEGEMMDeconvolutionLayer::validate(&input_info.clone()->set_is_resizable(false), &weights_info.clone()->set_is_resizable(false), &bias_info.clone()->set_is_resizable(false), &output_info.clone()->set_is_resizable(false), pad_info, 0, 0));
+    ARM_COMPUTE_EXPECT(is_valid == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEGEMMDeconvolutionLayerFixture4x4 = DeconvolutionValidationFixture<Tensor, Accessor, NEGEMMDeconvolutionLayer, T, 4, 4>;
+
+template <typename T>
+using NEGEMMDeconvolutionLayerFixture3x3 = DeconvolutionValidationFixture<Tensor, Accessor, NEGEMMDeconvolutionLayer, T, 3, 3>;
+
+template <typename T>
+using NEGEMMDeconvolutionLayerFixture1x1 = DeconvolutionValidationFixture<Tensor, Accessor, NEGEMMDeconvolutionLayer, T, 1, 1>;
+
+TEST_SUITE(Float)
+
+TEST_SUITE(FP32)
+TEST_SUITE(W4x4)
+FIXTURE_DATA_TEST_CASE(Run, NEGEMMDeconvolutionLayerFixture4x4<float>, framework::DatasetMode::ALL, combine(data4x4, framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+TEST_SUITE_END()
+
+TEST_SUITE(W3x3)
+FIXTURE_DATA_TEST_CASE(Run, NEGEMMDeconvolutionLayerFixture3x3<float>, framework::DatasetMode::ALL, combine(data3x3, framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+FIXTURE_DATA_TEST_CASE(RunInnerBorder, NEGEMMDeconvolutionLayerFixture3x3<float>, framework::DatasetMode::ALL, combine(data3x3_inner_border, framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+TEST_SUITE_END()
+
+TEST_SUITE(W1x1)
+FIXTURE_DATA_TEST_CASE(Run, NEGEMMDeconvolutionLayerFixture1x1<float>, framework::DatasetMode::ALL, combine(data1x1, framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
+TEST_SUITE_END()
 
 TEST_SUITE_END()
 TEST_SUITE_END()
+
+TEST_SUITE_END() // GEMMDeconvolutionLayer
+TEST_SUITE_END()
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
@@ -27,6 +27,7 @@
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "tests/NEON/Accessor.h"
 #include "tests/PaddingCalculator.h"
+#include "tests/datasets/DepthwiseSeparableConvolutionLayerDataset.h"
 #include "tests/datasets/system_tests/mobilenet/MobileNetDepthwiseSeparableConvolutionLayerDataset.h"
 #include "tests/framework/Asserts.h"
 #include "tests/framework/Macros.h"
@@ -44,6 +45,18 @@ namespace
 {
 RelativeTolerance<float> tolerance_f32(0.1f); /**< Tolerance value for comparing reference's output against implementation's output for DataType::F32 */
 const float              tolerance_num = 0.001f;
+
+/** Activation functions fused into the depthwise and pointwise stages */
+const auto ActivationFunctionsDataset = framework::dataset::make("DepthwiseActivationInfo",
+{
+    ActivationLayerInfo(),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f)
+})
+* framework::dataset::make("PointwiseActivationInfo",
+{
+    ActivationLayerInfo(),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)
+});
 } // namespace
 
 TEST_SUITE(NEON)
@@ -59,6 +72,17 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEDepthwiseSeparableConvolutionLayerFixture<flo
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
 }
+
+template <typename T>
+using NEDepthwiseSeparableConvolutionLayerWithActivationFixture = DepthwiseSeparableConvolutionWithActivationValidationFixture<Tensor, Accessor, NEDepthwiseSeparableConvolutionLayer, T>;
+
+FIXTURE_DATA_TEST_CASE(RunSmallWithActivation, NEDepthwiseSeparableConvolutionLayerWithActivationFixture<float>, framework::DatasetMode::ALL,
+                       combine(combine(datasets::SmallDepthwiseSeparableConvolutionLayerDataset(), ActivationFunctionsDataset),
+                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32, tolerance_num);
+}
 TEST_SUITE_END()
 TEST_SUITE_END()
 } // namespace validation
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/MultiImage.h"
+#include "arm_compute/runtime/NEON/functions/NEImageToTensor.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/datasets/ShapeDatasets.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/ImageToTensorFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+constexpr AbsoluteTolerance<float>   tolerance_f32(0.001f); /**< Tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+constexpr AbsoluteTolerance<uint8_t> tolerance_qasymm8(1);  /**< Tolerance value for comparing reference's output against implementation's output for DataType::QASYMM8 */
+
+const auto ResizeDataset = framework::dataset::make("ResizeRatio", { 1.f, 0.6f, 1.7f });
+const auto FormatDataset = framework::dataset::make("FormatType", { Format::RGB888, Format::YUYV422, Format::UYVY422, Format::NV12, Format::NV21 });
+const auto LayoutDataset = framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC });
+const auto PolicyDataset = framework::dataset::make("InterpolationPolicy", { InterpolationPolicy::NEAREST_NEIGHBOR, InterpolationPolicy::BILINEAR });
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(ImageToTensor)
+
+// *INDENT-OFF*
+// clang-format off
+DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(
+               framework::dataset::make("InputInfo", { TensorInfo(32U, 16U, Format::RGB888),
+                                                       TensorInfo(32U, 16U, Format::U8),         // Unsupported format
+                                                       TensorInfo(31U, 16U, Format::YUYV422),    // Odd width
+                                                       TensorInfo(32U, 16U, Format::RGB888),     // Wrong number of channels
+                                                       TensorInfo(32U, 16U, Format::RGB888),     // Unsupported data type
+                                                       TensorInfo(32U, 16U, Format::UYVY422),    // More than one batch
+                                                       TensorInfo(32U, 16U, Format::UYVY422),
+                                                     }),
+               framework::dataset::make("OutputInfo",{ TensorInfo(TensorShape(224U, 224U, 3U), 1, DataType::F32),
+                                                       TensorInfo(TensorShape(224U, 224U, 3U), 1, DataType::F32),
+                                                       TensorInfo(TensorShape(224U, 224U, 3U), 1, DataType::F32),
+                                                       TensorInfo(TensorShape(224U, 224U, 4U), 1, DataType::F32),
+                                                       TensorInfo(TensorShape(224U, 224U, 3U), 1, DataType::S16),
+                                                       TensorInfo(TensorShape(224U, 224U, 3U, 2U), 1, DataType::F32),
+                                                       TensorInfo(TensorShape(16U, 8U, 3U), 1, DataType::QASYMM8, QuantizationInfo(0.1f, 10)),
+                                                     })),
+               framework::dataset::make("InterpolationPolicy", { InterpolationPolicy::BILINEAR,
+                                                                 InterpolationPolicy::BILINEAR,
+                                                                 InterpolationPolicy::BILINEAR,
+                                                                 InterpolationPolicy::BILINEAR,
+                                                                 InterpolationPolicy::BILINEAR,
+                                                                 InterpolationPolicy::BILINEAR,
+                                                                 InterpolationPolicy::NEAREST_NEIGHBOR,
+                                                               })),
+               framework::dataset::make("Expected", { true, false, false, false, false, false, true })),
+               input_info, output_info, policy, expected)
+{
+    const Status status = NEImageToTensor::validate(&input_info.clone()->set_is_resizable(false), &output_info.clone()->set_is_resizable(false),
+                                                    ImageToTensorInfo(std::array<float, 3> { { 0.f, 0.f, 0.f } }, std::array<float, 3> { { 1.f, 1.f, 1.f } }, false, policy));
+    ARM_COMPUTE_EXPECT(bool(status) == expected, framework::LogLevel::ERRORS);
+}
+// clang-format on
+// *INDENT-ON*
+
+template <typename T>
+using NEImageToTensorFixture = ImageToTensorValidationFixture<MultiImage, Tensor, Accessor, NEImageToTensor, T>;
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEImageToTensorFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(combine(combine(combine(datasets::Small2DShapes(), ResizeDataset),
+                                                                                                                   FormatDataset),
+                                                                                                                   framework::dataset::make("DataType", DataType::F32)),
+                                                                                                                   LayoutDataset),
+                                                                                                           PolicyDataset),
+                                                                                                   framework::dataset::make("BGR", true)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NEImageToTensorFixture<float>, framework::DatasetMode::NIGHTLY, combine(combine(combine(combine(combine(combine(datasets::Large2DShapes(),
+                                                                                                                 framework::dataset::make("ResizeRatio", 0.1f)),
+                                                                                                                 FormatDataset),
+                                                                                                                 framework::dataset::make("DataType", DataType::F32)),
+                                                                                                                 LayoutDataset),
+                                                                                                         framework::dataset::make("InterpolationPolicy", InterpolationPolicy::BILINEAR)),
+                                                                                                 framework::dataset::make("BGR", true)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+TEST_SUITE_END()
+
+TEST_SUITE(QASYMM8)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEImageToTensorFixture<uint8_t>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(combine(combine(combine(datasets::Small2DShapes(), ResizeDataset),
+                                                                                                                     framework::dataset::make("FormatType", { Format::RGB888, Format::NV12 })),
+                                                                                                                     framework::dataset::make("DataType", DataType::QASYMM8)),
+                                                                                                                     LayoutDataset),
+                                                                                                             PolicyDataset),
+                                                                                                     framework::dataset::make("BGR", false)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
+TEST_SUITE_END()
+
+TEST_SUITE_END()
+TEST_SUITE_END()
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
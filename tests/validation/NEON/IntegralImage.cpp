@@ -57,7 +57,7 @@ DATA_TEST_CASE(Configuration, framework::DatasetMode::ALL, combine(concat(datase
 
     // Validate padding
     const PaddingSize src_padding = PaddingCalculator(shape.x(), 16).required_padding();
-    const PaddingSize dst_padding(1, src_padding.right, 0, 1);
+    const PaddingSize dst_padding(0, src_padding.right, 0, 0);
 
     validate(src.info()->padding(), src_padding);
     validate(dst.info()->padding(), dst_padding);
@@ -65,6 +65,8 @@ DATA_TEST_CASE(Configuration, framework::DatasetMode::ALL, combine(concat(datase
 
 template <typename T>
 using NEIntegralImageFixture = IntegralImageValidationFixture<Tensor, Accessor, NEIntegralImage, T>;
+template <typename T>
+using NEIntegralImageSquaredFixture = IntegralImageSquaredValidationFixture<Tensor, Accessor, NEIntegralImage, T>;
 
 FIXTURE_DATA_TEST_CASE(RunSmall, NEIntegralImageFixture<uint8_t>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallShapes(), framework::dataset::make("DataType",
                                                                                                              DataType::U8)))
@@ -79,6 +81,24 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEIntegralImageFixture<uint8_t>, framework::Dat
     validate(Accessor(_target), _reference);
 }
 
+
+TEST_SUITE(Squared)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEIntegralImageSquaredFixture<uint8_t>, framework::DatasetMode::PRECOMMIT, combine(datasets::SmallShapes(), framework::dataset::make("DataType",
+                                                                                                                    DataType::U8)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+    validate(Accessor(_target_squared), _reference_squared);
+}
+FIXTURE_DATA_TEST_CASE(RunLarge, NEIntegralImageSquaredFixture<uint8_t>, framework::DatasetMode::NIGHTLY, combine(datasets::LargeShapes(), framework::dataset::make("DataType",
+                                                                                                                  DataType::U8)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+    validate(Accessor(_target_squared), _reference_squared);
+}
+TEST_SUITE_END() // Squared
+
 TEST_SUITE_END()
 TEST_SUITE_END()
 } // namespace validation
@@ -21,6 +21,7 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include "arm_compute/runtime/Allocator.h"
 #include "arm_compute/runtime/Array.h"
 #include "arm_compute/runtime/NEON/functions/NEGaussianPyramid.h"
 #include "arm_compute/runtime/NEON/functions/NEOpticalFlow.h"
@@ -82,6 +83,29 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEOpticalFlowFixture, framework::DatasetMode::N
                        _reference.begin(),
                        _reference.end());
 }
+
+using NEOpticalFlowMemoryManagerFixture = OpticalFlowMemoryManagerValidationFixture<Tensor,
+                                                                                   Accessor,
+                                                                                   KeyPointArray,
+                                                                                   ArrayAccessor<KeyPoint>,
+                                                                                   NEOpticalFlow,
+                                                                                   Pyramid,
+                                                                                   NEGaussianPyramidHalf,
+                                                                                   uint8_t,
+                                                                                   Allocator>;
+
+FIXTURE_DATA_TEST_CASE(RunSmallMemoryManager, NEOpticalFlowMemoryManagerFixture, framework::DatasetMode::PRECOMMIT, combine(combine(
+                       datasets::SmallOpticalFlowDataset(),
+                       framework::dataset::make("Format", Format::U8)),
+                       datasets::BorderModes()))
+{
+    // Validate output
+    ArrayAccessor<KeyPoint> array(_target);
+    validate_keypoints(array.buffer(),
+                       array.buffer() + array.num_values(),
+                       _reference.begin(),
+                       _reference.end());
+}
 // clang-format on
 // *INDENT-ON*
 
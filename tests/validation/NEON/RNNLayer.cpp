@@ -122,6 +122,8 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(zip(zip(zi
 
 template <typename T>
 using NERNNLayerFixture = RNNLayerValidationFixture<Tensor, Accessor, NERNNLayer, T>;
+template <typename T>
+using NERNNLayerSequenceFixture = RNNLayerSequenceValidationFixture<Tensor, Accessor, NERNNLayer, T>;
 
 TEST_SUITE(FP32)
 FIXTURE_DATA_TEST_CASE(RunSmall, NERNNLayerFixture<float>, framework::DatasetMode::ALL, combine(datasets::SmallRNNLayerDataset(), framework::dataset::make("DataType", DataType::F32)))
@@ -129,6 +131,13 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NERNNLayerFixture<float>, framework::DatasetMod
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32);
 }
+FIXTURE_DATA_TEST_CASE(RunSequence, NERNNLayerSequenceFixture<float>, framework::DatasetMode::ALL, combine(combine(datasets::SmallRNNLayerDataset(), framework::dataset::make("DataType",
+                                                                                                                  DataType::F32)),
+                                                                                                          framework::dataset::make("Timesteps", { 3U })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
 TEST_SUITE_END() // FP32
 
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/GraphMutators.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/PassManager.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/runtime/WeightsCache.h"
+#include "support/ToolchainSupport.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Fills a F32 tensor with uniformly distributed values */
+class UniformAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] seed Seed of the generator
+     * @param[in] low  Lower bound of the values
+     * @param[in] high Upper bound of the values
+     */
+    UniformAccessor(std::mt19937::result_type seed, float low, float high)
+        : _seed(seed), _low(low), _high(high)
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        std::mt19937                          gen(_seed);
+        std::uniform_real_distribution<float> distribution(_low, _high);
+
+        Window window;
+        window.use_tensor_dimensions(tensor.info()->tensor_shape());
+        execute_window_loop(window, [&](const Coordinates & id)
+        {
+            *reinterpret_cast<float *>(tensor.ptr_to_element(id)) = distribution(gen);
+        });
+        return true;
+    }
+
+    std::string source() const override
+    {
+        return "uniform(" + support::cpp11::to_string(_seed) + ")";
+    }
+
+private:
+    std::mt19937::result_type _seed;
+    float                     _low;
+    float                     _high;
+};
+
+/** Copies a F32 tensor to a vector and stops the execution */
+class CopyAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[out] output Vector to copy the tensor to
+     */
+    CopyAccessor(std::vector<float> &output)
+        : _output(output)
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        _output.clear();
+
+        Window window;
+        window.use_tensor_dimensions(tensor.info()->tensor_shape());
+        execute_window_loop(window, [&](const Coordinates & id)
+        {
+            _output.push_back(*reinterpret_cast<const float *>(tensor.ptr_to_element(id)));
+        });
+        return false;
+    }
+
+private:
+    std::vector<float> &_output;
+};
+
+/** Builds a ShuffleNet unit: pointwise convolution, batch normalization, activation, channel shuffle, depthwise convolution, batch normalization and pointwise convolution
+ *
+ * @param[in, out] g              Graph to build the unit into
+ * @param[in]      first_groups   Number of groups of the first pointwise convolution
+ * @param[in]      last_groups    Number of groups of the last pointwise convolution
+ * @param[in]      shuffle_groups Number of groups of the channel shuffle
+ * @param[out]     output         Vector to copy the output of the unit to
+ */
+void build_shuffle_unit(graph::Graph &g, unsigned int first_groups, unsigned int last_groups, unsigned int shuffle_groups, std::vector<float> &output)
+{
+    const graph::NodeParams params   = { "", graph::Target::NEON };
+    const unsigned int      channels = 8;
+
+    graph::NodeIdxPair node = { graph::GraphBuilder::add_input_node(g, params, graph::TensorDescriptor(TensorShape(7U, 7U, channels), DataType::F32),
+                                                                    support::cpp14::make_unique<UniformAccessor>(0, -1.f, 1.f)), 0 };
+    node.node_id = graph::GraphBuilder::add_convolution_node(g, params, node, Size2D(1U, 1U), channels, PadStrideInfo(1, 1, 0, 0), first_groups,
+                                                             graph::ConvolutionMethod::Default, graph::FastMathHint::Disabled,
+                                                             support::cpp14::make_unique<UniformAccessor>(1, -1.f, 1.f), support::cpp14::make_unique<UniformAccessor>(2, -1.f, 1.f));
+    node.node_id = graph::GraphBuilder::add_batch_normalization_node(g, params, node, 0.001f,
+                                                                     support::cpp14::make_unique<UniformAccessor>(3, -1.f, 1.f), support::cpp14::make_unique<UniformAccessor>(4, 0.5f, 2.f),
+                                                                     support::cpp14::make_unique<UniformAccessor>(5, -1.f, 1.f), support::cpp14::make_unique<UniformAccessor>(6, 0.5f, 2.f));
+    node.node_id = graph::GraphBuilder::add_activation_node(g, params, node, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+    node.node_id = graph::GraphBuilder::add_channel_shuffle_node(g, params, node, shuffle_groups);
+    node.node_id = graph::GraphBuilder::add_depthwise_convolution_node(g, params, node, Size2D(3U, 3U), PadStrideInfo(1, 1, 1, 1), graph::DepthwiseConvolutionMethod::Default,
+                                                                       support::cpp14::make_unique<UniformAccessor>(7, -1.f, 1.f), support::cpp14::make_unique<UniformAccessor>(8, -1.f, 1.f));
+    node.node_id = graph::GraphBuilder::add_batch_normalization_node(g, params, node, 0.001f,
+                                                                     support::cpp14::make_unique<UniformAccessor>(9, -1.f, 1.f), support::cpp14::make_unique<UniformAccessor>(10, 0.5f, 2.f));
+    node.node_id = graph::GraphBuilder::add_convolution_node(g, params, node, Size2D(1U, 1U), channels, PadStrideInfo(1, 1, 0, 0), last_groups,
+                                                             graph::ConvolutionMethod::Default, graph::FastMathHint::Disabled,
+                                                             support::cpp14::make_unique<UniformAccessor>(11, -1.f, 1.f), support::cpp14::make_unique<UniformAccessor>(12, -1.f, 1.f));
+    graph::GraphBuilder::add_output_node(g, params, node, support::cpp14::make_unique<CopyAccessor>(output));
+}
+
+/** Counts the channel shuffle nodes of a graph
+ *
+ * @param[in] g Graph to inspect
+ *
+ * @return The number of channel shuffle nodes
+ */
+size_t count_shuffle_nodes(const graph::Graph &g)
+{
+    return std::count_if(g.nodes().begin(), g.nodes().end(), [](const std::unique_ptr<graph::INode> &n)
+    {
+        return n != nullptr && n->type() == graph::NodeType::ChannelShuffleLayer;
+    });
+}
+
+/** Runs a ShuffleNet unit, see @ref build_shuffle_unit
+ *
+ * @param[in]  first_groups      Number of groups of the first pointwise convolution
+ * @param[in]  last_groups       Number of groups of the last pointwise convolution
+ * @param[in]  fuse_shuffle      Run the channel shuffle fusion pass
+ * @param[out] num_shuffle_nodes Number of channel shuffle nodes left in the graph once finalized
+ *
+ * @return The output of the unit
+ */
+std::vector<float> run_shuffle_unit(unsigned int first_groups, unsigned int last_groups, bool fuse_shuffle, size_t &num_shuffle_nodes)
+{
+    const graph::Target target = graph::Target::NEON;
+    std::vector<float>  output{};
+
+    graph::Graph g(0, "ShuffleUnit");
+    build_shuffle_unit(g, first_groups, last_groups, 2, output);
+
+    // The reference runs the default passes except the channel shuffle fusion
+    graph::PassManager pm;
+    if(fuse_shuffle)
+    {
+        pm = graph::create_default_pass_manager(target);
+    }
+    else
+    {
+        pm.append(support::cpp14::make_unique<graph::GroupedConvolutionMutator>());
+        pm.append(support::cpp14::make_unique<graph::NodeFusionMutator>());
+        pm.append(support::cpp14::make_unique<graph::InPlaceOperationMutator>());
+        pm.append(support::cpp14::make_unique<graph::DepthConcatSubTensorMutator>());
+        pm.append(support::cpp14::make_unique<graph::SplitLayerSubTensorMutator>());
+        pm.append(support::cpp14::make_unique<graph::NodeExecutionMethodMutator>());
+    }
+
+    graph::GraphContext ctx;
+    graph::GraphManager manager;
+    manager.finalize_graph(g, ctx, pm, target);
+
+    num_shuffle_nodes = count_shuffle_nodes(g);
+
+    manager.execute_graph(g);
+
+    return output;
+}
+
+/** ShuffleNet unit finalized with the const tensors shared with the other graphs of the process */
+class SharedShuffleUnit final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] id             Graph id
+     * @param[in] shuffle_groups Number of groups of the channel shuffle
+     */
+    SharedShuffleUnit(graph::GraphID id, unsigned int shuffle_groups)
+        : _output(), _ctx(), _manager(), _g(id, "SharedShuffleUnit")
+    {
+        build_shuffle_unit(_g, 1, 1, shuffle_groups, _output);
+
+        graph::GraphConfig config;
+        config.share_weights = true;
+        _ctx.set_config(config);
+
+        graph::PassManager pm = graph::create_default_pass_manager(graph::Target::NEON);
+        _manager.finalize_graph(_g, _ctx, pm, graph::Target::NEON);
+    }
+    /** Runs the unit
+     *
+     * @return The output of the unit
+     */
+    const std::vector<float> &run()
+    {
+        _manager.execute_graph(_g);
+        return _output;
+    }
+    /** Number of channel shuffle nodes left in the graph once finalized
+     *
+     * @return The number of channel shuffle nodes
+     */
+    size_t num_shuffle_nodes() const
+    {
+        return count_shuffle_nodes(_g);
+    }
+
+private:
+    std::vector<float>  _output;
+    graph::GraphContext _ctx;
+    graph::GraphManager _manager;
+    graph::Graph        _g;
+};
+
+/** Checks that the outputs of a ShuffleNet unit are the same with and without the channel shuffle fusion, and that the shuffle has been removed
+ *
+ * @param[in] first_groups Number of groups of the first pointwise convolution
+ * @param[in] last_groups  Number of groups of the last pointwise convolution
+ */
+void validate_shuffle_unit(unsigned int first_groups, unsigned int last_groups)
+{
+    size_t                   num_shuffle_nodes = 0;
+    const std::vector<float> reference         = run_shuffle_unit(first_groups, last_groups, false, num_shuffle_nodes);
+    ARM_COMPUTE_EXPECT(num_shuffle_nodes == 1, framework::LogLevel::ERRORS);
+
+    const std::vector<float> target = run_shuffle_unit(first_groups, last_groups, true, num_shuffle_nodes);
+    ARM_COMPUTE_EXPECT(num_shuffle_nodes == 0, framework::LogLevel::ERRORS);
+
+    ARM_COMPUTE_EXPECT_EQUAL(target.size(), reference.size(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!reference.empty(), framework::LogLevel::ERRORS);
+    for(size_t i = 0; i < std::min(target.size(), reference.size()); ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::abs(target[i] - reference[i]) <= 1e-4f * std::max(1.f, std::abs(reference[i])), framework::LogLevel::ERRORS);
+    }
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(ChannelShuffleFusionMutator)
+
+// The shuffle is folded into the ungrouped pointwise convolution before it, through the batch normalization and the activation
+TEST_CASE(FoldIntoProducer, framework::DatasetMode::ALL)
+{
+    validate_shuffle_unit(1, 2);
+}
+
+// The shuffle is folded into the ungrouped pointwise convolution after it, through the depthwise convolution and the batch normalization
+TEST_CASE(FoldIntoConsumer, framework::DatasetMode::ALL)
+{
+    validate_shuffle_unit(2, 1);
+}
+
+// Two graphs folding shuffles of different groups into the same weights must not share the permuted weights
+TEST_CASE(ShareFoldedWeights, framework::DatasetMode::ALL)
+{
+    WeightsCache::get().clear();
+
+    SharedShuffleUnit unit_2(0, 2);
+    SharedShuffleUnit unit_4(1, 4);
+    ARM_COMPUTE_EXPECT(unit_2.num_shuffle_nodes() == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(unit_4.num_shuffle_nodes() == 0, framework::LogLevel::ERRORS);
+
+    const std::vector<float> target_2 = unit_2.run();
+    const std::vector<float> target_4 = unit_4.run();
+
+    // References: the same units without the channel shuffle fusion nor the sharing
+    std::vector<float> reference_2{};
+    std::vector<float> reference_4{};
+    for(auto &unit : { std::make_pair(2U, &reference_2), std::make_pair(4U, &reference_4) })
+    {
+        graph::Graph g(2, "ShuffleUnit");
+        build_shuffle_unit(g, 1, 1, unit.first, *unit.second);
+
+        graph::PassManager pm;
+        pm.append(support::cpp14::make_unique<graph::InPlaceOperationMutator>());
+
+        graph::GraphContext ctx;
+        graph::GraphManager manager;
+        manager.finalize_graph(g, ctx, pm, graph::Target::NEON);
+        manager.execute_graph(g);
+    }
+
+    for(const auto &result : { std::make_pair(&target_2, &reference_2), std::make_pair(&target_4, &reference_4) })
+    {
+        const std::vector<float> &target    = *result.first;
+        const std::vector<float> &reference = *result.second;
+        ARM_COMPUTE_EXPECT_EQUAL(target.size(), reference.size(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!reference.empty(), framework::LogLevel::ERRORS);
+        for(size_t i = 0; i < std::min(target.size(), reference.size()); ++i)
+        {
+            ARM_COMPUTE_EXPECT(std::abs(target[i] - reference[i]) <= 1e-4f * std::max(1.f, std::abs(reference[i])), framework::LogLevel::ERRORS);
+        }
+    }
+}
+
+TEST_SUITE_END() // ChannelShuffleFusionMutator
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/frontend/DynamicBatcher.h"
+
+#include "arm_compute/graph/frontend/Layers.h"
+#include "support/ToolchainSupport.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <chrono>
+#include <future>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Number of elements of a single sample of the test stream */
+constexpr size_t sample_size = 4 * 3 * 2;
+
+/** Forwards the output of a stream to the dynamic batcher and records the batch size of the stream it belongs to */
+class RecordingAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in]  batch_size Batch size of the stream
+     * @param[in]  accessor   Output accessor of the dynamic batcher
+     * @param[out] runs       Batch sizes of the streams executed so far
+     */
+    RecordingAccessor(unsigned int batch_size, graph::ITensorAccessorUPtr accessor, std::vector<unsigned int> &runs)
+        : _batch_size(batch_size), _accessor(std::move(accessor)), _runs(runs)
+    {
+    }
+
+    bool access_tensor(ITensor &tensor) override
+    {
+        _runs.push_back(_batch_size);
+        return _accessor->access_tensor(tensor);
+    }
+
+private:
+    unsigned int               _batch_size;
+    graph::ITensorAccessorUPtr _accessor;
+    std::vector<unsigned int> &_runs;
+};
+
+/** Creates a dynamic batcher whose stream computes 2 * x + 1 on samples of shape (4, 3, 2)
+ *
+ * @param[in]  max_batch_size Maximum batch size
+ * @param[in]  timeout_us     Batching timeout in microseconds
+ * @param[out] runs           Batch sizes of the streams executed by the batcher
+ *
+ * @return The dynamic batcher
+ */
+std::unique_ptr<graph::frontend::DynamicBatcher> create_batcher(unsigned int max_batch_size, unsigned int timeout_us, std::vector<unsigned int> &runs)
+{
+    graph::GraphConfig config;
+    config.max_batch_size      = max_batch_size;
+    config.batching_timeout_us = timeout_us;
+
+    return support::cpp14::make_unique<graph::frontend::DynamicBatcher>(graph::Target::NEON, config,
+                                                                          [&runs](graph::frontend::Stream & stream, unsigned int batch_size,
+                                                                                  graph::ITensorAccessorUPtr input_accessor, graph::ITensorAccessorUPtr output_accessor)
+    {
+        stream << graph::Target::NEON
+               << graph::frontend::InputLayer(graph::TensorDescriptor(TensorShape(4U, 3U, 2U, batch_size), DataType::F32), std::move(input_accessor))
+               << graph::frontend::ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LINEAR, 2.f, 1.f))
+               << graph::frontend::OutputLayer(support::cpp14::make_unique<RecordingAccessor>(batch_size, std::move(output_accessor), runs));
+    });
+}
+
+/** Inference request of a single caller */
+struct Request
+{
+    /** Constructor
+     *
+     * @param[in] caller Index of the caller, used to give each caller distinct input values
+     */
+    explicit Request(size_t caller)
+        : input(sample_size), output(sample_size, 0.f), future()
+    {
+        for(size_t i = 0; i < sample_size; ++i)
+        {
+            input[i] = static_cast<float>(caller * sample_size + i);
+        }
+    }
+
+    std::vector<float> input;  /**< Input sample */
+    std::vector<float> output; /**< Output sample */
+    std::future<void>  future; /**< Completion of the request */
+};
+
+/** Enqueues a request for each caller
+ *
+ * @param[in]  batcher     Dynamic batcher
+ * @param[in]  num_callers Number of callers
+ * @param[out] requests    Requests of the callers
+ */
+void enqueue_requests(graph::frontend::DynamicBatcher &batcher, size_t num_callers, std::vector<Request> &requests)
+{
+    requests.clear();
+    requests.reserve(num_callers);
+    for(size_t i = 0; i < num_callers; ++i)
+    {
+        requests.emplace_back(i);
+    }
+    for(auto &request : requests)
+    {
+        request.future = batcher.enqueue(request.input.data(), request.output.data());
+    }
+}
+
+/** Waits for the requests and checks that each caller received the result of its own sample
+ *
+ * @param[in] requests Requests of the callers
+ */
+void validate_requests(std::vector<Request> &requests)
+{
+    for(auto &request : requests)
+    {
+        ARM_COMPUTE_EXPECT(request.future.wait_for(std::chrono::seconds(10)) == std::future_status::ready, framework::LogLevel::ERRORS);
+        for(size_t i = 0; i < sample_size; ++i)
+        {
+            ARM_COMPUTE_EXPECT_EQUAL(request.output[i], 2.f * request.input[i] + 1.f, framework::LogLevel::ERRORS);
+        }
+    }
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(DynamicBatcher)
+
+TEST_CASE(BatchSizes, framework::DatasetMode::ALL)
+{
+    std::vector<unsigned int> runs;
+
+    const auto batcher = create_batcher(6, 1000, runs);
+    ARM_COMPUTE_EXPECT((batcher->batch_sizes() == std::vector<unsigned int> { 1, 2, 4, 6 }), framework::LogLevel::ERRORS);
+}
+
+// A partial batch is dispatched once its oldest request has waited for the timeout
+TEST_CASE(FlushPartialBatchOnTimeout, framework::DatasetMode::ALL)
+{
+    const auto                timeout = std::chrono::milliseconds(50);
+    std::vector<unsigned int> runs;
+    std::vector<Request>      requests;
+
+    const auto batcher = create_batcher(4, std::chrono::duration_cast<std::chrono::microseconds>(timeout).count(), runs);
+
+    const auto start = std::chrono::steady_clock::now();
+    enqueue_requests(*batcher, 1, requests);
+    validate_requests(requests);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ARM_COMPUTE_EXPECT(elapsed >= timeout, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT((runs == std::vector<unsigned int> { 1 }), framework::LogLevel::ERRORS);
+}
+
+// A full batch is dispatched without waiting for the timeout
+TEST_CASE(DispatchFullBatch, framework::DatasetMode::ALL)
+{
+    const auto                timeout = std::chrono::seconds(5);
+    std::vector<unsigned int> runs;
+    std::vector<Request>      requests;
+
+    const auto batcher = create_batcher(4, std::chrono::duration_cast<std::chrono::microseconds>(timeout).count(), runs);
+
+    const auto start = std::chrono::steady_clock::now();
+    enqueue_requests(*batcher, 4, requests);
+    validate_requests(requests);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ARM_COMPUTE_EXPECT(elapsed < timeout, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT((runs == std::vector<unsigned int> { 4 }), framework::LogLevel::ERRORS);
+}
+
+// Requests are packed up to the maximum batch size and the remainder runs on the smallest stream able to hold it
+TEST_CASE(PackRequests, framework::DatasetMode::ALL)
+{
+    std::vector<unsigned int> runs;
+    std::vector<Request>      requests;
+
+    const auto batcher = create_batcher(4, 50000, runs);
+
+    // 6 requests: a full batch of 4, then 2 samples on the stream of batch size 2
+    enqueue_requests(*batcher, 6, requests);
+    validate_requests(requests);
+    ARM_COMPUTE_EXPECT((runs == std::vector<unsigned int> { 4, 2 }), framework::LogLevel::ERRORS);
+
+    // 3 requests: run on the stream of batch size 4, the last sample of which is ignored
+    runs.clear();
+    enqueue_requests(*batcher, 3, requests);
+    validate_requests(requests);
+    ARM_COMPUTE_EXPECT((runs == std::vector<unsigned int> { 4 }), framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // DynamicBatcher
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+
+#include "arm_compute/graph/Edge.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/PassManager.h"
+#include "arm_compute/graph/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Adds a convolution node without weights accessors
+ *
+ * @param[in] g      Graph to add the node to
+ * @param[in] input  Input of the convolution
+ * @param[in] kernel Size of the (square) kernel
+ * @param[in] depth  Number of output feature maps
+ *
+ * @return The output of the convolution
+ */
+graph::NodeIdxPair add_convolution(graph::Graph &g, graph::NodeIdxPair input, unsigned int kernel, unsigned int depth)
+{
+    const graph::NodeParams params = { "", graph::Target::NEON };
+    return { graph::GraphBuilder::add_convolution_node(g, params, input, Size2D(kernel, kernel), depth, PadStrideInfo(1, 1, kernel / 2, kernel / 2)), 0 };
+}
+
+/** Builds an Inception module: a stem convolution feeding four branches of different depths that are concatenated back together
+ *
+ * @param[in, out] g Graph to build the module into
+ */
+void build_inception_module(graph::Graph &g)
+{
+    const graph::NodeParams params = { "", graph::Target::NEON };
+
+    graph::NodeIdxPair input = { graph::GraphBuilder::add_input_node(g, params, graph::TensorDescriptor(TensorShape(28U, 28U, 192U), DataType::F32)), 0 };
+    graph::NodeIdxPair stem  = add_convolution(g, input, 1, 192);
+
+    const graph::NodeIdxPair branch_1x1 = add_convolution(g, stem, 1, 64);
+    const graph::NodeIdxPair branch_3x3 = add_convolution(g, add_convolution(g, stem, 1, 96), 3, 128);
+    const graph::NodeIdxPair branch_5x5 = add_convolution(g, add_convolution(g, add_convolution(g, stem, 1, 16), 5, 32), 5, 32);
+    const graph::NodeIdxPair branch_pool
+    {
+        graph::GraphBuilder::add_pooling_node(g, params, stem, PoolingLayerInfo(PoolingType::MAX, 3, PadStrideInfo(1, 1, 1, 1))), 0
+    };
+    const graph::NodeIdxPair branch_pool_proj = add_convolution(g, branch_pool, 1, 32);
+
+    const graph::NodeIdxPair concat =
+    {
+        graph::GraphBuilder::add_concatenate_node(g, params, { branch_1x1, branch_3x3, branch_5x5, branch_pool_proj }, graph::DataLayoutDimension::CHANNEL), 0
+    };
+    graph::GraphBuilder::add_output_node(g, params, concat);
+}
+
+/** Checks that an execution order is a topological order of a graph
+ *
+ * @param[in] g     Graph
+ * @param[in] order Execution order to check
+ *
+ * @return True if every node of the graph appears exactly once and after all its producers
+ */
+bool is_topological_order(const graph::Graph &g, const std::vector<graph::NodeID> &order)
+{
+    std::vector<int> position(g.nodes().size(), -1);
+    for(size_t i = 0; i < order.size(); ++i)
+    {
+        if(order[i] >= position.size() || g.node(order[i]) == nullptr || position[order[i]] != -1)
+        {
+            return false;
+        }
+        position[order[i]] = static_cast<int>(i);
+    }
+
+    const size_t num_nodes = std::count_if(g.nodes().begin(), g.nodes().end(), [](const std::unique_ptr<graph::INode> &n)
+    {
+        return n != nullptr;
+    });
+    if(order.size() != num_nodes)
+    {
+        return false;
+    }
+
+    return std::all_of(g.edges().begin(), g.edges().end(), [&](const std::unique_ptr<graph::Edge> &e)
+    {
+        return e == nullptr || position[e->producer_id()] < position[e->consumer_id()];
+    });
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(TopologicalSort)
+
+TEST_CASE(MemoryAwareSort, framework::DatasetMode::ALL)
+{
+    graph::Graph g(0, "Inception");
+    build_inception_module(g);
+
+    const std::vector<graph::NodeID> memory_aware_order = graph::memory_aware_sort(g);
+    ARM_COMPUTE_EXPECT(is_topological_order(g, memory_aware_order), framework::LogLevel::ERRORS);
+
+    // The depth first traversal marks the input and const nodes as visited before emitting them, so it is only compared on its peak
+    const size_t dfs_peak          = graph::peak_transition_memory(g, graph::dfs(g));
+    const size_t memory_aware_peak = graph::peak_transition_memory(g, memory_aware_order);
+    ARM_COMPUTE_EXPECT(memory_aware_peak > 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(memory_aware_peak <= dfs_peak, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(ReportPeakTransitionMemory, framework::DatasetMode::ALL)
+{
+    graph::Graph g(0, "Inception");
+    build_inception_module(g);
+
+    graph::GraphContext ctx;
+    graph::GraphManager manager;
+    graph::PassManager  pm = graph::create_default_pass_manager(graph::Target::NEON);
+    manager.finalize_graph(g, ctx, pm, graph::Target::NEON);
+
+    // The report matches the orders of the finalized graph
+    const graph::TransitionMemoryInfo info = manager.transition_memory_info(g);
+    ARM_COMPUTE_EXPECT_EQUAL(info.dfs_peak, graph::peak_transition_memory(g, graph::dfs(g)), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT_EQUAL(info.memory_aware_peak, graph::peak_transition_memory(g, graph::memory_aware_sort(g)), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(info.memory_aware_peak > 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(info.memory_aware_peak <= info.dfs_peak, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(info.use_memory_aware == (info.memory_aware_peak < info.dfs_peak), framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // TopologicalSort
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
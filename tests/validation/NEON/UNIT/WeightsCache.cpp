@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/WeightsCache.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <cstring>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Checks that the elements of two tensors with the same shape are bitwise equal */
+bool are_equal(const Tensor &a, const Tensor &b)
+{
+    Window window;
+    window.use_tensor_dimensions(a.info()->tensor_shape());
+
+    bool     equal = true;
+    Iterator it_a(&a, window);
+    Iterator it_b(&b, window);
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        equal = equal && std::memcmp(it_a.ptr(), it_b.ptr(), a.info()->element_size()) == 0;
+    },
+    it_a, it_b);
+    return equal;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(WeightsCache)
+
+TEST_CASE(AcquirePublish, framework::DatasetMode::ALL)
+{
+    WeightsCache &cache = WeightsCache::get();
+    cache.clear();
+
+    const TensorInfo info(TensorShape(24U, 16U, 3U), 1, DataType::F32);
+
+    Tensor t1;
+    Tensor t2;
+    Tensor t3;
+    Tensor t4;
+    t1.allocator()->init(info);
+    t2.allocator()->init(info);
+    t3.allocator()->init(info);
+    t4.allocator()->init(TensorInfo(TensorShape(24U, 16U, 4U), 1, DataType::F32));
+
+    // Empty key: plain allocation
+    ARM_COMPUTE_EXPECT(!cache.acquire("", t1), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(t1.buffer() != nullptr, framework::LogLevel::ERRORS);
+    t1.allocator()->free();
+
+    // First tensor has to be filled
+    ARM_COMPUTE_EXPECT(!cache.acquire("weights", t1), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(t1.buffer() != nullptr, framework::LogLevel::ERRORS);
+
+    // Not published yet: private copy
+    ARM_COMPUTE_EXPECT(!cache.acquire("weights", t2), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(t2.buffer() != nullptr && t2.buffer() != t1.buffer(), framework::LogLevel::ERRORS);
+
+    // Publishing the private copy has no effect
+    cache.publish("weights", t2);
+    ARM_COMPUTE_EXPECT(!cache.acquire("weights", t3), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(t3.buffer() != t1.buffer(), framework::LogLevel::ERRORS);
+    t3.allocator()->free();
+
+    // Published: memory is imported
+    cache.publish("weights", t1);
+    ARM_COMPUTE_EXPECT(cache.acquire("weights", t3), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(t3.buffer() == t1.buffer(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cache.size_in_bytes() == info.total_size(), framework::LogLevel::ERRORS);
+
+    // Different size: not shared
+    ARM_COMPUTE_EXPECT(!cache.acquire("weights", t4), framework::LogLevel::ERRORS);
+    cache.publish("weights", t4);
+
+    // Entries are released with their last tensor
+    t1.allocator()->free();
+    t3.allocator()->free();
+    t4.allocator()->free();
+    ARM_COMPUTE_EXPECT(cache.size_in_bytes() == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!cache.acquire("weights", t1), framework::LogLevel::ERRORS);
+
+    cache.clear();
+}
+
+TEST_CASE(SharedPreparedWeights, framework::DatasetMode::ALL)
+{
+    WeightsCache::get().clear();
+
+    const TensorShape   src_shape(13U, 11U, 8U);
+    const TensorShape   weights_shape(3U, 3U, 8U, 16U);
+    const TensorShape   dst_shape(11U, 9U, 16U);
+    const PadStrideInfo conv_info(1, 1, 0, 0);
+
+    Tensor src     = create_tensor<Tensor>(src_shape, DataType::F32);
+    Tensor weights = create_tensor<Tensor>(weights_shape, DataType::F32);
+    Tensor biases  = create_tensor<Tensor>(TensorShape(16U), DataType::F32);
+    Tensor zeros   = create_tensor<Tensor>(weights_shape, DataType::F32);
+    Tensor dst0    = create_tensor<Tensor>(dst_shape, DataType::F32);
+    Tensor dst1    = create_tensor<Tensor>(dst_shape, DataType::F32);
+
+    // The second instance is given zero weights: it can only compute the right result from the weights prepared by the first one
+    NEGEMMConvolutionLayer conv0;
+    NEGEMMConvolutionLayer conv1;
+    conv0.configure(&src, &weights, &biases, &dst0, conv_info);
+    conv1.configure(&src, &zeros, &biases, &dst1, conv_info);
+
+    src.allocator()->allocate();
+    weights.allocator()->allocate();
+    biases.allocator()->allocate();
+    zeros.allocator()->allocate();
+    dst0.allocator()->allocate();
+    dst1.allocator()->allocate();
+
+    library->fill_tensor_uniform(Accessor(src), 0);
+    library->fill_tensor_uniform(Accessor(weights), 1);
+    library->fill_tensor_uniform(Accessor(biases), 2);
+    library->fill_tensor_value(Accessor(zeros), 0.f);
+
+    {
+        WeightsCache::Scope scope("conv");
+        conv0.prepare();
+        conv1.prepare();
+    }
+    ARM_COMPUTE_EXPECT(WeightsCache::get().size_in_bytes() != 0, framework::LogLevel::ERRORS);
+
+    conv0.run();
+    conv1.run();
+    ARM_COMPUTE_EXPECT(are_equal(dst0, dst1), framework::LogLevel::ERRORS);
+
+    WeightsCache::get().clear();
+}
+
+TEST_SUITE_END()
+TEST_SUITE_END()
+TEST_SUITE_END()
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -213,6 +213,97 @@ public:
                                                                                               data_type, data_layout, quantization_info, act_info);
     }
 };
+/** Fixture comparing the implicit GEMM path of a GEMM based convolution against its im2col path */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class ConvolutionImplicitGEMMValidationFixture : public ConvolutionValidationGenericFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    template <typename...>
+    void setup(TensorShape input_shape, TensorShape weights_shape, TensorShape bias_shape, TensorShape output_shape, PadStrideInfo info, Size2D dilation, bool reshape_weights, DataType data_type,
+               DataLayout data_layout, ActivationLayerInfo act_info)
+    {
+        ARM_COMPUTE_UNUSED(reshape_weights);
+
+        this->_data_type      = data_type;
+        this->_is_quantized   = is_data_type_quantized_asymmetric(data_type);
+        this->_bias_data_type = this->_is_quantized ? DataType::S32 : data_type;
+        this->_data_layout    = data_layout;
+
+        this->_target = compute_target(input_shape, weights_shape, bias_shape, output_shape, info, dilation, act_info, true);
+
+        // The reference is the output of the im2col path, laid out as NCHW
+        TensorType im2col_output = compute_target(input_shape, weights_shape, bias_shape, output_shape, info, dilation, act_info, false);
+        AccessorType im2col_accessor(im2col_output);
+
+        this->_reference = SimpleTensor<T>(output_shape, data_type);
+        for(int i = 0; i < this->_reference.num_elements(); ++i)
+        {
+            Coordinates id = index2coord(output_shape, i);
+            if(data_layout == DataLayout::NHWC)
+            {
+                permute(id, PermutationVector(2U, 0U, 1U));
+            }
+            this->_reference[i] = *reinterpret_cast<const T *>(im2col_accessor(id));
+        }
+    }
+
+protected:
+    TensorType compute_target(TensorShape input_shape, TensorShape weights_shape, const TensorShape &bias_shape, TensorShape output_shape, const PadStrideInfo &info,
+                              const Size2D &dilation, const ActivationLayerInfo &act_info, bool implicit_gemm)
+    {
+        // NHWC 1x1 convolutions with unit strides can run the GEMM without im2col, so they don't need an implicit GEMM
+        const bool can_skip_im2col = this->_data_layout == DataLayout::NHWC && weights_shape[0] == 1 && weights_shape[1] == 1 && info.stride().first == 1 && info.stride().second == 1;
+
+        if(this->_data_layout == DataLayout::NHWC)
+        {
+            permute(input_shape, PermutationVector(2U, 0U, 1U));
+            permute(weights_shape, PermutationVector(2U, 0U, 1U));
+            permute(output_shape, PermutationVector(2U, 0U, 1U));
+        }
+
+        // Create tensors
+        TensorType src     = create_tensor<TensorType>(input_shape, this->_data_type, 1, QuantizationInfo(), this->_data_layout);
+        TensorType weights = create_tensor<TensorType>(weights_shape, this->_data_type, 1, QuantizationInfo(), this->_data_layout);
+        TensorType bias    = create_tensor<TensorType>(bias_shape, this->_bias_data_type, 1, QuantizationInfo(), this->_data_layout);
+        TensorType dst     = create_tensor<TensorType>(output_shape, this->_data_type, 1, QuantizationInfo(), this->_data_layout);
+
+        // Create and configure function
+        FunctionType conv;
+        conv.configure(&src, &weights, &bias, &dst, info, WeightsInfo(), dilation, act_info, 1, implicit_gemm);
+
+        // Make sure the path under test was selected rather than silently falling back to im2col
+        if(!can_skip_im2col)
+        {
+            ARM_COMPUTE_EXPECT(conv.is_implicit_gemm() == implicit_gemm, framework::LogLevel::ERRORS);
+        }
+
+        ARM_COMPUTE_EXPECT(src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(bias.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_EXPECT(!src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!bias.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors: both paths get the same data
+        this->fill(AccessorType(src), 0);
+        this->fill(AccessorType(weights), 1);
+        this->fill(AccessorType(bias), 2);
+
+        // Compute function
+        conv.run();
+
+        return dst;
+    }
+};
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_CROP_RESIZE_FIXTURE
+#define ARM_COMPUTE_TEST_CROP_RESIZE_FIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/Utils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/reference/CropResize.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename TensorType, typename AccessorType, typename Array_T, typename ArrayAccessorType, typename FunctionType, typename T>
+class CropResizeValidationFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape, const ROIPoolingLayerInfo crop_info, unsigned int num_rois, DataType data_type, int batches, float extrapolation_value)
+    {
+        shape.set(3, batches);
+
+        // Random ROIs inside the input plane, plus one crossing its bottom right corner to exercise the extrapolation
+        std::vector<ROI> rois = generate_random_rois(shape, crop_info, num_rois, library->seed());
+
+        ROI edge_roi;
+        edge_roi.batch_idx   = batches - 1;
+        edge_roi.rect.x      = static_cast<uint16_t>((shape.x() - 2) / crop_info.spatial_scale());
+        edge_roi.rect.y      = static_cast<uint16_t>((shape.y() - 2) / crop_info.spatial_scale());
+        edge_roi.rect.width  = static_cast<uint16_t>(8 / crop_info.spatial_scale());
+        edge_roi.rect.height = static_cast<uint16_t>(8 / crop_info.spatial_scale());
+        rois.push_back(edge_roi);
+
+        _target    = compute_target(shape, rois, crop_info, data_type, extrapolation_value);
+        _reference = compute_reference(shape, rois, crop_info, data_type, extrapolation_value);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor)
+    {
+        library->fill_tensor_uniform(tensor, 0);
+    }
+
+    TensorType compute_target(const TensorShape &shape, const std::vector<ROI> &rois, const ROIPoolingLayerInfo &crop_info, DataType data_type, float extrapolation_value)
+    {
+        // Create tensors
+        TensorType src = create_tensor<TensorType>(shape, data_type);
+        TensorType dst;
+
+        Array_T rois_array(rois.size());
+        fill_array(ArrayAccessorType(rois_array), rois);
+
+        // Create and configure function
+        FunctionType crop_resize;
+        crop_resize.configure(&src, &rois_array, &dst, crop_info, extrapolation_value);
+
+        ARM_COMPUTE_EXPECT(src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_EXPECT(!src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        fill(AccessorType(src));
+
+        // Compute function
+        crop_resize.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &shape, const std::vector<ROI> &rois, const ROIPoolingLayerInfo &crop_info, DataType data_type, float extrapolation_value)
+    {
+        // Create reference
+        SimpleTensor<T> src{ shape, data_type };
+
+        // Fill reference
+        fill(src);
+
+        return reference::crop_resize<T>(src, rois, crop_info, extrapolation_value);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_CROP_RESIZE_FIXTURE */
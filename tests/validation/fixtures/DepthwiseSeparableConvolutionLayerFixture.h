@@ -148,6 +148,107 @@ protected:
     TensorType      _target{};
     SimpleTensor<T> _reference{};
 };
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class DepthwiseSeparableConvolutionWithActivationValidationFixture : public DepthwiseSeparableConvolutionValidationFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    template <typename...>
+    void setup(TensorShape in_shape, TensorShape depthwise_weights_shape, TensorShape depthwise_biases_shape, TensorShape depthwise_out_shape, TensorShape pointwise_weights_shape,
+               TensorShape pointwise_biases_shape, TensorShape output_shape,
+               PadStrideInfo pad_stride_depthwise_info, PadStrideInfo pad_stride_pointwise_info,
+               ActivationLayerInfo depthwise_act_info, ActivationLayerInfo pointwise_act_info, DataLayout data_layout)
+    {
+        this->_target = compute_target(in_shape, depthwise_weights_shape, depthwise_biases_shape, depthwise_out_shape, pointwise_weights_shape, pointwise_biases_shape, output_shape,
+                                       pad_stride_depthwise_info, pad_stride_pointwise_info, depthwise_act_info, pointwise_act_info, data_layout);
+        this->_reference = compute_reference(in_shape, depthwise_weights_shape, depthwise_biases_shape, depthwise_out_shape, pointwise_weights_shape, pointwise_biases_shape, output_shape,
+                                             pad_stride_depthwise_info, pad_stride_pointwise_info, depthwise_act_info, pointwise_act_info);
+    }
+
+protected:
+    TensorType compute_target(TensorShape input_shape, TensorShape depthwise_weights_shape, const TensorShape &depthwise_biases_shape, TensorShape depthwise_out_shape,
+                              TensorShape pointwise_weights_shape, const TensorShape &pointwise_biases_shape, TensorShape output_shape,
+                              const PadStrideInfo &pad_stride_depthwise_info, const PadStrideInfo &pad_stride_pointwise_info,
+                              const ActivationLayerInfo &depthwise_act_info, const ActivationLayerInfo &pointwise_act_info, DataLayout data_layout)
+    {
+        if(data_layout == DataLayout::NHWC)
+        {
+            permute(input_shape, PermutationVector(2U, 0U, 1U));
+            permute(depthwise_weights_shape, PermutationVector(2U, 0U, 1U));
+            permute(depthwise_out_shape, PermutationVector(2U, 0U, 1U));
+            permute(pointwise_weights_shape, PermutationVector(2U, 0U, 1U));
+            permute(output_shape, PermutationVector(2U, 0U, 1U));
+        }
+
+        // Create tensors
+        TensorType src               = create_tensor<TensorType>(input_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+        TensorType depthwise_weights = create_tensor<TensorType>(depthwise_weights_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+        TensorType depthwise_biases  = create_tensor<TensorType>(depthwise_biases_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+        TensorType depthwise_out     = create_tensor<TensorType>(depthwise_out_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+        TensorType pointwise_weights = create_tensor<TensorType>(pointwise_weights_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+        TensorType pointwise_biases  = create_tensor<TensorType>(pointwise_biases_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+        TensorType dst               = create_tensor<TensorType>(output_shape, DataType::F32, 1, QuantizationInfo(), data_layout);
+
+        // Create Depthwise Separable Convolution Layer configure function
+        FunctionType depthwise_separable_convolution_layer;
+        depthwise_separable_convolution_layer.configure(&src, &depthwise_weights, &depthwise_biases, &depthwise_out, &pointwise_weights, &pointwise_biases, &dst, pad_stride_depthwise_info,
+                                                        pad_stride_pointwise_info, depthwise_act_info, pointwise_act_info);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        depthwise_weights.allocator()->allocate();
+        depthwise_biases.allocator()->allocate();
+        depthwise_out.allocator()->allocate();
+        pointwise_weights.allocator()->allocate();
+        pointwise_biases.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_EXPECT(!src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!depthwise_weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!depthwise_biases.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!depthwise_out.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!pointwise_weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!pointwise_biases.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        this->fill(AccessorType(src), 0);
+        this->fill(AccessorType(depthwise_weights), 1);
+        this->fill(AccessorType(depthwise_biases), 2);
+        this->fill(AccessorType(pointwise_weights), 3);
+        this->fill(AccessorType(pointwise_biases), 4);
+
+        // Compute function
+        depthwise_separable_convolution_layer.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &in_shape, const TensorShape &depthwise_weights_shape, const TensorShape &depthwise_biases_shape, const TensorShape &depthwise_out_shape,
+                                      const TensorShape &pointwise_weights_shape, const TensorShape &pointwise_biases_shape, const TensorShape &dst_shape,
+                                      const PadStrideInfo &pad_stride_depthwise_info, const PadStrideInfo &pad_stride_pointwise_info,
+                                      const ActivationLayerInfo &depthwise_act_info, const ActivationLayerInfo &pointwise_act_info)
+    {
+        SimpleTensor<T> src(in_shape, DataType::F32);
+        SimpleTensor<T> depthwise_weights(depthwise_weights_shape, DataType::F32);
+        SimpleTensor<T> depthwise_biases(depthwise_biases_shape, DataType::F32);
+        SimpleTensor<T> pointwise_weights(pointwise_weights_shape, DataType::F32);
+        SimpleTensor<T> pointwise_biases(pointwise_biases_shape, DataType::F32);
+
+        this->fill(src, 0);
+        this->fill(depthwise_weights, 1);
+        this->fill(depthwise_biases, 2);
+        this->fill(pointwise_weights, 3);
+        this->fill(pointwise_biases, 4);
+
+        return reference::depthwise_separable_convolution_layer(src,
+                                                                depthwise_weights, depthwise_biases, depthwise_out_shape,
+                                                                pointwise_weights, pointwise_biases,
+                                                                dst_shape,
+                                                                pad_stride_depthwise_info, pad_stride_pointwise_info,
+                                                                depthwise_act_info, pointwise_act_info);
+    }
+};
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_IMAGE_TO_TENSOR_FIXTURE
+#define ARM_COMPUTE_TEST_IMAGE_TO_TENSOR_FIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ImageToTensor.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+template <typename MultiImageType, typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class ImageToTensorValidationFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape, float resize_ratio, Format format, DataType data_type, DataLayout data_layout, InterpolationPolicy policy, bool bgr)
+    {
+        shape = adjust_odd_shape(shape, format);
+
+        // ImageNet mean and standard deviation of the RGB channels
+        const ImageToTensorInfo info(std::array<float, 3> { { 123.68f, 116.78f, 103.94f } }, std::array<float, 3> { { 1.f / 58.4f, 1.f / 57.1f, 1.f / 57.4f } }, bgr, policy);
+        const QuantizationInfo  quantization_info = is_data_type_quantized_asymmetric(data_type) ? QuantizationInfo(4.5f / 255.f, 120) : QuantizationInfo();
+
+        const TensorShape dst_shape(std::max(1, static_cast<int>(std::round(shape.x() * resize_ratio))), std::max(1, static_cast<int>(std::round(shape.y() * resize_ratio))), 3U);
+
+        _target    = compute_target(shape, format, dst_shape, data_type, data_layout, quantization_info, info);
+        _reference = compute_reference(shape, format, dst_shape, data_type, quantization_info, info);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int i)
+    {
+        library->fill_tensor_uniform(tensor, i);
+    }
+
+    std::vector<SimpleTensor<uint8_t>> create_tensor_planes_reference(const TensorShape &shape, Format format)
+    {
+        std::vector<SimpleTensor<uint8_t>> tensor_planes;
+
+        switch(format)
+        {
+            case Format::RGB888:
+            case Format::YUYV422:
+            case Format::UYVY422:
+                tensor_planes.emplace_back(shape, format);
+                break;
+            case Format::NV12:
+            case Format::NV21:
+                tensor_planes.emplace_back(shape, Format::U8);
+                tensor_planes.emplace_back(calculate_subsampled_shape(shape, Format::UV88), Format::UV88);
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Not supported");
+                break;
+        }
+
+        return tensor_planes;
+    }
+
+    TensorType compute_target(const TensorShape &shape, Format format, TensorShape dst_shape, DataType data_type, DataLayout data_layout,
+                              QuantizationInfo quantization_info, const ImageToTensorInfo &info)
+    {
+        if(data_layout == DataLayout::NHWC)
+        {
+            permute(dst_shape, PermutationVector(2U, 0U, 1U));
+        }
+
+        // Create tensors
+        MultiImageType src = create_multi_image<MultiImageType>(shape, format);
+        TensorType     dst = create_tensor<TensorType>(dst_shape, data_type, 1, quantization_info, data_layout);
+
+        // Create and configure function
+        FunctionType image_to_tensor;
+        if(num_planes_from_format(format) == 1)
+        {
+            image_to_tensor.configure(src.plane(0), &dst, info);
+        }
+        else
+        {
+            image_to_tensor.configure(&src, &dst, info);
+        }
+
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        src.allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensor planes
+        for(unsigned int plane_idx = 0; plane_idx < num_planes_from_format(format); ++plane_idx)
+        {
+            fill(AccessorType(*src.plane(plane_idx)), plane_idx);
+        }
+
+        // Compute function
+        image_to_tensor.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &shape, Format format, const TensorShape &dst_shape, DataType data_type,
+                                      QuantizationInfo quantization_info, const ImageToTensorInfo &info)
+    {
+        // Create reference
+        std::vector<SimpleTensor<uint8_t>> src = create_tensor_planes_reference(shape, format);
+
+        // Fill references
+        for(unsigned int plane_idx = 0; plane_idx < src.size(); ++plane_idx)
+        {
+            fill(src[plane_idx], plane_idx);
+        }
+
+        return reference::image_to_tensor<T>(src, format, dst_shape, data_type, quantization_info, info);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_IMAGE_TO_TENSOR_FIXTURE */
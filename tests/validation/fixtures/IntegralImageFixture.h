@@ -100,6 +100,73 @@ protected:
     TensorType             _target{};
     SimpleTensor<uint32_t> _reference{};
 };
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class IntegralImageSquaredValidationFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape, DataType data_type)
+    {
+        compute_target(shape);
+        compute_reference(shape, data_type);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor)
+    {
+        library->fill_tensor_uniform(tensor, 0);
+    }
+
+    void compute_target(const TensorShape &shape)
+    {
+        // Create tensors
+        TensorType src  = create_tensor<TensorType>(shape, DataType::U8);
+        _target         = create_tensor<TensorType>(shape, DataType::U32);
+        _target_squared = create_tensor<TensorType>(shape, DataType::U64);
+
+        // Create and configure function
+        FunctionType integral_image;
+        integral_image.configure(&src, &_target, &_target_squared);
+
+        ARM_COMPUTE_EXPECT(src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(_target.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(_target_squared.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        _target.allocator()->allocate();
+        _target_squared.allocator()->allocate();
+
+        ARM_COMPUTE_EXPECT(!src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!_target.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!_target_squared.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        fill(AccessorType(src));
+
+        // Compute function
+        integral_image.run();
+    }
+
+    void compute_reference(const TensorShape &shape, DataType data_type)
+    {
+        // Create reference
+        SimpleTensor<T> src{ shape, data_type };
+
+        // Fill reference
+        fill(src);
+
+        _reference         = reference::integral_image<T>(src);
+        _reference_squared = reference::integral_image_squared<T>(src);
+    }
+
+    TensorType             _target{};
+    TensorType             _target_squared{};
+    SimpleTensor<uint32_t> _reference{};
+    SimpleTensor<uint64_t> _reference_squared{};
+};
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
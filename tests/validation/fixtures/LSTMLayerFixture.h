@@ -56,6 +56,14 @@ public:
     }
 
 protected:
+    static TensorShape sequence_shape(TensorShape shape, unsigned int num_timesteps)
+    {
+        if(num_timesteps > 1)
+        {
+            shape.set(2, num_timesteps);
+        }
+        return shape;
+    }
     template <typename U>
     void fill(U &&tensor, int i)
     {
@@ -70,13 +78,13 @@ protected:
     }
     TensorType compute_target(const TensorShape &input_shape, const TensorShape &input_weights_shape, const TensorShape &recurrent_weights_shape, const TensorShape &cell_bias_shape,
                               const TensorShape &output_cell_shape, const TensorShape &output_shape, const TensorShape &scratch_shape, ActivationLayerInfo info, float cell_threshold,
-                              float projection_threshold, DataType data_type, bool projection_opt, bool peephole_opt)
+                              float projection_threshold, DataType data_type, bool projection_opt, bool peephole_opt, unsigned int num_timesteps = 1)
     {
         const unsigned int num_cells   = input_weights_shape.y();
         const unsigned int num_outputs = recurrent_weights_shape.x();
 
         // Create tensors
-        TensorType input                 = create_tensor<TensorType>(input_shape, data_type);
+        TensorType input                 = create_tensor<TensorType>(sequence_shape(input_shape, num_timesteps), data_type);
         TensorType input_to_forget_w     = create_tensor<TensorType>(input_weights_shape, data_type);
         TensorType input_to_cell_w       = create_tensor<TensorType>(input_weights_shape, data_type);
         TensorType input_to_output_w     = create_tensor<TensorType>(input_weights_shape, data_type);
@@ -91,7 +99,7 @@ protected:
         TensorType scratch               = create_tensor<TensorType>(scratch_shape, data_type);
         TensorType output_state_out      = create_tensor<TensorType>(output_shape, data_type);
         TensorType cell_state_out        = create_tensor<TensorType>(output_cell_shape, data_type);
-        TensorType output                = create_tensor<TensorType>(output_shape, data_type);
+        TensorType output                = create_tensor<TensorType>(sequence_shape(output_shape, num_timesteps), data_type);
         TensorType input_to_input_w;
         TensorType recurrent_to_input_w;
         TensorType cell_to_input_w;
@@ -238,6 +246,7 @@ protected:
             cell_to_output_w.allocator()->allocate();
             ARM_COMPUTE_EXPECT(!cell_to_forget_w.info()->is_resizable(), framework::LogLevel::ERRORS);
             ARM_COMPUTE_EXPECT(!cell_to_output_w.info()->is_resizable(), framework::LogLevel::ERRORS);
+            fill(AccessorType(cell_to_forget_w), 21);
             fill(AccessorType(cell_to_output_w), 18);
         }
 
@@ -264,7 +273,7 @@ protected:
 
     SimpleTensor<T> compute_reference(const TensorShape &input_shape, const TensorShape &input_weights_shape, const TensorShape &recurrent_weights_shape, const TensorShape &cell_bias_shape,
                                       const TensorShape &output_cell_shape, const TensorShape &output_shape, const TensorShape &scratch_shape, ActivationLayerInfo info, float cell_threshold,
-                                      float projection_threshold, DataType data_type, bool projection_opt, bool peephole_opt)
+                                      float projection_threshold, DataType data_type, bool projection_opt, bool peephole_opt, unsigned int num_timesteps = 1)
     {
         const unsigned int num_cells   = input_weights_shape.y();
         const unsigned int num_outputs = recurrent_weights_shape.x();
@@ -279,6 +288,7 @@ protected:
         SimpleTensor<T> gemm_out{ gemm_shape, data_type };
 
         // Create reference
+        SimpleTensor<T> input_sequence{ sequence_shape(input_shape, num_timesteps), data_type };
         SimpleTensor<T> input{ input_shape, data_type };
         SimpleTensor<T> input_to_input_w{ input_weights_shape, data_type };
         SimpleTensor<T> input_to_forget_w{ input_weights_shape, data_type };
@@ -302,10 +312,10 @@ protected:
         SimpleTensor<T> scratch{ scratch_shape, data_type };
         SimpleTensor<T> output_state_out{ output_shape, data_type };
         SimpleTensor<T> cell_state_out{ output_cell_shape, data_type };
-        SimpleTensor<T> output{ output_shape, data_type };
+        SimpleTensor<T> output{ sequence_shape(output_shape, num_timesteps), data_type };
 
         // Fill reference
-        fill(input, 0);
+        fill(input_sequence, 0);
         fill(input_to_forget_w, 1);
         fill(input_to_cell_w, 2);
         fill(input_to_output_w, 3);
@@ -324,91 +334,122 @@ protected:
         fill(recurrent_to_input_w, 16);
         fill(input_gate_bias, 17);
         fill(cell_to_output_w, 18);
+        fill(cell_to_forget_w, 21);
         fill(projection_w, 19);
         fill(projection_bias, 20);
 
         bool cifg_opt = scratch_shape.x() == cell_bias_shape.x() * 4 ? true : false;
 
-        // Compute forget_gate
-        SimpleTensor<T> fully_connected_forget = reference::fully_connected_layer(input, input_to_forget_w, forget_gate_bias, output_cell_shape);
-        SimpleTensor<T> transposed_weights     = reference::transpose(recurrent_to_forget_w);
-        SimpleTensor<T> gemm                   = reference::gemm(output_state_in, transposed_weights, cell_state_in, 1.f, 0.f);
-        SimpleTensor<T> forget_gate            = reference::arithmetic_addition(fully_connected_forget, gemm, data_type, ConvertPolicy::SATURATE);
+        const size_t step_input_elements  = input.num_elements();
+        const size_t step_output_elements = output_state_out.num_elements();
 
-        if(peephole_opt)
+        for(unsigned int t = 0; t < num_timesteps; ++t)
         {
-            SimpleTensor<T> pixelwise_mul_forget_gate = reference::pixel_wise_multiplication(cell_state_in, cell_to_forget_w, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_NEAREST_EVEN);
-            forget_gate                               = reference::arithmetic_addition(forget_gate, pixelwise_mul_forget_gate, data_type, ConvertPolicy::SATURATE);
-        }
+            // Slice the input of the current timestep
+            std::copy_n(input_sequence.data() + t * step_input_elements, step_input_elements, input.data());
 
-        forget_gate = reference::activation_layer(forget_gate, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC));
+            // Compute forget_gate
+            SimpleTensor<T> fully_connected_forget = reference::fully_connected_layer(input, input_to_forget_w, forget_gate_bias, output_cell_shape);
+            SimpleTensor<T> transposed_weights     = reference::transpose(recurrent_to_forget_w);
+            SimpleTensor<T> gemm                   = reference::gemm(output_state_in, transposed_weights, cell_state_in, 1.f, 0.f);
+            SimpleTensor<T> forget_gate            = reference::arithmetic_addition(fully_connected_forget, gemm, data_type, ConvertPolicy::SATURATE);
 
-        // Compute input_gate
-        SimpleTensor<T> input_gate;
-        if(cifg_opt)
-        {
-            SimpleTensor<T> ones{ cell_bias_shape, data_type };
-            fill_custom_val(ones, 1.f, 0);
-            input_gate = reference::arithmetic_subtraction<T, T, T>(ones, forget_gate, data_type, ConvertPolicy::SATURATE);
-        }
-        else
-        {
-            SimpleTensor<T> fully_connected_input = reference::fully_connected_layer(input, input_to_input_w, input_gate_bias, output_cell_shape);
-            transposed_weights                    = reference::transpose(recurrent_to_input_w);
-            gemm                                  = reference::gemm(output_state_in, transposed_weights, cell_state_in, 1.f, 0.f);
-            input_gate                            = reference::arithmetic_addition(fully_connected_input, gemm, data_type, ConvertPolicy::SATURATE);
             if(peephole_opt)
             {
-                SimpleTensor<T> pixelwise_mul_input_gate = reference::pixel_wise_multiplication(cell_state_in, cell_to_input_w, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_NEAREST_EVEN);
-                input_gate                               = reference::arithmetic_addition(input_gate, pixelwise_mul_input_gate, data_type, ConvertPolicy::SATURATE);
+                SimpleTensor<T> pixelwise_mul_forget_gate = reference::pixel_wise_multiplication(cell_state_in, cell_to_forget_w, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_NEAREST_EVEN);
+                forget_gate                               = reference::arithmetic_addition(forget_gate, pixelwise_mul_forget_gate, data_type, ConvertPolicy::SATURATE);
             }
-            input_gate = reference::activation_layer(input_gate, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC));
-        }
 
-        // Compute cell_state
-        SimpleTensor<T> fully_connected_cell_state = reference::fully_connected_layer(input, input_to_cell_w, cell_bias, output_cell_shape);
-        transposed_weights                         = reference::transpose(recurrent_to_cell_w);
-        gemm                                       = reference::gemm(output_state_in, transposed_weights, cell_state_out, 1.f, 0.f);
-        SimpleTensor<T> pixelwise_mul              = reference::pixel_wise_multiplication(cell_state_in, forget_gate, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_NEAREST_EVEN);
-        cell_state_out                             = reference::arithmetic_addition(fully_connected_cell_state, gemm, data_type, ConvertPolicy::SATURATE);
-        cell_state_out                             = reference::activation_layer(cell_state_out, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC));
-        cell_state_out                             = reference::pixel_wise_multiplication(cell_state_out, input_gate, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_NEAREST_EVEN);
-        cell_state_out                             = reference::arithmetic_addition(cell_state_out, pixelwise_mul, data_type, ConvertPolicy::SATURATE);
-        if(cell_threshold != 0.f)
-        {
-            cell_state_out = reference::activation_layer(cell_state_out, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, -cell_threshold, cell_threshold));
-        }
+            forget_gate = reference::activation_layer(forget_gate, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC));
 
-        // Compute output
-        SimpleTensor<T> fully_connected_output = reference::fully_connected_layer(input, input_to_output_w, output_gate_bias, output_cell_shape);
-        transposed_weights                     = reference::transpose(recurrent_to_output_w);
-        gemm                                   = reference::gemm(output_state_in, transposed_weights, cell_state_out, 1.f, 0.f);
-        output                                 = reference::arithmetic_addition(fully_connected_output, gemm, data_type, ConvertPolicy::SATURATE);
-        if(peephole_opt)
-        {
-            pixelwise_mul = reference::pixel_wise_multiplication(cell_state_out, cell_to_output_w, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_NEAREST_EVEN);
-            output        = reference::arithmetic_addition(output, pixelwise_mul, data_type, ConvertPolicy::SATURATE);
-        }
-        output = reference::activation_layer(output, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC));
+            // Compute input_gate
+            SimpleTensor<T> input_gate;
+            if(cifg_opt)
+            {
+                SimpleTensor<T> ones{ cell_bias_shape, data_type };
+                fill_custom_val(ones, 1.f, 0);
+                input_gate = reference::arithmetic_subtraction<T, T, T>(ones, forget_gate, data_type, ConvertPolicy::SATURATE);
+            }
+            else
+            {
+                SimpleTensor<T> fully_connected_input = reference::fully_connected_layer(input, input_to_input_w, input_gate_bias, output_cell_shape);
+                transposed_weights                    = reference::transpose(recurrent_to_input_w);
+                gemm                                  = reference::gemm(output_state_in, transposed_weights, cell_state_in, 1.f, 0.f);
+                input_gate                            = reference::arithmetic_addition(fully_connected_input, gemm, data_type, ConvertPolicy::SATURATE);
+                if(peephole_opt)
+                {
+                    SimpleTensor<T> pixelwise_mul_input_gate = reference::pixel_wise_multiplication(cell_state_in, cell_to_input_w, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_NEAREST_EVEN);
+                    input_gate                               = reference::arithmetic_addition(input_gate, pixelwise_mul_input_gate, data_type, ConvertPolicy::SATURATE);
+                }
+                input_gate = reference::activation_layer(input_gate, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC));
+            }
 
-        // Compute output state
-        SimpleTensor<T> cell_state_activation = reference::activation_layer(cell_state_out, info);
-        output_state_out                      = reference::pixel_wise_multiplication(output, cell_state_activation, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_NEAREST_EVEN);
+            // Compute cell_state
+            SimpleTensor<T> fully_connected_cell_state = reference::fully_connected_layer(input, input_to_cell_w, cell_bias, output_cell_shape);
+            transposed_weights                         = reference::transpose(recurrent_to_cell_w);
+            gemm                                       = reference::gemm(output_state_in, transposed_weights, cell_state_out, 1.f, 0.f);
+            SimpleTensor<T> pixelwise_mul              = reference::pixel_wise_multiplication(cell_state_in, forget_gate, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_NEAREST_EVEN);
+            cell_state_out                             = reference::arithmetic_addition(fully_connected_cell_state, gemm, data_type, ConvertPolicy::SATURATE);
+            cell_state_out                             = reference::activation_layer(cell_state_out, info);
+            cell_state_out                             = reference::pixel_wise_multiplication(cell_state_out, input_gate, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_NEAREST_EVEN);
+            cell_state_out                             = reference::arithmetic_addition(cell_state_out, pixelwise_mul, data_type, ConvertPolicy::SATURATE);
+            if(cell_threshold != 0.f)
+            {
+                cell_state_out = reference::activation_layer(cell_state_out, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, -cell_threshold, cell_threshold));
+            }
 
-        if(projection_opt)
-        {
-            SimpleTensor<T> fully_connected_projection = reference::fully_connected_layer(output_state_out, projection_w, projection_bias, output_cell_shape);
-            if(projection_threshold != 0.f)
+            // Compute output
+            SimpleTensor<T> fully_connected_output = reference::fully_connected_layer(input, input_to_output_w, output_gate_bias, output_cell_shape);
+            transposed_weights                     = reference::transpose(recurrent_to_output_w);
+            gemm                                   = reference::gemm(output_state_in, transposed_weights, cell_state_out, 1.f, 0.f);
+            SimpleTensor<T> output_gate            = reference::arithmetic_addition(fully_connected_output, gemm, data_type, ConvertPolicy::SATURATE);
+            if(peephole_opt)
+            {
+                pixelwise_mul = reference::pixel_wise_multiplication(cell_state_out, cell_to_output_w, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_NEAREST_EVEN);
+                output_gate   = reference::arithmetic_addition(output_gate, pixelwise_mul, data_type, ConvertPolicy::SATURATE);
+            }
+            output_gate = reference::activation_layer(output_gate, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LOGISTIC));
+
+            // Compute output state
+            SimpleTensor<T> cell_state_activation = reference::activation_layer(cell_state_out, info);
+            output_state_out                      = reference::pixel_wise_multiplication(output_gate, cell_state_activation, 1, ConvertPolicy::SATURATE, RoundingPolicy::TO_NEAREST_EVEN);
+
+            if(projection_opt)
             {
-                output_state_out = reference::activation_layer(fully_connected_projection, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, -projection_threshold, projection_threshold));
+                SimpleTensor<T> fully_connected_projection = reference::fully_connected_layer(output_state_out, projection_w, projection_bias, output_shape);
+                output_state_out                           = fully_connected_projection;
+                if(projection_threshold != 0.f)
+                {
+                    output_state_out = reference::activation_layer(output_state_out, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, -projection_threshold, projection_threshold));
+                }
             }
+
+            // Store the output of the current timestep and feed the states back
+            std::copy_n(output_state_out.data(), step_output_elements, output.data() + t * step_output_elements);
+            output_state_in = output_state_out;
+            cell_state_in   = cell_state_out;
         }
-        return output_state_out;
+        return output;
     }
 
     TensorType      _target{};
     SimpleTensor<T> _reference{};
 };
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename FunctionParams, typename T>
+class LSTMLayerSequenceValidationFixture : public LSTMLayerValidationFixture<TensorType, AccessorType, FunctionType, FunctionParams, T>
+{
+public:
+    template <typename...>
+    void setup(TensorShape input_shape, TensorShape input_weights_shape, TensorShape recurrent_weights_shape, TensorShape cell_bias_shape, TensorShape output_cell_shape, TensorShape output_shape,
+               TensorShape scratch_shape, ActivationLayerInfo info, float cell_threshold, float projection_threshold, DataType data_type, bool projection_opt, bool peephole_opt, unsigned int num_timesteps)
+    {
+        this->_target = this->compute_target(input_shape, input_weights_shape, recurrent_weights_shape, cell_bias_shape, output_cell_shape, output_shape, scratch_shape, info, cell_threshold,
+                                             projection_threshold, data_type, projection_opt, peephole_opt, num_timesteps);
+        this->_reference = this->compute_reference(input_shape, input_weights_shape, recurrent_weights_shape, cell_bias_shape, output_cell_shape, output_shape, scratch_shape, info, cell_threshold,
+                                                   projection_threshold, data_type, projection_opt, peephole_opt, num_timesteps);
+    }
+};
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
@@ -27,6 +27,9 @@
 #include "arm_compute/core/PyramidInfo.h"
 #include "arm_compute/core/TensorShape.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/BlobLifetimeManager.h"
+#include "arm_compute/runtime/MemoryManagerOnDemand.h"
+#include "arm_compute/runtime/PoolManager.h"
 #include "tests/AssetsLibrary.h"
 #include "tests/Globals.h"
 #include "tests/IAccessor.h"
@@ -56,6 +59,14 @@ public:
     template <typename...>
     void setup(std::string old_image_name, std::string new_image_name, OpticalFlowParameters params,
                size_t num_levels, size_t num_keypoints, Format format, BorderMode border_mode)
+    {
+        setup_generic(old_image_name, new_image_name, params, num_levels, num_keypoints, format, border_mode, nullptr, nullptr);
+    }
+
+protected:
+    void setup_generic(std::string old_image_name, std::string new_image_name, OpticalFlowParameters params,
+                       size_t num_levels, size_t num_keypoints, Format format, BorderMode border_mode,
+                       std::shared_ptr<MemoryManagerOnDemand> memory_manager, IAllocator *allocator)
     {
         std::mt19937                           gen(library->seed());
         std::uniform_int_distribution<uint8_t> int_dist(0, 255);
@@ -65,11 +76,11 @@ public:
         std::vector<KeyPoint> old_keypoints           = generate_random_keypoints(library->get_image_shape(old_image_name), num_keypoints, library->seed(), num_levels);
         std::vector<KeyPoint> new_keypoints_estimates = old_keypoints;
 
-        _target    = compute_target(old_image_name, new_image_name, params, num_levels, old_keypoints, new_keypoints_estimates, format, border_mode, constant_border_value);
+        _target    = compute_target(old_image_name, new_image_name, params, num_levels, old_keypoints, new_keypoints_estimates, format, border_mode, constant_border_value,
+                                    memory_manager, allocator);
         _reference = compute_reference(old_image_name, new_image_name, params, num_levels, old_keypoints, new_keypoints_estimates, format, border_mode, constant_border_value);
     }
 
-protected:
     template <typename V>
     void fill(V &&tensor, const std::string image, Format format)
     {
@@ -78,7 +89,8 @@ protected:
 
     ArrayType compute_target(std::string old_image_name, std::string new_image_name, OpticalFlowParameters params, size_t num_levels,
                              std::vector<KeyPoint> &old_keypoints, std::vector<KeyPoint> &new_keypoints_estimates,
-                             Format format, BorderMode border_mode, uint8_t constant_border_value)
+                             Format format, BorderMode border_mode, uint8_t constant_border_value,
+                             std::shared_ptr<MemoryManagerOnDemand> memory_manager, IAllocator *allocator)
     {
         // Get image shapes
         TensorShape old_shape = library->get_image_shape(old_image_name);
@@ -115,7 +127,7 @@ protected:
         }
 
         // Create and configure optical flow function
-        FunctionType optical_flow;
+        FunctionType optical_flow(memory_manager);
 
         optical_flow.configure(&old_pyramid,
                                &new_pyramid,
@@ -150,6 +162,15 @@ protected:
             ARM_COMPUTE_EXPECT(!new_pyramid.get_pyramid_level(i)->info()->is_resizable(), framework::LogLevel::ERRORS);
         }
 
+        // Finalize memory manager
+        if(memory_manager != nullptr)
+        {
+            memory_manager->set_allocator(allocator);
+            memory_manager->set_num_pools(1);
+            memory_manager->finalize();
+            ARM_COMPUTE_EXPECT(memory_manager->is_finalized(), framework::LogLevel::ERRORS);
+        }
+
         // Fill tensors
         fill(AccessorType(old_image), old_image_name, format);
         fill(AccessorType(new_image), new_image_name, format);
@@ -180,6 +201,34 @@ protected:
     ArrayType             _target{};
     std::vector<KeyPoint> _reference{};
 };
+
+/** Optical flow fixture running the function with a blob memory manager, so that its intermediate buffers are shared when their lifetimes allow it */
+template <typename TensorType,
+          typename AccessorType,
+          typename ArrayType,
+          typename ArrayAccessorType,
+          typename FunctionType,
+          typename PyramidType,
+          typename PyramidFunctionType,
+          typename T,
+          typename AllocatorType>
+class OpticalFlowMemoryManagerValidationFixture
+    : public OpticalFlowValidationFixture<TensorType, AccessorType, ArrayType, ArrayAccessorType, FunctionType, PyramidType, PyramidFunctionType, T>
+{
+public:
+    template <typename...>
+    void setup(std::string old_image_name, std::string new_image_name, OpticalFlowParameters params,
+               size_t num_levels, size_t num_keypoints, Format format, BorderMode border_mode)
+    {
+        auto memory_manager = std::make_shared<MemoryManagerOnDemand>(std::make_shared<BlobLifetimeManager>(), std::make_shared<PoolManager>());
+
+        OpticalFlowValidationFixture<TensorType, AccessorType, ArrayType, ArrayAccessorType, FunctionType, PyramidType, PyramidFunctionType, T>::setup_generic(old_image_name, new_image_name, params,
+                num_levels, num_keypoints, format, border_mode, memory_manager, &_allocator);
+    }
+
+private:
+    AllocatorType _allocator{};
+};
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
@@ -51,6 +51,14 @@ public:
     }
 
 protected:
+    static TensorShape sequence_shape(TensorShape shape, unsigned int num_timesteps)
+    {
+        if(num_timesteps > 1)
+        {
+            shape.set(2, num_timesteps);
+        }
+        return shape;
+    }
     template <typename U>
     void fill(U &&tensor, int i)
     {
@@ -59,15 +67,15 @@ protected:
     }
 
     TensorType compute_target(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &recurrent_weights_shape, const TensorShape &bias_shape, const TensorShape &output_shape,
-                              ActivationLayerInfo info, DataType data_type)
+                              ActivationLayerInfo info, DataType data_type, unsigned int num_timesteps = 1)
     {
         // Create tensors
-        TensorType input             = create_tensor<TensorType>(input_shape, data_type);
+        TensorType input             = create_tensor<TensorType>(sequence_shape(input_shape, num_timesteps), data_type);
         TensorType weights           = create_tensor<TensorType>(weights_shape, data_type);
         TensorType recurrent_weights = create_tensor<TensorType>(recurrent_weights_shape, data_type);
         TensorType bias              = create_tensor<TensorType>(bias_shape, data_type);
         TensorType hidden_state      = create_tensor<TensorType>(output_shape, data_type);
-        TensorType output            = create_tensor<TensorType>(output_shape, data_type);
+        TensorType output            = create_tensor<TensorType>(sequence_shape(output_shape, num_timesteps), data_type);
 
         // Create and configure function
         FunctionType rnn;
@@ -109,17 +117,19 @@ protected:
     }
 
     SimpleTensor<T> compute_reference(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &recurrent_weights_shape, const TensorShape &bias_shape,
-                                      const TensorShape &output_shape, ActivationLayerInfo info, DataType data_type)
+                                      const TensorShape &output_shape, ActivationLayerInfo info, DataType data_type, unsigned int num_timesteps = 1)
     {
         // Create reference
+        SimpleTensor<T> input_sequence{ sequence_shape(input_shape, num_timesteps), data_type };
         SimpleTensor<T> input{ input_shape, data_type };
         SimpleTensor<T> weights{ weights_shape, data_type };
         SimpleTensor<T> recurrent_weights{ recurrent_weights_shape, data_type };
         SimpleTensor<T> bias{ bias_shape, data_type };
         SimpleTensor<T> hidden_state{ output_shape, data_type };
+        SimpleTensor<T> output{ sequence_shape(output_shape, num_timesteps), data_type };
 
         // Fill reference
-        fill(input, 0);
+        fill(input_sequence, 0);
         fill(weights, 0);
         fill(recurrent_weights, 0);
         fill(bias, 0);
@@ -128,17 +138,41 @@ protected:
         TensorShape out_shape = recurrent_weights_shape;
         out_shape.set(1, output_shape.y());
 
+        const size_t step_input_elements  = input.num_elements();
+        const size_t step_output_elements = hidden_state.num_elements();
+
         // Compute reference
         SimpleTensor<T> out_w{ out_shape, data_type };
-        SimpleTensor<T> fully_connected = reference::fully_connected_layer(input, weights, bias, out_shape);
-        SimpleTensor<T> gemm            = reference::gemm(hidden_state, recurrent_weights, out_w, 1.f, 0.f);
-        SimpleTensor<T> add_res         = reference::arithmetic_addition(fully_connected, gemm, data_type, ConvertPolicy::SATURATE);
-        return reference::activation_layer(add_res, info);
+        for(unsigned int t = 0; t < num_timesteps; ++t)
+        {
+            std::copy_n(input_sequence.data() + t * step_input_elements, step_input_elements, input.data());
+
+            SimpleTensor<T> fully_connected = reference::fully_connected_layer(input, weights, bias, out_shape);
+            SimpleTensor<T> gemm            = reference::gemm(hidden_state, recurrent_weights, out_w, 1.f, 0.f);
+            SimpleTensor<T> add_res         = reference::arithmetic_addition(fully_connected, gemm, data_type, ConvertPolicy::SATURATE);
+            hidden_state                    = reference::activation_layer(add_res, info);
+
+            std::copy_n(hidden_state.data(), step_output_elements, output.data() + t * step_output_elements);
+        }
+        return output;
     }
 
     TensorType      _target{};
     SimpleTensor<T> _reference{};
 };
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class RNNLayerSequenceValidationFixture : public RNNLayerValidationFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    template <typename...>
+    void setup(TensorShape input_shape, TensorShape weights_shape, TensorShape recurrent_weights_shape, TensorShape bias_shape, TensorShape output_shape, ActivationLayerInfo info,
+               DataType data_type, unsigned int num_timesteps)
+    {
+        this->_target    = this->compute_target(input_shape, weights_shape, recurrent_weights_shape, bias_shape, output_shape, info, data_type, num_timesteps);
+        this->_reference = this->compute_reference(input_shape, weights_shape, recurrent_weights_shape, bias_shape, output_shape, info, data_type, num_timesteps);
+    }
+};
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
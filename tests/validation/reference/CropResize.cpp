@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "CropResize.h"
+
+#include "tests/validation/Helpers.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+template <typename T>
+SimpleTensor<T> crop_resize(const SimpleTensor<T> &src, const std::vector<ROI> &rois, const ROIPoolingLayerInfo &crop_info, float extrapolation_value)
+{
+    const int crop_w = crop_info.pooled_width();
+    const int crop_h = crop_info.pooled_height();
+    const int width  = src.shape()[0];
+    const int height = src.shape()[1];
+    const int fms    = src.shape()[2];
+
+    SimpleTensor<T> dst{ TensorShape(crop_w, crop_h, fms, rois.size()), src.data_type() };
+
+    for(size_t roi_indx = 0; roi_indx < rois.size(); ++roi_indx)
+    {
+        const ROI &roi = rois[roi_indx];
+
+        const float roi_x = roi.rect.x * crop_info.spatial_scale();
+        const float roi_y = roi.rect.y * crop_info.spatial_scale();
+        const float roi_w = std::max(roi.rect.width * crop_info.spatial_scale(), 1.f);
+        const float roi_h = std::max(roi.rect.height * crop_info.spatial_scale(), 1.f);
+
+        for(int fm = 0; fm < fms; ++fm)
+        {
+            for(int py = 0; py < crop_h; ++py)
+            {
+                for(int px = 0; px < crop_w; ++px)
+                {
+                    // Sample at the centre of the bin
+                    float x = roi_x + (px + 0.5f) * (roi_w / crop_w) - 0.5f;
+                    float y = roi_y + (py + 0.5f) * (roi_h / crop_h) - 0.5f;
+
+                    T &out = dst[coord2index(dst.shape(), Coordinates(px, py, fm, roi_indx))];
+
+                    if(x < -1.f || x > width || y < -1.f || y > height)
+                    {
+                        out = static_cast<T>(extrapolation_value);
+                        continue;
+                    }
+
+                    x = std::min(std::max(x, 0.f), static_cast<float>(width - 1));
+                    y = std::min(std::max(y, 0.f), static_cast<float>(height - 1));
+
+                    const int   x0 = static_cast<int>(std::floor(x));
+                    const int   y0 = static_cast<int>(std::floor(y));
+                    const int   x1 = std::min(x0 + 1, width - 1);
+                    const int   y1 = std::min(y0 + 1, height - 1);
+                    const float dx = x - x0;
+                    const float dy = y - y0;
+
+                    const T a00 = src[coord2index(src.shape(), Coordinates(x0, y0, fm, roi.batch_idx))];
+                    const T a01 = src[coord2index(src.shape(), Coordinates(x1, y0, fm, roi.batch_idx))];
+                    const T a10 = src[coord2index(src.shape(), Coordinates(x0, y1, fm, roi.batch_idx))];
+                    const T a11 = src[coord2index(src.shape(), Coordinates(x1, y1, fm, roi.batch_idx))];
+
+                    out = static_cast<T>(a00 * (1.f - dx) * (1.f - dy) + a01 * dx * (1.f - dy) + a10 * (1.f - dx) * dy + a11 * dx * dy);
+                }
+            }
+        }
+    }
+
+    return dst;
+}
+
+template SimpleTensor<float> crop_resize(const SimpleTensor<float> &src, const std::vector<ROI> &rois, const ROIPoolingLayerInfo &crop_info, float extrapolation_value);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -25,6 +25,7 @@
 
 #include "DepthwiseSeparableConvolutionLayer.h"
 
+#include "ActivationLayer.h"
 #include "ConvolutionLayer.h"
 #include "Utils.h"
 
@@ -43,11 +44,21 @@ template <typename T>
 SimpleTensor<T> depthwise_separable_convolution_layer(const SimpleTensor<T> &src, const SimpleTensor<T> &depthwise_weights, const SimpleTensor<T> &depthwise_biases,
                                                       const TensorShape     &depthwise_out_shape,
                                                       const SimpleTensor<T> &pointwise_weights,
-                                                      const SimpleTensor<T> &pointwise_biases, const TensorShape &dst_shape, const PadStrideInfo &depthwise_conv_info, const PadStrideInfo &pointwise_conv_info)
+                                                      const SimpleTensor<T> &pointwise_biases, const TensorShape &dst_shape, const PadStrideInfo &depthwise_conv_info, const PadStrideInfo &pointwise_conv_info,
+                                                      const ActivationLayerInfo &depthwise_act_info, const ActivationLayerInfo &pointwise_act_info)
 {
     // Compute reference
     SimpleTensor<T> depthwise_out = depthwise_convolution(src, depthwise_weights, depthwise_biases, depthwise_out_shape, depthwise_conv_info, 1);
-    SimpleTensor<T> dst           = convolution_layer(depthwise_out, pointwise_weights, pointwise_biases, dst_shape, pointwise_conv_info);
+    if(depthwise_act_info.enabled())
+    {
+        depthwise_out = activation_layer(depthwise_out, depthwise_act_info);
+    }
+
+    SimpleTensor<T> dst = convolution_layer(depthwise_out, pointwise_weights, pointwise_biases, dst_shape, pointwise_conv_info);
+    if(pointwise_act_info.enabled())
+    {
+        dst = activation_layer(dst, pointwise_act_info);
+    }
 
     return dst;
 }
@@ -55,7 +66,7 @@ SimpleTensor<T> depthwise_separable_convolution_layer(const SimpleTensor<T> &src
 template SimpleTensor<float> depthwise_separable_convolution_layer(const SimpleTensor<float> &in, const SimpleTensor<float> &depthwise_weights, const SimpleTensor<float> &depthwise_biases,
                                                                    const TensorShape         &depthwise_out_shape,
                                                                    const SimpleTensor<float> &pointwise_weights, const SimpleTensor<float> &pointwise_biases, const TensorShape &dst_shape, const PadStrideInfo &depthwise_conv_info,
-                                                                   const PadStrideInfo &pointwise_conv_info);
+                                                                   const PadStrideInfo &pointwise_conv_info, const ActivationLayerInfo &depthwise_act_info, const ActivationLayerInfo &pointwise_act_info);
 } // namespace reference
 } // namespace validation
 } // namespace test
@@ -39,7 +39,8 @@ template <typename T>
 SimpleTensor<T> depthwise_separable_convolution_layer(const SimpleTensor<T> &src, const SimpleTensor<T> &depthwise_weights, const SimpleTensor<T> &depthwise_biases,
                                                       const TensorShape     &depthwise_out_shape,
                                                       const SimpleTensor<T> &pointwise_weights, const SimpleTensor<T> &pointwise_biases, const TensorShape &dst_shape,
-                                                      const PadStrideInfo &depthwise_conv_info, const PadStrideInfo &pointwise_conv_info);
+                                                      const PadStrideInfo &depthwise_conv_info, const PadStrideInfo &pointwise_conv_info,
+                                                      const ActivationLayerInfo &depthwise_act_info = ActivationLayerInfo(), const ActivationLayerInfo &pointwise_act_info = ActivationLayerInfo());
 } // namespace reference
 } // namespace validation
 } // namespace test
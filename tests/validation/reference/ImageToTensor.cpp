@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2018 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "ImageToTensor.h"
+
+#include "tests/validation/Helpers.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace reference
+{
+namespace
+{
+/** Read the channels of a pixel of the image: red, green and blue for RGB888, Y, U and V otherwise */
+void read_pixel(const std::vector<SimpleTensor<uint8_t>> &image_planes, Format format, int x, int y, float *c)
+{
+    switch(format)
+    {
+        case Format::RGB888:
+        {
+            const auto pixel = static_cast<const uint8_t *>(image_planes[0](Coordinates(x, y)));
+            c[0]             = pixel[0];
+            c[1]             = pixel[1];
+            c[2]             = pixel[2];
+            break;
+        }
+        case Format::YUYV422:
+        case Format::UYVY422:
+        {
+            // Macro pixel shared by two horizontally adjacent pixels
+            const auto pixels  = static_cast<const uint8_t *>(image_planes[0](Coordinates(x - (x % 2), y)));
+            const bool is_yuyv = format == Format::YUYV422;
+            c[0]               = pixels[is_yuyv ? 2 * (x % 2) : 2 * (x % 2) + 1];
+            c[1]               = pixels[is_yuyv ? 1 : 0];
+            c[2]               = pixels[is_yuyv ? 3 : 2];
+            break;
+        }
+        case Format::NV12:
+        case Format::NV21:
+        {
+            const auto uv = static_cast<const uint8_t *>(image_planes[1](Coordinates(x / 2, y / 2)));
+            c[0]          = *static_cast<const uint8_t *>(image_planes[0](Coordinates(x, y)));
+            c[1]          = uv[format == Format::NV12 ? 0 : 1];
+            c[2]          = uv[format == Format::NV12 ? 1 : 0];
+            break;
+        }
+        default:
+            ARM_COMPUTE_ERROR("Not supported");
+    }
+}
+
+/** Convert BT.709 YUV values to RGB */
+void yuv_to_rgb(float *c)
+{
+    const float y = c[0];
+    const float u = c[1] - 128.f;
+    const float v = c[2] - 128.f;
+
+    c[0] = utility::clamp<float>(y + 1.5748f * v, 0.f, 255.f);
+    c[1] = utility::clamp<float>(y - 0.1873f * u - 0.4681f * v, 0.f, 255.f);
+    c[2] = utility::clamp<float>(y + 1.8556f * u, 0.f, 255.f);
+}
+
+/** Source coordinates and weight of an output coordinate, centre aligned */
+void source_coordinate(int out, int in_size, int out_size, InterpolationPolicy policy, int &c0, int &c1, float &w)
+{
+    const float scale = static_cast<float>(in_size) / out_size;
+
+    if(policy == InterpolationPolicy::BILINEAR)
+    {
+        const float in = utility::clamp<float>((out + 0.5f) * scale - 0.5f, 0.f, in_size - 1);
+        c0             = static_cast<int>(std::floor(in));
+        c1             = std::min(c0 + 1, in_size - 1);
+        w              = in - c0;
+    }
+    else
+    {
+        c0 = std::min(static_cast<int>(std::floor((out + 0.5f) * scale)), in_size - 1);
+        c1 = c0;
+        w  = 0.f;
+    }
+}
+
+template <typename T>
+T convert(float value, const QuantizationInfo &quantization_info);
+
+template <>
+float convert(float value, const QuantizationInfo &quantization_info)
+{
+    ARM_COMPUTE_UNUSED(quantization_info);
+    return value;
+}
+
+template <>
+uint8_t convert(float value, const QuantizationInfo &quantization_info)
+{
+    return quantization_info.quantize(value, RoundingPolicy::TO_NEAREST_UP);
+}
+} // namespace
+
+template <typename T>
+SimpleTensor<T> image_to_tensor(const std::vector<SimpleTensor<uint8_t>> &image_planes, Format format, const TensorShape &dst_shape, DataType dst_data_type,
+                                QuantizationInfo quantization_info, const ImageToTensorInfo &info)
+{
+    SimpleTensor<T> dst{ dst_shape, dst_data_type, 1, quantization_info };
+
+    const int  src_width  = image_planes[0].shape().x();
+    const int  src_height = image_planes[0].shape().y();
+    const int  dst_width  = dst_shape.x();
+    const int  dst_height = dst_shape.y();
+    const bool is_yuv     = format != Format::RGB888;
+
+    for(int y = 0; y < dst_height; ++y)
+    {
+        int   y0 = 0;
+        int   y1 = 0;
+        float wy = 0.f;
+        source_coordinate(y, src_height, dst_height, info.interpolation_policy(), y0, y1, wy);
+
+        for(int x = 0; x < dst_width; ++x)
+        {
+            int   x0 = 0;
+            int   x1 = 0;
+            float wx = 0.f;
+            source_coordinate(x, src_width, dst_width, info.interpolation_policy(), x0, x1, wx);
+
+            float tl[3];
+            float tr[3];
+            float bl[3];
+            float br[3];
+            read_pixel(image_planes, format, x0, y0, tl);
+            read_pixel(image_planes, format, x1, y0, tr);
+            read_pixel(image_planes, format, x0, y1, bl);
+            read_pixel(image_planes, format, x1, y1, br);
+
+            float rgb[3];
+            for(int c = 0; c < 3; ++c)
+            {
+                const float top    = tl[c] + (tr[c] - tl[c]) * wx;
+                const float bottom = bl[c] + (br[c] - bl[c]) * wx;
+                rgb[c]             = top + (bottom - top) * wy;
+            }
+
+            // The conversion is applied after the interpolation, like in the kernel
+            if(is_yuv)
+            {
+                yuv_to_rgb(rgb);
+            }
+
+            for(int c = 0; c < 3; ++c)
+            {
+                const int   src_c                                 = info.bgr() ? 2 - c : c;
+                const float value                                 = (rgb[src_c] - info.mean()[src_c]) * info.scale()[src_c];
+                dst[coord2index(dst_shape, Coordinates(x, y, c))] = convert<T>(value, quantization_info);
+            }
+        }
+    }
+
+    return dst;
+}
+
+template SimpleTensor<float> image_to_tensor(const std::vector<SimpleTensor<uint8_t>> &image_planes, Format format, const TensorShape &dst_shape, DataType dst_data_type,
+                                             QuantizationInfo quantization_info, const ImageToTensorInfo &info);
+template SimpleTensor<uint8_t> image_to_tensor(const std::vector<SimpleTensor<uint8_t>> &image_planes, Format format, const TensorShape &dst_shape, DataType dst_data_type,
+                                               QuantizationInfo quantization_info, const ImageToTensorInfo &info);
+} // namespace reference
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -79,7 +79,42 @@ SimpleTensor<uint32_t> integral_image(const SimpleTensor<T> &src)
     return dst;
 }
 
+template <typename T>
+SimpleTensor<uint64_t> integral_image_squared(const SimpleTensor<T> &src)
+{
+    SimpleTensor<uint64_t> dst(src.shape(), DataType::U64);
+
+    // Length of dimensions
+    const size_t width  = src.shape().x();
+    const size_t height = src.shape().y();
+    const size_t depth  = src.shape().total_size_upper(2);
+
+    const size_t image_size = width * height;
+
+    for(size_t z = 0; z < depth; ++z)
+    {
+        for(size_t y = 0; y < height; ++y)
+        {
+            const size_t current_row = z * image_size + width * y;
+
+            // Sum of the squared pixels on the left, added to the integral of the row above
+            uint64_t row_sum = 0;
+
+            for(size_t x = 0; x < width; ++x)
+            {
+                const uint64_t value = src[current_row + x];
+
+                row_sum += value * value;
+                dst[current_row + x] = row_sum + ((y > 0) ? dst[current_row + x - width] : 0);
+            }
+        }
+    }
+
+    return dst;
+}
+
 template SimpleTensor<uint32_t> integral_image(const SimpleTensor<uint8_t> &src);
+template SimpleTensor<uint64_t> integral_image_squared(const SimpleTensor<uint8_t> &src);
 } // namespace reference
 } // namespace validation
 } // namespace test
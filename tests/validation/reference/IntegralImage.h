@@ -36,6 +36,9 @@ namespace reference
 {
 template <typename T>
 SimpleTensor<uint32_t> integral_image(const SimpleTensor<T> &src);
+
+template <typename T>
+SimpleTensor<uint64_t> integral_image_squared(const SimpleTensor<T> &src);
 } // namespace reference
 } // namespace validation
 } // namespace test
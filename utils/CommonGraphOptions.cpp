@@ -84,7 +84,16 @@ namespace utils
     os << "Data layout : " << common_params.data_layout << std::endl;
     os << "Tuner enabled? : " << (common_params.enable_tuner ? true_str : false_str) << std::endl;
     os << "Tuner file : " << common_params.tuner_file << std::endl;
+    if(!common_params.trace_file.empty())
+    {
+        os << "Trace file : " << common_params.trace_file << std::endl;
+    }
+    if(!common_params.profile_file.empty())
+    {
+        os << "Profile file : " << common_params.profile_file << std::endl;
+    }
     os << "Fast math enabled? : " << (common_params.fast_math_hint == FastMathHint::Enabled ? true_str : false_str) << std::endl;
+    os << "Implicit GEMM enabled? : " << (common_params.implicit_gemm ? true_str : false_str) << std::endl;
     if(!common_params.data_path.empty())
     {
         os << "Data path : " << common_params.data_path << std::endl;
@@ -118,13 +127,16 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
       data_layout(),
       enable_tuner(parser.add_option<ToggleOption>("enable-tuner")),
       fast_math_hint(parser.add_option<ToggleOption>("fast-math")),
+      implicit_gemm(parser.add_option<ToggleOption>("implicit-gemm")),
       data_path(parser.add_option<SimpleOption<std::string>>("data")),
       image(parser.add_option<SimpleOption<std::string>>("image")),
       labels(parser.add_option<SimpleOption<std::string>>("labels")),
       validation_file(parser.add_option<SimpleOption<std::string>>("validation-file")),
       validation_path(parser.add_option<SimpleOption<std::string>>("validation-path")),
       validation_range(parser.add_option<SimpleOption<std::string>>("validation-range")),
-      tuner_file(parser.add_option<SimpleOption<std::string>>("tuner-file"))
+      tuner_file(parser.add_option<SimpleOption<std::string>>("tuner-file")),
+      trace_file(parser.add_option<SimpleOption<std::string>>("trace-file")),
+      profile_file(parser.add_option<SimpleOption<std::string>>("profile-file"))
 {
     std::set<arm_compute::graph::Target> supported_targets
     {
@@ -157,6 +169,7 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
     data_layout->set_help("Data layout to use");
     enable_tuner->set_help("Enable OpenCL dynamic tuner");
     fast_math_hint->set_help("Enable fast math");
+    implicit_gemm->set_help("Let the NEON GEMM based convolutions gather their input without running im2col");
     data_path->set_help("Path where graph parameters reside");
     image->set_help("Input image for the graph");
     labels->set_help("File containing the output labels");
@@ -164,6 +177,8 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
     validation_path->set_help("Path to the validation data");
     validation_range->set_help("Range of the images to validate for (Format : start,end)");
     tuner_file->set_help("File to load/save CLTuner values");
+    trace_file->set_help("File to write a Chrome trace of the NEON kernels' execution to");
+    profile_file->set_help("File to write the CPU hardware counters of each NEON kernel and node to");
 }
 
 CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
@@ -182,6 +197,7 @@ CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
     }
     common_params.enable_tuner           = options.enable_tuner->is_set() ? options.enable_tuner->value() : false;
     common_params.fast_math_hint         = options.fast_math_hint->is_set() ? fast_math_hint_value : FastMathHint::Disabled;
+    common_params.implicit_gemm          = options.implicit_gemm->is_set() ? options.implicit_gemm->value() : false;
     common_params.data_path              = options.data_path->value();
     common_params.image                  = options.image->value();
     common_params.labels                 = options.labels->value();
@@ -190,6 +206,8 @@ CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
     common_params.validation_range_start = validation_range.first;
     common_params.validation_range_end   = validation_range.second;
     common_params.tuner_file             = options.tuner_file->value();
+    common_params.trace_file             = options.trace_file->value();
+    common_params.profile_file           = options.profile_file->value();
 
     return common_params;
 }
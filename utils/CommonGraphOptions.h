@@ -44,6 +44,7 @@ namespace utils
  * --layout           : Data layout to be used by the examples. Supported data layout options : NCHW, NHWC.
  * --enable-tuner     : Toggle option to enable the OpenCL dynamic tuner.
  * --fast-math        : Toggle option to enable the fast math option.
+ * --implicit-gemm    : Toggle option to let the NEON GEMM based convolutions gather their input without running im2col.
  * --data             : Path that contains the trainable parameter files of graph layers.
  * --image            : Image to load and operate on. Image types supported: PPM, JPEG, NPY.
  * --labels           : File that contains the labels that classify upon.
@@ -94,12 +95,15 @@ struct CommonGraphParams
     arm_compute::DataLayout          data_layout{ DataLayout::NHWC };
     bool                             enable_tuner{ false };
     arm_compute::graph::FastMathHint fast_math_hint{ arm_compute::graph::FastMathHint::Disabled };
+    bool                             implicit_gemm{ false };
     std::string                      data_path{};
     std::string                      image{};
     std::string                      labels{};
     std::string                      validation_file{};
     std::string                      validation_path{};
     std::string                      tuner_file{};
+    std::string                      trace_file{};
+    std::string                      profile_file{};
     unsigned int                     validation_range_start{ 0 };
     unsigned int                     validation_range_end{ std::numeric_limits<unsigned int>::max() };
 };
@@ -148,6 +152,7 @@ public:
     EnumOption<arm_compute::DataLayout>    *data_layout;      /**< Graph data layout */
     ToggleOption                           *enable_tuner;     /**< Enable tuner */
     ToggleOption                           *fast_math_hint;   /**< Fast math hint */
+    ToggleOption                           *implicit_gemm;    /**< Implicit GEMM convolutions */
     SimpleOption<std::string>              *data_path;        /**< Trainable parameters path */
     SimpleOption<std::string>              *image;            /**< Image */
     SimpleOption<std::string>              *labels;           /**< Labels */
@@ -155,6 +160,8 @@ public:
     SimpleOption<std::string>              *validation_path;  /**< Validation data path */
     SimpleOption<std::string>              *validation_range; /**< Validation range */
     SimpleOption<std::string>              *tuner_file;       /**< File to load/store the tuner's values from */
+    SimpleOption<std::string>              *trace_file;       /**< File to write the execution trace to */
+    SimpleOption<std::string>              *profile_file;     /**< File to write the hardware counters profile to */
 };
 
 /** Consumes the common graph options and creates a structure containing any information
@@ -31,6 +31,10 @@
 #include "utils/ImageLoader.h"
 #include "utils/Utils.h"
 
+#ifdef ARM_COMPUTE_NEON
+#include "arm_compute/runtime/NEON/functions/NEImageToTensor.h"
+#endif /* ARM_COMPUTE_NEON */
+
 #include <iomanip>
 #include <limits>
 
@@ -55,6 +59,49 @@ std::pair<arm_compute::TensorShape, arm_compute::PermutationVector> compute_perm
 
     return std::make_pair(permuted_shape, perm);
 }
+
+/** Fill a tensor with the content of an open image in a single pass.
+ *
+ * The image is resized to the size of the tensor and the preprocessing is fused with the conversion.
+ *
+ * @param[in]     loader       Loader of the open image.
+ * @param[in,out] tensor       Tensor to fill.
+ * @param[in]     bgr          Fill the first channel with blue.
+ * @param[in]     preprocessor (Optional) Preprocessor to fuse.
+ *
+ * @return True if the tensor has been filled, false if the fused path is not supported for this tensor or preprocessor
+ */
+bool fill_tensor_fused(arm_compute::utils::IImageLoader &loader, arm_compute::ITensor &tensor, bool bgr, const IPreprocessor *preprocessor)
+{
+#ifdef ARM_COMPUTE_NEON
+    std::array<float, 3> mean{ { 0.f, 0.f, 0.f } };
+    std::array<float, 3> scale{ { 1.f, 1.f, 1.f } };
+    if(preprocessor != nullptr && !preprocessor->normalisation(mean, scale))
+    {
+        return false;
+    }
+
+    arm_compute::Image image;
+    loader.init_image(image, arm_compute::Format::RGB888);
+
+    const arm_compute::ImageToTensorInfo info(mean, scale, bgr);
+    if(!bool(arm_compute::NEImageToTensor::validate(image.info(), tensor.info(), info)))
+    {
+        return false;
+    }
+
+    arm_compute::NEImageToTensor image_to_tensor;
+    image_to_tensor.configure(&image, &tensor, info);
+    image.allocator()->allocate();
+    loader.fill_image(image);
+    image_to_tensor.run();
+
+    return true;
+#else  /* ARM_COMPUTE_NEON */
+    ARM_COMPUTE_UNUSED(loader, tensor, bgr, preprocessor);
+    return false;
+#endif /* ARM_COMPUTE_NEON */
+}
 } // namespace
 
 void TFPreproccessor::preprocess(ITensor &tensor)
@@ -71,6 +118,14 @@ void TFPreproccessor::preprocess(ITensor &tensor)
     });
 }
 
+bool TFPreproccessor::normalisation(std::array<float, 3> &mean, std::array<float, 3> &scale) const
+{
+    // (value / 255 - 0.5) * 2 == (value - 127.5) / 127.5
+    mean.fill(127.5f);
+    scale.fill(1.f / 127.5f);
+    return true;
+}
+
 CaffePreproccessor::CaffePreproccessor(std::array<float, 3> mean, bool bgr)
     : _mean(mean), _bgr(bgr)
 {
@@ -94,6 +149,17 @@ void CaffePreproccessor::preprocess(ITensor &tensor)
     });
 }
 
+bool CaffePreproccessor::normalisation(std::array<float, 3> &mean, std::array<float, 3> &scale) const
+{
+    mean = _mean;
+    if(_bgr)
+    {
+        std::swap(mean[0], mean[2]);
+    }
+    scale.fill(1.f);
+    return true;
+}
+
 PPMWriter::PPMWriter(std::string name, unsigned int maximum)
     : _name(std::move(name)), _iterator(0), _maximum(maximum)
 {
@@ -188,24 +254,28 @@ bool ImageAccessor::access_tensor(ITensor &tensor)
         // Open image file
         image_loader->open(_filename);
 
-        // Get permutated shape and permutation parameters
-        TensorShape                    permuted_shape = tensor.info()->tensor_shape();
-        arm_compute::PermutationVector perm;
-        if(tensor.info()->data_layout() != DataLayout::NCHW)
+        // Resize, normalise and convert the image in a single pass when possible
+        if(!fill_tensor_fused(*image_loader, tensor, _bgr, _preprocessor.get()))
         {
-            std::tie(permuted_shape, perm) = compute_permutation_parameters(tensor.info()->tensor_shape(), tensor.info()->data_layout());
-        }
-        ARM_COMPUTE_EXIT_ON_MSG(image_loader->width() != permuted_shape.x() || image_loader->height() != permuted_shape.y(),
-                                "Failed to load image file: dimensions [%d,%d] not correct, expected [%d,%d].",
-                                image_loader->width(), image_loader->height(), permuted_shape.x(), permuted_shape.y());
+            // Get permutated shape and permutation parameters
+            TensorShape                    permuted_shape = tensor.info()->tensor_shape();
+            arm_compute::PermutationVector perm;
+            if(tensor.info()->data_layout() != DataLayout::NCHW)
+            {
+                std::tie(permuted_shape, perm) = compute_permutation_parameters(tensor.info()->tensor_shape(), tensor.info()->data_layout());
+            }
+            ARM_COMPUTE_EXIT_ON_MSG(image_loader->width() != permuted_shape.x() || image_loader->height() != permuted_shape.y(),
+                                    "Failed to load image file: dimensions [%d,%d] not correct, expected [%d,%d].",
+                                    image_loader->width(), image_loader->height(), permuted_shape.x(), permuted_shape.y());
 
-        // Fill the tensor with the PPM content (BGR)
-        image_loader->fill_planar_tensor(tensor, _bgr);
+            // Fill the tensor with the PPM content (BGR)
+            image_loader->fill_planar_tensor(tensor, _bgr);
 
-        // Preprocess tensor
-        if(_preprocessor)
-        {
-            _preprocessor->preprocess(tensor);
+            // Preprocess tensor
+            if(_preprocessor)
+            {
+                _preprocessor->preprocess(tensor);
+            }
         }
     }
 
@@ -213,6 +283,11 @@ bool ImageAccessor::access_tensor(ITensor &tensor)
     return _already_loaded;
 }
 
+std::string NumPyBinLoader::source() const
+{
+    return _filename + "(" + string_from_data_layout(_file_layout) + ")";
+}
+
 ValidationInputAccessor::ValidationInputAccessor(const std::string             &image_list,
                                                  std::string                    images_path,
                                                  std::unique_ptr<IPreprocessor> preprocessor,
@@ -263,25 +338,29 @@ bool ValidationInputAccessor::access_tensor(arm_compute::ITensor &tensor)
         jpeg.open(image_name);
         _output_stream << "[" << _offset << "/" << _images.size() << "] Validating " << image_name << std::endl;
 
-        // Get permutated shape and permutation parameters
-        TensorShape                    permuted_shape = tensor.info()->tensor_shape();
-        arm_compute::PermutationVector perm;
-        if(tensor.info()->data_layout() != DataLayout::NCHW)
+        // Resize, normalise and convert the image in a single pass when possible
+        if(!fill_tensor_fused(jpeg, tensor, _bgr, _preprocessor.get()))
         {
-            std::tie(permuted_shape, perm) = compute_permutation_parameters(tensor.info()->tensor_shape(),
-                                                                            tensor.info()->data_layout());
-        }
-        ARM_COMPUTE_EXIT_ON_MSG(jpeg.width() != permuted_shape.x() || jpeg.height() != permuted_shape.y(),
-                                "Failed to load image file: dimensions [%d,%d] not correct, expected [%d,%d].",
-                                jpeg.width(), jpeg.height(), permuted_shape.x(), permuted_shape.y());
+            // Get permutated shape and permutation parameters
+            TensorShape                    permuted_shape = tensor.info()->tensor_shape();
+            arm_compute::PermutationVector perm;
+            if(tensor.info()->data_layout() != DataLayout::NCHW)
+            {
+                std::tie(permuted_shape, perm) = compute_permutation_parameters(tensor.info()->tensor_shape(),
+                                                                                tensor.info()->data_layout());
+            }
+            ARM_COMPUTE_EXIT_ON_MSG(jpeg.width() != permuted_shape.x() || jpeg.height() != permuted_shape.y(),
+                                    "Failed to load image file: dimensions [%d,%d] not correct, expected [%d,%d].",
+                                    jpeg.width(), jpeg.height(), permuted_shape.x(), permuted_shape.y());
 
-        // Fill the tensor with the JPEG content (BGR)
-        jpeg.fill_planar_tensor(tensor, _bgr);
+            // Fill the tensor with the JPEG content (BGR)
+            jpeg.fill_planar_tensor(tensor, _bgr);
 
-        // Preprocess tensor
-        if(_preprocessor)
-        {
-            _preprocessor->preprocess(tensor);
+            // Preprocess tensor
+            if(_preprocessor)
+            {
+                _preprocessor->preprocess(tensor);
+            }
         }
     }
 
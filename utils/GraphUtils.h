@@ -54,6 +54,20 @@ public:
      * @param[in] tensor Tensor to preprocess.
      */
     virtual void preprocess(ITensor &tensor) = 0;
+    /** Get the per channel normalisation applied by the preprocessor.
+     *
+     * Preprocessors computing (value - mean) * scale for each channel can be fused with the loading of the image.
+     *
+     * @param[out] mean  Mean of the red, green and blue channels.
+     * @param[out] scale Scale of the red, green and blue channels.
+     *
+     * @return True if the preprocessing is a per channel normalisation
+     */
+    virtual bool normalisation(std::array<float, 3> &mean, std::array<float, 3> &scale) const
+    {
+        ARM_COMPUTE_UNUSED(mean, scale);
+        return false;
+    }
 };
 
 /** Caffe preproccessor */
@@ -67,6 +81,7 @@ public:
      */
     CaffePreproccessor(std::array<float, 3> mean = std::array<float, 3> { { 0, 0, 0 } }, bool bgr = true);
     void preprocess(ITensor &tensor) override;
+    bool normalisation(std::array<float, 3> &mean, std::array<float, 3> &scale) const override;
 
 private:
     std::array<float, 3> _mean;
@@ -78,6 +93,7 @@ class TFPreproccessor : public IPreprocessor
 {
 public:
     void preprocess(ITensor &tensor) override;
+    bool normalisation(std::array<float, 3> &mean, std::array<float, 3> &scale) const override;
 };
 
 /** PPM writer class */
@@ -338,7 +354,8 @@ public:
     NumPyBinLoader(NumPyBinLoader &&) = default;
 
     // Inherited methods overriden:
-    bool access_tensor(ITensor &tensor) override;
+    bool        access_tensor(ITensor &tensor) override;
+    std::string source() const override;
 
 private:
     bool              _already_loaded;
@@ -45,6 +45,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <random>
 #include <string>
@@ -90,6 +91,29 @@ public:
     virtual ~Example() = default;
 };
 
+#ifdef BENCHMARK_EXAMPLES
+/** Factory creating a new instance of an example */
+using ExampleFactory = std::function<std::unique_ptr<Example>()>;
+
+/** Benchmark an example using the test framework
+ *
+ * A new instance of the example is created and set up for each benchmarked configuration.
+ *
+ * @param[in] argc    Number of command line arguments
+ * @param[in] argv    Command line arguments
+ * @param[in] factory Factory creating the example to benchmark
+ */
+int run_example(int argc, char **argv, const ExampleFactory &factory);
+
+template <typename T>
+int run_example(int argc, char **argv)
+{
+    return run_example(argc, argv, []()
+    {
+        return std::unique_ptr<Example>(support::cpp14::make_unique<T>());
+    });
+}
+#else  /* BENCHMARK_EXAMPLES */
 /** Run an example and handle the potential exceptions it throws
  *
  * @param[in] argc    Number of command line arguments
@@ -103,6 +127,7 @@ int run_example(int argc, char **argv)
 {
     return run_example(argc, argv, support::cpp14::make_unique<T>());
 }
+#endif /* BENCHMARK_EXAMPLES */
 
 /** Draw a RGB rectangular window for the detected object
  *